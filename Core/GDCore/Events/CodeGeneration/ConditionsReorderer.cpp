@@ -0,0 +1,232 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ConditionsReorderer.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * \brief Check if an expression uses objects (their lists can be changed by
+ * the conditions picking objects), and if it calls functions that can have
+ * side effects.
+ */
+class ExpressionObjectsUsageFinder : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionObjectsUsageFinder(const gd::EventsCodeGenerator& codeGenerator_)
+      : codeGenerator(codeGenerator_),
+        usesObjects(false),
+        hasSideEffects(false){};
+  virtual ~ExpressionObjectsUsageFinder(){};
+
+  bool UsesObjects() const { return usesObjects; }
+  bool HasSideEffects() const { return hasSideEffects; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    if (IsObjectOrGroup(node.name)) usesObjects = true;
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    if (IsObjectOrGroup(node.identifierName)) usesObjects = true;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    if (!node.objectName.empty()) usesObjects = true;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    if (!node.objectName.empty()) usesObjects = true;
+
+    // Functions of events functions extensions can run any events.
+    const gd::ExpressionMetadata& metadata =
+        MetadataProvider::GetFunctionCallMetadata(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            node);
+    if (codeGenerator.IsEventsFunctionCall(node) ||
+        MetadataProvider::IsBadExpressionMetadata(metadata) ||
+        !metadata.IsPure())
+      hasSideEffects = true;
+
+    for (auto& parameter : node.parameters) {
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  bool IsObjectOrGroup(const gd::String& name) const {
+    const gd::ObjectsContainer& globalObjectsAndGroups =
+        codeGenerator.GetGlobalObjectsAndGroups();
+    const gd::ObjectsContainer& objectsAndGroups =
+        codeGenerator.GetObjectsAndGroups();
+    return objectsAndGroups.HasObjectNamed(name) ||
+           objectsAndGroups.GetObjectGroups().Has(name) ||
+           globalObjectsAndGroups.HasObjectNamed(name) ||
+           globalObjectsAndGroups.GetObjectGroups().Has(name);
+  }
+
+  const gd::EventsCodeGenerator& codeGenerator;
+  bool usesObjects;
+  bool hasSideEffects;
+};
+
+}  // namespace
+
+ConditionsReorderer::ConditionKind ConditionsReorderer::GetConditionKind(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::Instruction& condition) {
+  if (condition.GetType().empty() ||
+      codeGenerator.IsEventsFunctionCall(condition))
+    return Fixed;
+
+  const gd::InstructionMetadata& metadata =
+      MetadataProvider::GetConditionMetadata(codeGenerator.GetPlatform(),
+                                             condition.GetType());
+  if (MetadataProvider::IsBadInstructionMetadata(metadata) ||
+      !metadata.IsSideEffectFree() ||
+      !condition.GetSubInstructions().empty())
+    return Fixed;
+
+  bool usesObjects = false;
+  bool hasSideEffects = false;
+  gd::ParameterMetadataTools::IterateOverParameters(
+      condition.GetParameters(),
+      metadata.parameters,
+      [&](const gd::ParameterMetadata& parameterMetadata,
+          const gd::Expression& parameterValue,
+          const gd::String& lastObjectName) {
+        const gd::String& type = parameterMetadata.GetType();
+        if (gd::ParameterMetadata::IsObject(type)) {
+          usesObjects = true;
+        } else if (gd::ParameterMetadata::IsExpression("number", type) ||
+                   gd::ParameterMetadata::IsExpression("string", type) ||
+                   gd::ParameterMetadata::IsExpression("variable", type)) {
+          auto node = parameterValue.GetRootNode();
+          if (!node) return;
+
+          ExpressionObjectsUsageFinder finder(codeGenerator);
+          node->Visit(finder);
+          if (finder.UsesObjects()) usesObjects = true;
+          if (finder.HasSideEffects()) hasSideEffects = true;
+        }
+      });
+
+  if (hasSideEffects) return Fixed;
+  return usesObjects ? UsingObjects : Movable;
+}
+
+std::vector<std::size_t> ConditionsReorderer::GetEvaluationOrder(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::InstructionsList& conditions) {
+  std::vector<ConditionKind> kinds;
+  for (std::size_t i = 0; i < conditions.size(); ++i)
+    kinds.push_back(GetConditionKind(codeGenerator, conditions[i]));
+
+  std::vector<std::size_t> order;
+  std::size_t begin = 0;
+  for (std::size_t i = 0; i < conditions.size(); ++i) {
+    if (kinds[i] != Fixed) continue;
+
+    AddEvaluationOrder(codeGenerator, conditions, kinds, begin, i, order);
+    order.push_back(i);
+    begin = i + 1;
+  }
+  AddEvaluationOrder(
+      codeGenerator, conditions, kinds, begin, conditions.size(), order);
+
+  return order;
+}
+
+void ConditionsReorderer::AddEvaluationOrder(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::InstructionsList& conditions,
+    const std::vector<ConditionKind>& kinds,
+    std::size_t begin,
+    std::size_t end,
+    std::vector<std::size_t>& order) {
+  std::vector<int> costs;
+  for (std::size_t i = begin; i < end; ++i) {
+    costs.push_back(MetadataProvider::GetConditionMetadata(
+                        codeGenerator.GetPlatform(), conditions[i].GetType())
+                        .GetEvaluationCost());
+  }
+  auto getCost = [&](std::size_t i) { return costs[i - begin]; };
+
+  std::vector<std::size_t> usingObjects;
+  std::vector<std::size_t> movables;
+  for (std::size_t i = begin; i < end; ++i) {
+    if (kinds[i] == UsingObjects)
+      usingObjects.push_back(i);
+    else
+      movables.push_back(i);
+  }
+  std::stable_sort(movables.begin(),
+                   movables.end(),
+                   [&](std::size_t a, std::size_t b) {
+                     return getCost(a) < getCost(b);
+                   });
+
+  // Merge the movable conditions, from the cheapest, with the conditions using
+  // objects, which must stay in the same order. For the same cost, the order
+  // of the events sheet is kept.
+  std::size_t usingObjectsIndex = 0;
+  std::size_t movablesIndex = 0;
+  while (usingObjectsIndex < usingObjects.size() ||
+         movablesIndex < movables.size()) {
+    bool takeMovable = false;
+    if (usingObjectsIndex >= usingObjects.size()) {
+      takeMovable = true;
+    } else if (movablesIndex < movables.size()) {
+      std::size_t movable = movables[movablesIndex];
+      std::size_t usingObject = usingObjects[usingObjectsIndex];
+      takeMovable = getCost(movable) < getCost(usingObject) ||
+                    (getCost(movable) == getCost(usingObject) &&
+                     movable < usingObject);
+    }
+
+    if (takeMovable)
+      order.push_back(movables[movablesIndex++]);
+    else
+      order.push_back(usingObjects[usingObjectsIndex++]);
+  }
+}
+
+}  // namespace gd
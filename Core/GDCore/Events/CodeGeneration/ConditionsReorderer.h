@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_CONDITIONSREORDERER_H
+#define GDCORE_CONDITIONSREORDERER_H
+
+#include <vector>
+
+namespace gd {
+class EventsCodeGenerator;
+class Instruction;
+class InstructionsList;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find an order to evaluate the conditions of a list so that the
+ * cheapest are evaluated first, without changing the result of the list.
+ *
+ * Conditions are evaluated one after the other, and the evaluation stops at the
+ * first false condition. Only some conditions can be moved:
+ * - conditions not flagged as side effect free (see
+ *   gd::InstructionMetadata::MarkAsSideEffectFree), like "Trigger once", are
+ *   never moved, and no condition is moved before or after them. This is also
+ *   the case of conditions calling, in their parameters, functions that are
+ *   not pure (see gd::ExpressionMetadata::SetPure) or functions of events
+ *   functions extensions,
+ * - conditions picking objects, or using objects in their parameters, keep
+ *   their order relative to each other (each one can depend on the objects
+ *   picked by the previous ones),
+ * - other conditions can be moved before or after the conditions picking
+ *   objects, according to their cost (see
+ *   gd::InstructionMetadata::GetEvaluationCost).
+ *
+ * \see gd::EventsCodeGenerator::GetConditionsEvaluationOrder
+ */
+class GD_CORE_API ConditionsReorderer {
+ public:
+  /**
+   * \brief Return the indices of the conditions, in the order they should be
+   * evaluated.
+   */
+  static std::vector<std::size_t> GetEvaluationOrder(
+      const gd::EventsCodeGenerator& codeGenerator,
+      const gd::InstructionsList& conditions);
+
+  /**
+   * \brief How a condition can be moved in the list.
+   */
+  enum ConditionKind {
+    Fixed,  ///< The condition can have side effects: no condition can be
+            ///< moved before or after it.
+    UsingObjects,  ///< The condition keeps its order relative to other
+                   ///< conditions using objects.
+    Movable  ///< The condition can be moved anywhere between the fixed
+             ///< conditions around it.
+  };
+
+  /**
+   * \brief Return how the condition can be moved in its list.
+   */
+  static ConditionKind GetConditionKind(
+      const gd::EventsCodeGenerator& codeGenerator,
+      const gd::Instruction& condition);
+
+ private:
+  static void AddEvaluationOrder(const gd::EventsCodeGenerator& codeGenerator,
+                                 const gd::InstructionsList& conditions,
+                                 const std::vector<ConditionKind>& kinds,
+                                 std::size_t begin,
+                                 std::size_t end,
+                                 std::vector<std::size_t>& order);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_CONDITIONSREORDERER_H
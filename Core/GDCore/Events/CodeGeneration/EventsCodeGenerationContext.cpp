@@ -39,6 +39,7 @@ void EventsCodeGenerationContext::InheritsFrom(
   asyncDepth = parent_.asyncDepth;
   depthOfLastUse = parent_.depthOfLastUse;
   customConditionDepth = parent_.customConditionDepth;
+  loopInvariants = parent_.loopInvariants;
   contextDepth = parent_.GetContextDepth() + 1;
   if (parent_.maxDepthLevel) {
     maxDepthLevel = parent_.maxDepthLevel;
@@ -51,6 +52,8 @@ void EventsCodeGenerationContext::InheritsAsAsyncCallbackFrom(
   // Increasing the async depth is enough to mark the context as an async callback.
   InheritsFrom(parent_);
   asyncDepth = parent_.asyncDepth + 1;
+  // The callback is run after the loop, if any: nothing can be hoisted.
+  loopInvariants = nullptr;
 }
 
 void EventsCodeGenerationContext::Reuse(
@@ -58,6 +61,9 @@ void EventsCodeGenerationContext::Reuse(
   InheritsFrom(parent_);
   if (parent_.CanReuse())
     contextDepth = parent_.GetContextDepth();  // Keep same context depth
+
+  objectsListsSharingAllowed = parent_.objectsListsSharingAllowed;
+  modifiedObjectsLists = parent_.modifiedObjectsLists;
 }
 
 void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName) {
@@ -68,8 +74,24 @@ void EventsCodeGenerationContext::NotifyAsyncParentsAboutDeclaredObject(const gd
     asyncContext->allObjectsListToBeDeclaredAcrossChildren.insert(objectName);
 }
 
+bool EventsCodeGenerationContext::CanShareParentObjectsList(
+    const gd::String& objectName) const {
+  return objectsListsSharingAllowed && parent != nullptr &&
+         !IsInsideAsync() && ObjectAlreadyDeclaredByParents(objectName) &&
+         modifiedObjectsLists.find(objectName) == modifiedObjectsLists.end();
+}
+
 void EventsCodeGenerationContext::ObjectsListNeeded(
     const gd::String& objectName) {
+  if (CanShareParentObjectsList(objectName)) {
+    //*Optimization*: The list is only read, so the list of the parent is used
+    // (it will be "declared" without being copied, see IsSameObjectsList).
+    objectsListsToBeDeclared.insert(objectName);
+    depthOfLastUse[objectName] =
+        parent->GetLastDepthObjectListWasNeeded(objectName);
+    return;
+  }
+
   if (!IsToBeDeclared(objectName)) {
     objectsListsToBeDeclared.insert(objectName);
 
@@ -10,6 +10,9 @@
 #include <set>
 
 #include "GDCore/String.h"
+namespace gd {
+class LoopInvariants;
+}  // namespace gd
 
 namespace gd {
 
@@ -75,6 +78,46 @@ class GD_CORE_API EventsCodeGenerationContext {
     return !reuseExplicitlyForbidden && parent != nullptr;
   }
 
+  /**
+   * \brief Allow the context to directly use the objects lists of its parent,
+   * instead of declaring copies of them, for all the objects except the ones
+   * in \a modifiedObjectsLists.
+   *
+   * This must only be used when the code generated with the context only reads
+   * the other objects lists (see gd::ModifiedObjectsListsFinder). The sharing is
+   * kept by the contexts reusing this one (see Reuse).
+   */
+  void AllowObjectsListsSharing(
+      const std::set<gd::String>& modifiedObjectsLists_) {
+    objectsListsSharingAllowed = true;
+    modifiedObjectsLists = modifiedObjectsLists_;
+  }
+
+  /**
+   * \brief Forbid the context to directly use the objects lists of its parent
+   * (see AllowObjectsListsSharing). This is the default.
+   */
+  void ForbidObjectsListsSharing() {
+    objectsListsSharingAllowed = false;
+    modifiedObjectsLists.clear();
+  }
+
+  /**
+   * \brief Set the expressions to be hoisted out of the loop being generated
+   * (nullptr if the context is not in a loop). Children contexts use the same
+   * gd::LoopInvariants, except asynchronous callbacks, which are run after the
+   * loop.
+   */
+  void SetLoopInvariants(gd::LoopInvariants* loopInvariants_) {
+    loopInvariants = loopInvariants_;
+  }
+
+  /**
+   * \brief Return the expressions to be hoisted out of the loop being
+   * generated, or nullptr if the context is not in a loop.
+   */
+  gd::LoopInvariants* GetLoopInvariants() const { return loopInvariants; }
+
   /**
    * \brief Returns the depth of the inheritance of the context.
    *
@@ -270,6 +313,7 @@ class GD_CORE_API EventsCodeGenerationContext {
 
  private:
   void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
+  bool CanShareParentObjectsList(const gd::String& objectName) const;
 
   std::set<gd::String>
       alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
@@ -322,6 +366,15 @@ class GD_CORE_API EventsCodeGenerationContext {
   bool reuseExplicitlyForbidden =
       false;  ///< If set to true, forbid children contexts
               ///< to reuse this one without inheriting.
+  bool objectsListsSharingAllowed =
+      false;  ///< If set to true, the objects lists that are not modified
+              ///< are the ones of the parent context.
+  std::set<gd::String>
+      modifiedObjectsLists;  ///< The objects lists that can't be shared
+                             ///< with the parent context.
+  gd::LoopInvariants* loopInvariants =
+      nullptr;  ///< The expressions to be hoisted out of the loop being
+                ///< generated, if any.
 };
 
 }  // namespace gd
@@ -4,8 +4,11 @@
 #include <utility>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/CodeGeneration/ConditionsReorderer.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
@@ -14,9 +17,11 @@
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/InstructionSentenceFormatter.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 
 using namespace std;
 
@@ -412,12 +417,16 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
     outputCode += GenerateBooleanInitializationToFalse(
         "condition" + gd::String::From(i) + "IsTrue", context);
 
+  // Booleans are named after the position of the condition in the
+  // evaluation order, so that the last one is the result of the list.
+  std::vector<std::size_t> order = GetConditionsEvaluationOrder(conditions);
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
+    gd::Instruction& condition = conditions[order[cId]];
     gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
+        GenerateConditionCode(condition,
                               "condition" + gd::String::From(cId) + "IsTrue",
                               context);
-    if (!conditions[cId].GetType().empty()) {
+    if (!condition.GetType().empty()) {
       for (std::size_t i = 0; i < cId;
            ++i)  // Skip conditions if one condition is false. //TODO : Can be
                  // optimized
@@ -654,6 +663,10 @@ gd::String EventsCodeGenerator::GenerateActionsListCode(
   gd::String outputCode;
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
     gd::String actionCode = GenerateActionCode(actions[aId], context);
+    if (generateEventsProfilingCode && IsEventsFunctionCall(actions[aId])) {
+      actionCode = WrapWithEventsProfilingCode(
+          actionCode, "functionCall", actions[aId].GetType());
+    }
 
     outputCode += "{";
     if (actions[aId].GetType().empty()) {
@@ -667,6 +680,11 @@ gd::String EventsCodeGenerator::GenerateActionsListCode(
     outputCode += "}";
   }
 
+  if (generateEventsProfilingCode && !actions.empty()) {
+    outputCode = WrapWithEventsProfilingCode(
+        outputCode, "actions", GetInstructionsSentence(actions, false));
+  }
+
   return outputCode;
 }
 
@@ -898,13 +916,36 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
 
     auto& context = reuseParentContext ? reusedContext : newContext;
 
+    //*Optimization*: the objects lists that are only read by the conditions
+    // and actions of the event are the lists of the parent context. This
+    // avoids copies of the lists when events are only using the objects picked
+    // by their parent.
+    std::set<gd::String> modifiedObjectsLists;
+    if (ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+            platform,
+            GetGlobalObjectsAndGroups(),
+            GetObjectsAndGroups(),
+            events[eId],
+            modifiedObjectsLists))
+      context.AllowObjectsListsSharing(modifiedObjectsLists);
+    else
+      context.ForbidObjectsListsSharing();
+
+    currentEventPath.push_back(eId);
+    currentEventsStack.push_back(&events[eId]);
     gd::String eventCoreCode = events[eId].GenerateEventCode(*this, context);
     gd::String scopeBegin = GenerateScopeBegin(context);
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
+    gd::String eventCode = declarationsCode + "\n" + eventCoreCode;
+    if (generateEventsProfilingCode && events[eId].IsExecutable()) {
+      // Objects lists declarations are measured too, as they can be costly.
+      eventCode = WrapWithEventsProfilingCode(eventCode, "event");
+    }
+    currentEventsStack.pop_back();
+    currentEventPath.pop_back();
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    output += "\n" + scopeBegin + "\n" + eventCode + "\n" + scopeEnd + "\n";
   }
 
   return output;
@@ -1272,6 +1313,110 @@ gd::String EventsCodeGenerator::GenerateArgumentsList(
   return argumentsStr;
 }
 
+gd::String EventsCodeGenerator::WrapWithEventsProfilingCode(
+    const gd::String& code,
+    const gd::String& kind,
+    const gd::String& sentence) {
+  if (!generateEventsProfilingCode) return code;
+
+  gd::String eventPath;
+  for (std::size_t i = 0; i < currentEventPath.size(); ++i) {
+    if (i != 0) eventPath += ".";
+    eventPath += gd::String::From(currentEventPath[i]);
+  }
+  gd::String eventType =
+      currentEventsStack.empty() ? "" : currentEventsStack.back()->GetType();
+
+  std::size_t sectionId = eventsProfilingSections.size();
+  eventsProfilingSections.push_back(
+      EventsProfilingSection(kind, eventPath, eventType, sentence));
+
+  return GenerateEventsProfilingSectionBegin(sectionId) + "\n" + code + "\n" +
+         GenerateEventsProfilingSectionEnd(sectionId) + "\n";
+}
+
+gd::String EventsCodeGenerator::GetInstructionsSentence(
+    const gd::InstructionsList& instructions, bool areConditions) {
+  gd::String sentence;
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction& instruction = instructions[i];
+    const gd::InstructionMetadata& metadata =
+        areConditions ? MetadataProvider::GetConditionMetadata(
+                            platform, instruction.GetType())
+                      : MetadataProvider::GetActionMetadata(
+                            platform, instruction.GetType());
+
+    if (i != 0) sentence += areConditions ? " and " : ", then ";
+    sentence +=
+        MetadataProvider::IsBadInstructionMetadata(metadata)
+            ? instruction.GetType()
+            : gd::InstructionSentenceFormatter::Get()->GetFullText(instruction,
+                                                                  metadata);
+  }
+
+  return sentence;
+}
+
+std::vector<std::size_t> EventsCodeGenerator::GetConditionsEvaluationOrder(
+    const gd::InstructionsList& conditions) const {
+  if (reorderConditionsByCost)
+    return ConditionsReorderer::GetEvaluationOrder(*this, conditions);
+
+  std::vector<std::size_t> order;
+  for (std::size_t i = 0; i < conditions.size(); ++i) order.push_back(i);
+  return order;
+}
+
+const gd::String& EventsCodeGenerator::GetSharedExternalEventsFunction(
+    const gd::String& externalEventsName) const {
+  static const gd::String notShared;
+  auto it = sharedExternalEventsFunctions.find(externalEventsName);
+  return it != sharedExternalEventsFunctions.end() ? it->second : notShared;
+}
+
+bool EventsCodeGenerator::IsEventsFunctionCall(
+    const gd::Instruction& instruction) const {
+  return IsEventsFunctionsExtensionType(instruction.GetType());
+}
+
+bool EventsCodeGenerator::IsEventsFunctionCall(
+    const gd::FunctionCallNode& node) const {
+  if (node.objectName.empty())
+    return IsEventsFunctionsExtensionType(node.functionName);
+  if (!node.behaviorName.empty())
+    return IsEventsFunctionsExtensionType(gd::GetTypeOfBehavior(
+        GetGlobalObjectsAndGroups(), GetObjectsAndGroups(), node.behaviorName));
+  return IsEventsFunctionsExtensionType(gd::GetTypeOfObject(
+      GetGlobalObjectsAndGroups(), GetObjectsAndGroups(), node.objectName));
+}
+
+bool EventsCodeGenerator::IsEventsFunctionsExtensionType(
+    const gd::String& type) const {
+  if (!project) return false;
+
+  std::size_t separatorPosition =
+      type.find(PlatformExtension::GetNamespaceSeparator());
+  if (separatorPosition == gd::String::npos) return false;
+
+  return project->HasEventsFunctionsExtensionNamed(
+      type.substr(0, separatorPosition));
+}
+
+void EventsCodeGenerator::SerializeEventsProfilingSectionsTo(
+    gd::SerializerElement& element) const {
+  element.ConsiderAsArrayOf("section");
+  for (std::size_t i = 0; i < eventsProfilingSections.size(); ++i) {
+    const EventsProfilingSection& section = eventsProfilingSections[i];
+    gd::SerializerElement& sectionElement = element.AddChild("section");
+    sectionElement.SetAttribute("id", (int)i);
+    sectionElement.SetAttribute("kind", section.kind);
+    sectionElement.SetAttribute("eventPath", section.eventPath);
+    sectionElement.SetAttribute("eventType", section.eventType);
+    if (!section.sentence.empty())
+      sectionElement.SetAttribute("sentence", section.sentence);
+  }
+}
+
 EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
                                          const gd::Layout& layout,
                                          const gd::Platform& platform_)
@@ -1285,7 +1430,12 @@ EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project_,
       compilationForRuntime(false),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
-      eventsListNextUniqueId(0){};
+      eventsListNextUniqueId(0),
+      generateEventsProfilingCode(false),
+      reorderConditionsByCost(project_.GetReorderConditionsByCost()),
+      inliningMaxCodeGrowth(
+          project_.GetEventsFunctionsInliningMaxCodeGrowth()),
+      inliningCodeGrowth(0){};
 
 EventsCodeGenerator::EventsCodeGenerator(
     const gd::Platform& platform_,
@@ -1301,6 +1451,10 @@ EventsCodeGenerator::EventsCodeGenerator(
       compilationForRuntime(false),
       maxCustomConditionsDepth(0),
       maxConditionsListsSize(0),
-      eventsListNextUniqueId(0){};
+      eventsListNextUniqueId(0),
+      generateEventsProfilingCode(false),
+      reorderConditionsByCost(false),
+      inliningMaxCodeGrowth(0),
+      inliningCodeGrowth(0){};
 
 }  // namespace gd
@@ -6,6 +6,7 @@
 #ifndef GDCORE_EVENTSCODEGENERATOR_H
 #define GDCORE_EVENTSCODEGENERATOR_H
 
+#include <map>
 #include <set>
 #include <utility>
 #include <vector>
@@ -28,6 +29,8 @@ class EventsCodeGenerationContext;
 class ExpressionCodeGenerationInformation;
 class InstructionMetadata;
 class Platform;
+class SerializerElement;
+struct FunctionCallNode;
 }  // namespace gd
 
 namespace gd {
@@ -311,6 +314,147 @@ class GD_CORE_API EventsCodeGenerator {
     compilationForRuntime = compilationForRuntime_;
   }
 
+  /**
+   * \brief Return true if the generated code must be instrumented to measure
+   * the time spent in each event, conditions list, actions list and events
+   * function call.
+   */
+  bool GenerateEventsProfilingCode() const {
+    return generateEventsProfilingCode;
+  }
+
+  /**
+   * \brief Set if the generated code must be instrumented to measure the time
+   * spent in events.
+   *
+   * \see gd::EventsCodeGenerator::GetEventsProfilingSections
+   */
+  void SetGenerateEventsProfilingCode(bool enable) {
+    generateEventsProfilingCode = enable;
+  }
+
+  /**
+   * \brief Return true if the conditions can be evaluated in a different order
+   * than the one of the events sheet, so that the cheapest are evaluated
+   * first.
+   */
+  bool ShouldReorderConditionsByCost() const {
+    return reorderConditionsByCost;
+  }
+
+  /**
+   * \brief Set if the conditions can be evaluated in a different order than
+   * the one of the events sheet. By default, this is enabled for the events of
+   * a project having gd::Project::GetReorderConditionsByCost set.
+   *
+   * \see gd::ConditionsReorderer
+   */
+  void SetReorderConditionsByCost(bool enable) {
+    reorderConditionsByCost = enable;
+  }
+
+  /**
+   * \brief Return the number of characters of code that can be added by
+   * inlining the events functions called by expressions. 0 if the functions
+   * must not be inlined.
+   */
+  std::size_t GetInliningMaxCodeGrowth() const {
+    return inliningMaxCodeGrowth;
+  }
+
+  /**
+   * \brief Set the number of characters of code that can be added by inlining
+   * the events functions called by expressions. By default, this is
+   * gd::Project::GetEventsFunctionsInliningMaxCodeGrowth for the events of a
+   * scene.
+   *
+   * \see gd::EventsFunctionsInliner
+   */
+  void SetInliningMaxCodeGrowth(std::size_t maxCodeGrowth) {
+    inliningMaxCodeGrowth = maxCodeGrowth;
+  }
+
+  /**
+   * \brief Count some code added by inlining an events function.
+   *
+   * \return false (and nothing is counted) if this would exceed the maximum
+   * code growth.
+   */
+  bool ConsumeInliningCodeGrowth(std::size_t codeGrowth) {
+    if (inliningCodeGrowth + codeGrowth > inliningMaxCodeGrowth) return false;
+
+    inliningCodeGrowth += codeGrowth;
+    return true;
+  }
+
+  /**
+   * \brief Return the indices of the conditions of a list, in the order they
+   * must be evaluated.
+   */
+  std::vector<std::size_t> GetConditionsEvaluationOrder(
+      const gd::InstructionsList& conditions) const;
+
+  /**
+   * \brief Set the functions, shared by the scenes, running the external
+   * events that must be called by the links instead of being copied in the
+   * events.
+   *
+   * \param functions The name of the function to call for each external
+   * events.
+   * \see gd::SharedExternalEventsFinder
+   */
+  void SetSharedExternalEventsFunctions(
+      const std::map<gd::String, gd::String>& functions) {
+    sharedExternalEventsFunctions = functions;
+  }
+
+  /**
+   * \brief Return the name of the function to call to run the external events,
+   * or an empty string if the external events must be copied in the events.
+   */
+  const gd::String& GetSharedExternalEventsFunction(
+      const gd::String& externalEventsName) const;
+
+  /**
+   * \brief A part of the events measured when events profiling code is
+   * generated.
+   */
+  struct EventsProfilingSection {
+    EventsProfilingSection(const gd::String& kind_,
+                           const gd::String& eventPath_,
+                           const gd::String& eventType_,
+                           const gd::String& sentence_)
+        : kind(kind_),
+          eventPath(eventPath_),
+          eventType(eventType_),
+          sentence(sentence_){};
+
+    gd::String kind;  ///< "event", "conditions", "actions" or "functionCall".
+    gd::String eventPath;  ///< Position of the event, for example "2.0.1" is
+                           ///< the second sub-event of the first sub-event of
+                           ///< the third event.
+    gd::String eventType;  ///< The type of the event containing the section.
+    gd::String sentence;   ///< The sentences of the instructions, if any.
+  };
+
+  /**
+   * \brief Get the sections of events measured by the generated code. The
+   * identifier of a section, used in the generated code, is its index.
+   *
+   * Identifiers only depend on the position of events, so they are stable
+   * across code generations of the same events.
+   */
+  const std::vector<EventsProfilingSection>& GetEventsProfilingSections()
+      const {
+    return eventsProfilingSections;
+  }
+
+  /**
+   * \brief Serialize the sections of events measured by the generated code,
+   * so that the measures done at runtime can be mapped back to events.
+   */
+  void SerializeEventsProfilingSectionsTo(gd::SerializerElement& element) const;
+
   /**
    * \brief Report that an error occurred during code generation ( Event code
    * won't be generated )
@@ -439,6 +583,60 @@ class GD_CORE_API EventsCodeGenerator {
     return "";
   };
 
+  /**
+   * \brief Generate the code starting the measure of a section of events.
+   * Only called when events profiling code is generated.
+   *
+   * \param sectionId The section identifier, which is its index in
+   * GetEventsProfilingSections.
+   */
+  virtual gd::String GenerateEventsProfilingSectionBegin(std::size_t sectionId) {
+    return "";
+  };
+
+  /**
+   * \brief Generate the code ending the measure of a section of events.
+   * Only called when events profiling code is generated.
+   */
+  virtual gd::String GenerateEventsProfilingSectionEnd(std::size_t sectionId) {
+    return "";
+  };
+
+  /**
+   * \brief Wrap the code of a section of events with the code measuring it,
+   * if events profiling code is generated.
+   */
+  gd::String WrapWithEventsProfilingCode(const gd::String& code,
+                                         const gd::String& kind,
+                                         const gd::String& sentence = "");
+
+  /**
+   * \brief Return the sentence describing the instructions of a list, to be
+   * used in the events profiling sections.
+   */
+  gd::String GetInstructionsSentence(const gd::InstructionsList& instructions,
+                                     bool areConditions);
+
+  /**
+   * \brief Return true if the instruction is a call to a function of an events
+   * functions extension of the project.
+   */
+  bool IsEventsFunctionCall(const gd::Instruction& instruction) const;
+
+  /**
+   * \brief Return true if the function called in an expression is a function
+   * of an events functions extension of the project (including functions of
+   * events based objects and behaviors).
+   */
+  bool IsEventsFunctionCall(const gd::FunctionCallNode& node) const;
+
+  /**
+   * \brief Return true if the type (of an instruction, an expression, an
+   * object or a behavior) is declared by an events functions extension of the
+   * project.
+   */
+  bool IsEventsFunctionsExtensionType(const gd::String& type) const;
+
   /**
    * \brief Get the namespace to be used to store code generated
    * objects/values/functions, with the extra "dot" at the end to be used to
@@ -588,6 +786,22 @@ class GD_CORE_API EventsCodeGenerator {
    */
   virtual gd::String GenerateBadObject() { return "fakeNullObject"; }
 
+  /**
+   * \brief Generate the code converting a value to a number, like the
+   * arguments and the returned values of events functions.
+   */
+  virtual gd::String GenerateConversionToNumber(const gd::String& valueCode) {
+    return "(" + valueCode + ")";
+  }
+
+  /**
+   * \brief Generate the code converting a value to a string, like the
+   * arguments and the returned values of events functions.
+   */
+  virtual gd::String GenerateConversionToString(const gd::String& valueCode) {
+    return "(" + valueCode + ")";
+  }
+
   /**
    * \brief Call a function of the current object.
    * \note The current object is the object being manipulated by a condition or
@@ -807,6 +1021,24 @@ class GD_CORE_API EventsCodeGenerator {
       instructionUniqueIds;  ///< The unique ids generated for instructions.
   size_t eventsListNextUniqueId;  ///< The next identifier to use for an events
                                   ///< list function name.
+
+  bool generateEventsProfilingCode;  ///< Is set to true if the code must be
+                                     ///< instrumented to profile events.
+  std::vector<EventsProfilingSection>
+      eventsProfilingSections;  ///< The sections measured by the code.
+  std::vector<std::size_t>
+      currentEventPath;  ///< The position of the event being generated.
+  std::vector<const gd::BaseEvent*>
+      currentEventsStack;  ///< The events being generated, from the root.
+  bool reorderConditionsByCost;  ///< Is set to true if the cheapest conditions
+                                 ///< must be evaluated first.
+  std::size_t inliningMaxCodeGrowth;  ///< The code that can be added by
+                                      ///< inlining events functions.
+  std::size_t inliningCodeGrowth;  ///< The code added so far by inlining.
+  std::map<gd::String, gd::String>
+      sharedExternalEventsFunctions;  ///< The functions to call for the
+                                      ///< external events that are not copied
+                                      ///< in the events.
 };
 
 }  // namespace gd
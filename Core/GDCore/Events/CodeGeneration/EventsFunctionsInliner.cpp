@@ -0,0 +1,285 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/EventsFunctionsInliner.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Project.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Return the parameter of the events function with the given name if it's a
+ * number or a string, which can be replaced by the argument given at the call.
+ */
+const gd::ParameterMetadata* GetValueParameter(
+    const gd::EventsFunction& eventsFunction, const gd::String& name) {
+  for (const gd::ParameterMetadata& parameter :
+       eventsFunction.GetParameters()) {
+    if (parameter.IsCodeOnly() || parameter.GetName() != name) continue;
+
+    const gd::String& type = parameter.GetType();
+    return gd::ParameterMetadata::IsExpression("number", type) ||
+                   gd::ParameterMetadata::IsExpression("string", type)
+               ? &parameter
+               : nullptr;
+  }
+
+  return nullptr;
+}
+
+/**
+ * Return true if the argument is a constant: it can be evaluated any number of
+ * times, in any order.
+ */
+bool IsLiteral(const gd::ExpressionNode& node) {
+  if (dynamic_cast<const NumberNode*>(&node) ||
+      dynamic_cast<const TextNode*>(&node))
+    return true;
+
+  const UnaryOperatorNode* unaryOperator =
+      dynamic_cast<const UnaryOperatorNode*>(&node);
+  return unaryOperator &&
+         dynamic_cast<const NumberNode*>(unaryOperator->factor.get());
+}
+
+/**
+ * \brief Check that an expression returned by an events function only uses
+ * constants, operators, the parameters of the function and pure free
+ * functions.
+ */
+class InlinableExpressionChecker : public ExpressionParser2NodeWorker {
+ public:
+  InlinableExpressionChecker(const gd::EventsCodeGenerator& codeGenerator_,
+                             const gd::EventsFunction& eventsFunction_,
+                             std::vector<gd::String>& argumentsUsages_)
+      : codeGenerator(codeGenerator_),
+        eventsFunction(eventsFunction_),
+        argumentsUsages(argumentsUsages_),
+        isInlinable(true),
+        nodesCount(0){};
+  virtual ~InlinableExpressionChecker(){};
+
+  bool IsInlinable() const {
+    return isInlinable &&
+           nodesCount <= EventsFunctionsInliner::MaxInlinedNodesCount;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    CountNode(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    CountNode(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    CountNode(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { CountNode(node); }
+  void OnVisitTextNode(TextNode& node) override { CountNode(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    isInlinable = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    CountNode(node);
+    if (!node.objectName.empty()) {
+      isInlinable = false;
+      return;
+    }
+
+    if (node.functionName == "GetArgumentAsNumber" ||
+        node.functionName == "GetArgumentAsString") {
+      const TextNode* parameterName =
+          node.parameters.size() == 1
+              ? dynamic_cast<const TextNode*>(node.parameters[0].get())
+              : nullptr;
+      if (!parameterName ||
+          !GetValueParameter(eventsFunction, parameterName->text)) {
+        isInlinable = false;
+        return;
+      }
+
+      argumentsUsages.push_back(parameterName->text);
+      return;
+    }
+
+    // Events functions are never inlined in other events functions, which
+    // also ensures that an inlined function is not recursive.
+    if (codeGenerator.IsEventsFunctionsExtensionType(node.functionName)) {
+      isInlinable = false;
+      return;
+    }
+
+    const gd::ExpressionMetadata& metadata =
+        MetadataProvider::GetFunctionCallMetadata(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            node);
+    if (gd::MetadataProvider::IsBadExpressionMetadata(metadata) ||
+        !metadata.IsPure() ||
+        metadata.codeExtraInformation.HasCustomCodeGenerator()) {
+      isInlinable = false;
+      return;
+    }
+
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { isInlinable = false; }
+
+ private:
+  void CountNode(const ExpressionNode& node) {
+    nodesCount++;
+    if (node.diagnostic && node.diagnostic->IsError()) isInlinable = false;
+  }
+
+  const gd::EventsCodeGenerator& codeGenerator;
+  const gd::EventsFunction& eventsFunction;
+  std::vector<gd::String>& argumentsUsages;
+  bool isInlinable;
+  std::size_t nodesCount;
+};
+
+}  // namespace
+
+const gd::EventsFunction* EventsFunctionsInliner::GetEventsFunctionToInline(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::FunctionCallNode& node,
+    gd::String& returnedExpression) {
+  if (!codeGenerator.HasProjectAndLayout() || !node.objectName.empty())
+    return nullptr;
+
+  const gd::Project& project = codeGenerator.GetProject();
+  std::size_t separatorPosition =
+      node.functionName.find(PlatformExtension::GetNamespaceSeparator());
+  if (separatorPosition == gd::String::npos) return nullptr;
+
+  gd::String extensionName = node.functionName.substr(0, separatorPosition);
+  gd::String functionName = node.functionName.substr(
+      separatorPosition + PlatformExtension::GetNamespaceSeparator().size());
+  if (!project.HasEventsFunctionsExtensionNamed(extensionName))
+    return nullptr;
+  const gd::EventsFunctionsExtension& extension =
+      project.GetEventsFunctionsExtension(extensionName);
+  if (!extension.HasEventsFunctionNamed(functionName)) return nullptr;
+  const gd::EventsFunction& eventsFunction =
+      extension.GetEventsFunction(functionName);
+
+  std::vector<gd::String> argumentsUsages;
+  returnedExpression = GetInlinableReturnedExpression(
+      codeGenerator, eventsFunction, argumentsUsages);
+  if (returnedExpression.empty()) return nullptr;
+
+  // The arguments that are not constants must be evaluated once, in the same
+  // order as they would be before calling the function.
+  std::vector<gd::String> nonLiteralParameters;
+  std::size_t argumentIndex = 0;
+  for (const gd::ParameterMetadata& parameter :
+       eventsFunction.GetParameters()) {
+    if (parameter.IsCodeOnly()) continue;
+
+    if (argumentIndex < node.parameters.size() &&
+        !IsLiteral(*node.parameters[argumentIndex]))
+      nonLiteralParameters.push_back(parameter.GetName());
+    argumentIndex++;
+  }
+  if (node.parameters.size() > argumentIndex) return nullptr;
+
+  std::vector<gd::String> nonLiteralUsages;
+  for (const gd::String& usage : argumentsUsages) {
+    if (std::find(nonLiteralParameters.begin(),
+                  nonLiteralParameters.end(),
+                  usage) != nonLiteralParameters.end())
+      nonLiteralUsages.push_back(usage);
+  }
+  if (nonLiteralUsages != nonLiteralParameters) return nullptr;
+
+  return &eventsFunction;
+}
+
+gd::String EventsFunctionsInliner::GetInlinableReturnedExpression(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::EventsFunction& eventsFunction,
+    std::vector<gd::String>& argumentsUsages) {
+  if (eventsFunction.GetFunctionType() != gd::EventsFunction::Expression ||
+      eventsFunction.IsAsync())
+    return "";
+
+  // Find the only event of the function, ignoring comments.
+  const gd::StandardEvent* returningEvent = nullptr;
+  const gd::EventsList& events = eventsFunction.GetEvents();
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events.GetEvent(i);
+    if (event.IsDisabled() ||
+        dynamic_cast<const gd::CommentEvent*>(&event))
+      continue;
+
+    const gd::StandardEvent* standardEvent =
+        dynamic_cast<const gd::StandardEvent*>(&event);
+    if (!standardEvent || returningEvent) return "";
+    returningEvent = standardEvent;
+  }
+  if (!returningEvent || !returningEvent->GetConditions().IsEmpty() ||
+      !returningEvent->GetSubEvents().IsEmpty() ||
+      returningEvent->GetActions().size() != 1)
+    return "";
+
+  const gd::Instruction& action = returningEvent->GetActions()[0];
+  bool isNumber = eventsFunction.GetExpressionType().IsNumber();
+  if (action.GetType() != (isNumber ? "SetReturnNumber" : "SetReturnString") ||
+      action.GetParametersCount() < 1)
+    return "";
+
+  const gd::String& expression = action.GetParameter(0).GetPlainString();
+  gd::ExpressionParser2 parser;
+  auto node = parser.ParseExpression(expression);
+  if (!node) return "";
+
+  InlinableExpressionChecker checker(
+      codeGenerator, eventsFunction, argumentsUsages);
+  node->Visit(checker);
+  if (!checker.IsInlinable()) {
+    argumentsUsages.clear();
+    return "";
+  }
+
+  return expression;
+}
+
+}  // namespace gd
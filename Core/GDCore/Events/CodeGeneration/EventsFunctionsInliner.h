@@ -0,0 +1,79 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSFUNCTIONSINLINER_H
+#define GDCORE_EVENTSFUNCTIONSINLINER_H
+
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class EventsCodeGenerator;
+class EventsFunction;
+struct FunctionCallNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the expressions of events functions that are small enough to be
+ * inlined where they are called: the returned expression is generated
+ * instead of calling the function, which avoids the creation of its context.
+ *
+ * An expression function can be inlined when:
+ * - its events are a single event without conditions, with a single action
+ *   setting the returned value,
+ * - the returned value only uses constants, operators, the number and string
+ *   parameters of the function, and pure free functions (see
+ *   gd::ExpressionMetadata::IsPure). This ensures the function is not
+ *   recursive,
+ * - the returned value has at most MaxInlinedNodesCount nodes.
+ *
+ * At each call, the arguments are generated at the place of the parameters,
+ * so they must be evaluated the same number of times and in the same order:
+ * each argument that is not a constant must be used exactly once, in the
+ * order of the parameters.
+ *
+ * Only calls from scenes events are inlined, as the events functions can't be
+ * found without the project. The code added by inlining is limited by
+ * gd::Project::GetEventsFunctionsInliningMaxCodeGrowth.
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API EventsFunctionsInliner {
+ public:
+  /**
+   * \brief The maximum number of nodes of an inlined expression.
+   */
+  static const std::size_t MaxInlinedNodesCount = 16;
+
+  /**
+   * \brief Return the free events function called by the node, if it can be
+   * inlined at this call, or nullptr.
+   *
+   * \param returnedExpression Set to the expression returned by the function,
+   * to be generated instead of the call.
+   */
+  static const gd::EventsFunction* GetEventsFunctionToInline(
+      const gd::EventsCodeGenerator& codeGenerator,
+      const gd::FunctionCallNode& node,
+      gd::String& returnedExpression);
+
+  /**
+   * \brief Return the expression returned by the events function if it can be
+   * inlined, or an empty string.
+   *
+   * \param argumentsUsages Filled with the names of the parameters used by
+   * the expression, in the order they are evaluated.
+   */
+  static gd::String GetInlinableReturnedExpression(
+      const gd::EventsCodeGenerator& codeGenerator,
+      const gd::EventsFunction& eventsFunction,
+      std::vector<gd::String>& argumentsUsages);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSFUNCTIONSINLINER_H
@@ -5,12 +5,18 @@
  */
 #include "ExpressionCodeGenerator.h"
 
+#include <cmath>
+#include <locale>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/EventsFunctionsInliner.h"
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
@@ -23,6 +29,7 @@
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/EventsFunction.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/IDE/Events/ExpressionTypeFinder.h"
@@ -59,11 +66,101 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     return generator.GenerateDefaultValue(rootType);
   }
 
+  gd::ExpressionConstantFolder constantFolder(
+      codeGenerator.GetPlatform(),
+      codeGenerator.GetGlobalObjectsAndGroups(),
+      codeGenerator.GetObjectsAndGroups());
+  node->Visit(constantFolder);
+  generator.SetConstantFolder(&constantFolder);
+  generator.SetLoopInvariants(context.GetLoopInvariants());
+
   node->Visit(generator);
   return generator.GetOutput();
 }
 
+namespace {
+/**
+ * Write a number so that it's read back exactly, using as few digits as
+ * possible.
+ */
+gd::String GenerateNumberCode(double number) {
+  gd::String code;
+  for (int precision = 1; precision <= 17; ++precision) {
+    std::ostringstream oss;
+    oss.imbue(std::locale::classic());
+    oss.precision(precision);
+    oss << number;
+
+    std::istringstream iss(oss.str());
+    iss.imbue(std::locale::classic());
+    double readNumber = 0;
+    iss >> readNumber;
+    if (readNumber == number || precision == 17) {
+      code = gd::String(oss.str().c_str());
+      break;
+    }
+  }
+
+  // Negative numbers are put in parentheses to be usable as operands.
+  return std::signbit(number) ? "(" + code + ")" : code;
+}
+}  // namespace
+
+bool ExpressionCodeGenerator::GenerateConstantValue(
+    const ExpressionNode& node) {
+  if (!constantFolder) return false;
+  const ExpressionConstantFolder::Value* value =
+      constantFolder->GetConstantValue(node);
+  if (!value) return false;
+
+  output += value->isNumber
+                ? GenerateNumberCode(value->number)
+                : codeGenerator.ConvertToStringExplicit(value->string);
+  return true;
+}
+
+ExpressionNode* ExpressionCodeGenerator::GetSimplifiedOperand(
+    OperatorNode& node) {
+  // Only simplify numbers, as "+" is a concatenation for texts.
+  if (!constantFolder ||
+      !gd::ParameterMetadata::IsExpression("number", rootType))
+    return nullptr;
+
+  auto isConstantNumber = [this](const ExpressionNode& operand,
+                                 double number) {
+    const ExpressionConstantFolder::Value* value =
+        constantFolder->GetConstantValue(operand);
+    return value && value->isNumber && value->number == number;
+  };
+
+  if ((node.op == '+' || node.op == '-') &&
+      isConstantNumber(*node.rightHandSide, 0))
+    return node.leftHandSide.get();
+  if ((node.op == '*' || node.op == '/') &&
+      isConstantNumber(*node.rightHandSide, 1))
+    return node.leftHandSide.get();
+  if (node.op == '+' && isConstantNumber(*node.leftHandSide, 0)) {
+    // "a - 0 + b" is stored as "a - (0 + b)" by the parser, but is generated
+    // without parentheses: it can't be simplified to "a - b".
+    OperatorNode* parent = dynamic_cast<OperatorNode*>(node.parent);
+    bool isSubtracted = parent && parent->op == '-' &&
+                        parent->rightHandSide.get() == &node;
+    if (!isSubtracted) return node.rightHandSide.get();
+  }
+  if (node.op == '*' && isConstantNumber(*node.leftHandSide, 1))
+    return node.rightHandSide.get();
+
+  return nullptr;
+}
+
 void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
+  if (GenerateConstantValue(node)) return;
+  ExpressionNode* simplifiedOperand = GetSimplifiedOperand(node);
+  if (simplifiedOperand) {
+    simplifiedOperand->Visit(*this);
+    return;
+  }
+
   node.leftHandSide->Visit(*this);
   output += " ";
   output.push_back(node.op);
@@ -73,6 +170,8 @@ void ExpressionCodeGenerator::OnVisitOperatorNode(OperatorNode& node) {
 
 void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
     UnaryOperatorNode& node) {
+  if (GenerateConstantValue(node)) return;
+
   output.push_back(node.op);
   output += "(";  // Add extra parenthesis to ensure that things like --2 are
                   // properly outputted as -(-2) (GDevelop don't have -- or ++
@@ -83,6 +182,8 @@ void ExpressionCodeGenerator::OnVisitUnaryOperatorNode(
 
 void ExpressionCodeGenerator::OnVisitSubExpressionNode(
     SubExpressionNode& node) {
+  if (GenerateConstantValue(node)) return;
+
   output += "(";
   node.expression->Visit(*this);
   output += ")";
@@ -115,8 +216,12 @@ void ExpressionCodeGenerator::OnVisitVariableNode(VariableNode& node) {
                                         codeGenerator.GetObjectsAndGroups(),
                                         rootObjectName,
                                         node);
-  output += codeGenerator.GenerateGetVariable(
-      node.name, scope, context, objectName);
+  gd::String variableCode =
+      codeGenerator.GenerateGetVariable(node.name, scope, context, objectName);
+  // Scene and global variables are always the same objects.
+  if (loopInvariants && scope != gd::EventsCodeGenerator::OBJECT_VARIABLE)
+    variableCode = loopInvariants->Hoist(variableCode);
+  output += variableCode;
   if (node.child) node.child->Visit(*this);
 }
 
@@ -129,6 +234,9 @@ void ExpressionCodeGenerator::OnVisitVariableAccessorNode(
 void ExpressionCodeGenerator::OnVisitVariableBracketAccessorNode(
     VariableBracketAccessorNode& node) {
   ExpressionCodeGenerator generator("string", "", codeGenerator, context);
+  generator.SetConstantFolder(constantFolder);
+  generator.SetLoopInvariants(loopInvariants);
+  generator.SetInlinedArguments(inlinedArguments);
   node.expression->Visit(generator);
   output +=
       codeGenerator.GenerateVariableBracketAccessor(generator.GetOutput());
@@ -157,8 +265,11 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
                                             codeGenerator.GetObjectsAndGroups(),
                                             rootObjectName,
                                             node);
-      output += codeGenerator.GenerateGetVariable(
+      gd::String variableCode = codeGenerator.GenerateGetVariable(
           node.identifierName, scope, context, objectName);
+      if (loopInvariants && scope != gd::EventsCodeGenerator::OBJECT_VARIABLE)
+        variableCode = loopInvariants->Hoist(variableCode);
+      output += variableCode;
       if (!node.childIdentifierName.empty()) {
         output += codeGenerator.GenerateVariableAccessor(node.childIdentifierName);
       }
@@ -176,6 +287,21 @@ void ExpressionCodeGenerator::OnVisitIdentifierNode(IdentifierNode& node) {
 }
 
 void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
+  if (GenerateConstantValue(node)) return;
+  if (GenerateInlinedArgumentCode(node)) return;
+
+  if (loopInvariants && loopInvariants->IsInvariant(codeGenerator, node)) {
+    //*Optimization*: The function gives the same result at each iteration of
+    // the loop, so it's only evaluated once, before the loop.
+    ExpressionCodeGenerator generator(
+        rootType, rootObjectName, codeGenerator, context);
+    generator.SetConstantFolder(constantFolder);
+    generator.SetInlinedArguments(inlinedArguments);
+    node.Visit(generator);
+    output += loopInvariants->Hoist(generator.GetOutput());
+    return;
+  }
+
   auto type = gd::ExpressionTypeFinder::GetType(codeGenerator.GetPlatform(),
                                             codeGenerator.GetGlobalObjectsAndGroups(),
                                             codeGenerator.GetObjectsAndGroups(),
@@ -206,12 +332,120 @@ void ExpressionCodeGenerator::OnVisitFunctionCallNode(FunctionCallNode& node) {
       output += GenerateObjectFunctionCode(
           type, node.objectName, node.parameters, metadata);
     }
-  } else {
+  } else if (!GenerateInlinedFunctionCode(node, metadata)) {
     output +=
         GenerateFreeFunctionCode(node.parameters, metadata);
   }
 }
 
+bool ExpressionCodeGenerator::GenerateInlinedArgumentCode(
+    const FunctionCallNode& node) {
+  if (!inlinedArguments || !node.objectName.empty() ||
+      node.parameters.size() != 1)
+    return false;
+  bool isNumber = node.functionName == "GetArgumentAsNumber";
+  if (!isNumber && node.functionName != "GetArgumentAsString") return false;
+
+  const TextNode* parameterName =
+      dynamic_cast<const TextNode*>(node.parameters[0].get());
+  if (!parameterName) return false;
+  auto argument = inlinedArguments->find(parameterName->text);
+  if (argument == inlinedArguments->end()) return false;
+
+  // The argument is converted as it would be by the function.
+  const gd::String& argumentCode = argument->second;
+  output += isNumber ? codeGenerator.GenerateConversionToNumber(argumentCode)
+                     : codeGenerator.GenerateConversionToString(argumentCode);
+  return true;
+}
+
+bool ExpressionCodeGenerator::GenerateInlinedFunctionCode(
+    const FunctionCallNode& node,
+    const ExpressionMetadata& expressionMetadata) {
+  if (codeGenerator.GetInliningMaxCodeGrowth() == 0 ||
+      expressionMetadata.codeExtraInformation.HasCustomCodeGenerator())
+    return false;
+
+  gd::String returnedExpression;
+  const gd::EventsFunction* eventsFunction =
+      EventsFunctionsInliner::GetEventsFunctionToInline(
+          codeGenerator, node, returnedExpression);
+  if (!eventsFunction) return false;
+
+  std::vector<gd::String> parameterNames;
+  for (const gd::ParameterMetadata& parameter :
+       eventsFunction->GetParameters()) {
+    if (!parameter.IsCodeOnly()) parameterNames.push_back(parameter.GetName());
+  }
+
+  size_t nonCodeOnlyParametersCount = 0;
+  for (const gd::ParameterMetadata& parameterMetadata :
+       expressionMetadata.parameters) {
+    if (!parameterMetadata.IsCodeOnly()) nonCodeOnlyParametersCount++;
+  }
+  if (nonCodeOnlyParametersCount != parameterNames.size()) return false;
+
+  // Generate the arguments as they would be given to the function, and the
+  // call to the function (as done by GenerateFreeFunctionCode), so that the
+  // code of each parameter is generated only once.
+  std::map<gd::String, gd::String> arguments;
+  gd::String parametersCode;
+  size_t nonCodeOnlyParameterIndex = 0;
+  for (std::size_t i = 0; i < expressionMetadata.parameters.size(); ++i) {
+    if (i != 0) parametersCode += ", ";
+
+    const gd::ParameterMetadata& parameterMetadata =
+        expressionMetadata.parameters[i];
+    if (parameterMetadata.IsCodeOnly()) {
+      parametersCode +=
+          codeGenerator.GenerateParameterCodes(parameterMetadata.GetExtraInfo(),
+                                               parameterMetadata,
+                                               context,
+                                               "",
+                                               nullptr);
+      continue;
+    }
+
+    gd::String& argumentCode =
+        arguments[parameterNames[nonCodeOnlyParameterIndex]];
+    argumentCode = GenerateParameterCode(
+        node.parameters, nonCodeOnlyParameterIndex, parameterMetadata);
+    parametersCode += argumentCode;
+    nonCodeOnlyParameterIndex++;
+  }
+
+  bool isNumber = eventsFunction->GetExpressionType().IsNumber();
+  ExpressionParser2 parser;
+  auto returnedNode = parser.ParseExpression(returnedExpression);
+  ExpressionCodeGenerator generator(
+      isNumber ? "number" : "string", "", codeGenerator, context);
+  generator.SetLoopInvariants(loopInvariants);
+  generator.SetInlinedArguments(&arguments);
+  returnedNode->Visit(generator);
+
+  // The returned value is converted as it would be by the function.
+  const gd::String& returnedCode = generator.GetOutput();
+  gd::String inlinedCode =
+      isNumber ? codeGenerator.GenerateConversionToNumber(returnedCode)
+               : codeGenerator.GenerateConversionToString(returnedCode);
+
+  gd::String callCode =
+      expressionMetadata.codeExtraInformation.functionCallName + "(" +
+      parametersCode + ")";
+  if (inlinedCode.size() > callCode.size() &&
+      !codeGenerator.ConsumeInliningCodeGrowth(inlinedCode.size() -
+                                               callCode.size())) {
+    // The function is called instead, reusing the code of the parameters.
+    codeGenerator.AddIncludeFiles(
+        expressionMetadata.codeExtraInformation.GetIncludeFiles());
+    output += callCode;
+    return true;
+  }
+
+  output += inlinedCode;
+  return true;
+}
+
 gd::String ExpressionCodeGenerator::GenerateFreeFunctionCode(
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
     const ExpressionMetadata& expressionMetadata) {
@@ -356,31 +590,8 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
 
     auto& parameterMetadata = expressionMetadata.parameters[i];
     if (!parameterMetadata.IsCodeOnly()) {
-      if (nonCodeOnlyParameterIndex < parameters.size()) {
-        auto objectName = gd::ExpressionVariableOwnerFinder::GetObjectName(codeGenerator.GetPlatform(),
-                                              codeGenerator.GetGlobalObjectsAndGroups(),
-                                              codeGenerator.GetObjectsAndGroups(),
-                                              rootObjectName,
-                                              *parameters[nonCodeOnlyParameterIndex].get());
-        ExpressionCodeGenerator generator(parameterMetadata.GetType(), objectName, codeGenerator, context);
-        parameters[nonCodeOnlyParameterIndex]->Visit(generator);
-        parametersCode += generator.GetOutput();
-      } else if (parameterMetadata.IsOptional()) {
-        ExpressionCodeGenerator generator(parameterMetadata.GetType(), "", codeGenerator, context);
-        // Optional parameters default value were not parsed at the time of the
-        // expression parsing. Parse them now.
-        ExpressionParser2 parser;
-        auto node = parser.ParseExpression(parameterMetadata.GetDefaultValue());
-
-        node->Visit(generator);
-        parametersCode += generator.GetOutput();
-      } else {
-        parametersCode +=
-            "/* Error during generation, parameter not existing in the nodes "
-            "*/ " +
-            GenerateDefaultValue(parameterMetadata.GetType());
-      }
-
+      parametersCode += GenerateParameterCode(
+          parameters, nonCodeOnlyParameterIndex, parameterMetadata);
       nonCodeOnlyParameterIndex++;
     } else {
       parametersCode +=
@@ -395,6 +606,41 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
   return parametersCode;
 }
 
+gd::String ExpressionCodeGenerator::GenerateParameterCode(
+    const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
+    size_t nonCodeOnlyParameterIndex,
+    const ParameterMetadata& parameterMetadata) {
+  if (nonCodeOnlyParameterIndex < parameters.size()) {
+    auto objectName = gd::ExpressionVariableOwnerFinder::GetObjectName(
+        codeGenerator.GetPlatform(),
+        codeGenerator.GetGlobalObjectsAndGroups(),
+        codeGenerator.GetObjectsAndGroups(),
+        rootObjectName,
+        *parameters[nonCodeOnlyParameterIndex].get());
+    ExpressionCodeGenerator generator(
+        parameterMetadata.GetType(), objectName, codeGenerator, context);
+    generator.SetConstantFolder(constantFolder);
+    generator.SetLoopInvariants(loopInvariants);
+    generator.SetInlinedArguments(inlinedArguments);
+    parameters[nonCodeOnlyParameterIndex]->Visit(generator);
+    return generator.GetOutput();
+  } else if (parameterMetadata.IsOptional()) {
+    ExpressionCodeGenerator generator(
+        parameterMetadata.GetType(), "", codeGenerator, context);
+    // Optional parameters default value were not parsed at the time of the
+    // expression parsing. Parse them now.
+    ExpressionParser2 parser;
+    auto node = parser.ParseExpression(parameterMetadata.GetDefaultValue());
+
+    node->Visit(generator);
+    return generator.GetOutput();
+  }
+
+  return "/* Error during generation, parameter not existing in the nodes "
+         "*/ " +
+         GenerateDefaultValue(parameterMetadata.GetType());
+}
+
 std::vector<gd::Expression> ExpressionCodeGenerator::PrintParameters(
     const std::vector<std::unique_ptr<ExpressionNode>>& parameters) {
   // Printing parameters is only useful because custom code generator of
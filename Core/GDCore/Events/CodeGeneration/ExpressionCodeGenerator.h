@@ -7,6 +7,7 @@
 #ifndef GDCORE_ExpressionCodeGenerator_H
 #define GDCORE_ExpressionCodeGenerator_H
 
+#include <map>
 #include <memory>
 #include <vector>
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
@@ -20,6 +21,8 @@ class ParameterMetadata;
 class ExpressionMetadata;
 class EventsCodeGenerationContext;
 class EventsCodeGenerator;
+class ExpressionConstantFolder;
+class LoopInvariants;
 }  // namespace gd
 
 namespace gd {
@@ -30,6 +33,16 @@ namespace gd {
  * Almost all code generation is dedicated to the gd::EventsCodeGenerator,
  * so that it can be adapted to the target.
  *
+ * When a gd::ExpressionConstantFolder is set, constant parts of the
+ * expression are replaced by their values, and operations with a neutral
+ * element (`x * 1`, `x + 0`...) in number expressions are simplified.
+ *
+ * When the context is in a loop, the expressions giving the same result at
+ * each iteration are hoisted out of the loop (see gd::LoopInvariants).
+ *
+ * Calls to small expression events functions are replaced by the expression
+ * returned by the function (see gd::EventsFunctionsInliner).
+ *
  * \see gd::ExpressionParser2
  */
 class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
@@ -38,13 +51,20 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
                           const gd::String &rootObjectName_,
                           EventsCodeGenerator& codeGenerator_,
                           EventsCodeGenerationContext& context_)
-      : rootType(rootType_), rootObjectName(rootObjectName_), codeGenerator(codeGenerator_), context(context_){};
+      : rootType(rootType_),
+        rootObjectName(rootObjectName_),
+        codeGenerator(codeGenerator_),
+        context(context_),
+        constantFolder(nullptr),
+        loopInvariants(nullptr),
+        inlinedArguments(nullptr){};
   virtual ~ExpressionCodeGenerator(){};
 
   /**
    * Helper to generate the code for an expression.
    * If expression is invalid, a default generated value is returned (0 for
    * number expression, empty string for strings).
+   * Constant parts of the expression are evaluated.
    *
    * \param codeGenerator The code generator to use to output code.
    * \param context The context of the code generation.
@@ -63,6 +83,37 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
 
   const gd::String& GetOutput() { return output; };
 
+  /**
+   * \brief Set the constant folder used to replace the constant parts of the
+   * expression by their values (nullptr to generate the expression as is).
+   *
+   * The folder must have visited the expression before the code generation.
+   */
+  void SetConstantFolder(const ExpressionConstantFolder* constantFolder_) {
+    constantFolder = constantFolder_;
+  }
+
+  /**
+   * \brief Set the loop invariants used to hoist the expressions giving the
+   * same result at each iteration of a loop (nullptr to generate the
+   * expression as is).
+   */
+  void SetLoopInvariants(LoopInvariants* loopInvariants_) {
+    loopInvariants = loopInvariants_;
+  }
+
+  /**
+   * \brief Set the code of the arguments given to the events function whose
+   * returned expression is generated, by parameter name (nullptr if the
+   * expression is not inlined).
+   *
+   * \see gd::EventsFunctionsInliner
+   */
+  void SetInlinedArguments(
+      const std::map<gd::String, gd::String>* inlinedArguments_) {
+    inlinedArguments = inlinedArguments_;
+  }
+
  protected:
   void OnVisitSubExpressionNode(SubExpressionNode& node) override;
   void OnVisitOperatorNode(OperatorNode& node) override;
@@ -82,6 +133,17 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   gd::String GenerateFreeFunctionCode(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata);
+  /**
+   * \brief Generate the code of a call to an events function, inlining its
+   * returned expression if the code doesn't grow too much.
+   *
+   * \return false if the function can't be inlined, in which case no code
+   * is generated.
+   */
+  bool GenerateInlinedFunctionCode(
+      const FunctionCallNode& node,
+      const ExpressionMetadata& expressionMetadata);
+  bool GenerateInlinedArgumentCode(const FunctionCallNode& node);
   gd::String GenerateObjectFunctionCode(
       const gd::String& type,
       const gd::String& objectName,
@@ -97,7 +159,13 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
       const ExpressionMetadata& expressionMetadata,
       size_t initialParameterIndex);
+  gd::String GenerateParameterCode(
+      const std::vector<std::unique_ptr<ExpressionNode>>& parameters,
+      size_t nonCodeOnlyParameterIndex,
+      const ParameterMetadata& parameterMetadata);
   gd::String GenerateDefaultValue(const gd::String& type);
+  bool GenerateConstantValue(const ExpressionNode& node);
+  ExpressionNode* GetSimplifiedOperand(OperatorNode& node);
   static std::vector<gd::Expression> PrintParameters(
       const std::vector<std::unique_ptr<ExpressionNode>>& parameters);
 
@@ -106,6 +174,9 @@ class GD_CORE_API ExpressionCodeGenerator : public ExpressionParser2NodeWorker {
   EventsCodeGenerationContext& context;
   const gd::String rootType;
   const gd::String rootObjectName;
+  const ExpressionConstantFolder* constantFolder;
+  LoopInvariants* loopInvariants;
+  const std::map<gd::String, gd::String>* inlinedArguments;
 };
 
 }  // namespace gd
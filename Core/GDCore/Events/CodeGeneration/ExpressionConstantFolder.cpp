@@ -0,0 +1,316 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+
+namespace gd {
+
+namespace {
+
+typedef ExpressionConstantFolder::Value Value;
+typedef std::function<bool(const std::vector<Value>&, Value&)> Evaluator;
+
+const double pi = 3.141592653589793;
+
+bool AreNumbers(const std::vector<Value>& parameters, std::size_t count) {
+  if (parameters.size() != count) return false;
+  for (const auto& parameter : parameters)
+    if (!parameter.isNumber) return false;
+  return true;
+}
+
+Evaluator UnaryFunction(double (*function)(double)) {
+  return [function](const std::vector<Value>& parameters, Value& result) {
+    if (!AreNumbers(parameters, 1)) return false;
+    result = Value(function(parameters[0].number));
+    return true;
+  };
+}
+
+Evaluator BinaryFunction(double (*function)(double, double)) {
+  return [function](const std::vector<Value>& parameters, Value& result) {
+    if (!AreNumbers(parameters, 2)) return false;
+    result = Value(function(parameters[0].number, parameters[1].number));
+    return true;
+  };
+}
+
+/**
+ * Math.round, which rounds halfway values towards +infinity.
+ */
+double RoundHalfUp(double x) {
+  double floor = std::floor(x);
+  return x - floor >= 0.5 ? floor + 1 : floor;
+}
+
+/**
+ * The length of a string in JavaScript, which counts UTF-16 code units.
+ */
+std::size_t GetUtf16Length(const gd::String& string) {
+  std::size_t length = 0;
+  for (auto it = string.begin(); it != string.end(); ++it)
+    length += *it > 0xFFFF ? 2 : 1;
+  return length;
+}
+
+/**
+ * The implementations of the builtin pure functions that can be evaluated.
+ * They must give the same results as the game engine.
+ */
+const std::unordered_map<gd::String, Evaluator>& GetEvaluators() {
+  static std::unordered_map<gd::String, Evaluator> evaluators;
+  if (!evaluators.empty()) return evaluators;
+
+  evaluators["cos"] = UnaryFunction(std::cos);
+  evaluators["sin"] = UnaryFunction(std::sin);
+  evaluators["tan"] = UnaryFunction(std::tan);
+  evaluators["acos"] = UnaryFunction(std::acos);
+  evaluators["asin"] = UnaryFunction(std::asin);
+  evaluators["atan"] = UnaryFunction(std::atan);
+  evaluators["atan2"] = BinaryFunction(std::atan2);
+  evaluators["abs"] = UnaryFunction(std::fabs);
+  evaluators["sqrt"] = UnaryFunction(std::sqrt);
+  evaluators["ceil"] = UnaryFunction(std::ceil);
+  evaluators["floor"] = UnaryFunction(std::floor);
+  evaluators["exp"] = UnaryFunction(std::exp);
+  evaluators["log"] = UnaryFunction(std::log);
+  evaluators["pow"] = BinaryFunction(std::pow);
+  evaluators["round"] = UnaryFunction(RoundHalfUp);
+  evaluators["int"] = UnaryFunction(RoundHalfUp);
+  evaluators["rint"] = UnaryFunction(RoundHalfUp);
+  evaluators["min"] = BinaryFunction(
+      [](double a, double b) -> double { return a < b ? a : b; });
+  evaluators["max"] = BinaryFunction(
+      [](double a, double b) -> double { return a > b ? a : b; });
+  evaluators["mod"] = BinaryFunction(
+      [](double x, double y) -> double { return x - y * std::floor(x / y); });
+  evaluators["sign"] = UnaryFunction(
+      [](double x) -> double { return x == 0 ? 0 : (x > 0 ? 1 : -1); });
+  evaluators["ToRad"] =
+      UnaryFunction([](double x) -> double { return (x / 180) * pi; });
+  evaluators["ToDeg"] =
+      UnaryFunction([](double x) -> double { return (x * 180) / pi; });
+  evaluators["Pi"] = [](const std::vector<Value>& parameters, Value& result) {
+    if (!parameters.empty()) return false;
+    result = Value(pi);
+    return true;
+  };
+  evaluators["clamp"] = [](const std::vector<Value>& parameters,
+                           Value& result) {
+    if (!AreNumbers(parameters, 3)) return false;
+    double x = parameters[0].number;
+    double min = parameters[1].number;
+    double max = parameters[2].number;
+    x = x > min ? x : min;
+    result = Value(x < max ? x : max);
+    return true;
+  };
+  evaluators["lerp"] = [](const std::vector<Value>& parameters,
+                          Value& result) {
+    if (!AreNumbers(parameters, 3)) return false;
+    double a = parameters[0].number;
+    double b = parameters[1].number;
+    result = Value(a + (b - a) * parameters[2].number);
+    return true;
+  };
+
+  evaluators["NewLine"] = [](const std::vector<Value>& parameters,
+                             Value& result) {
+    if (!parameters.empty()) return false;
+    result = Value(gd::String("\n"));
+    return true;
+  };
+  evaluators["StrLength"] = [](const std::vector<Value>& parameters,
+                               Value& result) {
+    if (parameters.size() != 1 || parameters[0].isNumber) return false;
+    result = Value((double)GetUtf16Length(parameters[0].string));
+    return true;
+  };
+  evaluators["ToString"] = [](const std::vector<Value>& parameters,
+                              Value& result) {
+    // Only integers are converted, as other numbers would require to
+    // reproduce exactly the conversion done by JavaScript.
+    if (!AreNumbers(parameters, 1)) return false;
+    double number = parameters[0].number;
+    if (number != std::floor(number) || std::fabs(number) > 9007199254740992.0)
+      return false;
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.0f", number == 0 ? 0 : number);
+    result = Value(gd::String(buffer));
+    return true;
+  };
+
+  return evaluators;
+}
+
+}  // namespace
+
+bool ExpressionConstantFolder::EvaluateFunction(
+    const gd::String& functionName,
+    const std::vector<Value>& parameters,
+    Value& result) {
+  const auto& evaluators = GetEvaluators();
+  auto evaluator = evaluators.find(functionName);
+  if (evaluator == evaluators.end()) return false;
+
+  if (!evaluator->second(parameters, result)) return false;
+  return !result.isNumber || std::isfinite(result.number);
+}
+
+void ExpressionConstantFolder::SetConstantValue(const gd::ExpressionNode& node,
+                                                const Value& value) {
+  // Don't keep numbers that could not be written back in the code.
+  if (value.isNumber && !std::isfinite(value.number)) return;
+
+  constantValues[&node] = value;
+}
+
+void ExpressionConstantFolder::OnVisitSubExpressionNode(
+    SubExpressionNode& node) {
+  node.expression->Visit(*this);
+
+  const Value* value = GetConstantValue(*node.expression);
+  if (value) SetConstantValue(node, *value);
+}
+
+void ExpressionConstantFolder::OnVisitOperatorNode(OperatorNode& node) {
+  if (node.op == '+' || node.op == '-') {
+    OnVisitAdditiveOperatorNode(node);
+    return;
+  }
+
+  node.leftHandSide->Visit(*this);
+  node.rightHandSide->Visit(*this);
+
+  const Value* left = GetConstantValue(*node.leftHandSide);
+  const Value* right = GetConstantValue(*node.rightHandSide);
+  if (!left || !right || !left->isNumber || !right->isNumber) return;
+
+  if (node.op == '*')
+    SetConstantValue(node, Value(left->number * right->number));
+  else if (node.op == '/')
+    SetConstantValue(node, Value(left->number / right->number));
+}
+
+void ExpressionConstantFolder::OnVisitAdditiveOperatorNode(OperatorNode& node) {
+  // The parser nests the additions and subtractions on the right ("a - b + c"
+  // is stored as "a - (b + c)"), but they are generated without parentheses
+  // and evaluated from left to right by the game engine. Evaluate the whole
+  // chain in the same order, and never consider the nested nodes alone.
+  std::vector<std::pair<char, ExpressionNode*>> terms;
+  terms.push_back(std::make_pair('+', node.leftHandSide.get()));
+  char op = node.op;
+  ExpressionNode* rightHandSide = node.rightHandSide.get();
+  OperatorNode* nestedNode = nullptr;
+  while ((nestedNode = dynamic_cast<OperatorNode*>(rightHandSide)) &&
+         (nestedNode->op == '+' || nestedNode->op == '-')) {
+    terms.push_back(std::make_pair(op, nestedNode->leftHandSide.get()));
+    op = nestedNode->op;
+    rightHandSide = nestedNode->rightHandSide.get();
+  }
+  terms.push_back(std::make_pair(op, rightHandSide));
+
+  for (auto& term : terms) term.second->Visit(*this);
+
+  const Value* first = GetConstantValue(*terms[0].second);
+  if (!first) return;
+
+  Value result = *first;
+  for (std::size_t i = 1; i < terms.size(); ++i) {
+    const Value* value = GetConstantValue(*terms[i].second);
+    if (!value || value->isNumber != result.isNumber) return;
+
+    if (!result.isNumber) {
+      if (terms[i].first != '+') return;
+      result.string += value->string;
+    } else if (terms[i].first == '+') {
+      result.number += value->number;
+    } else {
+      result.number -= value->number;
+    }
+  }
+
+  SetConstantValue(node, result);
+}
+
+void ExpressionConstantFolder::OnVisitUnaryOperatorNode(
+    UnaryOperatorNode& node) {
+  node.factor->Visit(*this);
+
+  const Value* value = GetConstantValue(*node.factor);
+  if (!value || !value->isNumber) return;
+
+  if (node.op == '-')
+    SetConstantValue(node, Value(-value->number));
+  else if (node.op == '+')
+    SetConstantValue(node, *value);
+}
+
+void ExpressionConstantFolder::OnVisitNumberNode(NumberNode& node) {
+  SetConstantValue(node, Value(node.number.To<double>()));
+}
+
+void ExpressionConstantFolder::OnVisitTextNode(TextNode& node) {
+  SetConstantValue(node, Value(node.text));
+}
+
+void ExpressionConstantFolder::OnVisitVariableNode(VariableNode& node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableAccessorNode(
+    VariableAccessorNode& node) {
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitVariableBracketAccessorNode(
+    VariableBracketAccessorNode& node) {
+  node.expression->Visit(*this);
+  if (node.child) node.child->Visit(*this);
+}
+
+void ExpressionConstantFolder::OnVisitFunctionCallNode(FunctionCallNode& node) {
+  for (auto& parameter : node.parameters) parameter->Visit(*this);
+
+  if (!node.objectName.empty() || !node.behaviorName.empty()) return;
+
+  const gd::ExpressionMetadata& metadata =
+      MetadataProvider::GetFunctionCallMetadata(
+          platform, globalObjectsContainer, objectsContainer, node);
+  if (gd::MetadataProvider::IsBadExpressionMetadata(metadata) ||
+      !metadata.IsPure() ||
+      metadata.codeExtraInformation.HasCustomCodeGenerator())
+    return;
+
+  // All the parameters must be written, and be constants.
+  std::size_t parametersCount = 0;
+  for (const auto& parameterMetadata : metadata.parameters)
+    if (!parameterMetadata.IsCodeOnly()) parametersCount++;
+  if (node.parameters.size() != parametersCount) return;
+
+  std::vector<Value> parameters;
+  for (const auto& parameter : node.parameters) {
+    const Value* value = GetConstantValue(*parameter);
+    if (!value) return;
+    parameters.push_back(*value);
+  }
+
+  Value result;
+  if (EvaluateFunction(node.functionName, parameters, result))
+    SetConstantValue(node, result);
+}
+
+}  // namespace gd
@@ -0,0 +1,109 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONCONSTANTFOLDER_H
+#define GDCORE_EXPRESSIONCONSTANTFOLDER_H
+
+#include <map>
+#include <vector>
+
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/String.h"
+namespace gd {
+class ObjectsContainer;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the parts of an expression that can be evaluated when
+ * generating code: operations on numbers or texts, and calls to pure
+ * functions (see gd::ExpressionMetadata::IsPure) with constant parameters.
+ *
+ * The expression is not modified: code generators can use the value of
+ * a constant node (see GetConstantValue) instead of generating code for it.
+ *
+ * Only the pure functions of the builtin extensions that have an
+ * implementation here are evaluated, following the semantics of the game
+ * engine (which computes with double precision numbers).
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API ExpressionConstantFolder
+    : public ExpressionParser2NodeWorker {
+ public:
+  /**
+   * \brief The value of a constant node.
+   */
+  struct Value {
+    Value() : isNumber(true), number(0){};
+    Value(double number_) : isNumber(true), number(number_){};
+    Value(const gd::String& string_)
+        : isNumber(false), number(0), string(string_){};
+
+    bool isNumber;
+    double number;
+    gd::String string;
+  };
+
+  ExpressionConstantFolder(const gd::Platform& platform_,
+                           const gd::ObjectsContainer& globalObjectsContainer_,
+                           const gd::ObjectsContainer& objectsContainer_)
+      : platform(platform_),
+        globalObjectsContainer(globalObjectsContainer_),
+        objectsContainer(objectsContainer_){};
+  virtual ~ExpressionConstantFolder(){};
+
+  /**
+   * \brief Return the value of the node if it can be evaluated when
+   * generating code, or nullptr.
+   *
+   * \note Number and text nodes are constants too.
+   */
+  const Value* GetConstantValue(const gd::ExpressionNode& node) const {
+    auto it = constantValues.find(&node);
+    return it == constantValues.end() ? nullptr : &it->second;
+  }
+
+  /**
+   * \brief Evaluate a call to a builtin pure function.
+   *
+   * \return false if the function is unknown, if the parameters don't have
+   * the expected types or if the result is not a finite number.
+   */
+  static bool EvaluateFunction(const gd::String& functionName,
+                               const std::vector<Value>& parameters,
+                               Value& result);
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override;
+  void OnVisitOperatorNode(OperatorNode& node) override;
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override;
+  void OnVisitNumberNode(NumberNode& node) override;
+  void OnVisitTextNode(TextNode& node) override;
+  void OnVisitVariableNode(VariableNode& node) override;
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override;
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override;
+  void OnVisitIdentifierNode(IdentifierNode& node) override{};
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override{};
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override;
+  void OnVisitEmptyNode(EmptyNode& node) override{};
+
+ private:
+  void OnVisitAdditiveOperatorNode(OperatorNode& node);
+  void SetConstantValue(const gd::ExpressionNode& node, const Value& value);
+
+  const gd::Platform& platform;
+  const gd::ObjectsContainer& globalObjectsContainer;
+  const gd::ObjectsContainer& objectsContainer;
+  std::map<const gd::ExpressionNode*, Value> constantValues;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONCONSTANTFOLDER_H
@@ -0,0 +1,438 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
+
+#include "GDCore/Events/Builtin/CommentEvent.h"
+#include "GDCore/Events/Builtin/ForEachChildVariableEvent.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Builtin/WhileEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * Get the name of the variable (without its children) given as a parameter.
+ */
+bool GetVariableName(const gd::ExpressionNode& node, gd::String& name) {
+  const VariableNode* variable = dynamic_cast<const VariableNode*>(&node);
+  if (variable) {
+    name = variable->name;
+    return true;
+  }
+  const IdentifierNode* identifier = dynamic_cast<const IdentifierNode*>(&node);
+  if (identifier) {
+    name = identifier->identifierName;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Return true if one of the objects is an events based object or has an events
+ * based behavior: their events can be run when the objects are created or
+ * deleted.
+ */
+bool HasEventsBasedBehaviors(const gd::EventsCodeGenerator& codeGenerator,
+                             const gd::String& objectOrGroupName) {
+  const gd::ObjectsContainer& globalObjectsAndGroups =
+      codeGenerator.GetGlobalObjectsAndGroups();
+  const gd::ObjectsContainer& objectsAndGroups =
+      codeGenerator.GetObjectsAndGroups();
+
+  std::vector<gd::String> objectNames;
+  if (globalObjectsAndGroups.GetObjectGroups().Has(objectOrGroupName))
+    objectNames = globalObjectsAndGroups.GetObjectGroups()
+                      .Get(objectOrGroupName)
+                      .GetAllObjectsNames();
+  else if (objectsAndGroups.GetObjectGroups().Has(objectOrGroupName))
+    objectNames = objectsAndGroups.GetObjectGroups()
+                      .Get(objectOrGroupName)
+                      .GetAllObjectsNames();
+  else
+    objectNames.push_back(objectOrGroupName);
+
+  for (const gd::String& objectName : objectNames) {
+    const gd::Object* object = nullptr;
+    if (objectsAndGroups.HasObjectNamed(objectName))
+      object = &objectsAndGroups.GetObject(objectName);
+    else if (globalObjectsAndGroups.HasObjectNamed(objectName))
+      object = &globalObjectsAndGroups.GetObject(objectName);
+    if (!object) continue;
+
+    if (codeGenerator.IsEventsFunctionsExtensionType(object->GetType()))
+      return true;
+    for (const gd::String& behaviorName : object->GetAllBehaviorNames()) {
+      if (codeGenerator.IsEventsFunctionsExtensionType(
+              object->GetBehavior(behaviorName).GetTypeName()))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Find the variables that can be modified by the functions called in an
+ * expression: the variables given to functions that are not pure.
+ */
+class ExpressionWrittenVariablesFinder : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionWrittenVariablesFinder(
+      const gd::EventsCodeGenerator& codeGenerator_,
+      std::set<gd::String>& writtenSceneVariables_,
+      std::set<gd::String>& writtenGlobalVariables_)
+      : codeGenerator(codeGenerator_),
+        writtenSceneVariables(writtenSceneVariables_),
+        writtenGlobalVariables(writtenGlobalVariables_),
+        allModificationsKnown(true){};
+  virtual ~ExpressionWrittenVariablesFinder(){};
+
+  bool AreAllModificationsKnown() const { return allModificationsKnown; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    if (codeGenerator.IsEventsFunctionCall(node)) {
+      allModificationsKnown = false;
+      return;
+    }
+
+    const gd::ExpressionMetadata& metadata =
+        MetadataProvider::GetFunctionCallMetadata(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            node);
+    bool isPure = !MetadataProvider::IsBadExpressionMetadata(metadata) &&
+                  metadata.IsPure();
+
+    for (auto& parameter : node.parameters) {
+      gd::String variableName;
+      if (!isPure && GetVariableName(*parameter, variableName)) {
+        // The scope of the variable is not checked, to be conservative.
+        writtenSceneVariables.insert(variableName);
+        writtenGlobalVariables.insert(variableName);
+      }
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  const gd::EventsCodeGenerator& codeGenerator;
+  std::set<gd::String>& writtenSceneVariables;
+  std::set<gd::String>& writtenGlobalVariables;
+  bool allModificationsKnown;
+};
+
+/**
+ * \brief Check if an expression gives the same result at each iteration of a
+ * loop.
+ */
+class ExpressionInvariantChecker : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionInvariantChecker(const gd::EventsCodeGenerator& codeGenerator_,
+                             const gd::LoopInvariants& loopInvariants_)
+      : codeGenerator(codeGenerator_),
+        loopInvariants(loopInvariants_),
+        isInvariant(true){};
+  virtual ~ExpressionInvariantChecker(){};
+
+  bool IsInvariant() const { return isInvariant; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    // Variables are only checked when given to a function (see below).
+    isInvariant = false;
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    isInvariant = false;
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    isInvariant = false;
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    if (!node.objectName.empty() ||
+        codeGenerator.IsEventsFunctionCall(node)) {
+      isInvariant = false;
+      return;
+    }
+
+    const gd::ExpressionMetadata& metadata =
+        MetadataProvider::GetFunctionCallMetadata(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            node);
+    if (MetadataProvider::IsBadExpressionMetadata(metadata) ||
+        !metadata.IsPure() ||
+        metadata.codeExtraInformation.HasCustomCodeGenerator()) {
+      isInvariant = false;
+      return;
+    }
+
+    std::size_t parameterIndex = 0;
+    for (const auto& parameterMetadata : metadata.parameters) {
+      if (parameterMetadata.IsCodeOnly()) continue;
+      if (parameterIndex >= node.parameters.size()) break;
+
+      ExpressionNode& parameter = *node.parameters[parameterIndex];
+      const gd::String& type = parameterMetadata.GetType();
+      if (gd::ParameterMetadata::IsExpression("variable", type)) {
+        CheckVariable(parameter, type);
+      } else {
+        parameter.Visit(*this);
+      }
+      parameterIndex++;
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { isInvariant = false; }
+
+ private:
+  void CheckVariable(ExpressionNode& node, const gd::String& type) {
+    gd::String variableName;
+    if ((type != "scenevar" && type != "globalvar") ||
+        !GetVariableName(node, variableName) ||
+        !loopInvariants.IsVariableValueInvariant(variableName,
+                                                 type == "globalvar")) {
+      isInvariant = false;
+      return;
+    }
+
+    VariableNode* variable = dynamic_cast<VariableNode*>(&node);
+    if (variable && variable->child) variable->child->Visit(*this);
+  }
+
+  const gd::EventsCodeGenerator& codeGenerator;
+  const gd::LoopInvariants& loopInvariants;
+  bool isInvariant;
+};
+
+}  // namespace
+
+void LoopInvariants::FindWrittenVariables(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::BaseEvent& loopEvent) {
+  writtenSceneVariables.clear();
+  writtenGlobalVariables.clear();
+  variablesValuesInvariant =
+      codeGenerator.HasProjectAndLayout() &&
+      FindEventWrittenVariables(codeGenerator, loopEvent);
+}
+
+bool LoopInvariants::FindEventWrittenVariables(
+    const gd::EventsCodeGenerator& codeGenerator, const gd::BaseEvent& event) {
+  // Other events (like JavaScript events) can run any code.
+  if (!dynamic_cast<const gd::StandardEvent*>(&event) &&
+      !dynamic_cast<const gd::CommentEvent*>(&event) &&
+      !dynamic_cast<const gd::GroupEvent*>(&event) &&
+      !dynamic_cast<const gd::WhileEvent*>(&event) &&
+      !dynamic_cast<const gd::RepeatEvent*>(&event) &&
+      !dynamic_cast<const gd::ForEachEvent*>(&event) &&
+      !dynamic_cast<const gd::ForEachChildVariableEvent*>(&event))
+    return false;
+
+  const gd::ForEachChildVariableEvent* forEachChildVariableEvent =
+      dynamic_cast<const gd::ForEachChildVariableEvent*>(&event);
+  if (forEachChildVariableEvent) {
+    writtenSceneVariables.insert(
+        forEachChildVariableEvent->GetValueIteratorVariableName());
+    writtenSceneVariables.insert(
+        forEachChildVariableEvent->GetKeyIteratorVariableName());
+  }
+
+  for (const gd::InstructionsList* conditions :
+       event.GetAllConditionsVectors()) {
+    if (!FindWrittenVariables(codeGenerator, *conditions, true)) return false;
+  }
+  for (const gd::InstructionsList* actions : event.GetAllActionsVectors()) {
+    if (!FindWrittenVariables(codeGenerator, *actions, false)) return false;
+  }
+  for (const auto& expressionAndMetadata :
+       event.GetAllExpressionsWithMetadata()) {
+    if (!FindWrittenVariables(codeGenerator, *expressionAndMetadata.first))
+      return false;
+  }
+
+  if (event.CanHaveSubEvents()) {
+    const gd::EventsList& subEvents = event.GetSubEvents();
+    for (std::size_t i = 0; i < subEvents.size(); ++i) {
+      if (!FindEventWrittenVariables(codeGenerator, subEvents[i]))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+bool LoopInvariants::FindWrittenVariables(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::InstructionsList& instructions,
+    bool areConditions) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    const gd::Instruction& instruction = instructions[i];
+    if (codeGenerator.IsEventsFunctionCall(instruction)) return false;
+
+    const gd::InstructionMetadata& metadata =
+        areConditions
+            ? MetadataProvider::GetConditionMetadata(
+                  codeGenerator.GetPlatform(), instruction.GetType())
+            : MetadataProvider::GetActionMetadata(codeGenerator.GetPlatform(),
+                                                  instruction.GetType());
+
+    bool allModificationsKnown = true;
+    gd::ParameterMetadataTools::IterateOverParameters(
+        instruction.GetParameters(),
+        metadata.parameters,
+        [&](const gd::ParameterMetadata& parameterMetadata,
+            const gd::Expression& parameterValue,
+            const gd::String& lastObjectName) {
+          const gd::String& type = parameterMetadata.GetType();
+          if (gd::ParameterMetadata::IsExpression("number", type) ||
+              gd::ParameterMetadata::IsExpression("string", type) ||
+              gd::ParameterMetadata::IsExpression("variable", type)) {
+            if (!FindWrittenVariables(codeGenerator, parameterValue))
+              allModificationsKnown = false;
+          }
+          // Conditions are considered to only read their parameters.
+          if (areConditions) return;
+
+          if (type == "scenevar" || type == "globalvar") {
+            gd::String variableName;
+            auto node = parameterValue.GetRootNode();
+            if (!node || !GetVariableName(*node, variableName))
+              allModificationsKnown = false;
+            else if (type == "scenevar")
+              writtenSceneVariables.insert(variableName);
+            else
+              writtenGlobalVariables.insert(variableName);
+          } else if (gd::ParameterMetadata::IsObject(type)) {
+            if (HasEventsBasedBehaviors(codeGenerator,
+                                        parameterValue.GetPlainString()))
+              allModificationsKnown = false;
+          } else if (type == "externalLayoutName") {
+            // Objects created from an external layout can have events based
+            // behaviors.
+            allModificationsKnown = false;
+          }
+        });
+    if (!allModificationsKnown) return false;
+
+    if (!FindWrittenVariables(
+            codeGenerator, instruction.GetSubInstructions(), areConditions))
+      return false;
+  }
+
+  return true;
+}
+
+bool LoopInvariants::FindWrittenVariables(
+    const gd::EventsCodeGenerator& codeGenerator,
+    const gd::Expression& expression) {
+  auto node = expression.GetRootNode();
+  if (!node) return false;
+
+  ExpressionWrittenVariablesFinder finder(
+      codeGenerator, writtenSceneVariables, writtenGlobalVariables);
+  node->Visit(finder);
+  return finder.AreAllModificationsKnown();
+}
+
+bool LoopInvariants::IsVariableValueInvariant(const gd::String& variableName,
+                                              bool isGlobal) const {
+  if (!variablesValuesInvariant) return false;
+
+  const std::set<gd::String>& writtenVariables =
+      isGlobal ? writtenGlobalVariables : writtenSceneVariables;
+  return writtenVariables.find(variableName) == writtenVariables.end();
+}
+
+bool LoopInvariants::IsInvariant(const gd::EventsCodeGenerator& codeGenerator,
+                                 gd::FunctionCallNode& node) const {
+  ExpressionInvariantChecker checker(codeGenerator, *this);
+  node.Visit(checker);
+  return checker.IsInvariant();
+}
+
+gd::String LoopInvariants::Hoist(const gd::String& code) {
+  auto existingCode = hoistedCodesIndices.find(code);
+  if (existingCode != hoistedCodesIndices.end())
+    return hoistedCodes[existingCode->second].first;
+
+  gd::String name = namePrefix + gd::String::From(hoistedCodes.size());
+  hoistedCodesIndices[code] = hoistedCodes.size();
+  hoistedCodes.push_back(std::make_pair(name, code));
+  return name;
+}
+
+}  // namespace gd
@@ -0,0 +1,123 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_LOOPINVARIANTS_H
+#define GDCORE_LOOPINVARIANTS_H
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class EventsCodeGenerator;
+class Expression;
+class Instruction;
+class InstructionsList;
+struct FunctionCallNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Store the code of the expressions of a loop that give the same
+ * result at each iteration, so that they are evaluated only once, before the
+ * loop.
+ *
+ * Code generators of loop events give it to the context used for the
+ * conditions, actions and sub-events of the loop (see
+ * gd::EventsCodeGenerationContext::SetLoopInvariants), then output the code
+ * of the hoisted expressions (see GetHoistedCodes) before the loop.
+ *
+ * The following are hoisted:
+ * - the references to scene and global variables, which are always the same
+ *   objects,
+ * - the calls to pure free functions (see gd::ExpressionMetadata::IsPure),
+ *   when their parameters are constants or variables not modified by the loop
+ *   (see FindWrittenVariables).
+ *
+ * \see gd::ExpressionCodeGenerator
+ */
+class GD_CORE_API LoopInvariants {
+ public:
+  /**
+   * \param namePrefix_ The prefix of the names of the variables holding the
+   * values of the hoisted expressions.
+   */
+  LoopInvariants(const gd::String& namePrefix_)
+      : namePrefix(namePrefix_), variablesValuesInvariant(false){};
+  virtual ~LoopInvariants(){};
+
+  /**
+   * \brief Find the scene and global variables that can be modified by the
+   * conditions, actions and sub-events of the loop event.
+   *
+   * The values of variables can only be hoisted if all the modifications are
+   * known. This is not the case when the loop calls functions of events
+   * functions extensions, contains JavaScript events, or acts on objects
+   * having events based behaviors (which can run events when objects are
+   * created or deleted). This is also not the case in events functions, as
+   * calls to other functions can't be recognized without the project.
+   */
+  void FindWrittenVariables(const gd::EventsCodeGenerator& codeGenerator,
+                            const gd::BaseEvent& loopEvent);
+
+  /**
+   * \brief Return true if the value of the scene variable (or of the global
+   * variable, if \a isGlobal is true) is the same at each iteration.
+   */
+  bool IsVariableValueInvariant(const gd::String& variableName,
+                                bool isGlobal) const;
+
+  /**
+   * \brief Return true if the function call gives the same result at each
+   * iteration of the loop: the function is pure and all its parameters are
+   * constants or invariant variables.
+   */
+  bool IsInvariant(const gd::EventsCodeGenerator& codeGenerator,
+                   gd::FunctionCallNode& node) const;
+
+  /**
+   * \brief Hoist the code out of the loop.
+   *
+   * \return The name of the variable holding the value of the code (the same
+   * code is only hoisted once).
+   */
+  gd::String Hoist(const gd::String& code);
+
+  /**
+   * \brief Return the hoisted codes, with the names of the variables holding
+   * their values, in the order they must be evaluated.
+   */
+  const std::vector<std::pair<gd::String, gd::String> >& GetHoistedCodes()
+      const {
+    return hoistedCodes;
+  }
+
+ private:
+  bool FindWrittenVariables(const gd::EventsCodeGenerator& codeGenerator,
+                            const gd::InstructionsList& instructions,
+                            bool areConditions);
+  bool FindWrittenVariables(const gd::EventsCodeGenerator& codeGenerator,
+                            const gd::Expression& expression);
+  bool FindEventWrittenVariables(const gd::EventsCodeGenerator& codeGenerator,
+                                 const gd::BaseEvent& event);
+
+  gd::String namePrefix;
+  bool variablesValuesInvariant;  ///< False if the modifications of the
+                                  ///< variables by the loop are unknown.
+  std::set<gd::String> writtenSceneVariables;
+  std::set<gd::String> writtenGlobalVariables;
+  std::vector<std::pair<gd::String, gd::String> >
+      hoistedCodes;  ///< The names and codes of the hoisted expressions.
+  std::map<gd::String, std::size_t>
+      hoistedCodesIndices;  ///< The index of each code in hoistedCodes.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_LOOPINVARIANTS_H
@@ -0,0 +1,175 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * \brief Find the objects passed as parameters to functions, which receive
+ * their lists.
+ */
+class ExpressionObjectParametersFinder : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionObjectParametersFinder(std::vector<gd::String>& objectNames_)
+      : objectNames(objectNames_){};
+  virtual ~ExpressionObjectParametersFinder(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    for (auto& parameter : node.parameters) {
+      IdentifierNode* identifier =
+          dynamic_cast<IdentifierNode*>(parameter.get());
+      if (identifier)
+        objectNames.push_back(identifier->identifierName);
+      else
+        parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  std::vector<gd::String>& objectNames;
+};
+
+bool IsObjectsListParameter(const gd::String& type) {
+  return type == "objectList" || type == "objectListOrEmptyIfJustDeclared" ||
+         type == "objectListOrEmptyWithoutPicking";
+}
+
+}  // namespace
+
+bool ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+    const gd::Platform& platform,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::BaseEvent& event,
+    std::set<gd::String>& modifiedObjectsLists) {
+  const gd::StandardEvent* standardEvent =
+      dynamic_cast<const gd::StandardEvent*>(&event);
+  if (!standardEvent) return false;
+
+  ModifiedObjectsListsFinder finder(platform,
+                                    globalObjectsContainer,
+                                    objectsContainer,
+                                    modifiedObjectsLists);
+  return finder.VisitInstructions(standardEvent->GetConditions(), true) &&
+         finder.VisitInstructions(standardEvent->GetActions(), false);
+}
+
+bool ModifiedObjectsListsFinder::VisitInstructions(
+    const gd::InstructionsList& instructions, bool areConditions) {
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    if (!VisitInstruction(instructions[i], areConditions)) return false;
+  }
+
+  return true;
+}
+
+bool ModifiedObjectsListsFinder::VisitInstruction(
+    const gd::Instruction& instruction, bool isCondition) {
+  const gd::InstructionMetadata& metadata =
+      isCondition ? MetadataProvider::GetConditionMetadata(
+                        platform, instruction.GetType())
+                  : MetadataProvider::GetActionMetadata(platform,
+                                                        instruction.GetType());
+  // The objects lists are given to the callback of asynchronous actions.
+  if (!isCondition && metadata.IsAsync()) return false;
+
+  bool hasCustomCodeGenerator =
+      metadata.codeExtraInformation.HasCustomCodeGenerator();
+  gd::ParameterMetadataTools::IterateOverParameters(
+      instruction.GetParameters(),
+      metadata.parameters,
+      [&](const gd::ParameterMetadata& parameterMetadata,
+          const gd::Expression& parameterValue,
+          const gd::String& lastObjectName) {
+        const gd::String& type = parameterMetadata.GetType();
+        if (gd::ParameterMetadata::IsObject(type)) {
+          // Actions are launched on each object of the list, without
+          // modifying it.
+          if (isCondition || hasCustomCodeGenerator ||
+              IsObjectsListParameter(type))
+            AddModifiedObjectsList(parameterValue.GetPlainString());
+        } else if (gd::ParameterMetadata::IsExpression("number", type) ||
+                   gd::ParameterMetadata::IsExpression("string", type) ||
+                   gd::ParameterMetadata::IsExpression("variable", type)) {
+          std::vector<gd::String> objectNames;
+          ExpressionObjectParametersFinder objectParametersFinder(objectNames);
+          parameterValue.GetRootNode()->Visit(objectParametersFinder);
+          for (const gd::String& objectName : objectNames)
+            AddModifiedObjectsList(objectName);
+        }
+      });
+
+  return VisitInstructions(instruction.GetSubInstructions(), isCondition);
+}
+
+void ModifiedObjectsListsFinder::AddModifiedObjectsList(
+    const gd::String& objectOrGroupName) {
+  for (const gd::String& objectName : ExpandObjectsName(objectOrGroupName))
+    modifiedObjectsLists.insert(objectName);
+}
+
+std::vector<gd::String> ModifiedObjectsListsFinder::ExpandObjectsName(
+    const gd::String& objectOrGroupName) const {
+  // Note: this logic is similar to EventsCodeGenerator::ExpandObjectsName
+  // (without the handling of the current object, to find all the objects).
+  std::vector<gd::String> realObjects;
+  if (globalObjectsContainer.GetObjectGroups().Has(objectOrGroupName))
+    realObjects = globalObjectsContainer.GetObjectGroups()
+                      .Get(objectOrGroupName)
+                      .GetAllObjectsNames();
+  else if (objectsContainer.GetObjectGroups().Has(objectOrGroupName))
+    realObjects = objectsContainer.GetObjectGroups()
+                      .Get(objectOrGroupName)
+                      .GetAllObjectsNames();
+  else
+    realObjects.push_back(objectOrGroupName);
+
+  return realObjects;
+}
+
+}  // namespace gd
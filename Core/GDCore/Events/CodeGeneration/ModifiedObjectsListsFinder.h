@@ -0,0 +1,84 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_MODIFIEDOBJECTSLISTSFINDER_H
+#define GDCORE_MODIFIEDOBJECTSLISTSFINDER_H
+
+#include <set>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class BaseEvent;
+class Instruction;
+class InstructionsList;
+class ObjectsContainer;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the objects lists that the conditions and actions of an event
+ * can filter or modify.
+ *
+ * The other objects lists used by the event are only read: the code generator
+ * can use the lists of the parent events for them instead of copying them (see
+ * gd::EventsCodeGenerationContext::AllowObjectsListsSharing).
+ *
+ * The analysis is conservative: a list is considered as modified when:
+ * - the object is used by a condition (conditions filter the objects),
+ * - the object is passed as a list to an action (which can pick objects, or
+ *   add the objects it creates to the list),
+ * - the object is passed as a parameter to a function in an expression,
+ * - the object is used by an instruction with a custom code generator.
+ *
+ * Sub-events are not analyzed, as they have their own objects lists.
+ *
+ * \see gd::EventsCodeGenerator
+ */
+class GD_CORE_API ModifiedObjectsListsFinder {
+ public:
+  /**
+   * \brief Find the objects lists that can be modified by the conditions and
+   * actions of the event. Groups are replaced by their objects.
+   *
+   * \return false if the event can't be analyzed: only standard events
+   * without asynchronous actions are supported.
+   */
+  static bool FindModifiedObjectsLists(
+      const gd::Platform& platform,
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer,
+      const gd::BaseEvent& event,
+      std::set<gd::String>& modifiedObjectsLists);
+
+ private:
+  ModifiedObjectsListsFinder(
+      const gd::Platform& platform_,
+      const gd::ObjectsContainer& globalObjectsContainer_,
+      const gd::ObjectsContainer& objectsContainer_,
+      std::set<gd::String>& modifiedObjectsLists_)
+      : platform(platform_),
+        globalObjectsContainer(globalObjectsContainer_),
+        objectsContainer(objectsContainer_),
+        modifiedObjectsLists(modifiedObjectsLists_){};
+
+  bool VisitInstructions(const gd::InstructionsList& instructions,
+                         bool areConditions);
+  bool VisitInstruction(const gd::Instruction& instruction, bool isCondition);
+  void AddModifiedObjectsList(const gd::String& objectOrGroupName);
+  std::vector<gd::String> ExpandObjectsName(
+      const gd::String& objectOrGroupName) const;
+
+  const gd::Platform& platform;
+  const gd::ObjectsContainer& globalObjectsContainer;
+  const gd::ObjectsContainer& objectsContainer;
+  std::set<gd::String>& modifiedObjectsLists;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_MODIFIEDOBJECTSLISTSFINDER_H
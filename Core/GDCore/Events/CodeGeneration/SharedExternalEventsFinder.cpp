@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/CodeGeneration/SharedExternalEventsFinder.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+
+namespace gd {
+
+bool SharedExternalEventsFinder::CanBeShared(
+    const gd::ExternalEvents& externalEvents) {
+  return !HasLinks(externalEvents.GetEvents());
+}
+
+bool SharedExternalEventsFinder::HasLinks(const gd::EventsList& events) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events.GetEvent(i);
+    if (event.IsDisabled()) continue;
+
+    if (dynamic_cast<const gd::LinkEvent*>(&event)) return true;
+    if (event.CanHaveSubEvents() && HasLinks(event.GetSubEvents()))
+      return true;
+  }
+
+  return false;
+}
+
+std::set<gd::String> SharedExternalEventsFinder::FindExternalEventsToCall(
+    const gd::Project& project, const gd::Layout& layout) {
+  std::vector<gd::String> linkedTargets;
+  std::map<gd::String, LinksUsage> usages;
+  FindLinksUsages(project, layout.GetEvents(), true, linkedTargets, usages);
+
+  std::set<gd::String> externalEventsToCall;
+  for (const auto& it : usages) {
+    const LinksUsage& usage = it.second;
+    if (usage.mustBeCopied || usage.linksCount != 1) continue;
+    if (!CanBeShared(project.GetExternalEvents(it.first))) continue;
+
+    externalEventsToCall.insert(it.first);
+  }
+
+  return externalEventsToCall;
+}
+
+void SharedExternalEventsFinder::FindLinksUsages(
+    const gd::Project& project,
+    const gd::EventsList& events,
+    bool isAtRoot,
+    std::vector<gd::String>& linkedTargets,
+    std::map<gd::String, LinksUsage>& usages) {
+  for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+    const gd::BaseEvent& event = events.GetEvent(i);
+    if (event.IsDisabled()) continue;
+
+    const gd::LinkEvent* linkEvent = dynamic_cast<const gd::LinkEvent*>(&event);
+    if (linkEvent) {
+      const gd::String& target = linkEvent->GetTarget();
+      if (project.HasExternalEventsNamed(target)) {
+        LinksUsage& usage = usages[target];
+        usage.linksCount++;
+        if (!isAtRoot ||
+            linkEvent->GetIncludeConfig() != gd::LinkEvent::INCLUDE_ALL)
+          usage.mustBeCopied = true;
+      }
+
+      // The linked events can themselves contain links, which are copied at
+      // the same place. Links forming a cycle are not followed again.
+      const gd::EventsList* linkedEvents = linkEvent->GetLinkedEvents(project);
+      if (linkedEvents &&
+          std::find(linkedTargets.begin(), linkedTargets.end(), target) ==
+              linkedTargets.end()) {
+        linkedTargets.push_back(target);
+        FindLinksUsages(
+            project, *linkedEvents, isAtRoot, linkedTargets, usages);
+        linkedTargets.pop_back();
+      }
+      continue;
+    }
+
+    // Only groups are generated in the same context as their parent.
+    if (event.CanHaveSubEvents()) {
+      bool subEventsAreAtRoot =
+          isAtRoot && dynamic_cast<const gd::GroupEvent*>(&event) != nullptr;
+      FindLinksUsages(project,
+                      event.GetSubEvents(),
+                      subEventsAreAtRoot,
+                      linkedTargets,
+                      usages);
+    }
+  }
+}
+
+}  // namespace gd
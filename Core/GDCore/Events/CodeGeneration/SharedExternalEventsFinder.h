@@ -0,0 +1,76 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SHAREDEXTERNALEVENTSFINDER_H
+#define GDCORE_SHAREDEXTERNALEVENTSFINDER_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class EventsList;
+class ExternalEvents;
+class Layout;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Find the external events that a scene can run by calling a function
+ * shared by all the scenes, instead of copying them in its events (see
+ * gd::LinkEvent::ReplaceLinkByLinkedEvents).
+ *
+ * A scene can call the function of external events when:
+ * - the external events don't contain links themselves (see CanBeShared),
+ * - the scene links all the external events only once, directly in its events
+ *   (or in groups), so that they don't depend on the objects picked by a
+ *   parent event. This also ensures that the states of the "Trigger once"
+ *   conditions are not shared by several links.
+ *
+ * Other links are still replaced by the linked events.
+ *
+ * \see gd::EventsCodeGenerator::SetSharedExternalEventsFunctions
+ */
+class GD_CORE_API SharedExternalEventsFinder {
+ public:
+  /**
+   * \brief Return true if the external events can be generated in a function
+   * shared by the scenes: they must not contain any link.
+   */
+  static bool CanBeShared(const gd::ExternalEvents& externalEvents);
+
+  /**
+   * \brief Return the names of the external events that the scene can run by
+   * calling a shared function.
+   */
+  static std::set<gd::String> FindExternalEventsToCall(
+      const gd::Project& project, const gd::Layout& layout);
+
+ private:
+  /**
+   * \brief How a scene links external events.
+   */
+  struct LinksUsage {
+    LinksUsage() : linksCount(0), mustBeCopied(false){};
+
+    std::size_t linksCount;
+    bool mustBeCopied;  ///< True if a link depends on its parent events or
+                        ///< includes only a part of the external events.
+  };
+
+  static bool HasLinks(const gd::EventsList& events);
+  static void FindLinksUsages(const gd::Project& project,
+                              const gd::EventsList& events,
+                              bool isAtRoot,
+                              std::vector<gd::String>& linkedTargets,
+                              std::map<gd::String, LinksUsage>& usages);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SHAREDEXTERNALEVENTSFINDER_H
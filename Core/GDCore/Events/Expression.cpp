@@ -14,7 +14,7 @@ namespace gd {
 Expression::Expression() : node(nullptr) {};
 
 Expression::Expression(gd::String plainString_)
-    : node(nullptr), plainString(plainString_) {};
+    : node(nullptr), plainString(std::move(plainString_)) {};
 
 Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
@@ -28,6 +28,15 @@ Expression& Expression::operator=(const Expression& expression) {
   return *this;
 };
 
+Expression::Expression(Expression&& other) noexcept
+    : node(std::move(other.node)), plainString(std::move(other.plainString)) {};
+
+Expression& Expression::operator=(Expression&& expression) noexcept {
+  plainString = std::move(expression.plainString);
+  node = std::move(expression.node);
+  return *this;
+};
+
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
@@ -54,6 +54,16 @@ class GD_CORE_API Expression {
    */
   Expression& operator=(const Expression& expression);
 
+  /**
+   * \brief Move construct an expression, keeping its parsed expression node.
+   */
+  Expression(Expression&& other) noexcept;
+
+  /**
+   * \brief Move an expression, keeping its parsed expression node.
+   */
+  Expression& operator=(Expression&& expression) noexcept;
+
   /**
    * \brief Get the plain string representing the expression
    */
@@ -70,7 +80,7 @@ class GD_CORE_API Expression {
    */
   inline const char* c_str() const { return plainString.c_str(); };
 
-  virtual ~Expression();
+  ~Expression();
 
  private:
   gd::String plainString;  ///< The expression string
@@ -8,6 +8,9 @@
 #include <assert.h>
 
 #include <iostream>
+#include <mutex>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include "GDCore/Events/Expression.h"
@@ -18,17 +21,35 @@ namespace gd {
 
 gd::Expression Instruction::badExpression("");
 
-Instruction::Instruction(gd::String type_) : type(type_), inverted(false) {
+Instruction::Instruction(gd::String type_)
+    : type(GetInternedType(type_)), inverted(false) {
   parameters.reserve(8);
 }
 
 Instruction::Instruction(gd::String type_,
                          const std::vector<gd::Expression>& parameters_,
                          bool inverted_)
-    : type(type_), inverted(inverted_), parameters(parameters_) {
+    : type(GetInternedType(type_)),
+      inverted(inverted_),
+      parameters(parameters_) {
   parameters.reserve(8);
 }
 
+Instruction::Instruction(gd::String type_,
+                         std::vector<gd::Expression>&& parameters_,
+                         bool inverted_)
+    : type(GetInternedType(type_)),
+      inverted(inverted_),
+      parameters(std::move(parameters_)) {}
+
+const gd::String* Instruction::GetInternedType(const gd::String& type) {
+  // Never destroyed, as instructions can be destroyed after it otherwise.
+  static std::set<gd::String>* types = new std::set<gd::String>();
+  static std::mutex* typesMutex = new std::mutex();
+  std::lock_guard<std::mutex> lock(*typesMutex);
+  return &*types->insert(type).first;
+}
+
 const gd::Expression& Instruction::GetParameter(std::size_t index) const {
   if (index >= parameters.size()) return badExpression;
 
@@ -6,6 +6,7 @@
 #ifndef INSTRUCTION_H
 #define INSTRUCTION_H
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "GDCore/Events/Expression.h"
@@ -46,19 +47,34 @@ class GD_CORE_API Instruction {
               const std::vector<gd::Expression>& parameters_,
               bool inverted = false);
 
-  virtual ~Instruction(){};
+  /**
+   * \brief Constructor, moving the parameters into the instruction.
+   * \param type The type of the instruction
+   * \param parameters A vector containing the parameters of the instruction
+   * \param inverted true to set the instruction as inverted (used for condition
+   * instructions).
+   */
+  Instruction(gd::String type_,
+              std::vector<gd::Expression>&& parameters_,
+              bool inverted = false);
+
+  Instruction(const Instruction&) = default;
+  Instruction(Instruction&&) = default;
+  Instruction& operator=(const Instruction&) = default;
+  Instruction& operator=(Instruction&&) = default;
+  ~Instruction(){};
 
   /**
    * \brief Return the type of the instruction.
    * \return The type of the instruction
    */
-  const gd::String& GetType() const { return type; }
+  const gd::String& GetType() const { return *type; }
 
   /**
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType) { type = GetInternedType(newType); }
 
   /**
    * \brief Return true if the condition is inverted
@@ -142,6 +158,14 @@ class GD_CORE_API Instruction {
     parameters = val;
   }
 
+  /** \brief Replace all the parameters by new ones, moved into the
+   * instruction.
+   * \param val A vector containing the new parameters.
+   */
+  inline void SetParameters(std::vector<gd::Expression>&& val) {
+    parameters = std::move(val);
+  }
+
   /**
    * \brief Return a reference to the vector containing sub instructions
    */
@@ -168,7 +192,17 @@ class GD_CORE_API Instruction {
       std::shared_ptr<Instruction> instruction);
 
  private:
-  gd::String type;  ///< Instruction type
+  /**
+   * \brief Return the unique copy of the type, shared by all the instructions
+   * having this type.
+   *
+   * \note This is thread-safe: instructions can be created by several
+   * threads at the same time.
+   */
+  static const gd::String* GetInternedType(const gd::String& type);
+
+  const gd::String* type;  ///< Instruction type (interned, as there are a lot
+                           ///< of instructions and a few different types).
   bool inverted;  ///< True if the instruction if inverted. Only applicable for
                   ///< instruction used as conditions by events
   bool awaitAsync =
@@ -6,11 +6,13 @@
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -27,9 +29,289 @@ namespace gd {
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
+    : expression(),
       currentPosition(0) {}
 
+namespace {
+/**
+ * \brief Shift the locations of the nodes after an edited part of an
+ * expression.
+ */
+class GD_CORE_API ExpressionLocationsShifter
+    : public ExpressionParser2NodeWorker {
+ public:
+  ExpressionLocationsShifter(size_t fromPosition_, std::ptrdiff_t offset_)
+      : fromPosition(fromPosition_), offset(offset_){};
+  virtual ~ExpressionLocationsShifter(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    ShiftNode(node);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    ShiftNode(node);
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    ShiftNode(node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override { ShiftNode(node); }
+  void OnVisitTextNode(TextNode& node) override { ShiftNode(node); }
+  void OnVisitVariableNode(VariableNode& node) override {
+    ShiftNode(node);
+    Shift(node.nameLocation);
+    if (node.child) ShiftVariableAccessor(*node.child);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    Shift(node.nameLocation);
+    Shift(node.dotLocation);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    ShiftNode(node);
+    Shift(node.identifierNameLocation);
+    Shift(node.identifierNameDotLocation);
+    Shift(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    ShiftNode(node);
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.objectFunctionOrBehaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    ShiftNode(node);
+    Shift(node.functionNameLocation);
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.behaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.openingParenthesisLocation);
+    Shift(node.closingParenthesisLocation);
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override { ShiftNode(node); }
+
+ private:
+  void ShiftVariableAccessor(
+      VariableAccessorOrVariableBracketAccessorNode& node) {
+    // The last accessor has no type (and does nothing when visited).
+    ShiftNode(node);
+    node.Visit(*this);
+    if (node.child) ShiftVariableAccessor(*node.child);
+  }
+
+  void ShiftNode(ExpressionNode& node) {
+    Shift(node.location);
+    if (node.diagnostic && node.diagnostic->IsError()) {
+      auto& error = static_cast<ExpressionParserError&>(*node.diagnostic);
+      ExpressionParserLocation location = error.GetLocation();
+      Shift(location);
+      error.SetLocation(location);
+    }
+  }
+
+  void Shift(ExpressionParserLocation& location) {
+    if (!location.IsValid()) return;
+
+    location = ExpressionParserLocation(Shift(location.GetStartPosition()),
+                                        Shift(location.GetEndPosition()));
+  }
+
+  size_t Shift(size_t position) {
+    return position >= fromPosition ? position + offset : position;
+  }
+
+  size_t fromPosition;
+  std::ptrdiff_t offset;
+};
+
+/**
+ * \brief A part of an expression that can be parsed again on its own: a
+ * sub-expression or a parameter of a function.
+ */
+struct ReparseableSpan {
+  size_t startPosition;
+  size_t endPosition;  ///< The position of the character ending the span.
+  SubExpressionNode* subExpression;
+  FunctionCallNode* function;
+  size_t parameterIndex;
+};
+
+/**
+ * \brief Find the parts of an expression that can be parsed again on their
+ * own and that contain an edit, from the largest to the smallest.
+ */
+class GD_CORE_API ReparseableSpansFinder : public ExpressionParser2NodeWorker {
+ public:
+  ReparseableSpansFinder(const std::u32string& expression_,
+                         size_t editStartPosition_,
+                         size_t editEndPosition_)
+      : expression(expression_),
+        editStartPosition(editStartPosition_),
+        editEndPosition(editEndPosition_){};
+  virtual ~ReparseableSpansFinder(){};
+
+  const std::vector<ReparseableSpan>& GetSpans() const { return spans; }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    // Sub-expressions without their closing parenthesis are not reparsed, as
+    // the error is on the node of the sub-expression.
+    const ExpressionParserLocation& location = node.location;
+    if (location.IsValid() &&
+        location.GetEndPosition() < expression.size() &&
+        expression[location.GetEndPosition()] == ')')
+      AddSpan(ReparseableSpan{location.GetStartPosition(),
+                              location.GetEndPosition(),
+                              &node,
+                              nullptr,
+                              0});
+
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {}
+  void OnVisitVariableNode(VariableNode& node) override {
+    for (auto* child = node.child.get(); child; child = child->child.get())
+      child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {}
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    // The parameters are between the parenthesis and the commas.
+    size_t parameterStartPosition =
+        node.openingParenthesisLocation.GetEndPosition();
+    bool isParameterStartValid = node.openingParenthesisLocation.IsValid();
+    for (size_t i = 0; i < node.parameters.size(); ++i) {
+      const ExpressionParserLocation& location = node.parameters[i]->location;
+
+      size_t parameterEndPosition = 0;
+      bool isParameterEndValid = false;
+      if (i + 1 == node.parameters.size()) {
+        parameterEndPosition =
+            node.closingParenthesisLocation.GetStartPosition();
+        isParameterEndValid = node.closingParenthesisLocation.IsValid();
+      } else if (location.IsValid()) {
+        parameterEndPosition = location.GetEndPosition();
+        while (parameterEndPosition < expression.size() &&
+               IsWhitespace(expression[parameterEndPosition]))
+          parameterEndPosition++;
+        isParameterEndValid = parameterEndPosition < expression.size() &&
+                              expression[parameterEndPosition] == ',';
+      }
+
+      if (isParameterStartValid && isParameterEndValid)
+        AddSpan(ReparseableSpan{parameterStartPosition,
+                                parameterEndPosition,
+                                nullptr,
+                                &node,
+                                i});
+
+      node.parameters[i]->Visit(*this);
+
+      parameterStartPosition = parameterEndPosition + 1;
+      isParameterStartValid = isParameterEndValid;
+    }
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+ private:
+  static bool IsWhitespace(char32_t character) {
+    return character == ' ' || character == '\n' || character == '\r';
+  }
+
+  void AddSpan(const ReparseableSpan& span) {
+    // Empty spans are not used, as an insertion in them could not be
+    // distinguished from an insertion before or after them.
+    if (span.startPosition < span.endPosition &&
+        span.startPosition <= editStartPosition &&
+        editEndPosition <= span.endPosition)
+      spans.push_back(span);
+  }
+
+  const std::u32string& expression;
+  size_t editStartPosition;
+  size_t editEndPosition;
+  std::vector<ReparseableSpan> spans;
+};
+}  // namespace
+
+std::unique_ptr<ExpressionNode> ExpressionParser2::ReparseExpression(
+    const gd::String& previousExpression,
+    std::unique_ptr<ExpressionNode> previousNode,
+    size_t editStartPosition,
+    size_t editEndPosition,
+    const gd::String& replacement) {
+  std::u32string previous = previousExpression.ToUTF32();
+  editEndPosition = std::min(editEndPosition, previous.size());
+  editStartPosition = std::min(editStartPosition, editEndPosition);
+  std::u32string replacement32 = replacement.ToUTF32();
+  expression = previous.substr(0, editStartPosition) + replacement32 +
+               previous.substr(editEndPosition);
+  std::ptrdiff_t offset =
+      static_cast<std::ptrdiff_t>(replacement32.size()) -
+      static_cast<std::ptrdiff_t>(editEndPosition - editStartPosition);
+
+  if (previousNode) {
+    ReparseableSpansFinder finder(
+        previous, editStartPosition, editEndPosition);
+    previousNode->Visit(finder);
+
+    // Try the smallest part first: the parsing of the text before a part
+    // does not depend on its content, and the parsing after it is unchanged
+    // if the new content is parsed up to the same character ending it.
+    const std::vector<ReparseableSpan>& spans = finder.GetSpans();
+    for (auto span = spans.rbegin(); span != spans.rend(); ++span) {
+      size_t newEndPosition = span->endPosition + offset;
+      currentPosition = span->startPosition;
+      if (span->function) {
+        // Empty parameters are parsed differently (see Parameters).
+        SkipAllWhitespaces();
+        if (IsEndReached() || CheckIfChar(IsParameterSeparator) ||
+            CheckIfChar(IsClosingParenthesis))
+          continue;
+      }
+
+      std::unique_ptr<ExpressionNode> node = Expression();
+      if (currentPosition != newEndPosition) continue;
+
+      ExpressionLocationsShifter shifter(span->endPosition, offset);
+      previousNode->Visit(shifter);
+      if (span->function) {
+        node->parent = span->function;
+        span->function->parameters[span->parameterIndex] = std::move(node);
+      } else {
+        span->subExpression->expression = std::move(node);
+      }
+      return previousNode;
+    }
+  }
+
+  currentPosition = 0;
+  return Start();
+}
+
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
   size_t textStartPosition = GetCurrentPosition();
   SkipAllWhitespaces();
@@ -57,12 +57,44 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
     return Start();
   }
 
+  /**
+   * Parse an expression that was edited, reusing the nodes of the expression
+   * before the edit.
+   *
+   * Only the smallest sub-expression (between parenthesis) or function
+   * parameter containing the edit is parsed again, and the locations of the
+   * nodes after it are shifted. If there is no such node, or if the edit
+   * changes the structure of the expression around it (for example by adding
+   * a parenthesis or a comma), the whole expression is parsed again.
+   *
+   * \param previousExpression The expression before the edit.
+   * \param previousNode The node returned when parsing \a previousExpression.
+   * It's modified and returned, or destroyed if the whole expression is
+   * parsed again.
+   * \param editStartPosition The position of the first replaced character.
+   * \param editEndPosition The position after the last replaced character.
+   * \param replacement The text replacing the characters between
+   * \a editStartPosition and \a editEndPosition.
+   *
+   * \return The node representing the edited expression, which is the same
+   * as the one returned by ParseExpression for the edited expression.
+   *
+   * \note The results of the validation of the previous expression are not
+   * kept: the returned node must be validated again.
+   */
+  std::unique_ptr<ExpressionNode> ReparseExpression(
+      const gd::String &previousExpression,
+      std::unique_ptr<ExpressionNode> previousNode,
+      size_t editStartPosition,
+      size_t editEndPosition,
+      const gd::String &replacement);
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -698,9 +730,13 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    size_t position = currentPosition;
+    for (gd::String::value_type character : NAMESPACE_SEPARATOR) {
+      if (position >= expression.size() || expression[position] != character)
+        return false;
+      position++;
+    }
+    return true;
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -806,7 +842,8 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The expression, decoded so that characters
+                              ///< can be accessed in constant time.
   std::size_t currentPosition;
 
   static gd::String NAMESPACE_SEPARATOR;
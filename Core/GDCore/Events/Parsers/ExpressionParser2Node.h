@@ -79,6 +79,14 @@ struct GD_CORE_API ExpressionParserError : public ExpressionParserDiagnostic {
   const gd::String &GetMessage() override { return message; }
   size_t GetStartPosition() override { return location.GetStartPosition(); }
   size_t GetEndPosition() override { return location.GetEndPosition(); }
+  const ExpressionParserLocation &GetLocation() const { return location; }
+
+  /**
+   * \brief Change the location of the error, when the expression is edited.
+   */
+  void SetLocation(const ExpressionParserLocation &location_) {
+    location = location_;
+  }
 
  private:
   gd::String type;
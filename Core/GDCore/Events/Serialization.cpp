@@ -5,6 +5,8 @@
  */
 #include "GDCore/Events/Serialization.h"
 
+#include <utility>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Event.h"
 #include "GDCore/Events/EventsList.h"
@@ -207,7 +209,8 @@ void EventsListSerialization::UnserializeEventsFrom(
     gd::Project& project, EventsList& list, const SerializerElement& events) {
   list.Clear();
   events.ConsiderAsArrayOf("event", "Event");
-  for (std::size_t i = 0; i < events.GetChildrenCount(); ++i) {
+  std::size_t eventsCount = events.GetChildrenCount();
+  for (std::size_t i = 0; i < eventsCount; ++i) {
     SerializerElement& eventElem = events.GetChild(i);
     gd::String type =
         eventElem.GetChild("type", 0, "Type").GetValue().GetString();
@@ -230,16 +233,18 @@ void EventsListSerialization::SerializeEventsTo(const EventsList& list,
                                                 SerializerElement& events) {
   events.ConsiderAsArrayOf("event");
   for (std::size_t j = 0; j < list.size(); j++) {
-    const gd::BaseEvent& event = list.GetEvent(j);
-    SerializerElement& eventElem = events.AddChild("event");
+    SerializeEventTo(list.GetEvent(j), events.AddChild("event"));
+  }
+}
 
-    if (event.IsDisabled())
-      eventElem.SetAttribute("disabled", event.IsDisabled());
-    if (event.IsFolded()) eventElem.SetAttribute("folded", event.IsFolded());
-    eventElem.AddChild("type").SetValue(event.GetType());
+void EventsListSerialization::SerializeEventTo(
+    const gd::BaseEvent& event, SerializerElement& eventElement) {
+  if (event.IsDisabled())
+    eventElement.SetAttribute("disabled", event.IsDisabled());
+  if (event.IsFolded()) eventElement.SetAttribute("folded", event.IsFolded());
+  eventElement.AddChild("type").SetValue(event.GetType());
 
-    event.SerializeTo(eventElem);
-  }
+  event.SerializeTo(eventElement);
 }
 
 using namespace std;
@@ -256,21 +261,11 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
     elem.ConsiderAsArrayOf("action", "Action");
   // end of compatibility code
 
-  for (std::size_t i = 0; i < elem.GetChildrenCount(); ++i) {
-    gd::Instruction instruction;
+  std::size_t instructionsCount = elem.GetChildrenCount();
+  for (std::size_t i = 0; i < instructionsCount; ++i) {
     const SerializerElement& instrElement = elem.GetChild(i);
-
-    instruction.SetType(
-        instrElement.GetChild("type", 0, "Type")
-            .GetStringAttribute("value")
-            .FindAndReplace("Automatism",
-                            "Behavior"));  // Compatibility with GD <= 4
-    instruction.SetInverted(
-        instrElement.GetChild("type", 0, "Type")
-            .GetBoolAttribute("inverted", false, "Contraire"));
-
-    instruction.SetAwaited(
-        instrElement.GetChild("type", 0, "Type").GetBoolAttribute("await"));
+    const SerializerElement& typeElement =
+        instrElement.GetChild("type", 0, "Type");
 
     // Read parameters
     vector<gd::Expression> parameters;
@@ -288,12 +283,24 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
       const SerializerElement& parametersElem =
           instrElement.GetChild("parameters");
       parametersElem.ConsiderAsArrayOf("parameter");
-      for (std::size_t j = 0; j < parametersElem.GetChildrenCount(); ++j)
-        parameters.push_back(
-            gd::Expression(parametersElem.GetChild(j).GetValue().GetString()));
+      std::size_t parametersCount = parametersElem.GetChildrenCount();
+      parameters.reserve(parametersCount);
+      for (std::size_t j = 0; j < parametersCount; ++j)
+        parameters.emplace_back(
+            parametersElem.GetChild(j).GetValue().GetString());
     }
 
-    instruction.SetParameters(parameters);
+    gd::String type = typeElement.GetStringAttribute("value");
+    // Compatibility with GD <= 4
+    if (type.find("Automatism") != gd::String::npos)
+      type = type.FindAndReplace("Automatism", "Behavior");
+    // end of compatibility code
+
+    gd::Instruction instruction(
+        type,
+        std::move(parameters),
+        typeElement.GetBoolAttribute("inverted", false, "Contraire"));
+    instruction.SetAwaited(typeElement.GetBoolAttribute("await"));
 
     // Read sub instructions
     if (instrElement.HasChild("subInstructions"))
@@ -313,7 +320,7 @@ void gd::EventsListSerialization::UnserializeInstructionsFrom(
           instrElement.GetChild("subActions", 0, "SubActions"));
     // end of compatibility code
 
-    instructions.Insert(instruction);
+    instructions.Insert(std::move(instruction));
   }
 
   // Compatibility with GD <= 3.1
@@ -16,6 +16,9 @@ class Project;
 namespace gd {
 class EventsList;
 }
+namespace gd {
+class BaseEvent;
+}
 
 namespace gd {
 
@@ -42,6 +45,16 @@ class GD_CORE_API EventsListSerialization {
   static void SerializeEventsTo(const gd::EventsList& list,
                                 SerializerElement& events);
 
+  /**
+   * \brief Save an event to a SerializerElement, like it's saved in an events
+   * list.
+   * \param event The event to be saved.
+   * \param eventElement The SerializerElement in which the event must be
+   * serialized.
+   */
+  static void SerializeEventTo(const gd::BaseEvent& event,
+                               SerializerElement& eventElement);
+
   /**
    * \brief Unserialize a list of instructions
    */
@@ -79,7 +79,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAdvancedExtension(
                     "res/function32.png")
       .AddParameter("functionParameterName", "Parameter name")
       .SetRelevantForFunctionEventsOnly()
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpression(
@@ -113,7 +115,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAdvancedExtension(
       .AddParameter("functionParameterName", "Parameter name")
       .UseStandardRelationalOperatorParameters(
           "number", gd::ParameterOptions::MakeNewOptions())
-      .SetRelevantForFunctionEventsOnly();
+      .SetRelevantForFunctionEventsOnly()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -127,7 +131,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAdvancedExtension(
       .AddParameter("functionParameterName", "Parameter name")
       .UseStandardRelationalOperatorParameters(
           "string", gd::ParameterOptions::MakeNewOptions())
-      .SetRelevantForFunctionEventsOnly();
+      .SetRelevantForFunctionEventsOnly()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 }
 
 }  // namespace gd
@@ -404,7 +404,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/musicplaying.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("MusicPaused",
@@ -416,7 +417,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/musicpaused.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("MusicStopped",
@@ -428,7 +430,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/musicstopped.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("SoundPlaying",
@@ -440,7 +443,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/sonplaying.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("SoundPaused",
@@ -452,7 +456,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/sonpaused.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("SoundStopped",
@@ -464,7 +469,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
                     "res/conditions/sonstopped.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("expression", _("Channel"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -481,7 +487,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Volume to compare to (0-100)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -499,7 +506,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Volume to compare to (0-100)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -514,7 +522,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
       .UseStandardRelationalOperatorParameters(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
-              _("Volume to compare to (0-100)")));
+              _("Volume to compare to (0-100)")))
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -532,7 +541,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Pitch to compare to (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -549,7 +559,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Pitch to compare to (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -566,7 +577,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Position to compare to (in seconds)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -583,7 +595,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsAudioExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Position to compare to (in seconds)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpression("SoundChannelPlayingOffset",
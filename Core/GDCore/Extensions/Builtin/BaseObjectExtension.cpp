@@ -46,7 +46,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("MettreX",
                 _("X position"),
@@ -72,7 +74,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("MettreY",
                 _("Y position"),
@@ -128,7 +132,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
          _("Position/Center"),
          "res/actions/position24_black.png")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndConditionAndAction(
          "number",
@@ -139,7 +144,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
          _("Position/Center"),
          "res/actions/position24_black.png")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition("number",
                                 "BoundingBoxLeft",
@@ -150,7 +156,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                                 _("Position/Bounding Box"),
                                 "res/conditions/bounding-box-left_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition(
          "number",
@@ -161,7 +168,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
          _("Position/Bounding Box"),
          "res/conditions/bounding-box-top_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition("number",
                                 "BoundingBoxRight",
@@ -172,7 +180,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                                 _("Position/Bounding Box"),
                                 "res/conditions/bounding-box-right_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition("number",
                                 "BoundingBoxBottom",
@@ -183,7 +192,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                                 _("Position/Bounding Box"),
                                 "res/conditions/bounding-box-bottom_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition("number",
                                 "BoundingBoxCenterX",
@@ -194,7 +204,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                                 _("Position/Bounding Box"),
                                 "res/conditions/bounding-box-center_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddExpressionAndCondition("number",
                                 "BoundingBoxCenterY",
@@ -205,7 +216,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                                 _("Position/Bounding Box"),
                                 "res/conditions/bounding-box-center_black.svg")
       .AddParameter("object", _("Object"))
-      .UseStandardParameters("number", ParameterOptions::MakeNewOptions());
+      .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree();
 
   obj.AddAction("MettreAutourPos",
                 _("Put around a position"),
@@ -474,7 +486,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("objectvar", _("Structure variable"))
       .AddParameter("string", _("Name of the child"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("ObjectVariableRemoveChild",
                 _("Remove a child"),
@@ -536,7 +550,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Angle to compare to (in degrees)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Plan",
                    _("Z-order"),
@@ -549,7 +565,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Layer",
                    _("Current layer"),
@@ -561,7 +579,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
 
       .AddParameter("object", _("Object"))
       .AddParameter("layer", _("Layer"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Visible",
                    _("Visibility"),
@@ -572,7 +592,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                    "res/conditions/visibilite.png")
 
       .AddParameter("object", _("Object"))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Invisible",
                    "Invisibility of an object",
@@ -583,7 +605,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                    "res/conditions/visibilite.png")
 
       .AddParameter("object", _("Object"))
-      .SetHidden();  // Inverted "Visible" condition  does the same thing.
+      .SetHidden()  // Inverted "Visible" condition  does the same thing.
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Arret",
                    _("Object is stopped (no forces applied on it)"),
@@ -594,7 +618,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                    "res/conditions/arret.png")
 
       .AddParameter("object", _("Object"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   obj.AddCondition("Vitesse",
                    _("Speed (from forces)"),
@@ -607,7 +632,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   obj.AddCondition("AngleOfDisplacement",
                    _("Angle of movement (using forces)"),
@@ -622,7 +648,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("expression", _("Angle, in degrees"))
       .AddParameter("expression", _("Tolerance, in degrees"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   obj.AddCondition("VarObjet",
                    _("Number variable"),
@@ -635,7 +662,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("objectvar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "number", ParameterOptions::MakeNewOptions());
+          "number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("VarObjetTxt",
                    _("Text variable"),
@@ -648,7 +677,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("objectvar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "string", ParameterOptions::MakeNewOptions());
+          "string", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("ObjectVariableAsBoolean",
                    _("Boolean variable"),
@@ -661,7 +692,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("objectvar", _("Variable"))
       .AddParameter("trueorfalse", _("Check if the value is"))
-      .SetDefaultValue("true");
+      .SetDefaultValue("true")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("VarObjetDef",
                    "Variable defined",
@@ -673,7 +706,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
 
       .AddParameter("object", _("Object"))
       .AddParameter("string", _("Variable"))
-      .SetHidden();  // Deprecated.
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();  // Deprecated.
 
   obj.AddAction(
          "ObjectVariablePush",
@@ -756,7 +791,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("objectvar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddStrExpression(
          "ArrayVariableFirstString",
@@ -808,7 +845,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
 
       .AddParameter("object", _("Object"))
       .AddParameter("behavior", _("Behavior"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("ActivateBehavior",
                 _("De/activate a behavior"),
@@ -933,7 +972,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("expression", _("X position of the point"))
       .AddParameter("expression", _("Y position of the point"))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddCondition("SourisSurObjet",
@@ -950,7 +991,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("yesorno", _("Accurate test (yes by default)"), "", true)
       .SetDefaultValue("yes")
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 
   // Deprecated and replaced by CompareObjectTimer
   obj.AddCondition(
@@ -1323,7 +1366,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("object", _("Object"))
       .AddParameter("objectEffectName", _("Effect name"))
       .MarkAsSimple()
-      .SetRequiresBaseObjectCapability("effect");
+      .SetRequiresBaseObjectCapability("effect")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("SetIncludedInParentCollisionMask",
                 _("Include in parent collision mask"),
@@ -1434,7 +1479,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("objectList", _("Object 2"))
       .AddParameter("expression", _("Tolerance, in degrees"))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition("Distance",
@@ -1450,7 +1496,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("objectList", _("Object 2"))
       .AddParameter("expression", _("Distance"))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -1465,7 +1512,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
           "res/conditions/add.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("objectList", _("Object"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -1497,7 +1545,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("expression", _("X position"))
       .AddParameter("expression", _("Y position"))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -1515,7 +1564,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
       .MarkAsSimple()
-      .SetHidden();
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpressionAndCondition(
@@ -1530,7 +1581,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddCodeOnlyParameter("objectsContext", "")
       .AddParameter("objectListOrEmptyWithoutPicking", _("Object"))
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpressionAndCondition(
@@ -1544,7 +1597,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
           "res/conditions/nbObjet24.png")
       .AddParameter("objectListOrEmptyWithoutPicking", _("Object"))
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -1566,7 +1621,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
                     "",
                     true)
       .SetDefaultValue("no")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddCondition("EstTourne",
@@ -1581,7 +1638,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
       .AddParameter("expression",
                     _("Angle of tolerance, in degrees (0: minimum tolerance)"))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddCondition(
@@ -1612,7 +1670,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
           _("Scene variable where to store the Y position of the intersection. "
             "If no intersection is found, the variable won't be changed."))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddCondition(
@@ -1643,7 +1702,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsBaseObjectExtension(
           _("Scene variable where to store the Y position of the intersection. "
             "If no intersection is found, the variable won't be changed."))
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddExpression("Count",
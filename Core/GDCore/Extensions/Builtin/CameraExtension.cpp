@@ -44,7 +44,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
       .SetDefaultValue("0")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   // Compatibility with GD <= 5.0.135
   extension.AddDuplicatedCondition("CameraX", "CameraCenterX")
@@ -76,7 +77,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
       .SetDefaultValue("0")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   // Compatibility with GD <= 5.0.135
   extension.AddDuplicatedCondition("CameraY", "CameraCenterY")
@@ -107,7 +109,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndCondition(
@@ -123,7 +126,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndCondition(
@@ -140,7 +144,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndCondition(
@@ -157,7 +162,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndCondition(
@@ -174,7 +180,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndCondition(
@@ -191,7 +198,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number"), "", true)
       .UseStandardParameters("number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension
       .AddExpressionAndConditionAndAction(
@@ -208,7 +216,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
       .SetDefaultValue("0")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   extension.AddDuplicatedAction("RotateCamera", "SetCameraAngle").SetHidden();
   extension.AddDuplicatedExpression("CameraRotation", "CameraAngle")
@@ -444,7 +453,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("layer", _("Layer"))
       .SetDefaultValue("\"\"")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction(
@@ -515,7 +526,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .AddParameter("layer", _("Layer (base layer if empty)"), "", true)
       .SetDefaultValue("\"\"")
       .AddParameter("layerEffectName", _("Effect name"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction("EnableLayerEffect",
@@ -548,7 +561,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
           "number",
           gd::ParameterOptions::MakeNewOptions().SetDescription(
               _("Time scale (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction(
@@ -579,7 +594,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsCameraExtension(
       .SetDefaultValue("\"\"")
       .UseStandardRelationalOperatorParameters(
           "number", gd::ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction("SetLayerDefaultZOrder",
@@ -29,7 +29,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                      _("Convert the text to a number"),
                      "",
                      "res/conditions/toujours24_black.png")
-      .AddParameter("string", _("Text to convert to a number"));
+      .AddParameter("string", _("Text to convert to a number"))
+      .SetPure();
 
   extension
       .AddStrExpression("ToString",
@@ -37,7 +38,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                         _("Convert the result of the expression to text"),
                         "",
                         "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Expression to be converted to text"));
+      .AddParameter("expression", _("Expression to be converted to text"))
+      .SetPure();
 
   extension
       .AddStrExpression("LargeNumberToString",
@@ -46,7 +48,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
                           "without using the scientific notation"),
                         "",
                         "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Expression to be converted to text"));
+      .AddParameter("expression", _("Expression to be converted to text"))
+      .SetPure();
 
   extension
       .AddExpression(
@@ -55,7 +58,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
           _("Converts the angle, expressed in degrees, into radians"),
           "",
           "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Angle, in degrees"));
+      .AddParameter("expression", _("Angle, in degrees"))
+      .SetPure();
 
   extension
       .AddExpression(
@@ -64,7 +68,8 @@ BuiltinExtensionsImplementer::ImplementsCommonConversionsExtension(
           _("Converts the angle, expressed in radians, into degrees"),
           "",
           "res/conditions/toujours24_black.png")
-      .AddParameter("expression", _("Angle, in radians"));
+      .AddParameter("expression", _("Angle, in radians"))
+      .SetPure();
 
   extension
       .AddStrExpression("ToJSON",
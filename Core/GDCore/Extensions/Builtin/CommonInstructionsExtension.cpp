@@ -46,7 +46,9 @@ BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
                     "res/conditions/toujours_black.png")
       .SetHelpPath("/all-features/advanced-conditions")
       .AddCodeOnlyParameter("conditionInverted", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   // Compatibility with GD <= 5.0.127
   extension
@@ -110,7 +112,8 @@ BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
       .AddParameter("expression", _("First expression"))
       .AddParameter("relationalOperator", _("Sign of the test"), "number")
       .AddParameter("expression", _("Second expression"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   // Compatibility with GD <= 5.0.127
   extension
@@ -131,7 +134,8 @@ BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
       .AddParameter("string", _("First string expression"))
       .AddParameter("relationalOperator", _("Sign of the test"), "string")
       .AddParameter("string", _("Second string expression"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   // Compatibility with GD <= 5.0.127
   extension
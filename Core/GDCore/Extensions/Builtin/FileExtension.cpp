@@ -37,7 +37,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsFileExtension(
           "res/conditions/fichier.png")
       .AddParameter("string", _("Storage name"))
       .AddParameter("string", _("Group"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddAction(
@@ -170,7 +172,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsFileExtension(
                     "res/conditions/fichier24.png",
                     "res/conditions/fichier.png")
       .AddParameter("string", _("Storage name"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 
   extension
       .AddAction("ExecuteCmd",
@@ -35,7 +35,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "res/conditions/keyboard24.png",
                     "res/conditions/keyboard.png")
       .AddCodeOnlyParameter("currentScene", "")
-      .AddParameter("key", _("Key"));
+      .AddParameter("key", _("Key"))
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("KeyReleased",
@@ -46,7 +48,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "res/conditions/keyboard24.png",
                     "res/conditions/keyboard.png")
       .AddCodeOnlyParameter("currentScene", "")
-      .AddParameter("key", _("Key"));
+      .AddParameter("key", _("Key"))
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("KeyFromTextPressed",
@@ -59,7 +63,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "res/conditions/keyboard.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("string", _("Expression generating the key to check"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("KeyFromTextReleased",
@@ -72,7 +78,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "res/conditions/keyboard.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("string", _("Expression generating the key to check"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("AnyKeyPressed",
@@ -82,7 +90,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "",
                     "res/conditions/keyboard24.png",
                     "res/conditions/keyboard.png")
-      .AddCodeOnlyParameter("currentScene", "");
+      .AddCodeOnlyParameter("currentScene", "")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
  extension
       .AddCondition("AnyKeyReleased",
@@ -92,7 +102,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsKeyboardExtension(
                     "",
                     "res/conditions/keyboard24.png",
                     "res/conditions/keyboard.png")
-      .AddCodeOnlyParameter("currentScene", "");
+      .AddCodeOnlyParameter("currentScene", "")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddStrExpression(
@@ -78,7 +78,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Value"))
       .AddParameter("expression", _("Min"))
-      .AddParameter("expression", _("Max"));
+      .AddParameter("expression", _("Max"))
+      .SetPure();
 
   extension
       .AddExpression("clamp",
@@ -88,7 +89,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Value"))
       .AddParameter("expression", _("Min"))
-      .AddParameter("expression", _("Max"));
+      .AddParameter("expression", _("Max"))
+      .SetPure();
 
   extension
       .AddExpression("AngleDifference",
@@ -97,7 +99,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First angle, in degrees"))
-      .AddParameter("expression", _("Second angle, in degrees"));
+      .AddParameter("expression", _("Second angle, in degrees"))
+      .SetPure();
 
   extension
       .AddExpression("AngleBetweenPositions",
@@ -108,7 +111,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
       .AddParameter("expression", _("First point X position"))
       .AddParameter("expression", _("First point Y position"))
       .AddParameter("expression", _("Second point X position"))
-      .AddParameter("expression", _("Second point Y position"));
+      .AddParameter("expression", _("Second point Y position"))
+      .SetPure();
 
   extension
       .AddExpression("DistanceBetweenPositions",
@@ -119,7 +123,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
       .AddParameter("expression", _("First point X position"))
       .AddParameter("expression", _("First point Y position"))
       .AddParameter("expression", _("Second point X position"))
-      .AddParameter("expression", _("Second point Y position"));
+      .AddParameter("expression", _("Second point Y position"))
+      .SetPure();
 
   extension
       .AddExpression("mod",
@@ -128,7 +133,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("x (as in x mod y)"))
-      .AddParameter("expression", _("y (as in x mod y)"));
+      .AddParameter("expression", _("y (as in x mod y)"))
+      .SetPure();
 
   extension
       .AddExpression("min",
@@ -137,7 +143,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First expression"))
-      .AddParameter("expression", _("Second expression"));
+      .AddParameter("expression", _("Second expression"))
+      .SetPure();
 
   extension
       .AddExpression("max",
@@ -146,7 +153,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("First expression"))
-      .AddParameter("expression", _("Second expression"));
+      .AddParameter("expression", _("Second expression"))
+      .SetPure();
 
   extension
       .AddExpression("abs",
@@ -154,7 +162,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Absolute value"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("acos",
@@ -163,7 +172,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("acosh",
@@ -171,7 +181,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic arccosine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("asin",
@@ -180,7 +191,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("asinh",
@@ -188,7 +200,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Arcsine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("atan",
@@ -197,7 +210,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "`ToDeg` allows to convert it to degrees."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("atan2",
@@ -206,7 +220,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Y"))
-      .AddParameter("expression", _("X"));
+      .AddParameter("expression", _("X"))
+      .SetPure();
 
   extension
       .AddExpression("atanh",
@@ -214,7 +229,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic arctangent"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("cbrt",
@@ -222,7 +238,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Cube root"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("ceil",
@@ -230,7 +247,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Round number up to an integer"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("ceilTo",
@@ -239,7 +257,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Expression"))
-      .AddParameter("expression", _("Expression"), "", true);
+      .AddParameter("expression", _("Expression"), "", true)
+      .SetPure();
 
   extension
       .AddExpression("floor",
@@ -247,7 +266,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Round number down to an integer"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("floorTo",
@@ -256,7 +276,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Expression"))
-      .AddParameter("expression", _("Expression"), "", true);
+      .AddParameter("expression", _("Expression"), "", true)
+      .SetPure();
 
   extension
       .AddExpression("cos",
@@ -265,7 +286,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "If you want to use degrees, use`ToRad`: `sin(ToRad(45))`."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("cosh",
@@ -273,7 +295,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic cosine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("cot",
@@ -281,7 +304,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Cotangent of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("csc",
@@ -289,7 +313,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Cosecant of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("int",
@@ -298,7 +323,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("rint",
@@ -307,7 +333,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("round",
@@ -315,7 +342,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Round a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("roundTo",
@@ -324,7 +352,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Expression"))
-      .AddParameter("expression", _("Expression"), "", true);
+      .AddParameter("expression", _("Expression"), "", true)
+      .SetPure();
 
   extension
       .AddExpression("exp",
@@ -332,7 +361,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Exponential of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("log",
@@ -340,7 +370,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Logarithm"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("ln",
@@ -349,7 +380,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .SetHidden()
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("log2",
@@ -357,7 +389,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Base 2 Logarithm"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("log10",
@@ -365,7 +398,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Base-10 logarithm"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("nthroot",
@@ -374,7 +408,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Number"))
-      .AddParameter("expression", _("N"));
+      .AddParameter("expression", _("N"))
+      .SetPure();
 
   extension
       .AddExpression("pow",
@@ -383,7 +418,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Number"))
-      .AddParameter("expression", _("The exponent (n in x^n)"));
+      .AddParameter("expression", _("The exponent (n in x^n)"))
+      .SetPure();
 
   extension
       .AddExpression("sec",
@@ -391,7 +427,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Secant"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("sign",
@@ -399,7 +436,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Return the sign of a number (1,-1 or 0)"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("sin",
@@ -408,7 +446,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "If you want to use degrees, use`ToRad`: `sin(ToRad(45))`."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("sinh",
@@ -416,7 +455,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic sine"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("sqrt",
@@ -424,7 +464,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Square root of a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("tan",
@@ -433,7 +474,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                        "If you want to use degrees, use`ToRad`: `tan(ToRad(45))`."),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("tanh",
@@ -441,7 +483,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Hyperbolic tangent"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("trunc",
@@ -449,7 +492,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("Truncate a number"),
                      "",
                      "res/mathfunction.png")
-      .AddParameter("expression", _("Expression"));
+      .AddParameter("expression", _("Expression"))
+      .SetPure();
 
   extension
       .AddExpression("lerp",
@@ -459,7 +503,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("a (in a+(b-a)*x)"))
       .AddParameter("expression", _("b (in a+(b-a)*x)"))
-      .AddParameter("expression", _("x (in a+(b-a)*x)"));
+      .AddParameter("expression", _("x (in a+(b-a)*x)"))
+      .SetPure();
 
   extension
       .AddExpression("XFromAngleAndDistance",
@@ -471,7 +516,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Angle, in degrees"))
-      .AddParameter("expression", _("Distance"));
+      .AddParameter("expression", _("Distance"))
+      .SetPure();
 
   extension
       .AddExpression("YFromAngleAndDistance",
@@ -483,7 +529,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "",
                      "res/mathfunction.png")
       .AddParameter("expression", _("Angle, in degrees"))
-      .AddParameter("expression", _("Distance"));
+      .AddParameter("expression", _("Distance"))
+      .SetPure();
 
   extension
       .AddExpression("Pi",
@@ -491,7 +538,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      _("The number Pi (3.1415...)"),
                      "",
                      "res/mathfunction.png")
-      .SetHelpPath("/all-features/expressions");
+      .SetHelpPath("/all-features/expressions")
+      .SetPure();
 
   extension
       .AddExpression("lerpAngle",
@@ -501,7 +549,8 @@ BuiltinExtensionsImplementer::ImplementsMathematicalToolsExtension(
                      "res/mathfunction.png")
       .AddParameter("expression", _("Starting angle, in degrees"))
       .AddParameter("expression", _("Destination angle, in degrees"))
-      .AddParameter("expression", _("Interpolation value between 0 and 1."));
+      .AddParameter("expression", _("Interpolation value between 0 and 1."))
+      .SetPure();
 }
 
 }  // namespace gd
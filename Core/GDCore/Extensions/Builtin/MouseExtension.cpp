@@ -42,7 +42,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
           "res/actions/mouse.png")
 
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -56,7 +58,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
           "res/actions/mouse.png")
 
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction(
@@ -166,7 +170,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("layer", _("Layer (base layer if empty)"), "", true)
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
-      .SetDefaultValue("0");
+      .SetDefaultValue("0")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   // Support for deprecated names:
   extension.AddDuplicatedCondition("MouseX", "CursorX").SetHidden();
@@ -188,7 +194,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("layer", _("Layer (base layer if empty)"), "", true)
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
-      .SetDefaultValue("0");
+      .SetDefaultValue("0")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   // Support for deprecated names:
   extension.AddDuplicatedCondition("MouseY", "CursorY").SetHidden();
@@ -211,7 +219,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
       .SetDefaultValue("0")
       // It's only useful for extensions as they can't use TouchSimulateMouse.
-      .SetHidden();
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpressionAndCondition("number",
@@ -228,7 +238,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
       .SetDefaultValue("0")
       // It's only useful for extensions as they can't use TouchSimulateMouse.
-      .SetHidden();
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("IsMouseInsideCanvas",
@@ -239,7 +251,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "res/conditions/mouse24.png",
                     "res/conditions/mouse.png")
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("MouseButtonPressed",
@@ -252,7 +266,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "res/conditions/mouse.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("mouse", _("Button to check"))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   // Support for deprecated names:
   extension.AddDuplicatedCondition("SourisBouton", "MouseButtonPressed")
@@ -268,7 +284,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "res/conditions/mouse.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("mouse", _("Button to check"))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -286,7 +304,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "[\"Left\", \"Right\", \"Middle\"]")
       .SetParameterLongDescription(
           _("Possible values are Left, Right and Middle."))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -304,7 +324,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "[\"Left\", \"Right\", \"Middle\"]")
       .SetParameterLongDescription(
           _("Possible values are Left, Right and Middle."))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpressionAndCondition("number",
@@ -320,7 +342,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("layer", _("Layer (base layer if empty)"), "", true)
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
-      .SetDefaultValue("0");
+      .SetDefaultValue("0")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpressionAndCondition("number",
@@ -336,7 +360,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
       .AddParameter("layer", _("Layer (base layer if empty)"), "", true)
       .SetDefaultValue("\"\"")
       .AddParameter("expression", _("Camera number (default : 0)"), "", true)
-      .SetDefaultValue("0");
+      .SetDefaultValue("0")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -382,7 +408,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
           "res/conditions/touch24.png",
           "res/conditions/touch.png")
       .AddCodeOnlyParameter("currentScene", "")
-      .SetHidden();
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpression("StartedTouchCount",
@@ -419,7 +447,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
           _("Multitouch"),
           "res/conditions/touch24.png",
           "res/conditions/touch.png")
-      .AddCodeOnlyParameter("currentScene", "");
+      .AddCodeOnlyParameter("currentScene", "")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpression(
@@ -454,7 +484,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsMouseExtension(
                     "res/conditions/touch24.png",
                     "res/conditions/touch.png")
       .AddCodeOnlyParameter("currentScene", "")
-      .AddParameter("expression", _("Touch identifier"));
+      .AddParameter("expression", _("Touch identifier"))
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddExpression("MouseWheelDelta",
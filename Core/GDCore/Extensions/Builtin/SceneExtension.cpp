@@ -40,7 +40,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSceneExtension(
                     "res/conditions/depart.png")
       .SetHelpPath("/interface/scene-editor/events")
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("SceneJustResumed",
@@ -52,7 +54,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSceneExtension(
                     "res/conditions/depart.png")
       .SetHelpPath("/interface/scene-editor/events")
       .AddCodeOnlyParameter("currentScene", "")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction("Scene",
@@ -149,7 +153,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSceneExtension(
           "res/actions/window24.png",
           "res/actions/window.png")
       .SetHelpPath("/interface/scene-editor/events")
-      .AddCodeOnlyParameter("currentScene", "");
+      .AddCodeOnlyParameter("currentScene", "")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 }
 
 }  // namespace gd
@@ -0,0 +1,373 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Builtin/SpriteExtension/Polygon2dTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+const double epsilon = 1e-6;
+
+struct Point {
+  Point(double x_, double y_) : x(x_), y(y_){};
+  Point(const gd::Vector2f& vector) : x(vector.x), y(vector.y){};
+
+  double x;
+  double y;
+};
+
+/**
+ * Cross product of (b - a) and (c - a): positive if a, b, c turn in the same
+ * direction as the vertices of a polygon with a positive area.
+ */
+double Cross(const Point& a, const Point& b, const Point& c) {
+  return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+double SquaredDistance(const Point& a, const Point& b) {
+  return (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y);
+}
+
+double DistanceToSegment(const Point& point,
+                         const Point& start,
+                         const Point& end) {
+  double segmentSquaredLength = SquaredDistance(start, end);
+  if (segmentSquaredLength == 0)
+    return std::sqrt(SquaredDistance(point, start));
+
+  double t = ((point.x - start.x) * (end.x - start.x) +
+              (point.y - start.y) * (end.y - start.y)) /
+             segmentSquaredLength;
+  t = std::max(0.0, std::min(1.0, t));
+  return std::sqrt(SquaredDistance(
+      point,
+      Point(start.x + t * (end.x - start.x), start.y + t * (end.y - start.y))));
+}
+
+/**
+ * Check if a point is inside (or on the border of) a triangle having a
+ * positive area.
+ */
+bool IsInTriangle(const Point& point,
+                  const Point& a,
+                  const Point& b,
+                  const Point& c) {
+  return Cross(a, b, point) >= -epsilon && Cross(b, c, point) >= -epsilon &&
+         Cross(c, a, point) >= -epsilon;
+}
+
+bool SegmentsIntersect(const Point& a,
+                       const Point& b,
+                       const Point& c,
+                       const Point& d) {
+  double abc = Cross(a, b, c);
+  double abd = Cross(a, b, d);
+  double cda = Cross(c, d, a);
+  double cdb = Cross(c, d, b);
+  if (((abc > epsilon && abd < -epsilon) ||
+       (abc < -epsilon && abd > epsilon)) &&
+      ((cda > epsilon && cdb < -epsilon) || (cda < -epsilon && cdb > epsilon)))
+    return true;
+
+  // Touching segments
+  auto isOnSegment = [](const Point& point,
+                        const Point& start,
+                        const Point& end) {
+    return std::abs(Cross(start, end, point)) <= epsilon &&
+           std::min(start.x, end.x) - epsilon <= point.x &&
+           point.x <= std::max(start.x, end.x) + epsilon &&
+           std::min(start.y, end.y) - epsilon <= point.y &&
+           point.y <= std::max(start.y, end.y) + epsilon;
+  };
+  return isOnSegment(c, a, b) || isOnSegment(d, a, b) ||
+         isOnSegment(a, c, d) || isOnSegment(b, c, d);
+}
+
+/**
+ * Check that the edges of the polygon only touch their neighbors.
+ */
+bool IsSimple(const std::vector<Point>& points) {
+  const std::size_t count = points.size();
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t j = i + 2; j < count; ++j) {
+      if (i == 0 && j == count - 1) continue;  // Neighbors
+
+      if (SegmentsIntersect(points[i],
+                            points[(i + 1) % count],
+                            points[j],
+                            points[(j + 1) % count]))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool IsConvex(const std::vector<std::size_t>& indices,
+              const std::vector<Point>& points) {
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    const Point& previous =
+        points[indices[(i + indices.size() - 1) % indices.size()]];
+    const Point& current = points[indices[i]];
+    const Point& next = points[indices[(i + 1) % indices.size()]];
+    if (Cross(previous, current, next) < -epsilon) return false;
+  }
+  return true;
+}
+
+/**
+ * Triangulate a simple polygon having a positive area, using ear clipping.
+ * \return false if the polygon can't be triangulated.
+ */
+bool Triangulate(const std::vector<Point>& points,
+                 std::vector<std::vector<std::size_t>>& triangles) {
+  std::vector<std::size_t> remaining;
+  for (std::size_t i = 0; i < points.size(); ++i) remaining.push_back(i);
+
+  while (remaining.size() > 3) {
+    bool earFound = false;
+    std::size_t collinearVertex = std::numeric_limits<std::size_t>::max();
+    for (std::size_t i = 0; i < remaining.size() && !earFound; ++i) {
+      std::size_t previous =
+          remaining[(i + remaining.size() - 1) % remaining.size()];
+      std::size_t current = remaining[i];
+      std::size_t next = remaining[(i + 1) % remaining.size()];
+
+      double cross = Cross(points[previous], points[current], points[next]);
+      if (std::abs(cross) <= epsilon) collinearVertex = i;
+      if (cross <= epsilon) continue;
+
+      bool isEar = true;
+      for (std::size_t other : remaining) {
+        if (other == previous || other == current || other == next) continue;
+        if (IsInTriangle(points[other],
+                         points[previous],
+                         points[current],
+                         points[next])) {
+          isEar = false;
+          break;
+        }
+      }
+
+      if (isEar) {
+        triangles.push_back({previous, current, next});
+        remaining.erase(remaining.begin() + i);
+        earFound = true;
+      }
+    }
+
+    if (!earFound) {
+      // A vertex lying on the segment between its neighbors does not enclose
+      // any area: drop it to continue.
+      if (collinearVertex == std::numeric_limits<std::size_t>::max())
+        return false;
+      remaining.erase(remaining.begin() + collinearVertex);
+    }
+  }
+
+  if (Cross(points[remaining[0]], points[remaining[1]], points[remaining[2]]) >
+      epsilon)
+    triangles.push_back(remaining);
+  return true;
+}
+
+/**
+ * Remove the diagonals that are not needed for the parts to be convex
+ * (Hertel-Mehlhorn algorithm).
+ */
+void MergeIntoConvexParts(const std::vector<Point>& points,
+                          std::vector<std::vector<std::size_t>>& parts) {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (std::size_t a = 0; a < parts.size() && !merged; ++a) {
+      for (std::size_t i = 0; i < parts[a].size() && !merged; ++i) {
+        std::size_t u = parts[a][i];
+        std::size_t v = parts[a][(i + 1) % parts[a].size()];
+
+        for (std::size_t b = 0; b < parts.size() && !merged; ++b) {
+          if (b == a) continue;
+
+          // Search for the same edge, in the other direction.
+          const std::vector<std::size_t>& partB = parts[b];
+          std::size_t j = 0;
+          while (j < partB.size() &&
+                 !(partB[j] == v && partB[(j + 1) % partB.size()] == u))
+            ++j;
+          if (j == partB.size()) continue;
+
+          // Walk part A from v to u, then part B from u to v (excluded).
+          std::vector<std::size_t> mergedPart;
+          for (std::size_t k = 0; k < parts[a].size(); ++k)
+            mergedPart.push_back(parts[a][(i + 1 + k) % parts[a].size()]);
+          for (std::size_t k = 2; k < partB.size(); ++k)
+            mergedPart.push_back(partB[(j + k) % partB.size()]);
+
+          if (!IsConvex(mergedPart, points)) continue;
+
+          parts[a] = mergedPart;
+          parts.erase(parts.begin() + b);
+          merged = true;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+namespace gd {
+
+double Polygon2dTools::ComputeSignedArea(const Polygon2d& polygon) {
+  const auto& vertices = polygon.vertices;
+  double area = 0;
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    const auto& current = vertices[i];
+    const auto& next = vertices[(i + 1) % vertices.size()];
+    area += (double)current.x * next.y - (double)next.x * current.y;
+  }
+  return area / 2;
+}
+
+Polygon2d Polygon2dTools::RemoveCollinearVertices(const Polygon2d& polygon,
+                                                  double epsilon) {
+  std::vector<gd::Vector2f> vertices = polygon.vertices;
+
+  bool removed = true;
+  while (removed && vertices.size() >= 3) {
+    removed = false;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+      Point previous = vertices[(i + vertices.size() - 1) % vertices.size()];
+      Point current = vertices[i];
+      Point next = vertices[(i + 1) % vertices.size()];
+
+      if (std::abs(Cross(previous, current, next)) <= epsilon &&
+          DistanceToSegment(current, previous, next) <= epsilon) {
+        vertices.erase(vertices.begin() + i);
+        removed = true;
+        break;
+      }
+    }
+  }
+
+  Polygon2d result;
+  result.vertices = vertices;
+  return result;
+}
+
+Polygon2d Polygon2dTools::SimplifyVertices(const Polygon2d& polygon,
+                                           double tolerance) {
+  const std::size_t verticesCount = polygon.vertices.size();
+  if (verticesCount <= 3) return polygon;
+
+  std::vector<Point> points;
+  for (const auto& vertex : polygon.vertices) points.push_back(vertex);
+
+  // The outline is split in two chains, between the first vertex and the
+  // vertex the farthest from it, which are always kept. Chains are expressed
+  // with indices up to verticesCount, this last index being the first vertex.
+  std::size_t farthest = 0;
+  for (std::size_t i = 1; i < verticesCount; ++i) {
+    if (SquaredDistance(points[0], points[i]) >
+        SquaredDistance(points[0], points[farthest]))
+      farthest = i;
+  }
+  if (farthest == 0) return polygon;
+
+  std::vector<bool> kept(verticesCount, false);
+  kept[0] = true;
+  kept[farthest] = true;
+
+  std::vector<std::pair<std::size_t, std::size_t>> chains = {
+      {0, farthest}, {farthest, verticesCount}};
+  while (!chains.empty()) {
+    std::size_t start = chains.back().first;
+    std::size_t end = chains.back().second;
+    chains.pop_back();
+
+    double maxDistance = 0;
+    std::size_t maxDistanceIndex = start;
+    for (std::size_t i = start + 1; i < end; ++i) {
+      double distance = DistanceToSegment(
+          points[i], points[start], points[end % verticesCount]);
+      if (distance > maxDistance) {
+        maxDistance = distance;
+        maxDistanceIndex = i;
+      }
+    }
+
+    if (maxDistance > tolerance) {
+      kept[maxDistanceIndex] = true;
+      chains.push_back({start, maxDistanceIndex});
+      chains.push_back({maxDistanceIndex, end});
+    }
+  }
+
+  Polygon2d simplified;
+  for (std::size_t i = 0; i < verticesCount; ++i)
+    if (kept[i]) simplified.vertices.push_back(polygon.vertices[i]);
+
+  if (simplified.vertices.size() < 3) return polygon;
+  return simplified;
+}
+
+std::vector<Polygon2d> Polygon2dTools::DecomposeIntoConvexPolygons(
+    const Polygon2d& polygon) {
+  Polygon2d cleaned = RemoveCollinearVertices(polygon);
+  if (cleaned.vertices.size() < 3) return {polygon};
+  if (cleaned.IsConvex()) return {cleaned};
+
+  // Work on a polygon having a positive area, and restore the orientation of
+  // the vertices at the end.
+  bool reversed = ComputeSignedArea(cleaned) < 0;
+  if (reversed)
+    std::reverse(cleaned.vertices.begin(), cleaned.vertices.end());
+
+  std::vector<Point> points;
+  for (const auto& vertex : cleaned.vertices) points.push_back(vertex);
+
+  if (!IsSimple(points)) return {polygon};
+
+  std::vector<std::vector<std::size_t>> parts;
+  if (!Triangulate(points, parts) || parts.empty()) return {polygon};
+  MergeIntoConvexParts(points, parts);
+
+  std::vector<Polygon2d> convexPolygons;
+  for (const auto& part : parts) {
+    Polygon2d convexPolygon;
+    for (std::size_t index : part)
+      convexPolygon.vertices.push_back(cleaned.vertices[index]);
+    if (reversed)
+      std::reverse(convexPolygon.vertices.begin(),
+                   convexPolygon.vertices.end());
+
+    convexPolygons.push_back(RemoveCollinearVertices(convexPolygon));
+  }
+
+  return convexPolygons;
+}
+
+std::vector<Polygon2d> Polygon2dTools::OptimizeCollisionMask(
+    const std::vector<Polygon2d>& collisionMask, double tolerance) {
+  std::vector<Polygon2d> optimizedCollisionMask;
+  for (const auto& polygon : collisionMask) {
+    std::vector<Polygon2d> convexPolygons =
+        DecomposeIntoConvexPolygons(SimplifyVertices(polygon, tolerance));
+
+    // The simplification can make the outline self-intersecting: use the
+    // original polygon in this case.
+    if (convexPolygons.size() == 1 && !convexPolygons[0].IsConvex())
+      convexPolygons = DecomposeIntoConvexPolygons(polygon);
+
+    optimizedCollisionMask.insert(optimizedCollisionMask.end(),
+                                  convexPolygons.begin(),
+                                  convexPolygons.end());
+  }
+
+  return optimizedCollisionMask;
+}
+
+}  // namespace gd
@@ -0,0 +1,74 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_POLYGON2DTOOLS_H
+#define GDCORE_POLYGON2DTOOLS_H
+#include <vector>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/Polygon2d.h"
+
+namespace gd {
+
+/**
+ * \brief Geometry operations on polygons, used to prepare collision masks
+ * for the separating axis collision tests done by the game engine (which
+ * only handle convex polygons, and are slower with more vertices).
+ *
+ * \see Polygon2d
+ * \ingroup GameEngine
+ */
+class GD_CORE_API Polygon2dTools {
+ public:
+  /**
+   * \brief Return the signed area of the polygon: positive if its vertices
+   * are in the same order as the vertices of Polygon2d::CreateRectangle.
+   */
+  static double ComputeSignedArea(const Polygon2d& polygon);
+
+  /**
+   * \brief Return the polygon without duplicated consecutive vertices and
+   * without vertices lying on the segment between their neighbors.
+   */
+  static Polygon2d RemoveCollinearVertices(const Polygon2d& polygon,
+                                           double epsilon = 1e-6);
+
+  /**
+   * \brief Reduce the number of vertices of the polygon, using the
+   * Douglas-Peucker algorithm: removed vertices are at most at \a tolerance
+   * from the simplified outline.
+   *
+   * The polygon is returned unchanged if it would be simplified to less than
+   * 3 vertices.
+   */
+  static Polygon2d SimplifyVertices(const Polygon2d& polygon,
+                                    double tolerance);
+
+  /**
+   * \brief Decompose a simple (non self-intersecting) polygon into convex
+   * polygons, using the Hertel-Mehlhorn algorithm: the polygon is
+   * triangulated by ear clipping, then diagonals that are not needed for the
+   * parts to be convex are removed.
+   *
+   * Convex polygons are returned as is (without collinear vertices). Polygons
+   * that can't be triangulated (for example because they are self
+   * intersecting) are returned unchanged.
+   */
+  static std::vector<Polygon2d> DecomposeIntoConvexPolygons(
+      const Polygon2d& polygon);
+
+  /**
+   * \brief Simplify the polygons of a collision mask and decompose them into
+   * convex polygons.
+   *
+   * \see SimplifyVertices
+   * \see DecomposeIntoConvexPolygons
+   */
+  static std::vector<Polygon2d> OptimizeCollisionMask(
+      const std::vector<Polygon2d>& collisionMask, double tolerance);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_POLYGON2DTOOLS_H
@@ -230,7 +230,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   obj.AddAction("ChangeHeight",
                 _("Height"),
@@ -256,7 +257,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree();
 
   obj.AddAction("SetSize",
                 _("Size"),
@@ -283,7 +285,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("AnimationName",
                    _("Current animation name"),
@@ -295,7 +299,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
 
       .AddParameter("object", _("Object"), "Sprite")
       .AddParameter("objectAnimationName", _("Animation name"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition(
          "Direction",
@@ -311,7 +317,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                     // interface.
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
-          "number", ParameterOptions::MakeNewOptions());
+          "number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Sprite",
                    _("Current frame"),
@@ -326,7 +334,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("AnimStopped",
                    _("Animation paused"),
@@ -337,7 +347,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                    "res/conditions/animation.png")
 
       .AddParameter("object", _("Object"), "Sprite")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("AnimationEnded",
                    _("Animation finished"),
@@ -350,7 +362,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
 
       .AddParameter("object", _("Object"), "Sprite")
       .MarkAsSimple()
-      .SetHidden();
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("AnimationEnded2",
                    _("Animation finished"),
@@ -362,7 +376,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                    "res/conditions/animation.png")
 
       .AddParameter("object", _("Object"), "Sprite")
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("ScaleWidth",
                    _("Scale on X axis"),
@@ -377,7 +393,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Scale (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("ScaleHeight",
                    _("Scale on Y axis"),
@@ -392,7 +410,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Scale (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("Opacity",
                    _("Opacity"),
@@ -408,7 +428,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
           "number",
           ParameterOptions::MakeNewOptions().SetDescription(
               _("Opacity to compare to (0-255)")))
-      .MarkAsSimple();
+      .MarkAsSimple()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition(
          "BlendMode",
@@ -422,7 +444,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
       .AddParameter("object", _("Object"), "Sprite")
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("ChangeColor",
                 _("Tint color"),
@@ -481,7 +505,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                    "res/actions/flipX24.png",
                    "res/actions/flipX.png")
 
-      .AddParameter("object", _("Object"), "Sprite");
+      .AddParameter("object", _("Object"), "Sprite")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddCondition("FlippedY",
                    _("Vertically flipped"),
@@ -491,7 +517,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                    "res/actions/flipY24.png",
                    "res/actions/flipY.png")
 
-      .AddParameter("object", _("Object"), "Sprite");
+      .AddParameter("object", _("Object"), "Sprite")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   obj.AddAction("TourneVers",
                 "Rotate an object toward another",
@@ -634,7 +662,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsSpriteExtension(
                     "res/conditions/collision.png")
       .AddParameter("objectList", _("Object 1"), "Sprite")
       .AddParameter("objectList", _("Object 2"), "Sprite")
-      .AddCodeOnlyParameter("conditionInverted", "");
+      .AddCodeOnlyParameter("conditionInverted", "")
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate();
 }
 
 }  // namespace gd
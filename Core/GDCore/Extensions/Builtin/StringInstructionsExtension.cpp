@@ -27,7 +27,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                              _("Insert a new line"),
                              _("Insert a new line"),
                              "",
-                             "res/conditions/toujours24_black.png");
+                             "res/conditions/toujours24_black.png")
+      .SetPure();
 
   extension
       .AddStrExpression("FromCodePoint",
@@ -36,7 +37,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "",
                         "res/conditions/toujours24_black.png")
 
-      .AddParameter("expression", _("Code point"));
+      .AddParameter("expression", _("Code point"))
+      .SetPure();
 
   extension
       .AddStrExpression("ToUpperCase",
@@ -45,7 +47,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "",
                         "res/conditions/toujours24_black.png")
 
-      .AddParameter("string", _("Text"));
+      .AddParameter("string", _("Text"))
+      .SetPure();
 
   extension
       .AddStrExpression("ToLowerCase",
@@ -54,7 +57,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "",
                         "res/conditions/toujours24_black.png")
 
-      .AddParameter("string", _("Text"));
+      .AddParameter("string", _("Text"))
+      .SetPure();
 
   extension
       .AddStrExpression("SubStr",
@@ -67,7 +71,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
       .AddParameter("expression",
                     _("Start position of the portion (the first letter is at "
                       "position 0)"))
-      .AddParameter("expression", _("Length of the portion"));
+      .AddParameter("expression", _("Length of the portion"))
+      .SetPure();
 
   extension
       .AddStrExpression("StrAt",
@@ -79,7 +84,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
       .AddParameter("string", _("Text"))
       .AddParameter(
           "expression",
-          _("Position of the character (the first letter is at position 0)"));
+          _("Position of the character (the first letter is at position 0)"))
+      .SetPure();
 
   extension
       .AddStrExpression("StrRepeat",
@@ -89,7 +95,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "res/conditions/toujours24_black.png")
 
       .AddParameter("string", _("Text to repeat"))
-      .AddParameter("expression", _("Repetition count"));
+      .AddParameter("expression", _("Repetition count"))
+      .SetPure();
 
   extension
       .AddExpression("StrLength",
@@ -98,7 +105,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                      "",
                      "res/conditions/toujours24_black.png")
 
-      .AddParameter("string", _("Text"));
+      .AddParameter("string", _("Text"))
+      .SetPure();
 
   extension
       .AddExpression("StrFind",
@@ -109,7 +117,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                      "res/conditions/toujours24_black.png")
 
       .AddParameter("string", _("Text"))
-      .AddParameter("string", _("Text to search for"));
+      .AddParameter("string", _("Text to search for"))
+      .SetPure();
 
   extension
       .AddExpression("StrRFind",
@@ -121,6 +130,7 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
 
       .AddParameter("string", _("Text"))
       .AddParameter("string", _("Text to search for"))
+      .SetPure()
       .SetHidden();  // Deprecated, see StrFindLast instead.
 
   extension
@@ -134,7 +144,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
           "res/conditions/toujours24_black.png")
 
       .AddParameter("string", _("Text"))
-      .AddParameter("string", _("Text to search for"));
+      .AddParameter("string", _("Text to search for"))
+      .SetPure();
 
   extension
       .AddExpression("StrFindFrom",
@@ -148,7 +159,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
       .AddParameter("string", _("Text to search for"))
       .AddParameter("expression",
                     _("Position of the first character in the string to be "
-                      "considered in the search"));
+                      "considered in the search"))
+      .SetPure();
 
   extension
       .AddExpression(
@@ -164,6 +176,7 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
       .AddParameter("expression",
                     "Position of the last character in the string to be "
                     "considered in the search")
+      .SetPure()
       .SetHidden();  // Deprecated, see StrFindLastFrom instead.
 
   extension
@@ -181,7 +194,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
       .AddParameter("string", _("Text to search for"))
       .AddParameter("expression",
                     _("Position of the last character in the string to be "
-                      "considered in the search"));
+                      "considered in the search"))
+      .SetPure();
 
   extension
       .AddStrExpression("StrReplaceOne",
@@ -191,7 +205,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "res/conditions/toujours24_black.png")
       .AddParameter("string", _("Text in which the replacement must be done"))
       .AddParameter("string", _("Text to find inside the first text"))
-      .AddParameter("string", _("Replacement to put instead of the text to find"));
+      .AddParameter("string", _("Replacement to put instead of the text to find"))
+      .SetPure();
 
   extension
       .AddStrExpression("StrReplaceAll",
@@ -201,7 +216,8 @@ BuiltinExtensionsImplementer::ImplementsStringInstructionsExtension(
                         "res/conditions/toujours24_black.png")
       .AddParameter("string", _("Text in which the replacement(s) must be done"))
       .AddParameter("string", _("Text to find inside the first text"))
-      .AddParameter("string", _("Replacement to put instead of the text to find"));
+      .AddParameter("string", _("Replacement to put instead of the text to find"))
+      .SetPure();
 
 }
 
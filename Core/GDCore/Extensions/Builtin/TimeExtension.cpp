@@ -69,7 +69,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsTimeExtension(
           "number",
           gd::ParameterOptions::MakeNewOptions().SetDescription(
               _("Time scale (1 by default)")))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("TimerPaused",
@@ -35,7 +35,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("scenevar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "number", ParameterOptions::MakeNewOptions());
+          "number", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("VarSceneTxt",
@@ -47,7 +49,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("scenevar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
-          "string", ParameterOptions::MakeNewOptions());
+          "string", ParameterOptions::MakeNewOptions())
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -60,7 +64,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
           "res/conditions/var.png")
       .AddParameter("scenevar", _("Variable"))
       .AddParameter("trueorfalse", _("Check if the value is"))
-      .SetDefaultValue("true");
+      .SetDefaultValue("true")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("VariableChildExists",
@@ -73,7 +79,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("scenevar", _("Variable"))
       .AddParameter("string", _("Name of the child"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("GlobalVariableChildExists",
@@ -86,7 +94,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddParameter("globalvar", _("Variable"))
       .AddParameter("string", _("Name of the child"))
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("VarSceneDef",
@@ -98,7 +108,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                     "res/conditions/var.png")
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("string", _("Variable"))
-      .SetHidden();  // Deprecated.
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();  // Deprecated.
 
   extension
       .AddCondition("VarGlobal",
@@ -111,7 +123,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .AddParameter("globalvar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("VarGlobalTxt",
@@ -124,7 +138,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .AddParameter("globalvar", _("Variable"))
       .UseStandardRelationalOperatorParameters(
           "string", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition(
@@ -137,7 +153,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
           "res/conditions/var.png")
       .AddParameter("globalvar", _("Variable"))
       .AddParameter("trueorfalse", _("Check if the value is"))
-      .SetDefaultValue("true");
+      .SetDefaultValue("true")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddCondition("VarGlobalDef",
@@ -150,7 +168,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .AddCodeOnlyParameter("currentScene", "")
       .AddParameter("string", _("Variable"))
       .MarkAsAdvanced()
-      .SetHidden();  // Deprecated.
+      .SetHidden()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();  // Deprecated.
 
   extension
       .AddAction("ModVarScene",
@@ -379,7 +399,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .AddParameter("scenevar", _("Array variable"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddStrExpression(
@@ -500,7 +522,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
       .AddParameter("globalvar", _("Array variable"))
       .UseStandardRelationalOperatorParameters(
           "number", ParameterOptions::MakeNewOptions())
-      .MarkAsAdvanced();
+      .MarkAsAdvanced()
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddStrExpression("GlobalVariableFirstString",
@@ -547,7 +571,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                        "structure variable"),
                      _("Global variables/Arrays and structures"),
                      "res/actions/var.png")
-      .AddParameter("globalvar", _("Array or structure variable"));
+      .AddParameter("globalvar", _("Array or structure variable"))
+      .SetPure();
 
   extension
       .AddExpression("VariableChildCount",
@@ -556,7 +581,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                        "structure variable"),
                      _("Scene variables/Arrays and structures"),
                      "res/actions/var.png")
-      .AddParameter("scenevar", _("Array or structure variable"));
+      .AddParameter("scenevar", _("Array or structure variable"))
+      .SetPure();
 
   extension
       .AddExpression("Variable",
@@ -564,7 +590,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                      _("Number value of a scene variable"),
                      _("Scene variables"),
                      "res/actions/var.png")
-      .AddParameter("scenevar", _("Variable"));
+      .AddParameter("scenevar", _("Variable"))
+      .SetPure();
 
   extension
       .AddStrExpression("VariableString",
@@ -572,7 +599,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                         _("Text of a scene variable"),
                         _("Scene variables"),
                         "res/actions/var.png")
-      .AddParameter("scenevar", _("Variable"));
+      .AddParameter("scenevar", _("Variable"))
+      .SetPure();
 
   extension
       .AddExpression("GlobalVariable",
@@ -580,7 +608,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                      _("Number value of a global variable"),
                      _("Global variables"),
                      "res/actions/var.png")
-      .AddParameter("globalvar", _("Name of the global variable"));
+      .AddParameter("globalvar", _("Name of the global variable"))
+      .SetPure();
 
   extension
       .AddStrExpression("GlobalVariableString",
@@ -588,7 +617,8 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsVariablesExtension(
                         _("Text of a global variable"),
                         _("Global variables"),
                         "res/actions/var.png")
-      .AddParameter("globalvar", _("Variable"));
+      .AddParameter("globalvar", _("Variable"))
+      .SetPure();
 }
 
 }  // namespace gd
@@ -52,7 +52,9 @@ void GD_CORE_API BuiltinExtensionsImplementer::ImplementsWindowExtension(
                     "",
                     "res/actions/fullscreen24.png",
                     "res/actions/fullscreen.png")
-      .AddCodeOnlyParameter("currentScene", "");
+      .AddCodeOnlyParameter("currentScene", "")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate();
 
   extension
       .AddAction("SetWindowMargins",
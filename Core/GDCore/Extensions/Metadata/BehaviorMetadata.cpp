@@ -85,17 +85,16 @@ gd::InstructionMetadata& BehaviorMetadata::AddCondition(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsBehaviorInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& condition = conditionsInfos[nameWithNamespace];
+  condition = InstructionMetadata(extensionNamespace,
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  sentence,
+                                  group,
+                                  icon,
+                                  smallicon);
+  return condition.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddAction(
@@ -108,17 +107,16 @@ gd::InstructionMetadata& BehaviorMetadata::AddAction(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsBehaviorInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& action = actionsInfos[nameWithNamespace];
+  action = InstructionMetadata(extensionNamespace,
+                               nameWithNamespace,
+                               fullname,
+                               description,
+                               sentence,
+                               group,
+                               icon,
+                               smallicon);
+  return action.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddScopedCondition(
@@ -131,17 +129,16 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedCondition(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsBehaviorInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& condition = conditionsInfos[nameWithNamespace];
+  condition = InstructionMetadata(extensionNamespace,
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  sentence,
+                                  group,
+                                  icon,
+                                  smallicon);
+  return condition.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
 }
 
 gd::InstructionMetadata& BehaviorMetadata::AddScopedAction(
@@ -154,17 +151,16 @@ gd::InstructionMetadata& BehaviorMetadata::AddScopedAction(
     const gd::String& smallicon) {
   gd::String nameWithNamespace =
       GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsBehaviorInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& action = actionsInfos[nameWithNamespace];
+  action = InstructionMetadata(extensionNamespace,
+                               nameWithNamespace,
+                               fullname,
+                               description,
+                               sentence,
+                               group,
+                               icon,
+                               smallicon);
+  return action.SetHelpPath(GetHelpPath()).SetIsBehaviorInstruction();
 }
 
 gd::ExpressionMetadata& BehaviorMetadata::AddExpression(
@@ -175,15 +171,15 @@ gd::ExpressionMetadata& BehaviorMetadata::AddExpression(
     const gd::String& smallicon) {
   // Be careful, behaviors expression do not have namespace (not necessary as
   // we refer to the behavior name in the expression).
-  expressionsInfos[name] = ExpressionMetadata("number",
-                                              extensionNamespace,
-                                              name,
-                                              fullname,
-                                              description,
-                                              group,
-                                              smallicon)
-                               .SetHelpPath(GetHelpPath());
-  return expressionsInfos[name];
+  gd::ExpressionMetadata& expression = expressionsInfos[name];
+  expression = ExpressionMetadata("number",
+                                  extensionNamespace,
+                                  name,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 }
 
 gd::ExpressionMetadata& BehaviorMetadata::AddStrExpression(
@@ -194,15 +190,15 @@ gd::ExpressionMetadata& BehaviorMetadata::AddStrExpression(
     const gd::String& smallicon) {
   // Be careful, behaviors expression do not have namespace (not necessary as
   // we refer to the behavior name in the expression).
-  strExpressionsInfos[name] = ExpressionMetadata("string",
-                                                 extensionNamespace,
-                                                 name,
-                                                 fullname,
-                                                 description,
-                                                 group,
-                                                 smallicon)
-                                  .SetHelpPath(GetHelpPath());
-  return strExpressionsInfos[name];
+  gd::ExpressionMetadata& expression = strExpressionsInfos[name];
+  expression = ExpressionMetadata("string",
+                                  extensionNamespace,
+                                  name,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 }
 
 gd::MultipleInstructionMetadata BehaviorMetadata::AddExpressionAndCondition(
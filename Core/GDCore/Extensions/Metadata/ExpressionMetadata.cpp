@@ -24,6 +24,7 @@ ExpressionMetadata::ExpressionMetadata(const gd::String& returnType_,
       smallIconFilename(smallicon_),
       extensionNamespace(extensionNamespace_),
       isPrivate(false),
+      isPure(false),
       relevantContext("Any") {
 }
 
@@ -60,7 +61,7 @@ gd::ExpressionMetadata& ExpressionMetadata::AddParameter(
   // TODO: Assert against supplementaryInformation === "emsc" (when running with
   // Emscripten), and warn about a missing argument when calling addParameter.
 
-  parameters.push_back(info);
+  parameters.push_back(std::move(info));
   return *this;
 }
 
@@ -71,7 +72,7 @@ gd::ExpressionMetadata& ExpressionMetadata::AddCodeOnlyParameter(
   info.codeOnly = true;
   info.SetExtraInfo(supplementaryInformation);
 
-  parameters.push_back(info);
+  parameters.push_back(std::move(info));
   return *this;
 }
 
@@ -26,6 +26,14 @@ class ExpressionCodeGenerationInformation {
   ExpressionCodeGenerationInformation()
       : staticFunction(false), hasCustomCodeGenerator(false){};
   virtual ~ExpressionCodeGenerationInformation(){};
+  ExpressionCodeGenerationInformation(
+      const ExpressionCodeGenerationInformation&) = default;
+  ExpressionCodeGenerationInformation(ExpressionCodeGenerationInformation&&) =
+      default;
+  ExpressionCodeGenerationInformation& operator=(
+      const ExpressionCodeGenerationInformation&) = default;
+  ExpressionCodeGenerationInformation& operator=(
+      ExpressionCodeGenerationInformation&&) = default;
 
   /**
    * \brief Set the function name which will be used when generating the code.
@@ -137,9 +145,17 @@ class GD_CORE_API ExpressionMetadata {
    * to fulfill std::map requirements.
    */
   ExpressionMetadata()
-      : returnType("unknown"), shown(false), isPrivate(false), relevantContext("Any"){};
+      : returnType("unknown"),
+        shown(false),
+        isPrivate(false),
+        isPure(false),
+        relevantContext("Any"){};
 
   virtual ~ExpressionMetadata(){};
+  ExpressionMetadata(const ExpressionMetadata&) = default;
+  ExpressionMetadata(ExpressionMetadata&&) = default;
+  ExpressionMetadata& operator=(const ExpressionMetadata&) = default;
+  ExpressionMetadata& operator=(ExpressionMetadata&&) = default;
 
   /**
    * \brief Set the expression as not shown in the IDE.
@@ -184,6 +200,26 @@ class GD_CORE_API ExpressionMetadata {
     return *this;
   }
 
+  /**
+   * Check if the expression is pure: it always returns the same value when
+   * called with the same parameters and has no side effect, so code
+   * generators are free to evaluate it only once (or at compile time).
+   *
+   * For a variable parameter, the value of the variable is considered as the
+   * parameter.
+   */
+  bool IsPure() const { return isPure; }
+
+  /**
+   * Set that the expression is pure: it always returns the same value when
+   * called with the same parameters (or variables with the same values) and
+   * has no side effect.
+   */
+  ExpressionMetadata& SetPure() {
+    isPure = true;
+    return *this;
+  }
+
   /**
    * Check if the instruction can be used in layouts or external events.
    */
@@ -386,6 +422,7 @@ class GD_CORE_API ExpressionMetadata {
   gd::String smallIconFilename;
   gd::String extensionNamespace;
   bool isPrivate;
+  bool isPure;
   gd::String requiredBaseObjectCapability;
   gd::String relevantContext;
 };
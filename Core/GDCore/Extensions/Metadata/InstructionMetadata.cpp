@@ -22,6 +22,8 @@ InstructionMetadata::InstructionMetadata()
       canHaveSubInstructions(false),
       hidden(true),
       usageComplexity(5),
+      evaluationCost(5),
+      sideEffectFree(false),
       isPrivate(false),
       isObjectInstruction(false),
       isBehaviorInstruction(false) {}
@@ -45,6 +47,8 @@ InstructionMetadata::InstructionMetadata(const gd::String& extensionNamespace_,
       extensionNamespace(extensionNamespace_),
       hidden(false),
       usageComplexity(5),
+      evaluationCost(5),
+      sideEffectFree(false),
       isPrivate(false),
       isObjectInstruction(false),
       isBehaviorInstruction(false),
@@ -79,7 +83,7 @@ InstructionMetadata& InstructionMetadata::AddParameter(
   // TODO: Assert against supplementaryInformation === "emsc" (when running with
   // Emscripten), and warn about a missing argument when calling addParameter.
 
-  parameters.push_back(info);
+  parameters.push_back(std::move(info));
   return *this;
 }
 
@@ -90,7 +94,7 @@ InstructionMetadata& InstructionMetadata::AddCodeOnlyParameter(
   info.codeOnly = true;
   info.SetExtraInfo(supplementaryInformation);
 
-  parameters.push_back(info);
+  parameters.push_back(std::move(info));
   return *this;
 }
 
@@ -54,6 +54,10 @@ class GD_CORE_API InstructionMetadata {
   InstructionMetadata();
 
   virtual ~InstructionMetadata(){};
+  InstructionMetadata(const InstructionMetadata &) = default;
+  InstructionMetadata(InstructionMetadata &&) = default;
+  InstructionMetadata &operator=(const InstructionMetadata &) = default;
+  InstructionMetadata &operator=(InstructionMetadata &&) = default;
 
   const gd::String &GetFullName() const { return fullname; }
   const gd::String &GetDescription() const { return description; }
@@ -379,6 +383,49 @@ class GD_CORE_API InstructionMetadata {
    */
   int GetUsageComplexity() const { return usageComplexity; }
 
+  /**
+   * \brief Consider that the instruction is fast to run (for example, a
+   * comparison of a variable).
+   */
+  InstructionMetadata &MarkAsCheapToEvaluate() {
+    evaluationCost = 2;
+    return *this;
+  }
+
+  /**
+   * \brief Consider that the instruction is slow to run (for example, a test
+   * done on every pair of objects of two lists).
+   */
+  InstructionMetadata &MarkAsExpensiveToEvaluate() {
+    evaluationCost = 8;
+    return *this;
+  }
+
+  /**
+   * \brief Return the cost class of this instruction, estimating the time it
+   * takes to run, from 0 (cheap) to 10 (expensive).
+   */
+  int GetEvaluationCost() const { return evaluationCost; }
+
+  /**
+   * \brief Consider that the instruction has no side effect: running it only
+   * changes the objects lists given to it.
+   *
+   * For conditions, this allows the code generator to run them in a
+   * different order than the one of the events sheet.
+   * \see gd::ConditionsReorderer
+   */
+  InstructionMetadata &MarkAsSideEffectFree() {
+    sideEffectFree = true;
+    return *this;
+  }
+
+  /**
+   * \brief Return true if running the instruction only changes the objects
+   * lists given to it.
+   */
+  bool IsSideEffectFree() const { return sideEffectFree; }
+
   /**
    * \brief Defines information about how generate the code for an instruction
    */
@@ -387,6 +434,10 @@ class GD_CORE_API InstructionMetadata {
     enum AccessType { Reference, MutatorAndOrAccessor, Mutators };
     ExtraInformation() : accessType(Reference), hasCustomCodeGenerator(false){};
     virtual ~ExtraInformation(){};
+    ExtraInformation(const ExtraInformation &) = default;
+    ExtraInformation(ExtraInformation &&) = default;
+    ExtraInformation &operator=(const ExtraInformation &) = default;
+    ExtraInformation &operator=(ExtraInformation &&) = default;
 
     /**
      * Set the name of the function which will be called in the generated code.
@@ -596,6 +647,9 @@ class GD_CORE_API InstructionMetadata {
   bool hidden;
   int usageComplexity;  ///< Evaluate the instruction from 0 (simple&easy to
                         ///< use) to 10 (complex to understand)
+  int evaluationCost;  ///< Estimate the time taken by the instruction to run,
+                       ///< from 0 (cheap) to 10 (expensive).
+  bool sideEffectFree;
   bool isPrivate;
   bool isObjectInstruction;
   bool isBehaviorInstruction;
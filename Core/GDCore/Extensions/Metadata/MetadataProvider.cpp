@@ -6,6 +6,7 @@
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 
 #include <algorithm>
+#include <mutex>
 
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/EffectMetadata.h"
@@ -85,9 +86,43 @@ const EffectMetadata& MetadataProvider::GetEffectMetadata(
   return GetExtensionAndEffectMetadata(platform, objectType).GetMetadata();
 }
 
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::GetCachedExtensionAndInstructionMetadata(
+    const gd::Platform& platform, const gd::String& type, bool isCondition) {
+  Platform::InstructionsMetadataCache& cache =
+      platform.instructionsMetadataCache;
+  Platform::InstructionsMetadataCache::Map& metadata =
+      isCondition ? cache.conditions : cache.actions;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto cachedMetadata = metadata.find(type);
+    if (cachedMetadata != metadata.end())
+      return ExtensionAndMetadata<InstructionMetadata>(
+          *cachedMetadata->second.first, *cachedMetadata->second.second);
+  }
+
+  ExtensionAndMetadata<InstructionMetadata> extensionAndMetadata =
+      isCondition ? FindExtensionAndConditionMetadata(platform, type)
+                  : FindExtensionAndActionMetadata(platform, type);
+  // Unknown instructions are not cached, as they can be declared later by
+  // the extensions.
+  if (!IsBadInstructionMetadata(extensionAndMetadata.GetMetadata())) {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    metadata[type] = std::make_pair(&extensionAndMetadata.GetExtension(),
+                                 &extensionAndMetadata.GetMetadata());
+  }
+  return extensionAndMetadata;
+}
+
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndActionMetadata(const gd::Platform& platform,
                                                 gd::String actionType) {
+  return GetCachedExtensionAndInstructionMetadata(platform, actionType, false);
+}
+
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::FindExtensionAndActionMetadata(
+    const gd::Platform& platform, const gd::String& actionType) {
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allActions = extension->GetAllActions();
@@ -126,6 +161,13 @@ const gd::InstructionMetadata& MetadataProvider::GetActionMetadata(
 ExtensionAndMetadata<InstructionMetadata>
 MetadataProvider::GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                                    gd::String conditionType) {
+  return GetCachedExtensionAndInstructionMetadata(
+      platform, conditionType, true);
+}
+
+ExtensionAndMetadata<InstructionMetadata>
+MetadataProvider::FindExtensionAndConditionMetadata(
+    const gd::Platform& platform, const gd::String& conditionType) {
   auto& extensions = platform.GetAllPlatformExtensions();
   for (auto& extension : extensions) {
     const auto& allConditions = extension->GetAllConditions();
@@ -83,6 +83,9 @@ class GD_CORE_API MetadataProvider {
   /**
    * Get the metadata of an action, and its associated extension.
    * Works for object, behaviors and static actions.
+   *
+   * \note The metadata found is cached by the platform until extensions are
+   * added or removed, so that extensions are only searched once per type.
    */
   static ExtensionAndMetadata<InstructionMetadata>
   GetExtensionAndActionMetadata(const gd::Platform& platform,
@@ -91,6 +94,9 @@ class GD_CORE_API MetadataProvider {
   /**
    * Get the metadata of a condition, and its associated extension.
    * Works for object, behaviors and static conditions.
+   *
+   * \note The metadata found is cached by the platform until extensions are
+   * added or removed, so that extensions are only searched once per type.
    */
   static ExtensionAndMetadata<InstructionMetadata>
   GetExtensionAndConditionMetadata(const gd::Platform& platform,
@@ -280,6 +286,30 @@ class GD_CORE_API MetadataProvider {
  private:
   MetadataProvider();
 
+  /**
+   * \brief Search the extensions for an action, without using the cache.
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  FindExtensionAndActionMetadata(const gd::Platform& platform,
+                                 const gd::String& actionType);
+
+  /**
+   * \brief Search the extensions for a condition, without using the cache.
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  FindExtensionAndConditionMetadata(const gd::Platform& platform,
+                                    const gd::String& conditionType);
+
+  /**
+   * \brief Return the metadata of an instruction from the cache of a platform,
+   * or search it and cache it if it's found.
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetCachedExtensionAndInstructionMetadata(
+      const gd::Platform& platform,
+      const gd::String& type,
+      bool isCondition);
+
   static PlatformExtension badExtension;
   static BehaviorMetadata badBehaviorMetadata;
   static ObjectMetadata badObjectInfo;
@@ -218,6 +218,35 @@ class GD_CORE_API MultipleInstructionMetadata {
     return *this;
   }
 
+  /**
+   * \see gd::InstructionMetadata::MarkAsCheapToEvaluate
+   */
+  MultipleInstructionMetadata &MarkAsCheapToEvaluate() {
+    if (condition) condition->MarkAsCheapToEvaluate();
+    if (action) action->MarkAsCheapToEvaluate();
+    return *this;
+  }
+
+  /**
+   * \see gd::InstructionMetadata::MarkAsExpensiveToEvaluate
+   */
+  MultipleInstructionMetadata &MarkAsExpensiveToEvaluate() {
+    if (condition) condition->MarkAsExpensiveToEvaluate();
+    if (action) action->MarkAsExpensiveToEvaluate();
+    return *this;
+  }
+
+  /**
+   * \brief Consider that the condition has no side effect (the action, if
+   * any, always has one).
+   *
+   * \see gd::InstructionMetadata::MarkAsSideEffectFree
+   */
+  MultipleInstructionMetadata &MarkAsSideEffectFree() {
+    if (condition) condition->MarkAsSideEffectFree();
+    return *this;
+  }
+
   /**
    * \brief Don't use, only here to fulfill Emscripten bindings requirements.
    */
@@ -83,17 +83,16 @@ gd::InstructionMetadata& ObjectMetadata::AddCondition(
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsObjectInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& condition = conditionsInfos[nameWithNamespace];
+  condition = InstructionMetadata(extensionNamespace,
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  sentence,
+                                  group,
+                                  icon,
+                                  smallicon);
+  return condition.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
 #endif
 }
 
@@ -108,17 +107,16 @@ gd::InstructionMetadata& ObjectMetadata::AddAction(
 #if defined(GD_IDE_ONLY)
   gd::String nameWithNamespace =
       extensionNamespace.empty() ? name : extensionNamespace + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsObjectInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& action = actionsInfos[nameWithNamespace];
+  action = InstructionMetadata(extensionNamespace,
+                               nameWithNamespace,
+                               fullname,
+                               description,
+                               sentence,
+                               group,
+                               icon,
+                               smallicon);
+  return action.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
 #endif
 }
 
@@ -136,17 +134,16 @@ gd::InstructionMetadata& ObjectMetadata::AddScopedCondition(
           ? name // Don't insert a namespace separator for the base object.
           : GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
 
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath())
-                                           .SetIsObjectInstruction();
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& condition = conditionsInfos[nameWithNamespace];
+  condition = InstructionMetadata(extensionNamespace,
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  sentence,
+                                  group,
+                                  icon,
+                                  smallicon);
+  return condition.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
 #endif
 }
 
@@ -164,17 +161,16 @@ gd::InstructionMetadata& ObjectMetadata::AddScopedAction(
           ? name // Don't insert a namespace separator for the base object.
           : GetName() + gd::PlatformExtension::GetNamespaceSeparator() + name;
 
-  actionsInfos[nameWithNamespace] = InstructionMetadata(extensionNamespace,
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath())
-                                        .SetIsObjectInstruction();
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& action = actionsInfos[nameWithNamespace];
+  action = InstructionMetadata(extensionNamespace,
+                               nameWithNamespace,
+                               fullname,
+                               description,
+                               sentence,
+                               group,
+                               icon,
+                               smallicon);
+  return action.SetHelpPath(GetHelpPath()).SetIsObjectInstruction();
 #endif
 }
 
@@ -187,16 +183,15 @@ gd::ExpressionMetadata& ObjectMetadata::AddExpression(
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace (not necessary as
   // objects inherits from only one derived object).
-  expressionsInfos[name] = ExpressionMetadata("number",
-                                              extensionNamespace,
-                                              name,
-                                              fullname,
-                                              description,
-                                              group,
-                                              smallicon)
-                               .SetHelpPath(GetHelpPath());
-
-  return expressionsInfos[name];
+  gd::ExpressionMetadata& expression = expressionsInfos[name];
+  expression = ExpressionMetadata("number",
+                                  extensionNamespace,
+                                  name,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 #endif
 }
 
@@ -209,16 +204,15 @@ gd::ExpressionMetadata& ObjectMetadata::AddStrExpression(
 #if defined(GD_IDE_ONLY)
   // Be careful, objects expression do not have namespace (not necessary as
   // objects inherits from only one derived object).
-  strExpressionsInfos[name] = ExpressionMetadata("string",
-                                                 extensionNamespace,
-                                                 name,
-                                                 fullname,
-                                                 description,
-                                                 group,
-                                                 smallicon)
-                                  .SetHelpPath(GetHelpPath());
-
-  return strExpressionsInfos[name];
+  gd::ExpressionMetadata& expression = strExpressionsInfos[name];
+  expression = ExpressionMetadata("string",
+                                  extensionNamespace,
+                                  name,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 #endif
 }
 
@@ -28,6 +28,10 @@ class GD_CORE_API ParameterMetadata {
  public:
   ParameterMetadata();
   virtual ~ParameterMetadata(){};
+  ParameterMetadata(const ParameterMetadata&) = default;
+  ParameterMetadata(ParameterMetadata&&) = default;
+  ParameterMetadata& operator=(const ParameterMetadata&) = default;
+  ParameterMetadata& operator=(ParameterMetadata&&) = default;
 
   /**
    * \brief Return the metadata of the parameter type.
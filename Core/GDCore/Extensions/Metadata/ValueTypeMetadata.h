@@ -27,6 +27,10 @@ class GD_CORE_API ValueTypeMetadata {
  public:
   ValueTypeMetadata();
   virtual ~ValueTypeMetadata(){};
+  ValueTypeMetadata(const ValueTypeMetadata&) = default;
+  ValueTypeMetadata(ValueTypeMetadata&&) = default;
+  ValueTypeMetadata& operator=(const ValueTypeMetadata&) = default;
+  ValueTypeMetadata& operator=(ValueTypeMetadata&&) = default;
 
   /**
    * \brief Return the string representation of the type.
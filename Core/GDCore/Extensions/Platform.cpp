@@ -37,6 +37,7 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  ClearInstructionsMetadataCache();
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -74,6 +75,13 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  ClearInstructionsMetadataCache();
+}
+
+void Platform::ClearInstructionsMetadataCache() {
+  std::lock_guard<std::mutex> lock(instructionsMetadataCache.mutex);
+  instructionsMetadataCache.actions.clear();
+  instructionsMetadataCache.conditions.clear();
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
@@ -8,12 +8,16 @@
 #define GDCORE_PLATFORM_H
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "GDCore/Extensions/Metadata/InstructionOrExpressionGroupMetadata.h"
 #include "GDCore/String.h"
 namespace gd {
 class InstructionsMetadataHolder;
+class InstructionMetadata;
 class Project;
 class Object;
 class ObjectConfiguration;
@@ -174,6 +178,42 @@ class GD_CORE_API Platform {
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
   bool enableExtensionLoadingLogs;
+
+  /**
+   * \brief Forget the metadata of the instructions found by
+   * gd::MetadataProvider, to be called when extensions are added or removed.
+   */
+  void ClearInstructionsMetadataCache();
+
+  /**
+   * \brief The extension and metadata of the actions and conditions found by
+   * gd::MetadataProvider, indexed by their types.
+   *
+   * The cache is not copied with the platform, as it points to the metadata
+   * of the extensions of the platform.
+   */
+  struct InstructionsMetadataCache {
+    InstructionsMetadataCache(){};
+    InstructionsMetadataCache(const InstructionsMetadataCache&){};
+    InstructionsMetadataCache& operator=(const InstructionsMetadataCache&) {
+      std::lock_guard<std::mutex> lock(mutex);
+      actions.clear();
+      conditions.clear();
+      return *this;
+    };
+
+    typedef std::unordered_map<
+        gd::String,
+        std::pair<const PlatformExtension*, const InstructionMetadata*>>
+        Map;
+    Map actions;
+    Map conditions;
+    std::mutex mutex;  ///< Protects the maps, as events can be analyzed by
+                       ///< several threads.
+  };
+  mutable InstructionsMetadataCache instructionsMetadataCache;
+
+  friend class MetadataProvider;
 };
 
 }  // namespace gd
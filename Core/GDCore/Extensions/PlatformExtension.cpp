@@ -40,16 +40,16 @@ gd::InstructionMetadata& PlatformExtension::AddCondition(
     const gd::String& icon,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  conditionsInfos[nameWithNamespace] = InstructionMetadata(GetNameSpace(),
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           sentence,
-                                                           group,
-                                                           icon,
-                                                           smallicon)
-                                           .SetHelpPath(GetHelpPath());
-  return conditionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& condition = conditionsInfos[nameWithNamespace];
+  condition = InstructionMetadata(GetNameSpace(),
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  sentence,
+                                  group,
+                                  icon,
+                                  smallicon);
+  return condition.SetHelpPath(GetHelpPath());
 }
 
 gd::InstructionMetadata& PlatformExtension::AddAction(
@@ -61,16 +61,16 @@ gd::InstructionMetadata& PlatformExtension::AddAction(
     const gd::String& icon,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  actionsInfos[nameWithNamespace] = InstructionMetadata(GetNameSpace(),
-                                                        nameWithNamespace,
-                                                        fullname,
-                                                        description,
-                                                        sentence,
-                                                        group,
-                                                        icon,
-                                                        smallicon)
-                                        .SetHelpPath(GetHelpPath());
-  return actionsInfos[nameWithNamespace];
+  gd::InstructionMetadata& action = actionsInfos[nameWithNamespace];
+  action = InstructionMetadata(GetNameSpace(),
+                               nameWithNamespace,
+                               fullname,
+                               description,
+                               sentence,
+                               group,
+                               icon,
+                               smallicon);
+  return action.SetHelpPath(GetHelpPath());
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddExpression(
@@ -80,15 +80,15 @@ gd::ExpressionMetadata& PlatformExtension::AddExpression(
     const gd::String& group,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  expressionsInfos[nameWithNamespace] = ExpressionMetadata("number",
-                                                           GetNameSpace(),
-                                                           nameWithNamespace,
-                                                           fullname,
-                                                           description,
-                                                           group,
-                                                           smallicon)
-                                            .SetHelpPath(GetHelpPath());
-  return expressionsInfos[nameWithNamespace];
+  gd::ExpressionMetadata& expression = expressionsInfos[nameWithNamespace];
+  expression = ExpressionMetadata("number",
+                                  GetNameSpace(),
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 }
 
 gd::ExpressionMetadata& PlatformExtension::AddStrExpression(
@@ -98,15 +98,15 @@ gd::ExpressionMetadata& PlatformExtension::AddStrExpression(
     const gd::String& group,
     const gd::String& smallicon) {
   gd::String nameWithNamespace = GetNameSpace() + name;
-  strExpressionsInfos[nameWithNamespace] = ExpressionMetadata("string",
-                                                              GetNameSpace(),
-                                                              nameWithNamespace,
-                                                              fullname,
-                                                              description,
-                                                              group,
-                                                              smallicon)
-                                               .SetHelpPath(GetHelpPath());
-  return strExpressionsInfos[nameWithNamespace];
+  gd::ExpressionMetadata& expression = strExpressionsInfos[nameWithNamespace];
+  expression = ExpressionMetadata("string",
+                                  GetNameSpace(),
+                                  nameWithNamespace,
+                                  fullname,
+                                  description,
+                                  group,
+                                  smallicon);
+  return expression.SetHelpPath(GetHelpPath());
 }
 
 gd::MultipleInstructionMetadata PlatformExtension::AddExpressionAndCondition(
@@ -18,4 +18,59 @@ gd::String gd::AbstractFileSystem::NormalizeSeparator(gd::String filename) {
   return filename.FindAndReplace("\\", "/");
 }
 
+bool AbstractFileSystem::ReadBinaryFile(const gd::String& file,
+                                        std::string& content) {
+  return false;
+}
+
+bool AbstractFileSystem::WriteBinaryFile(const gd::String& file,
+                                         const std::string& content) {
+  return false;
+}
+
+std::vector<gd::FileStatus> AbstractFileSystem::StatFiles(
+    const std::vector<gd::String>& paths) {
+  std::vector<gd::FileStatus> statuses(paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    statuses[i].fileExists = FileExists(paths[i]);
+    statuses[i].dirExists = DirExists(paths[i]);
+  }
+  return statuses;
+}
+
+void AbstractFileSystem::MkDirs(const std::vector<gd::String>& paths) {
+  std::vector<gd::FileStatus> statuses = StatFiles(paths);
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    if (!statuses[i].dirExists) MkDir(paths[i]);
+  }
+}
+
+std::vector<bool> AbstractFileSystem::CopyFiles(
+    const std::vector<gd::FileCopyRequest>& requests) {
+  std::vector<bool> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i)
+    results[i] = CopyFile(requests[i].source, requests[i].destination);
+  return results;
+}
+
+std::vector<bool> AbstractFileSystem::WriteFiles(
+    const std::vector<gd::FileWriteRequest>& requests) {
+  std::vector<bool> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i)
+    results[i] = WriteToFile(requests[i].file, requests[i].content);
+  return results;
+}
+
+void AbstractFileSystem::CopyFilesAsync(
+    const std::vector<gd::FileCopyRequest>& requests,
+    std::function<void(const std::vector<bool>&)> callback) {
+  callback(CopyFiles(requests));
+}
+
+void AbstractFileSystem::WriteFilesAsync(
+    const std::vector<gd::FileWriteRequest>& requests,
+    std::function<void(const std::vector<bool>&)> callback) {
+  callback(WriteFiles(requests));
+}
+
 }  // namespace gd
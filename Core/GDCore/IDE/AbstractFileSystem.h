@@ -6,6 +6,8 @@
 
 #ifndef GDCORE_ABSTRACTFILESYSTEM
 #define GDCORE_ABSTRACTFILESYSTEM
+#include <functional>
+#include <string>
 #include <vector>
 #include "GDCore/String.h"
 
@@ -13,6 +15,40 @@
 
 namespace gd {
 
+/**
+ * \brief A file to copy with gd::AbstractFileSystem::CopyFiles.
+ */
+struct GD_CORE_API FileCopyRequest {
+  FileCopyRequest(const gd::String& source_, const gd::String& destination_)
+      : source(source_), destination(destination_){};
+
+  gd::String source;
+  gd::String destination;
+};
+
+/**
+ * \brief A file to write with gd::AbstractFileSystem::WriteFiles.
+ */
+struct GD_CORE_API FileWriteRequest {
+  FileWriteRequest(const gd::String& file_, const gd::String& content_)
+      : file(file_), content(content_){};
+
+  gd::String file;
+  gd::String content;
+};
+
+/**
+ * \brief The status of a path, returned by gd::AbstractFileSystem::StatFiles.
+ */
+struct GD_CORE_API FileStatus {
+  FileStatus() : fileExists(false), dirExists(false), size(0){};
+
+  bool fileExists;  ///< The same as gd::AbstractFileSystem::FileExists.
+  bool dirExists;   ///< The same as gd::AbstractFileSystem::DirExists.
+  std::size_t size;  ///< The size of the file in bytes, or 0 if it's not a
+                     ///< file or if the file system can't tell it.
+};
+
 /**
  * \brief An interface to manipulate files in a platform agnostic
  * way. This allow exporters to work on files without knowing
@@ -113,6 +149,29 @@ class GD_CORE_API AbstractFileSystem {
    */
   virtual gd::String ReadFile(const gd::String& file) = 0;
 
+  /**
+   * \brief Read the raw bytes of a file (for example, an image).
+   *
+   * \note File systems are not required to support binary files: the default
+   * implementation always fails.
+   *
+   * \param file The file to read.
+   * \param content Filled with the bytes of the file.
+   * \return true if the operation succeeded.
+   */
+  virtual bool ReadBinaryFile(const gd::String& file, std::string& content);
+
+  /**
+   * \brief Write raw bytes to a file.
+   *
+   * \note File systems are not required to support binary files: the default
+   * implementation always fails.
+   *
+   * \return true if the operation succeeded.
+   */
+  virtual bool WriteBinaryFile(const gd::String& file,
+                               const std::string& content);
+
   /**
    * \brief Return a vector containing the files in the specified path
    *
@@ -123,6 +182,67 @@ class GD_CORE_API AbstractFileSystem {
   virtual std::vector<gd::String> ReadDir(const gd::String& path,
                                           const gd::String& extension = "") = 0;
 
+  /** \name Batch operations
+   * Operations on several files at once. They should be preferred when many
+   * files are handled, as file systems can implement them faster than with
+   * one call per file (for example, with a single call to JavaScript or by
+   * using several threads).
+   *
+   * The default implementations call the operations on a single file, in
+   * order.
+   */
+  ///@{
+  /**
+   * \brief Return the status of each of the paths.
+   *
+   * \note The default implementation can't tell the sizes of the files.
+   */
+  virtual std::vector<gd::FileStatus> StatFiles(
+      const std::vector<gd::String>& paths);
+
+  /**
+   * \brief Create each of the directories that does not exist yet.
+   */
+  virtual void MkDirs(const std::vector<gd::String>& paths);
+
+  /**
+   * \brief Copy each of the files. Directories of the destinations must
+   * exist.
+   *
+   * \return For each request, true if the copy succeeded.
+   */
+  virtual std::vector<bool> CopyFiles(
+      const std::vector<gd::FileCopyRequest>& requests);
+
+  /**
+   * \brief Write each of the files.
+   *
+   * \return For each request, true if the write succeeded.
+   */
+  virtual std::vector<bool> WriteFiles(
+      const std::vector<gd::FileWriteRequest>& requests);
+
+  /**
+   * \brief Copy each of the files, then call the callback with the results.
+   *
+   * \note The callback can be called before this method returns (this is the
+   * case with the default implementation, which calls CopyFiles), or later
+   * from another thread.
+   */
+  virtual void CopyFilesAsync(
+      const std::vector<gd::FileCopyRequest>& requests,
+      std::function<void(const std::vector<bool>&)> callback);
+
+  /**
+   * \brief Write each of the files, then call the callback with the results.
+   *
+   * \see CopyFilesAsync
+   */
+  virtual void WriteFilesAsync(
+      const std::vector<gd::FileWriteRequest>& requests,
+      std::function<void(const std::vector<bool>&)> callback);
+  ///@}
+
  protected:
   AbstractFileSystem(){};
 };
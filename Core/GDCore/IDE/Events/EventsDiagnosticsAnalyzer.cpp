@@ -0,0 +1,407 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/EventsDiagnosticsAnalyzer.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#if !defined(EMSCRIPTEN)
+#include <atomic>
+#include <thread>
+#endif
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Serialization.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/EventsFunctionTools.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerHash.h"
+#include "GDCore/Tools/Localization.h"
+
+namespace gd {
+
+namespace {
+/**
+ * \brief An events list to be validated, with the objects that its events
+ * can use.
+ */
+struct EventsListTask {
+  gd::String path;
+  const gd::EventsList* events;
+  const gd::ObjectsContainer* globalObjectsContainer;
+  const gd::ObjectsContainer* objectsContainer;
+  std::unique_ptr<gd::ObjectsContainer> ownedGlobalObjectsContainer;
+  std::unique_ptr<gd::ObjectsContainer> ownedObjectsContainer;
+
+  std::uint64_t hash;
+  bool isValidated;
+  std::vector<EventsDiagnostic> diagnostics;
+};
+
+/**
+ * \brief Validate the parameters of the instructions of an events list,
+ * keeping track of the path of the events.
+ */
+class GD_CORE_API EventsDiagnosticsWorker
+    : public ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  EventsDiagnosticsWorker(const gd::Platform& platform_,
+                          const gd::String& path_,
+                          std::vector<EventsDiagnostic>& diagnostics_)
+      : platform(platform_), path(path_), diagnostics(diagnostics_){};
+  virtual ~EventsDiagnosticsWorker(){};
+
+ private:
+  void DoVisitEventList(const gd::EventsList& events) override {
+    eventsListsStack.push_back(std::make_pair(&events, 0));
+  }
+
+  void DoVisitEvent(const gd::BaseEvent& event) override {
+    // Sub-events are visited after their event: the lists that were
+    // entirely visited are removed from the stack.
+    while (eventsListsStack.back().second >=
+               eventsListsStack.back().first->size() ||
+           &eventsListsStack.back().first->GetEvent(
+               eventsListsStack.back().second) != &event)
+      eventsListsStack.pop_back();
+
+    eventsListsStack.back().second++;
+    currentEventPath = path + "/events";
+    for (const auto& eventsList : eventsListsStack)
+      currentEventPath += "/" + gd::String::From(eventsList.second - 1);
+  }
+
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    const gd::InstructionMetadata& metadata =
+        isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : gd::MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    if (gd::MetadataProvider::IsBadInstructionMetadata(metadata)) {
+      diagnostics.push_back(EventsDiagnostic(
+          currentEventPath,
+          instruction.GetType(),
+          0,
+          "",
+          _("This instruction is unknown: it may be from an extension that "
+            "is not installed."),
+          0,
+          0));
+      return;
+    }
+
+    const std::vector<gd::ParameterMetadata>& parameters =
+        metadata.GetParameters();
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+      const gd::String& type = parameters[i].GetType();
+      if (!gd::ParameterMetadata::IsExpression("number", type) &&
+          !gd::ParameterMetadata::IsExpression("string", type) &&
+          !gd::ParameterMetadata::IsExpression("variable", type) &&
+          !gd::ParameterMetadata::IsObject(type))
+        continue;
+
+      // Missing parameters are validated as empty expressions (the
+      // expression returned by GetParameter for them is shared by all
+      // instructions, so it can't be parsed by several threads).
+      gd::Expression missingParameter;
+      const gd::Expression& parameter =
+          i < instruction.GetParametersCount() ? instruction.GetParameter(i)
+                                                : missingParameter;
+      if (parameters[i].IsOptional() && parameter.GetPlainString().empty())
+        continue;
+
+      gd::ExpressionNode* node = parameter.GetRootNode();
+      if (!node) continue;
+
+      gd::ExpressionValidator validator(
+          platform, GetGlobalObjectsContainer(), GetObjectsContainer(), type);
+      node->Visit(validator);
+      for (gd::ExpressionParserDiagnostic* error : validator.GetErrors()) {
+        diagnostics.push_back(EventsDiagnostic(currentEventPath,
+                                               instruction.GetType(),
+                                               i,
+                                               parameter.GetPlainString(),
+                                               error->GetMessage(),
+                                               error->GetStartPosition(),
+                                               error->GetEndPosition()));
+      }
+
+      // The validator only checks that a name was entered.
+      const gd::String& objectName = parameter.GetPlainString();
+      if (gd::ParameterMetadata::IsObject(type) && !objectName.empty() &&
+          validator.GetErrors().empty() && !HasObjectOrGroup(objectName))
+        diagnostics.push_back(EventsDiagnostic(
+            currentEventPath,
+            instruction.GetType(),
+            i,
+            objectName,
+            _("This object does not exist in the scene or in the project."),
+            0,
+            objectName.size()));
+    }
+  }
+
+  bool HasObjectOrGroup(const gd::String& name) {
+    return GetObjectsContainer().HasObjectNamed(name) ||
+           GetObjectsContainer().GetObjectGroups().Has(name) ||
+           GetGlobalObjectsContainer().HasObjectNamed(name) ||
+           GetGlobalObjectsContainer().GetObjectGroups().Has(name);
+  }
+
+  const gd::Platform& platform;
+  gd::String path;
+  std::vector<EventsDiagnostic>& diagnostics;
+  std::vector<std::pair<const gd::EventsList*, std::size_t> >
+      eventsListsStack;  ///< The lists being visited, with the index of the
+                         ///< next event to visit.
+  gd::String currentEventPath;
+};
+
+std::uint64_t ComputeObjectsContainerHash(
+    const gd::ObjectsContainer& objectsContainer) {
+  // Objects are serialized with their behaviors and variables.
+  gd::SerializerElement element;
+  objectsContainer.SerializeObjectsTo(element.AddChild("objects"));
+  objectsContainer.GetObjectGroups().SerializeTo(
+      element.AddChild("objectGroups"));
+
+  return gd::SerializerHash::ComputeHash(element);
+}
+
+/**
+ * \brief Return the hash of what the errors of an events list depend on: its
+ * events and the objects they can use.
+ */
+std::uint64_t ComputeEventsListHash(
+    const EventsListTask& task,
+    const std::map<const gd::ObjectsContainer*, std::uint64_t>&
+        objectsContainersHashes) {
+  auto getObjectsContainerHash =
+      [&objectsContainersHashes](const gd::ObjectsContainer& container) {
+        auto hash = objectsContainersHashes.find(&container);
+        return hash != objectsContainersHashes.end()
+                   ? hash->second
+                   : ComputeObjectsContainerHash(container);
+      };
+
+  gd::SerializerElement element;
+  gd::EventsListSerialization::SerializeEventsTo(*task.events,
+                                                 element.AddChild("events"));
+  element.AddChild("globalObjects")
+      .SetStringValue(gd::SerializerHash::ToString(
+          getObjectsContainerHash(*task.globalObjectsContainer)));
+  element.AddChild("objects").SetStringValue(gd::SerializerHash::ToString(
+      getObjectsContainerHash(*task.objectsContainer)));
+
+  return gd::SerializerHash::ComputeHash(element);
+}
+
+void AddEventsFunctionsTasks(
+    const gd::String& path,
+    const gd::EventsFunctionsContainer& eventsFunctions,
+    const std::function<void(const gd::EventsFunction&,
+                             gd::ObjectsContainer&,
+                             gd::ObjectsContainer&)>&
+        eventsFunctionToObjectsContainer,
+    std::vector<std::unique_ptr<EventsListTask> >& tasks) {
+  for (const auto& eventsFunction : eventsFunctions.GetInternalVector()) {
+    std::unique_ptr<EventsListTask> task(new EventsListTask());
+    task->path = path + "/functions/" + eventsFunction->GetName();
+    task->events = &eventsFunction->GetEvents();
+    task->ownedGlobalObjectsContainer.reset(new gd::ObjectsContainer());
+    task->ownedObjectsContainer.reset(new gd::ObjectsContainer());
+    eventsFunctionToObjectsContainer(*eventsFunction,
+                                     *task->ownedGlobalObjectsContainer,
+                                     *task->ownedObjectsContainer);
+    task->globalObjectsContainer = task->ownedGlobalObjectsContainer.get();
+    task->objectsContainer = task->ownedObjectsContainer.get();
+    tasks.push_back(std::move(task));
+  }
+}
+
+std::vector<std::unique_ptr<EventsListTask> > GetEventsListTasks(
+    const gd::Project& project) {
+  std::vector<std::unique_ptr<EventsListTask> > tasks;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    const gd::Layout& layout = project.GetLayout(i);
+    std::unique_ptr<EventsListTask> task(new EventsListTask());
+    task->path = "layouts/" + layout.GetName();
+    task->events = &layout.GetEvents();
+    task->globalObjectsContainer = &project;
+    task->objectsContainer = &layout;
+    tasks.push_back(std::move(task));
+  }
+  // External events are only validated if they are associated to a layout,
+  // as the objects they use are unknown otherwise.
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    const gd::ExternalEvents& externalEvents = project.GetExternalEvents(i);
+    const gd::String& associatedLayout = externalEvents.GetAssociatedLayout();
+    if (!project.HasLayoutNamed(associatedLayout)) continue;
+
+    std::unique_ptr<EventsListTask> task(new EventsListTask());
+    task->path = "externalEvents/" + externalEvents.GetName();
+    task->events = &externalEvents.GetEvents();
+    task->globalObjectsContainer = &project;
+    task->objectsContainer = &project.GetLayout(associatedLayout);
+    tasks.push_back(std::move(task));
+  }
+
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const gd::EventsFunctionsExtension& extension =
+        project.GetEventsFunctionsExtension(e);
+    gd::String extensionPath =
+        "eventsFunctionsExtensions/" + extension.GetName();
+    AddEventsFunctionsTasks(
+        extensionPath,
+        extension,
+        [&project, &extension](const gd::EventsFunction& eventsFunction,
+                               gd::ObjectsContainer& globalObjectsContainer,
+                               gd::ObjectsContainer& objectsContainer) {
+          gd::EventsFunctionTools::FreeEventsFunctionToObjectsContainer(
+              project,
+              extension,
+              eventsFunction,
+              globalObjectsContainer,
+              objectsContainer);
+        },
+        tasks);
+
+    for (const auto& eventsBasedBehavior :
+         extension.GetEventsBasedBehaviors().GetInternalVector()) {
+      const gd::EventsBasedBehavior& behavior = *eventsBasedBehavior;
+      AddEventsFunctionsTasks(
+          extensionPath + "/eventsBasedBehaviors/" + behavior.GetName(),
+          behavior.GetEventsFunctions(),
+          [&project, &behavior](const gd::EventsFunction& eventsFunction,
+                                gd::ObjectsContainer& globalObjectsContainer,
+                                gd::ObjectsContainer& objectsContainer) {
+            gd::EventsFunctionTools::BehaviorEventsFunctionToObjectsContainer(
+                project,
+                behavior,
+                eventsFunction,
+                globalObjectsContainer,
+                objectsContainer);
+          },
+          tasks);
+    }
+    for (const auto& eventsBasedObject :
+         extension.GetEventsBasedObjects().GetInternalVector()) {
+      const gd::EventsBasedObject& object = *eventsBasedObject;
+      AddEventsFunctionsTasks(
+          extensionPath + "/eventsBasedObjects/" + object.GetName(),
+          object.GetEventsFunctions(),
+          [&project, &object](const gd::EventsFunction& eventsFunction,
+                              gd::ObjectsContainer& globalObjectsContainer,
+                              gd::ObjectsContainer& objectsContainer) {
+            gd::EventsFunctionTools::ObjectEventsFunctionToObjectsContainer(
+                project,
+                object,
+                eventsFunction,
+                globalObjectsContainer,
+                objectsContainer);
+          },
+          tasks);
+    }
+  }
+
+  return tasks;
+}
+}  // namespace
+
+EventsDiagnosticsAnalyzer::EventsDiagnosticsAnalyzer(
+    const gd::Platform& platform_)
+    : platform(platform_), threadsCount(0), validatedEventsListsCount(0) {}
+
+const std::vector<EventsDiagnostic>& EventsDiagnosticsAnalyzer::AnalyzeProject(
+    gd::Project& project) {
+  std::vector<std::unique_ptr<EventsListTask> > tasks =
+      GetEventsListTasks(project);
+
+  // The objects of the project and of the layouts are used by several events
+  // lists: their hashes are only computed once.
+  std::map<const gd::ObjectsContainer*, std::uint64_t> objectsContainersHashes;
+  objectsContainersHashes[&project] = ComputeObjectsContainerHash(project);
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    objectsContainersHashes[&project.GetLayout(i)] =
+        ComputeObjectsContainerHash(project.GetLayout(i));
+
+  // Each task only reads the cache and writes its own results, so that
+  // tasks can be run in parallel. Each task serializes the events in its own
+  // elements, as reading a gd::SerializerElement is not thread-safe.
+  auto runTask = [this, &objectsContainersHashes](EventsListTask& task) {
+    task.hash = ComputeEventsListHash(task, objectsContainersHashes);
+    auto cachedResults = cache.find(task.path);
+    task.isValidated =
+        cachedResults == cache.end() || cachedResults->second.hash != task.hash;
+    if (!task.isValidated) {
+      task.diagnostics = cachedResults->second.diagnostics;
+      return;
+    }
+
+    EventsDiagnosticsWorker worker(platform, task.path, task.diagnostics);
+    worker.Launch(
+        *task.events, *task.globalObjectsContainer, *task.objectsContainer);
+  };
+
+#if defined(EMSCRIPTEN)
+  for (auto& task : tasks) runTask(*task);
+#else
+  std::size_t usedThreadsCount =
+      threadsCount != 0 ? threadsCount : std::thread::hardware_concurrency();
+  usedThreadsCount = std::max<std::size_t>(
+      1, std::min<std::size_t>(usedThreadsCount, tasks.size()));
+
+  std::atomic<std::size_t> nextTaskIndex(0);
+  auto runTasks = [&tasks, &nextTaskIndex, &runTask]() {
+    for (std::size_t i = nextTaskIndex++; i < tasks.size();
+         i = nextTaskIndex++)
+      runTask(*tasks[i]);
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < usedThreadsCount; ++i)
+    threads.push_back(std::thread(runTasks));
+  runTasks();
+  for (auto& thread : threads) thread.join();
+#endif
+
+  // Results of events lists that were removed are forgotten.
+  cache.clear();
+  diagnostics.clear();
+  validatedEventsListsCount = 0;
+  for (auto& task : tasks) {
+    if (task->isValidated) validatedEventsListsCount++;
+    diagnostics.insert(diagnostics.end(),
+                       task->diagnostics.begin(),
+                       task->diagnostics.end());
+
+    EventsListResults& results = cache[task->path];
+    results.hash = task->hash;
+    results.diagnostics = std::move(task->diagnostics);
+  }
+
+  return diagnostics;
+}
+
+}  // namespace gd
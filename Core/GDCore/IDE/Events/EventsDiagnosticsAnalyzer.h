@@ -0,0 +1,177 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EVENTSDIAGNOSTICSANALYZER_H
+#define GDCORE_EVENTSDIAGNOSTICSANALYZER_H
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class Platform;
+class Project;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An error found in a parameter of an instruction by
+ * gd::EventsDiagnosticsAnalyzer.
+ */
+class GD_CORE_API EventsDiagnostic {
+ public:
+  EventsDiagnostic(const gd::String& eventPath_,
+                   const gd::String& instructionType_,
+                   std::size_t parameterIndex_,
+                   const gd::String& expression_,
+                   const gd::String& message_,
+                   std::size_t startPosition_,
+                   std::size_t endPosition_)
+      : eventPath(eventPath_),
+        instructionType(instructionType_),
+        parameterIndex(parameterIndex_),
+        expression(expression_),
+        message(message_),
+        startPosition(startPosition_),
+        endPosition(endPosition_){};
+
+  /** Default constructor, only to be used by Emscripten bindings. */
+  EventsDiagnostic() : parameterIndex(0), startPosition(0), endPosition(0){};
+
+  /**
+   * \brief Return the path of the event containing the instruction, like
+   * "layouts/Scene/events/2/0" for the first sub-event of the third event of
+   * the layout "Scene".
+   *
+   * The events of events functions are in
+   * "eventsFunctionsExtensions/MyExtension/functions/MyFunction/events"
+   * (with "eventsBasedBehaviors/MyBehavior/" or "eventsBasedObjects/MyObject/"
+   * before "functions" for the functions of behaviors and objects).
+   */
+  const gd::String& GetEventPath() const { return eventPath; }
+
+  /**
+   * \brief Return the type of the instruction with the error.
+   */
+  const gd::String& GetInstructionType() const { return instructionType; }
+
+  /**
+   * \brief Return the index of the parameter with the error.
+   */
+  std::size_t GetParameterIndex() const { return parameterIndex; }
+
+  /**
+   * \brief Return the expression of the parameter.
+   */
+  const gd::String& GetExpression() const { return expression; }
+
+  /**
+   * \brief Return the message explaining the error.
+   */
+  const gd::String& GetMessage() const { return message; }
+
+  /**
+   * \brief Return the position of the start of the error in the expression.
+   */
+  std::size_t GetStartPosition() const { return startPosition; }
+
+  /**
+   * \brief Return the position of the end of the error in the expression.
+   */
+  std::size_t GetEndPosition() const { return endPosition; }
+
+ private:
+  gd::String eventPath;
+  gd::String instructionType;
+  std::size_t parameterIndex;
+  gd::String expression;
+  gd::String message;
+  std::size_t startPosition;
+  std::size_t endPosition;
+};
+
+/**
+ * \brief Validate the parameters of all the instructions of a project
+ * (layouts, external events and events functions), to find errors without
+ * having to open each events sheet or to export the game.
+ *
+ * Parameters which are expressions, objects or variables are validated by
+ * gd::ExpressionValidator, according to their gd::ParameterMetadata, and
+ * instructions that are not declared by any extension are reported.
+ *
+ * The results of each events list are kept, with the hash of the events and
+ * of the objects they can use: when the project is analyzed again, only the
+ * events lists that were changed are validated. Events lists are validated in
+ * parallel, on several threads (except for Emscripten).
+ *
+ * \warning The analyzer must be created again (or ClearCache called) when
+ * extensions are added to or removed from the platform.
+ *
+ * \see gd::ExpressionValidator
+ */
+class GD_CORE_API EventsDiagnosticsAnalyzer {
+ public:
+  EventsDiagnosticsAnalyzer(const gd::Platform& platform_);
+  virtual ~EventsDiagnosticsAnalyzer(){};
+
+  /**
+   * \brief Validate the events of the project, and return the errors.
+   *
+   * \note The events of the project are not modified, but the parsed
+   * expressions are stored in them.
+   */
+  const std::vector<EventsDiagnostic>& AnalyzeProject(gd::Project& project);
+
+  /**
+   * \brief Return the errors found by the last call to AnalyzeProject.
+   */
+  const std::vector<EventsDiagnostic>& GetDiagnostics() const {
+    return diagnostics;
+  }
+
+  /**
+   * \brief Return the number of events lists that were validated by the last
+   * call to AnalyzeProject (the others had not changed).
+   */
+  std::size_t GetValidatedEventsListsCount() const {
+    return validatedEventsListsCount;
+  }
+
+  /**
+   * \brief Set the number of threads used to validate the events lists.
+   * 0 (the default) uses one thread per core.
+   */
+  void SetThreadsCount(std::size_t threadsCount_) {
+    threadsCount = threadsCount_;
+  }
+
+  /**
+   * \brief Forget the results of the events lists that were already
+   * validated.
+   */
+  void ClearCache() { cache.clear(); }
+
+ private:
+  /**
+   * \brief The results of an events list, and the hash of its content.
+   */
+  struct EventsListResults {
+    std::uint64_t hash;
+    std::vector<EventsDiagnostic> diagnostics;
+  };
+
+  const gd::Platform& platform;
+  std::size_t threadsCount;
+  std::map<gd::String, EventsListResults> cache;  ///< The results of each
+                                                  ///< events list, by path.
+  std::vector<EventsDiagnostic> diagnostics;
+  std::size_t validatedEventsListsCount;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EVENTSDIAGNOSTICSANALYZER_H
@@ -0,0 +1,438 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionCompletionIndex.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/ValueTypeMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gd {
+
+namespace {
+bool StartsWith(const std::u32string& string, const std::u32string& prefix) {
+  return string.size() >= prefix.size() &&
+         string.compare(0, prefix.size(), prefix) == 0;
+}
+
+std::set<std::u32string> GetTrigrams(const std::u32string& string) {
+  std::set<std::u32string> trigrams;
+  for (std::size_t i = 0; i + 3 <= string.size(); ++i)
+    trigrams.insert(string.substr(i, 3));
+
+  return trigrams;
+}
+
+/**
+ * \brief Combine a name with a signature (FNV-1a hash of the names, each one
+ * followed by a null character).
+ */
+void AddToSignature(std::uint64_t& signature, const gd::String& name) {
+  for (unsigned char character : name.Raw()) {
+    signature ^= character;
+    signature *= 1099511628211ULL;
+  }
+  signature *= 1099511628211ULL;  // The null character ending the name.
+}
+
+const std::uint64_t emptySignature = 14695981039346656037ULL;
+
+std::uint64_t ComputeSignature(
+    const gd::ObjectsContainer& objectsContainer) {
+  std::uint64_t signature = emptySignature;
+  for (const auto& object : objectsContainer.GetObjects()) {
+    AddToSignature(signature, object->GetName());
+    AddToSignature(signature, object->GetType());
+
+    const gd::VariablesContainer& objectVariables = object->GetVariables();
+    for (std::size_t i = 0; i < objectVariables.Count(); ++i)
+      AddToSignature(signature, objectVariables.GetNameAt(i));
+    AddToSignature(signature, "");
+  }
+  AddToSignature(signature, "");
+
+  const gd::ObjectGroupsContainer& groups = objectsContainer.GetObjectGroups();
+  for (std::size_t i = 0; i < groups.size(); ++i)
+    AddToSignature(signature, groups.Get(i).GetName());
+
+  return signature;
+}
+
+std::uint64_t ComputeSignature(
+    const gd::VariablesContainer& variablesContainer) {
+  std::uint64_t signature = emptySignature;
+  for (std::size_t i = 0; i < variablesContainer.Count(); ++i)
+    AddToSignature(signature, variablesContainer.GetNameAt(i));
+
+  return signature;
+}
+
+void AddExpressions(
+    const std::map<gd::String, gd::ExpressionMetadata>& expressions,
+    const gd::String& type,
+    std::vector<std::pair<gd::String, gd::String> >& names) {
+  for (const auto& expression : expressions) {
+    if (expression.second.IsShown())
+      names.push_back(std::make_pair(expression.first, type));
+  }
+}
+}  // namespace
+
+void ExpressionCompletionIndex::NamesIndex::Add(const gd::String& name,
+                                                const gd::String& type) {
+  entries.push_back(Entry{name, type, name.LowerCase().ToUTF32()});
+}
+
+void ExpressionCompletionIndex::NamesIndex::Build() {
+  std::sort(entries.begin(),
+            entries.end(),
+            [](const Entry& entry, const Entry& otherEntry) {
+              return entry.lowerCaseName < otherEntry.lowerCaseName ||
+                     (entry.lowerCaseName == otherEntry.lowerCaseName &&
+                      entry.name < otherEntry.name);
+            });
+
+  trigrams.clear();
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    for (const std::u32string& trigram : GetTrigrams(entries[i].lowerCaseName))
+      trigrams[trigram].push_back(i);
+  }
+}
+
+void ExpressionCompletionIndex::NamesIndex::Search(
+    const gd::String& pattern,
+    ExpressionCompletionDescription::CompletionKind completionKind,
+    const std::vector<gd::String>& acceptedTypes,
+    std::vector<ExpressionCompletionCandidate>& candidates) const {
+  std::u32string lowerCasePattern = pattern.LowerCase().ToUTF32();
+
+  // Names starting with the pattern are contiguous.
+  auto prefixBegin = std::lower_bound(
+      entries.begin(),
+      entries.end(),
+      lowerCasePattern,
+      [](const Entry& entry, const std::u32string& lowerCasePattern) {
+        return entry.lowerCaseName < lowerCasePattern;
+      });
+  auto prefixEnd = prefixBegin;
+  while (prefixEnd != entries.end() &&
+         StartsWith(prefixEnd->lowerCaseName, lowerCasePattern)) {
+    AddCandidate(*prefixEnd,
+                 ComputeMatchScore(pattern, prefixEnd->name),
+                 completionKind,
+                 acceptedTypes,
+                 candidates);
+    ++prefixEnd;
+  }
+
+  // Other names are only compared with the pattern if they share enough
+  // trigrams with it.
+  std::set<std::u32string> patternTrigrams = GetTrigrams(lowerCasePattern);
+  if (patternTrigrams.empty()) return;
+
+  std::map<std::size_t, std::size_t> sharedTrigramsCounts;
+  for (const std::u32string& trigram : patternTrigrams) {
+    auto indices = trigrams.find(trigram);
+    if (indices == trigrams.end()) continue;
+
+    for (std::size_t index : indices->second) sharedTrigramsCounts[index]++;
+  }
+
+  std::size_t prefixBeginIndex = prefixBegin - entries.begin();
+  std::size_t prefixEndIndex = prefixEnd - entries.begin();
+  for (const auto& sharedTrigramsCount : sharedTrigramsCounts) {
+    std::size_t index = sharedTrigramsCount.first;
+    if (sharedTrigramsCount.second * 2 < patternTrigrams.size() ||
+        (index >= prefixBeginIndex && index < prefixEndIndex))
+      continue;
+
+    int score = ComputeMatchScore(pattern, entries[index].name);
+    if (score >= 0)
+      AddCandidate(
+          entries[index], score, completionKind, acceptedTypes, candidates);
+  }
+}
+
+void ExpressionCompletionIndex::NamesIndex::AddCandidate(
+    const Entry& entry,
+    int score,
+    ExpressionCompletionDescription::CompletionKind completionKind,
+    const std::vector<gd::String>& acceptedTypes,
+    std::vector<ExpressionCompletionCandidate>& candidates) const {
+  if (!acceptedTypes.empty() &&
+      std::find(acceptedTypes.begin(), acceptedTypes.end(), entry.type) ==
+          acceptedTypes.end())
+    return;
+
+  candidates.push_back(ExpressionCompletionCandidate(
+      completionKind, entry.name, entry.type, score));
+}
+
+ExpressionCompletionIndex::ExpressionCompletionIndex(
+    const gd::Platform& platform) {
+  std::vector<std::pair<gd::String, gd::String> > freeExpressionsNames;
+  std::map<gd::String, std::vector<std::pair<gd::String, gd::String> > >
+      objectsExpressionsNames;
+  std::map<gd::String, std::vector<std::pair<gd::String, gd::String> > >
+      behaviorsExpressionsNames;
+  for (const auto& extension : platform.GetAllPlatformExtensions()) {
+    AddExpressions(
+        extension->GetAllExpressions(), "number", freeExpressionsNames);
+    AddExpressions(
+        extension->GetAllStrExpressions(), "string", freeExpressionsNames);
+
+    for (const gd::String& objectType :
+         extension->GetExtensionObjectsTypes()) {
+      auto& names = objectsExpressionsNames[objectType];
+      AddExpressions(extension->GetAllExpressionsForObject(objectType),
+                     "number",
+                     names);
+      AddExpressions(extension->GetAllStrExpressionsForObject(objectType),
+                     "string",
+                     names);
+    }
+    for (const gd::String& behaviorType : extension->GetBehaviorsTypes()) {
+      auto& names = behaviorsExpressionsNames[behaviorType];
+      AddExpressions(extension->GetAllExpressionsForBehavior(behaviorType),
+                     "number",
+                     names);
+      AddExpressions(extension->GetAllStrExpressionsForBehavior(behaviorType),
+                     "string",
+                     names);
+    }
+  }
+
+  for (const auto& name : freeExpressionsNames)
+    freeExpressions.Add(name.first, name.second);
+  freeExpressions.Build();
+  for (const auto& objectExpressionsNames : objectsExpressionsNames) {
+    NamesIndex& index = objectsExpressions[objectExpressionsNames.first];
+    for (const auto& name : objectExpressionsNames.second)
+      index.Add(name.first, name.second);
+    index.Build();
+  }
+  for (const auto& behaviorExpressionsNames : behaviorsExpressionsNames) {
+    NamesIndex& index = behaviorsExpressions[behaviorExpressionsNames.first];
+    for (const auto& name : behaviorExpressionsNames.second)
+      index.Add(name.first, name.second);
+    index.Build();
+  }
+}
+
+void ExpressionCompletionIndex::RemoveObjectsContainer(
+    const gd::ObjectsContainer& objectsContainer) {
+  objectsContainers.erase(&objectsContainer);
+}
+
+void ExpressionCompletionIndex::RemoveVariablesContainer(
+    const gd::VariablesContainer& variablesContainer) {
+  variablesContainers.erase(&variablesContainer);
+}
+
+const ExpressionCompletionIndex::ObjectsContainerIndex&
+ExpressionCompletionIndex::GetObjectsContainerIndex(
+    const gd::ObjectsContainer& objectsContainer) {
+  std::uint64_t signature = ComputeSignature(objectsContainer);
+  auto existingIndex = objectsContainers.find(&objectsContainer);
+  if (existingIndex != objectsContainers.end() &&
+      existingIndex->second.signature == signature)
+    return existingIndex->second;
+
+  ObjectsContainerIndex& index = objectsContainers[&objectsContainer];
+  index = ObjectsContainerIndex();
+  index.signature = signature;
+  for (const auto& object : objectsContainer.GetObjects()) {
+    index.objects.Add(object->GetName(), object->GetType());
+
+    NamesIndex& objectVariables = index.objectsVariables[object->GetName()];
+    const gd::VariablesContainer& objectVariablesContainer =
+        object->GetVariables();
+    for (std::size_t i = 0; i < objectVariablesContainer.Count(); ++i)
+      objectVariables.Add(objectVariablesContainer.GetNameAt(i), "");
+    objectVariables.Build();
+  }
+  const gd::ObjectGroupsContainer& groups = objectsContainer.GetObjectGroups();
+  for (std::size_t i = 0; i < groups.size(); ++i)
+    index.objects.Add(groups.Get(i).GetName(), "");
+  index.objects.Build();
+  return index;
+}
+
+const ExpressionCompletionIndex::VariablesContainerIndex&
+ExpressionCompletionIndex::GetVariablesContainerIndex(
+    const gd::VariablesContainer& variablesContainer) {
+  std::uint64_t signature = ComputeSignature(variablesContainer);
+  auto existingIndex = variablesContainers.find(&variablesContainer);
+  if (existingIndex != variablesContainers.end() &&
+      existingIndex->second.signature == signature)
+    return existingIndex->second;
+
+  VariablesContainerIndex& index = variablesContainers[&variablesContainer];
+  index = VariablesContainerIndex();
+  index.signature = signature;
+  for (std::size_t i = 0; i < variablesContainer.Count(); ++i)
+    index.variables.Add(variablesContainer.GetNameAt(i), "");
+  index.variables.Build();
+  return index;
+}
+
+std::vector<ExpressionCompletionCandidate>
+ExpressionCompletionIndex::GetCompletionCandidatesFor(
+    const ExpressionCompletionDescription& description,
+    const gd::ObjectsContainer& globalObjectsContainer,
+    const gd::ObjectsContainer& objectsContainer,
+    const gd::VariablesContainer& globalVariables,
+    const gd::VariablesContainer& variables,
+    size_t maxCount) {
+  const ObjectsContainerIndex& globalIndex =
+      GetObjectsContainerIndex(globalObjectsContainer);
+  const ObjectsContainerIndex& index =
+      GetObjectsContainerIndex(objectsContainer);
+  const gd::String& prefix = description.GetPrefix();
+  const gd::String& objectName = description.GetObjectName();
+  ExpressionCompletionDescription::CompletionKind completionKind =
+      description.GetCompletionKind();
+
+  std::vector<ExpressionCompletionCandidate> candidates;
+  std::vector<gd::String> noTypes;
+  if (completionKind == ExpressionCompletionDescription::Object) {
+    index.objects.Search(prefix, completionKind, noTypes, candidates);
+    globalIndex.objects.Search(prefix, completionKind, noTypes, candidates);
+  } else if (completionKind == ExpressionCompletionDescription::Behavior) {
+    // Objects have a few behaviors, which are not worth being indexed.
+    NamesIndex behaviors;
+    for (const gd::String& behaviorName : gd::GetBehaviorsOfObject(
+             globalObjectsContainer, objectsContainer, objectName))
+      behaviors.Add(behaviorName,
+                    gd::GetTypeOfBehavior(globalObjectsContainer,
+                                          objectsContainer,
+                                          behaviorName));
+    behaviors.Build();
+    behaviors.Search(prefix, completionKind, noTypes, candidates);
+  } else if (completionKind == ExpressionCompletionDescription::Expression) {
+    std::vector<gd::String> types;
+    const gd::String& valueType =
+        gd::ValueTypeMetadata::GetPrimitiveValueType(description.GetType());
+    if (valueType == "number" || valueType == "string")
+      types.push_back(valueType);
+
+    if (objectName.empty()) {
+      freeExpressions.Search(prefix, completionKind, types, candidates);
+    } else if (description.GetBehaviorName().empty()) {
+      // Expressions of the object type, and of all objects.
+      gd::String objectType = gd::GetTypeOfObject(
+          globalObjectsContainer, objectsContainer, objectName);
+      auto objectExpressions = objectsExpressions.find(objectType);
+      if (objectExpressions != objectsExpressions.end())
+        objectExpressions->second.Search(
+            prefix, completionKind, types, candidates);
+      auto baseObjectExpressions = objectsExpressions.find("");
+      if (!objectType.empty() &&
+          baseObjectExpressions != objectsExpressions.end())
+        baseObjectExpressions->second.Search(
+            prefix, completionKind, types, candidates);
+    } else {
+      auto behaviorExpressions = behaviorsExpressions.find(
+          gd::GetTypeOfBehavior(globalObjectsContainer,
+                                objectsContainer,
+                                description.GetBehaviorName()));
+      if (behaviorExpressions != behaviorsExpressions.end())
+        behaviorExpressions->second.Search(
+            prefix, completionKind, types, candidates);
+    }
+  } else if (completionKind == ExpressionCompletionDescription::Variable) {
+    if (!objectName.empty()) {
+      auto objectVariables = index.objectsVariables.find(objectName);
+      auto globalObjectVariables =
+          globalIndex.objectsVariables.find(objectName);
+      if (objectVariables != index.objectsVariables.end())
+        objectVariables->second.Search(
+            prefix, completionKind, noTypes, candidates);
+      else if (globalObjectVariables != globalIndex.objectsVariables.end())
+        globalObjectVariables->second.Search(
+            prefix, completionKind, noTypes, candidates);
+    } else {
+      if (description.GetType() != "globalvar")
+        GetVariablesContainerIndex(variables).variables.Search(
+            prefix, completionKind, noTypes, candidates);
+      if (description.GetType() != "scenevar")
+        GetVariablesContainerIndex(globalVariables)
+            .variables.Search(prefix, completionKind, noTypes, candidates);
+    }
+  }
+
+  return GetBestCandidates(candidates, maxCount);
+}
+
+std::vector<ExpressionCompletionCandidate>
+ExpressionCompletionIndex::GetBestCandidates(
+    std::vector<ExpressionCompletionCandidate>& candidates, size_t maxCount) {
+  auto isBetter = [](const ExpressionCompletionCandidate& candidate,
+                     const ExpressionCompletionCandidate& otherCandidate) {
+    return candidate.GetScore() > otherCandidate.GetScore() ||
+           (candidate.GetScore() == otherCandidate.GetScore() &&
+            candidate.GetName() < otherCandidate.GetName());
+  };
+
+  maxCount = std::min(maxCount, candidates.size());
+  std::partial_sort(candidates.begin(),
+                    candidates.begin() + maxCount,
+                    candidates.end(),
+                    isBetter);
+  candidates.resize(maxCount);
+  return candidates;
+}
+
+int ExpressionCompletionIndex::ComputeMatchScore(const gd::String& pattern,
+                                                 const gd::String& name) {
+  if (pattern.empty()) return 0;
+  if (pattern == name) return 4000;
+
+  std::u32string lowerCasePattern = pattern.LowerCase().ToUTF32();
+  std::u32string lowerCaseName = name.LowerCase().ToUTF32();
+  if (lowerCasePattern.size() > lowerCaseName.size()) return -1;
+
+  // Shorter names are better, as less characters are missing.
+  int missingCharactersCount = std::min(
+      static_cast<int>(lowerCaseName.size() - lowerCasePattern.size()), 499);
+  if (StartsWith(lowerCaseName, lowerCasePattern)) {
+    bool isCaseMatching = name.Raw().compare(
+                              0, pattern.Raw().size(), pattern.Raw()) == 0;
+    return (isCaseMatching ? 3500 : 3000) - missingCharactersCount;
+  }
+
+  std::size_t position = lowerCaseName.find(lowerCasePattern);
+  if (position != std::u32string::npos)
+    return 2000 -
+           std::min(static_cast<int>(position) * 10 + missingCharactersCount,
+                    999);
+
+  // Characters of the pattern must be found in the same order, preferably
+  // next to each other.
+  std::size_t characterPosition = 0;
+  int gapsLength = 0;
+  for (char32_t character : lowerCasePattern) {
+    std::size_t foundPosition =
+        lowerCaseName.find(character, characterPosition);
+    if (foundPosition == std::u32string::npos) return -1;
+
+    if (characterPosition != 0)
+      gapsLength += static_cast<int>(foundPosition - characterPosition);
+    characterPosition = foundPosition + 1;
+  }
+  return 1000 - std::min(gapsLength * 10 + missingCharactersCount, 999);
+}
+
+}  // namespace gd
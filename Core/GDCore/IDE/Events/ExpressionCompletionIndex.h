@@ -0,0 +1,241 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONCOMPLETIONINDEX_H
+#define GDCORE_EXPRESSIONCOMPLETIONINDEX_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GDCore/IDE/Events/ExpressionCompletionFinder.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class ObjectsContainer;
+class Platform;
+class VariablesContainer;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A name to be shown to the user as a completion, found by
+ * gd::ExpressionCompletionIndex.
+ */
+struct GD_CORE_API ExpressionCompletionCandidate {
+ public:
+  ExpressionCompletionCandidate(
+      ExpressionCompletionDescription::CompletionKind completionKind_,
+      const gd::String& name_,
+      const gd::String& type_,
+      int score_)
+      : completionKind(completionKind_),
+        name(name_),
+        type(type_),
+        score(score_){};
+
+  /** Default constructor, only to be used by Emscripten bindings. */
+  ExpressionCompletionCandidate()
+      : completionKind(ExpressionCompletionDescription::Object), score(0){};
+
+  /** \brief Return the kind of the completion */
+  ExpressionCompletionDescription::CompletionKind GetCompletionKind() const {
+    return completionKind;
+  }
+
+  /**
+   * \brief Return the name to insert: the name of the expression (with its
+   * namespace), of the object, of the behavior or of the variable.
+   */
+  const gd::String& GetName() const { return name; }
+
+  /**
+   * \brief Return the type of the candidate: the type returned by an
+   * expression ("number" or "string"), the type of an object or of a behavior.
+   * Empty for variables.
+   */
+  const gd::String& GetType() const { return type; }
+
+  /**
+   * \brief Return how well the candidate matches what was typed (higher is
+   * better).
+   */
+  int GetScore() const { return score; }
+
+ private:
+  ExpressionCompletionDescription::CompletionKind completionKind;
+  gd::String name;
+  gd::String type;
+  int score;
+};
+
+/**
+ * \brief Find the names (of expressions, objects, behaviors and variables)
+ * matching a completion described by gd::ExpressionCompletionFinder, ranked
+ * by how well they match what was typed.
+ *
+ * The expressions of the platform are indexed once, when the index is
+ * created. The objects of each gd::ObjectsContainer and the variables of
+ * each gd::VariablesContainer are indexed the first time they are used. A
+ * signature of their names is kept with them, and compared at each search
+ * (which only goes through the names, without allocating anything) so that
+ * they are indexed again when they were changed (or when another container
+ * was created at the address of a destroyed one).
+ *
+ * Names are matched (ignoring the case) by prefix first, then by substring
+ * and finally as a fuzzy pattern (the characters of the pattern appear in
+ * the name, in the same order). Names are sorted, so that the names starting
+ * with a prefix are found without going through all of them. Other matches
+ * are only searched for patterns of at least 3 characters, among the names
+ * sharing at least half of the trigrams (3 consecutive characters) of the
+ * pattern: only a few names are compared with the pattern, even for
+ * platforms with a lot of extensions.
+ *
+ * \see gd::ExpressionCompletionFinder
+ */
+class GD_CORE_API ExpressionCompletionIndex {
+ public:
+  /**
+   * \brief Create the index of the expressions of the platform.
+   *
+   * \warning The index must be created again if extensions are added to or
+   * removed from the platform.
+   */
+  ExpressionCompletionIndex(const gd::Platform& platform);
+  virtual ~ExpressionCompletionIndex(){};
+
+  /**
+   * \brief Forget a container that was indexed, to free its index when it's
+   * destroyed.
+   */
+  void RemoveObjectsContainer(const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Forget a container that was indexed, to free its index when it's
+   * destroyed.
+   */
+  void RemoveVariablesContainer(
+      const gd::VariablesContainer& variablesContainer);
+
+  /**
+   * \brief Return the best candidates for a completion, from the best one to
+   * the worst one.
+   *
+   * Expressions are filtered by the type required by the completion, and
+   * hidden expressions are not returned.
+   *
+   * \param globalVariables The global variables of the project.
+   * \param variables The variables of the layout.
+   * \param maxCount The maximum number of candidates to return.
+   */
+  std::vector<ExpressionCompletionCandidate> GetCompletionCandidatesFor(
+      const ExpressionCompletionDescription& description,
+      const gd::ObjectsContainer& globalObjectsContainer,
+      const gd::ObjectsContainer& objectsContainer,
+      const gd::VariablesContainer& globalVariables,
+      const gd::VariablesContainer& variables,
+      size_t maxCount);
+
+  /**
+   * \brief Return how well a name matches a pattern, or -1 if it does not
+   * match at all.
+   */
+  static int ComputeMatchScore(const gd::String& pattern,
+                               const gd::String& name);
+
+ private:
+  /**
+   * \brief Names, sorted so that names starting with a prefix are
+   * contiguous, and their trigrams.
+   */
+  class NamesIndex {
+   public:
+    void Add(const gd::String& name, const gd::String& type);
+
+    /**
+     * \brief Sort the names and index their trigrams, to be called after
+     * names are added and before searching.
+     */
+    void Build();
+
+    /**
+     * \brief Add to the candidates the names matching the pattern (and whose
+     * type is accepted).
+     */
+    void Search(const gd::String& pattern,
+                ExpressionCompletionDescription::CompletionKind completionKind,
+                const std::vector<gd::String>& acceptedTypes,
+                std::vector<ExpressionCompletionCandidate>& candidates) const;
+
+   private:
+    struct Entry {
+      gd::String name;
+      gd::String type;
+      std::u32string lowerCaseName;
+    };
+
+    void AddCandidate(
+        const Entry& entry,
+        int score,
+        ExpressionCompletionDescription::CompletionKind completionKind,
+        const std::vector<gd::String>& acceptedTypes,
+        std::vector<ExpressionCompletionCandidate>& candidates) const;
+
+    std::vector<Entry> entries;
+    std::map<std::u32string, std::vector<std::size_t> > trigrams;
+  };
+
+  /**
+   * \brief The indexed objects, groups and object variables of a container.
+   */
+  struct ObjectsContainerIndex {
+    std::uint64_t signature;  ///< The signature of the indexed names.
+    NamesIndex objects;
+    std::map<gd::String, NamesIndex> objectsVariables;
+  };
+
+  /**
+   * \brief The indexed variables of a container.
+   */
+  struct VariablesContainerIndex {
+    std::uint64_t signature;  ///< The signature of the indexed names.
+    NamesIndex variables;
+  };
+
+  /**
+   * \brief Return the index of the container, indexing it (again) if it was
+   * never indexed or if it was changed.
+   */
+  const ObjectsContainerIndex& GetObjectsContainerIndex(
+      const gd::ObjectsContainer& objectsContainer);
+
+  /**
+   * \brief Return the index of the container, indexing it (again) if it was
+   * never indexed or if it was changed.
+   */
+  const VariablesContainerIndex& GetVariablesContainerIndex(
+      const gd::VariablesContainer& variablesContainer);
+
+  static std::vector<ExpressionCompletionCandidate> GetBestCandidates(
+      std::vector<ExpressionCompletionCandidate>& candidates,
+      size_t maxCount);
+
+  NamesIndex freeExpressions;
+  std::map<gd::String, NamesIndex> objectsExpressions;  ///< Indexed by the
+                                                        ///< object types.
+  std::map<gd::String, NamesIndex> behaviorsExpressions;  ///< Indexed by the
+                                                          ///< behavior types.
+  std::map<const gd::ObjectsContainer*, ObjectsContainerIndex>
+      objectsContainers;
+  std::map<const gd::VariablesContainer*, VariablesContainerIndex>
+      variablesContainers;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONCOMPLETIONINDEX_H
@@ -0,0 +1,466 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#if !defined(EMSCRIPTEN) && !defined(_WIN32)
+#include "GDCore/IDE/PosixFileSystem.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <utility>
+#if defined(__linux__)
+#include <sys/sendfile.h>
+#endif
+
+namespace gd {
+
+namespace {
+
+std::vector<std::string> SplitPath(const std::string& path) {
+  std::vector<std::string> segments;
+  std::size_t start = 0;
+  while (start <= path.size()) {
+    std::size_t end = path.find('/', start);
+    if (end == std::string::npos) end = path.size();
+    std::string segment = path.substr(start, end - start);
+    if (segment == "..") {
+      if (!segments.empty() && segments.back() != "..")
+        segments.pop_back();
+      else if (path.empty() || path[0] != '/')
+        segments.push_back(segment);
+    } else if (!segment.empty() && segment != ".") {
+      segments.push_back(segment);
+    }
+    start = end + 1;
+  }
+  return segments;
+}
+
+std::string JoinPath(const std::vector<std::string>& segments,
+                     bool isAbsolute) {
+  std::string path = isAbsolute ? "/" : "";
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    if (i != 0) path += "/";
+    path += segments[i];
+  }
+  return path.empty() ? "." : path;
+}
+
+/**
+ * \brief Resolve the "." and ".." of a path, and remove duplicated slashs.
+ */
+std::string NormalizePath(const std::string& path) {
+  return JoinPath(SplitPath(path), !path.empty() && path[0] == '/');
+}
+
+std::string GetCurrentDirectory() {
+  std::vector<char> buffer(4096);
+  while (!getcwd(buffer.data(), buffer.size())) {
+    if (errno != ERANGE) return "/";
+    buffer.resize(buffer.size() * 2);
+  }
+  return buffer.data();
+}
+
+std::string ResolvePath(const std::string& path) {
+  if (!path.empty() && path[0] == '/') return NormalizePath(path);
+  return NormalizePath(GetCurrentDirectory() + "/" + path);
+}
+
+std::string StripTrailingSlashs(const std::string& path) {
+  std::size_t end = path.find_last_not_of('/');
+  if (end == std::string::npos) return path.empty() ? path : "/";
+  return path.substr(0, end + 1);
+}
+
+std::string GetDirName(const std::string& path) {
+  std::string strippedPath = StripTrailingSlashs(path);
+  std::size_t lastSlash = strippedPath.rfind('/');
+  if (lastSlash == std::string::npos) return ".";
+  if (lastSlash == 0) return "/";
+  return StripTrailingSlashs(strippedPath.substr(0, lastSlash));
+}
+
+bool GetStatus(const std::string& path, gd::FileStatus& status) {
+  struct stat fileStat;
+  if (stat(path.c_str(), &fileStat) != 0) return false;
+
+  status.fileExists = S_ISREG(fileStat.st_mode);
+  status.dirExists = S_ISDIR(fileStat.st_mode);
+  status.size = status.fileExists ? fileStat.st_size : 0;
+  return true;
+}
+
+void MakeDirectories(const std::string& path) {
+  std::size_t slash = path.find('/', 1);
+  while (slash != std::string::npos) {
+    mkdir(path.substr(0, slash).c_str(), 0777);
+    slash = path.find('/', slash + 1);
+  }
+  mkdir(path.c_str(), 0777);
+}
+
+bool RemoveRecursively(const std::string& path) {
+  struct stat fileStat;
+  if (lstat(path.c_str(), &fileStat) != 0) return false;
+  if (!S_ISDIR(fileStat.st_mode)) return unlink(path.c_str()) == 0;
+
+  DIR* directory = opendir(path.c_str());
+  if (!directory) return false;
+  bool succeeded = true;
+  while (struct dirent* entry = readdir(directory)) {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    if (!RemoveRecursively(path + "/" + name)) succeeded = false;
+  }
+  closedir(directory);
+  return rmdir(path.c_str()) == 0 && succeeded;
+}
+
+/**
+ * \brief Open a file for writing, creating its directory if needed.
+ */
+int OpenForWriting(const std::string& file, mode_t mode) {
+  int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  int descriptor = open(file.c_str(), flags, mode);
+  if (descriptor < 0 && errno == ENOENT) {
+    MakeDirectories(GetDirName(file));
+    descriptor = open(file.c_str(), flags, mode);
+  }
+  return descriptor;
+}
+
+bool WriteAll(int descriptor, const char* data, std::size_t size) {
+  while (size > 0) {
+    ssize_t written = write(descriptor, data, size);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+
+/**
+ * \brief Copy the content of a file to another one, letting the kernel copy
+ * it when possible, and falling back to reading and writing it.
+ */
+bool CopyContent(int input, int output, off_t size) {
+  off_t remaining = size;
+#if defined(__linux__)
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+  while (remaining > 0) {
+    ssize_t copied =
+        copy_file_range(input, nullptr, output, nullptr, remaining, 0);
+    if (copied <= 0) break;
+    remaining -= copied;
+  }
+#endif
+  while (remaining > 0) {
+    ssize_t copied = sendfile(output, input, nullptr, remaining);
+    if (copied <= 0) break;
+    remaining -= copied;
+  }
+#endif
+
+  // Copy what remains (or the whole file if the kernel can't copy it).
+  std::vector<char> buffer(64 * 1024);
+  while (true) {
+    ssize_t readSize = read(input, buffer.data(), buffer.size());
+    if (readSize == 0) return true;
+    if (readSize < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    if (!WriteAll(output, buffer.data(), readSize)) return false;
+  }
+}
+
+bool CopyFileContent(const std::string& source,
+                     const std::string& destination) {
+  if (source == destination) return true;
+
+  int input = open(source.c_str(), O_RDONLY | O_CLOEXEC);
+  if (input < 0) return false;
+  struct stat inputStat;
+  if (fstat(input, &inputStat) != 0 || !S_ISREG(inputStat.st_mode)) {
+    close(input);
+    return false;
+  }
+
+  int output = OpenForWriting(destination, inputStat.st_mode & 0777);
+  if (output < 0) {
+    close(input);
+    return false;
+  }
+
+  bool succeeded = CopyContent(input, output, inputStat.st_size);
+  close(input);
+  if (close(output) != 0) succeeded = false;
+  return succeeded;
+}
+
+bool WriteFileContent(const std::string& file, const std::string& content) {
+  int output = OpenForWriting(file, 0666);
+  if (output < 0) return false;
+
+  bool succeeded = WriteAll(output, content.data(), content.size());
+  if (close(output) != 0) succeeded = false;
+  return succeeded;
+}
+
+}  // namespace
+
+PosixFileSystem::PosixFileSystem(std::size_t threadsCount_)
+    : threadsCount(threadsCount_) {}
+
+PosixFileSystem::~PosixFileSystem() { WaitForAsyncOperations(); }
+
+void PosixFileSystem::MkDir(const gd::String& path) {
+  MakeDirectories(path.ToUTF8());
+}
+
+bool PosixFileSystem::DirExists(const gd::String& path) {
+  gd::FileStatus status;
+  return GetStatus(path.ToUTF8(), status) && status.dirExists;
+}
+
+bool PosixFileSystem::FileExists(const gd::String& path) {
+  gd::FileStatus status;
+  return GetStatus(path.ToUTF8(), status) && status.fileExists;
+}
+
+bool PosixFileSystem::ClearDir(const gd::String& directory) {
+  std::string path = directory.ToUTF8();
+  DIR* directoryHandle = opendir(path.c_str());
+  if (!directoryHandle) {
+    MakeDirectories(path);
+    return DirExists(directory);
+  }
+
+  bool succeeded = true;
+  while (struct dirent* entry = readdir(directoryHandle)) {
+    std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    if (!RemoveRecursively(path + "/" + name)) succeeded = false;
+  }
+  closedir(directoryHandle);
+  return succeeded;
+}
+
+gd::String PosixFileSystem::GetTempDir() {
+  const char* temporaryDirectory = std::getenv("TMPDIR");
+  if (!temporaryDirectory || temporaryDirectory[0] == '\0') return "/tmp";
+
+  return gd::String::FromUTF8(StripTrailingSlashs(temporaryDirectory));
+}
+
+gd::String PosixFileSystem::FileNameFrom(const gd::String& file) {
+  std::string strippedPath = StripTrailingSlashs(file.ToUTF8());
+  if (strippedPath == "/") return "";
+  return gd::String::FromUTF8(
+      strippedPath.substr(strippedPath.rfind('/') + 1));
+}
+
+gd::String PosixFileSystem::DirNameFrom(const gd::String& file) {
+  return gd::String::FromUTF8(GetDirName(file.ToUTF8()));
+}
+
+bool PosixFileSystem::MakeAbsolute(gd::String& filename,
+                                   const gd::String& baseDirectory) {
+  std::string path = filename.ToUTF8();
+  if (path.empty() || path[0] != '/')
+    path = ResolvePath(baseDirectory.ToUTF8()) + "/" + path;
+
+  filename = gd::String::FromUTF8(NormalizePath(path));
+  return true;
+}
+
+bool PosixFileSystem::IsAbsolute(const gd::String& filename) {
+  // Like the file system of the IDE, an empty path is considered absolute.
+  return filename.empty() || filename[0] == '/';
+}
+
+bool PosixFileSystem::MakeRelative(gd::String& filename,
+                                   const gd::String& baseDirectory) {
+  std::vector<std::string> segments =
+      SplitPath(ResolvePath(filename.ToUTF8()));
+  std::vector<std::string> baseSegments =
+      SplitPath(ResolvePath(baseDirectory.ToUTF8()));
+
+  std::size_t commonSegmentsCount = 0;
+  while (commonSegmentsCount < segments.size() &&
+         commonSegmentsCount < baseSegments.size() &&
+         segments[commonSegmentsCount] == baseSegments[commonSegmentsCount])
+    commonSegmentsCount++;
+
+  std::vector<std::string> relativeSegments(
+      baseSegments.size() - commonSegmentsCount, "..");
+  relativeSegments.insert(relativeSegments.end(),
+                          segments.begin() + commonSegmentsCount,
+                          segments.end());
+  filename = relativeSegments.empty()
+                 ? ""
+                 : gd::String::FromUTF8(JoinPath(relativeSegments, false));
+  return true;
+}
+
+bool PosixFileSystem::CopyFile(const gd::String& file,
+                               const gd::String& destination) {
+  return CopyFileContent(file.ToUTF8(), destination.ToUTF8());
+}
+
+bool PosixFileSystem::WriteToFile(const gd::String& file,
+                                  const gd::String& content) {
+  return WriteFileContent(file.ToUTF8(), content.Raw());
+}
+
+gd::String PosixFileSystem::ReadFile(const gd::String& file) {
+  std::string content;
+  if (!ReadBinaryFile(file, content)) return "";
+
+  return gd::String::FromUTF8(content);
+}
+
+bool PosixFileSystem::ReadBinaryFile(const gd::String& file,
+                                     std::string& content) {
+  int input = open(file.ToUTF8().c_str(), O_RDONLY | O_CLOEXEC);
+  if (input < 0) return false;
+
+  content.clear();
+  std::vector<char> buffer(64 * 1024);
+  while (true) {
+    ssize_t readSize = read(input, buffer.data(), buffer.size());
+    if (readSize == 0) break;
+    if (readSize < 0) {
+      if (errno == EINTR) continue;
+      close(input);
+      return false;
+    }
+    content.append(buffer.data(), readSize);
+  }
+  close(input);
+  return true;
+}
+
+bool PosixFileSystem::WriteBinaryFile(const gd::String& file,
+                                      const std::string& content) {
+  return WriteFileContent(file.ToUTF8(), content);
+}
+
+std::vector<gd::String> PosixFileSystem::ReadDir(const gd::String& path,
+                                                 const gd::String& extension) {
+  std::vector<gd::String> files;
+  DIR* directory = opendir(path.ToUTF8().c_str());
+  if (!directory) return files;
+
+  gd::String upperCaseExtension = extension.UpperCase();
+  while (struct dirent* entry = readdir(directory)) {
+    gd::String name = gd::String::FromUTF8(entry->d_name);
+    if (name == "." || name == "..") continue;
+
+    gd::String upperCaseName = name.UpperCase();
+    if (upperCaseName.size() >= upperCaseExtension.size() &&
+        upperCaseName.substr(upperCaseName.size() -
+                             upperCaseExtension.size()) == upperCaseExtension)
+      files.push_back(path + "/" + name);
+  }
+  closedir(directory);
+
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+std::vector<gd::FileStatus> PosixFileSystem::StatFiles(
+    const std::vector<gd::String>& paths) {
+  std::vector<gd::FileStatus> statuses(paths.size());
+  RunInParallel(paths.size(), [&paths, &statuses](std::size_t i) {
+    GetStatus(paths[i].ToUTF8(), statuses[i]);
+  });
+  return statuses;
+}
+
+std::vector<bool> PosixFileSystem::CopyFiles(
+    const std::vector<gd::FileCopyRequest>& requests) {
+  // std::vector<bool> can't be written by several threads.
+  std::vector<char> results(requests.size(), false);
+  RunInParallel(requests.size(), [&requests, &results](std::size_t i) {
+    results[i] = CopyFileContent(requests[i].source.ToUTF8(),
+                                 requests[i].destination.ToUTF8());
+  });
+  return std::vector<bool>(results.begin(), results.end());
+}
+
+std::vector<bool> PosixFileSystem::WriteFiles(
+    const std::vector<gd::FileWriteRequest>& requests) {
+  std::vector<char> results(requests.size(), false);
+  RunInParallel(requests.size(), [&requests, &results](std::size_t i) {
+    results[i] = WriteFileContent(requests[i].file.ToUTF8(),
+                                  requests[i].content.Raw());
+  });
+  return std::vector<bool>(results.begin(), results.end());
+}
+
+void PosixFileSystem::CopyFilesAsync(
+    const std::vector<gd::FileCopyRequest>& requests,
+    std::function<void(const std::vector<bool>&)> callback) {
+  std::lock_guard<std::mutex> lock(asyncOperationsMutex);
+  asyncOperations.push_back(std::thread(
+      [this, requests, callback]() { callback(CopyFiles(requests)); }));
+}
+
+void PosixFileSystem::WriteFilesAsync(
+    const std::vector<gd::FileWriteRequest>& requests,
+    std::function<void(const std::vector<bool>&)> callback) {
+  std::lock_guard<std::mutex> lock(asyncOperationsMutex);
+  asyncOperations.push_back(std::thread(
+      [this, requests, callback]() { callback(WriteFiles(requests)); }));
+}
+
+void PosixFileSystem::WaitForAsyncOperations() {
+  // Callbacks can start new operations, so wait until there are none left.
+  while (true) {
+    std::vector<std::thread> operations;
+    {
+      std::lock_guard<std::mutex> lock(asyncOperationsMutex);
+      std::swap(operations, asyncOperations);
+    }
+    if (operations.empty()) return;
+
+    for (auto& operation : operations) operation.join();
+  }
+}
+
+void PosixFileSystem::RunInParallel(
+    std::size_t count, const std::function<void(std::size_t)>& task) {
+  std::size_t usedThreadsCount =
+      threadsCount != 0 ? threadsCount : std::thread::hardware_concurrency();
+  usedThreadsCount =
+      std::max<std::size_t>(1, std::min<std::size_t>(usedThreadsCount, count));
+
+  std::atomic<std::size_t> nextIndex(0);
+  auto runTasks = [count, &nextIndex, &task]() {
+    for (std::size_t i = nextIndex++; i < count; i = nextIndex++) task(i);
+  };
+  std::vector<std::thread> threads;
+  for (std::size_t i = 1; i < usedThreadsCount; ++i)
+    threads.push_back(std::thread(runTasks));
+  runTasks();
+  for (auto& thread : threads) thread.join();
+}
+
+}  // namespace gd
+
+#endif
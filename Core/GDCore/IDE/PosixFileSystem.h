@@ -0,0 +1,116 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_POSIXFILESYSTEM_H
+#define GDCORE_POSIXFILESYSTEM_H
+#if !defined(EMSCRIPTEN) && !defined(_WIN32)
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A file system working on the files of the computer, for the
+ * platforms following POSIX (Linux, macOS...).
+ *
+ * It is meant to be used when exporting games without the IDE. Paths are
+ * handled like the file system of the IDE does with Node.js: only slashs are
+ * used as separators, copying or writing a file creates its directory if
+ * needed, and clearing a directory removes all its content.
+ *
+ * Batch operations are run on several threads, and files are copied by the
+ * kernel (with `copy_file_range` or `sendfile`) when possible.
+ *
+ * \note This file system is not available when compiling with Emscripten or
+ * on Windows.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API PosixFileSystem : public AbstractFileSystem {
+ public:
+  /**
+   * \param threadsCount The number of threads used for batch operations (0
+   * to use as many threads as the computer can run at once).
+   */
+  PosixFileSystem(std::size_t threadsCount = 0);
+
+  /**
+   * \brief Wait for the asynchronous operations to be finished before being
+   * destroyed.
+   */
+  virtual ~PosixFileSystem();
+
+  void MkDir(const gd::String& path) override;
+  bool DirExists(const gd::String& path) override;
+  bool FileExists(const gd::String& path) override;
+  bool ClearDir(const gd::String& directory) override;
+  gd::String GetTempDir() override;
+  gd::String FileNameFrom(const gd::String& file) override;
+  gd::String DirNameFrom(const gd::String& file) override;
+  bool MakeAbsolute(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool IsAbsolute(const gd::String& filename) override;
+  bool MakeRelative(gd::String& filename,
+                    const gd::String& baseDirectory) override;
+  bool CopyFile(const gd::String& file,
+                const gd::String& destination) override;
+  bool WriteToFile(const gd::String& file, const gd::String& content) override;
+  gd::String ReadFile(const gd::String& file) override;
+  bool ReadBinaryFile(const gd::String& file, std::string& content) override;
+  bool WriteBinaryFile(const gd::String& file,
+                       const std::string& content) override;
+  std::vector<gd::String> ReadDir(const gd::String& path,
+                                  const gd::String& extension = "") override;
+
+  std::vector<gd::FileStatus> StatFiles(
+      const std::vector<gd::String>& paths) override;
+  std::vector<bool> CopyFiles(
+      const std::vector<gd::FileCopyRequest>& requests) override;
+  std::vector<bool> WriteFiles(
+      const std::vector<gd::FileWriteRequest>& requests) override;
+
+  /**
+   * \brief Copy the files on another thread, which then calls the callback.
+   */
+  void CopyFilesAsync(
+      const std::vector<gd::FileCopyRequest>& requests,
+      std::function<void(const std::vector<bool>&)> callback) override;
+
+  /**
+   * \brief Write the files on another thread, which then calls the callback.
+   */
+  void WriteFilesAsync(
+      const std::vector<gd::FileWriteRequest>& requests,
+      std::function<void(const std::vector<bool>&)> callback) override;
+
+  /**
+   * \brief Wait for all the asynchronous operations to be finished (their
+   * callbacks being called).
+   */
+  void WaitForAsyncOperations();
+
+ private:
+  /**
+   * \brief Call the task for each index from 0 to count, on several threads.
+   */
+  void RunInParallel(std::size_t count,
+                     const std::function<void(std::size_t)>& task);
+
+  std::size_t threadsCount;
+  std::mutex asyncOperationsMutex;
+  std::vector<std::thread> asyncOperations;
+};
+
+}  // namespace gd
+
+#endif
+#endif  // GDCORE_POSIXFILESYSTEM_H
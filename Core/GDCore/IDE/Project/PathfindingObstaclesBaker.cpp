@@ -0,0 +1,208 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/PathfindingObstaclesBaker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/Project/SpriteInstancesBounds.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+const gd::String PathfindingObstaclesBaker::pathfindingBehaviorType =
+    "PathfindingBehavior::PathfindingBehavior";
+const gd::String PathfindingObstaclesBaker::obstacleBehaviorType =
+    "PathfindingBehavior::PathfindingObstacleBehavior";
+
+namespace {
+
+class InstancesCollector : public gd::InitialInstanceFunctor {
+ public:
+  InstancesCollector(){};
+  virtual ~InstancesCollector(){};
+
+  void operator()(gd::InitialInstance& instance) override {
+    instances.push_back(&instance);
+  }
+
+  std::vector<gd::InitialInstance*> instances;
+};
+
+struct BakedObstacle {
+  gd::String persistentUuid;
+  double x;
+  double y;
+  double width;
+  double height;
+};
+
+/**
+ * \brief The obstacles of the objects having an obstacle behavior with the
+ * same name, and the cells of the grid they cover.
+ */
+struct BakedObstacles {
+  std::vector<BakedObstacle> obstacles;
+  std::map<std::pair<int, int>, std::vector<std::size_t>> cells;
+};
+
+const gd::Object* GetInstanceObject(const gd::Project& project,
+                                    const gd::Layout& layout,
+                                    const gd::String& objectName) {
+  if (layout.HasObjectNamed(objectName)) return &layout.GetObject(objectName);
+  if (project.HasObjectNamed(objectName))
+    return &project.GetObject(objectName);
+
+  return nullptr;
+}
+
+double GetLargestCellSize(const gd::ObjectsContainer& objects) {
+  double largestCellSize = 0;
+  for (const auto& object : objects.GetObjects()) {
+    for (const gd::String& behaviorName : object->GetAllBehaviorNames()) {
+      const gd::Behavior& behavior = object->GetBehavior(behaviorName);
+      if (behavior.GetTypeName() !=
+          PathfindingObstaclesBaker::pathfindingBehaviorType)
+        continue;
+
+      largestCellSize = std::max(
+          largestCellSize,
+          std::max(behavior.GetContent().GetDoubleAttribute("cellWidth"),
+                   behavior.GetContent().GetDoubleAttribute("cellHeight")));
+    }
+  }
+
+  return largestCellSize;
+}
+
+void SerializeBakedObstacles(const BakedObstacles& bakedObstacles,
+                             double cellSize,
+                             gd::SerializerElement& element) {
+  element.SetAttribute("cellSize", cellSize);
+
+  gd::SerializerElement& obstaclesElement = element.AddChild("obstacles");
+  obstaclesElement.ConsiderAsArrayOf("obstacle");
+  for (const BakedObstacle& obstacle : bakedObstacles.obstacles) {
+    obstaclesElement.AddChild("obstacle")
+        .SetAttribute("persistentUuid", obstacle.persistentUuid)
+        .SetAttribute("x", obstacle.x)
+        .SetAttribute("y", obstacle.y)
+        .SetAttribute("width", obstacle.width)
+        .SetAttribute("height", obstacle.height);
+  }
+
+  gd::SerializerElement& cellsElement = element.AddChild("cells");
+  cellsElement.ConsiderAsArrayOf("cell");
+  for (const auto& cell : bakedObstacles.cells) {
+    gd::SerializerElement& cellElement = cellsElement.AddChild("cell");
+    cellElement.SetAttribute("x", cell.first.first);
+    cellElement.SetAttribute("y", cell.first.second);
+    gd::SerializerElement& indicesElement = cellElement.AddChild("obstacles");
+    indicesElement.ConsiderAsArrayOf("index");
+    for (std::size_t index : cell.second)
+      indicesElement.AddChild("index").SetIntValue(static_cast<int>(index));
+  }
+}
+
+}  // namespace
+
+std::size_t PathfindingObstaclesBaker::BakeProjectObstacles(
+    gd::Project& project,
+    gd::AbstractFileSystem& fs,
+    const gd::String& exportDir,
+    std::size_t maxCellsPerObstacle) {
+  gd::SpriteInstancesBounds instancesBounds(project, fs, exportDir);
+  std::size_t bakedObstaclesCount = 0;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::Layout& layout = project.GetLayout(i);
+    // Obstacles are only useful to the pathfinding behavior, which searches
+    // them in a square of twice its cell size around each node.
+    double cellSize =
+        2 * std::max(GetLargestCellSize(project), GetLargestCellSize(layout));
+    if (cellSize <= 0) continue;
+
+    InstancesCollector collector;
+    layout.GetInitialInstances().IterateOverInstances(collector);
+
+    std::map<gd::String, BakedObstacles> bakedObstaclesByBehaviorName;
+    for (const gd::InitialInstance* instance : collector.instances) {
+      const gd::Object* object =
+          GetInstanceObject(project, layout, instance->GetObjectName());
+      if (!object) continue;
+
+      const auto* spriteObject =
+          dynamic_cast<const gd::SpriteObject*>(&object->GetConfiguration());
+      if (!spriteObject) continue;
+
+      gd::String obstacleBehaviorName;
+      for (const gd::String& behaviorName : object->GetAllBehaviorNames()) {
+        if (object->GetBehavior(behaviorName).GetTypeName() ==
+            obstacleBehaviorType) {
+          obstacleBehaviorName = behaviorName;
+          break;
+        }
+      }
+      if (obstacleBehaviorName.empty() ||
+          !layout.HasBehaviorSharedData(obstacleBehaviorName))
+        continue;
+
+      BakedObstacle obstacle;
+      if (!instancesBounds.ComputeBounds(*spriteObject,
+                                         *instance,
+                                         obstacle.x,
+                                         obstacle.y,
+                                         obstacle.width,
+                                         obstacle.height))
+        continue;
+      obstacle.persistentUuid = instance->GetPersistentUuid();
+
+      int minCellX = static_cast<int>(std::floor(obstacle.x / cellSize));
+      int minCellY = static_cast<int>(std::floor(obstacle.y / cellSize));
+      int maxCellX = static_cast<int>(
+          std::floor((obstacle.x + obstacle.width) / cellSize));
+      int maxCellY = static_cast<int>(
+          std::floor((obstacle.y + obstacle.height) / cellSize));
+      if (static_cast<double>(maxCellX - minCellX + 1) *
+              (maxCellY - minCellY + 1) >
+          maxCellsPerObstacle)
+        continue;
+
+      BakedObstacles& bakedObstacles =
+          bakedObstaclesByBehaviorName[obstacleBehaviorName];
+      std::size_t index = bakedObstacles.obstacles.size();
+      bakedObstacles.obstacles.push_back(obstacle);
+      for (int x = minCellX; x <= maxCellX; ++x) {
+        for (int y = minCellY; y <= maxCellY; ++y)
+          bakedObstacles.cells[std::make_pair(x, y)].push_back(index);
+      }
+    }
+
+    for (const auto& it : bakedObstaclesByBehaviorName) {
+      gd::SerializerElement& content =
+          layout.GetBehaviorSharedData(it.first).GetContent();
+      content.RemoveChild("bakedObstacles");
+      SerializeBakedObstacles(
+          it.second, cellSize, content.AddChild("bakedObstacles"));
+      bakedObstaclesCount += it.second.obstacles.size();
+    }
+  }
+
+  return bakedObstaclesCount;
+}
+
+}  // namespace gd
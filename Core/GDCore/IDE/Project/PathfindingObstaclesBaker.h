@@ -0,0 +1,74 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PATHFINDINGOBSTACLESBAKER_H
+#define GDCORE_PATHFINDINGOBSTACLESBAKER_H
+#include <cstddef>
+
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class AbstractFileSystem;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Compute, for each scene, the obstacles for pathfinding of the
+ * initial instances, so that the game does not have to index them when the
+ * scene starts.
+ *
+ * For each scene using the pathfinding behavior, the rectangles of the
+ * instances of sprite objects having the pathfinding obstacle behavior are
+ * computed (from the size and origin of their first image, their custom size
+ * and their animation). They are stored, with a grid indexing them, in the
+ * shared data of the obstacle behavior of the scene:
+ * `{"bakedObstacles": {"cellSize", "obstacles": [{"persistentUuid", "x", "y",
+ * "width", "height"}], "cells": [{"x", "y", "obstacles": [index]}]}}`,
+ * where x and y of an obstacle are the position of its top-left corner.
+ * The size of the cells of the grid is the one searched around each node by
+ * the pathfinding behavior: twice the largest cell size of the pathfinding
+ * behaviors of the scene.
+ *
+ * The game engine uses an obstacle from the grid as long as its object was
+ * created from the instance and is still at the same position with the same
+ * size. Otherwise, the obstacle is handled as if it had not been baked.
+ *
+ * This is meant to be used on a copy of the project being exported, after
+ * the resources were copied to the export directory (images are read
+ * relatively to it) and before images are packed into texture atlases.
+ *
+ * \note Behaviors are recognized by their type, as they are declared by the
+ * PathfindingBehavior extension.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API PathfindingObstaclesBaker {
+ public:
+  /**
+   * \brief Bake the obstacles of all the scenes of the project.
+   *
+   * \param fs The file system used to read the size of images. Instances
+   * of objects whose image can't be read are not baked.
+   * \param exportDir The directory where resources were exported.
+   * \param maxCellsPerObstacle Obstacles covering more cells are not baked.
+   * \return The number of obstacles that were baked.
+   */
+  static std::size_t BakeProjectObstacles(
+      gd::Project& project,
+      gd::AbstractFileSystem& fs,
+      const gd::String& exportDir,
+      std::size_t maxCellsPerObstacle = 1024);
+
+  static const gd::String pathfindingBehaviorType;
+  static const gd::String obstacleBehaviorType;
+
+ private:
+  PathfindingObstaclesBaker();
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PATHFINDINGOBSTACLESBAKER_H
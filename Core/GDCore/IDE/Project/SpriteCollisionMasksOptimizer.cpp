@@ -0,0 +1,46 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SpriteCollisionMasksOptimizer.h"
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Polygon2dTools.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+
+namespace gd {
+
+void SpriteCollisionMasksOptimizer::OptimizeProjectCollisionMasks(
+    gd::Project& project, double tolerance) {
+  SpriteCollisionMasksOptimizer worker(tolerance);
+  gd::ProjectBrowserHelper::ExposeProjectObjects(project, worker);
+}
+
+void SpriteCollisionMasksOptimizer::DoVisitObject(gd::Object& object) {
+  auto* spriteConfiguration =
+      dynamic_cast<gd::SpriteObject*>(&object.GetConfiguration());
+  if (!spriteConfiguration) return;
+
+  for (std::size_t a = 0; a < spriteConfiguration->GetAnimationsCount(); ++a) {
+    gd::Animation& animation = spriteConfiguration->GetAnimation(a);
+    for (std::size_t d = 0; d < animation.GetDirectionsCount(); ++d) {
+      gd::Direction& direction = animation.GetDirection(d);
+      for (std::size_t s = 0; s < direction.GetSpritesCount(); ++s) {
+        gd::Sprite& sprite = direction.GetSprite(s);
+        if (sprite.IsCollisionMaskAutomatic()) continue;
+
+        sprite.SetCustomCollisionMask(
+            gd::Polygon2dTools::OptimizeCollisionMask(
+                sprite.GetCustomCollisionMask(), tolerance));
+      }
+    }
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,57 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SPRITECOLLISIONMASKSOPTIMIZER_H
+#define GDCORE_SPRITECOLLISIONMASKSOPTIMIZER_H
+
+#include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
+namespace gd {
+class Project;
+class Object;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Optimize the custom collision masks of the sprites of all the
+ * objects of a project, so that they are made of convex polygons (as
+ * required by the collision tests of the game engine) with as few vertices
+ * as possible.
+ *
+ * This is meant to be used on a copy of the project being exported.
+ *
+ * \note No bounding circle or box is exported with the masks: the game
+ * engine already rejects objects that are too far from each other with a
+ * circle computed from their size and center of rotation (see
+ * `gdjs.RuntimeObject.collisionTest`), which stays valid when objects are
+ * scaled, rotated or flipped.
+ *
+ * \see gd::Polygon2dTools::OptimizeCollisionMask
+ * \ingroup IDE
+ */
+class GD_CORE_API SpriteCollisionMasksOptimizer
+    : public ArbitraryObjectsWorker {
+ public:
+  /**
+   * \brief Optimize the collision masks of all the sprite objects of the
+   * project.
+   *
+   * \param tolerance The maximum distance, in pixels, between a removed vertex
+   * and the simplified outline.
+   */
+  static void OptimizeProjectCollisionMasks(gd::Project& project,
+                                            double tolerance = 0.5);
+
+ private:
+  SpriteCollisionMasksOptimizer(double tolerance_) : tolerance(tolerance_){};
+
+  void DoVisitObject(gd::Object& object) override;
+
+  double tolerance;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SPRITECOLLISIONMASKSOPTIMIZER_H
@@ -0,0 +1,112 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SpriteInstancesBounds.h"
+
+#include <cmath>
+#include <string>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/PngCodec.h"
+
+namespace gd {
+
+const gd::Sprite* SpriteInstancesBounds::GetInitialSprite(
+    const gd::SpriteObject& spriteObject, const gd::InitialInstance& instance) {
+  if (spriteObject.GetAnimationsCount() == 0) return nullptr;
+
+  // Invalid animations are ignored by the game engine.
+  double animationProperty = instance.GetRawDoubleProperty("animation");
+  std::size_t animationIndex =
+      animationProperty >= 0 &&
+              animationProperty < spriteObject.GetAnimationsCount()
+          ? static_cast<std::size_t>(animationProperty)
+          : 0;
+  const gd::Animation& animation = spriteObject.GetAnimation(animationIndex);
+  // The direction depends on the angle (applied to the first animation
+  // before the animation of the instance is set).
+  if (animation.UseMultipleDirections() ||
+      spriteObject.GetAnimation(0).UseMultipleDirections() ||
+      animation.GetDirectionsCount() == 0 ||
+      animation.GetDirection(0).GetSpritesCount() == 0)
+    return nullptr;
+
+  return &animation.GetDirection(0).GetSprite(0);
+}
+
+bool SpriteInstancesBounds::ComputeBounds(const gd::SpriteObject& spriteObject,
+                                          const gd::InitialInstance& instance,
+                                          double& x,
+                                          double& y,
+                                          double& width,
+                                          double& height) {
+  const gd::Sprite* sprite = GetInitialSprite(spriteObject, instance);
+  if (!sprite) return false;
+
+  unsigned int imageWidth = 0;
+  unsigned int imageHeight = 0;
+  if (!GetImageSize(sprite->GetImageName(), imageWidth, imageHeight))
+    return false;
+
+  double scaleX = 1;
+  double scaleY = 1;
+  if (instance.HasCustomSize()) {
+    scaleX = std::abs(instance.GetCustomWidth()) / imageWidth;
+    scaleY = std::abs(instance.GetCustomHeight()) / imageHeight;
+  }
+  x = instance.GetX() - sprite->GetOrigin().GetX() * scaleX;
+  y = instance.GetY() - sprite->GetOrigin().GetY() * scaleY;
+  width = imageWidth * scaleX;
+  height = imageHeight * scaleY;
+  return true;
+}
+
+bool SpriteInstancesBounds::GetImageSize(const gd::String& resourceName,
+                                         unsigned int& width,
+                                         unsigned int& height) {
+  auto it = imagesSizes.find(resourceName);
+  if (it == imagesSizes.end()) {
+    std::pair<unsigned int, unsigned int> size(0, 0);
+    const gd::ResourcesManager& resourcesManager =
+        project.GetResourcesManager();
+    if (resourcesManager.HasResource(resourceName)) {
+      const gd::Resource& resource =
+          resourcesManager.GetResource(resourceName);
+
+      // Images packed in a texture atlas have the size of their frame.
+      gd::SerializerElement metadata =
+          resource.GetMetadata().empty()
+              ? gd::SerializerElement()
+              : gd::Serializer::FromJSON(resource.GetMetadata());
+      std::string fileContent;
+      if (metadata.HasChild("atlasFrame")) {
+        const gd::SerializerElement& atlasFrame =
+            metadata.GetChild("atlasFrame");
+        size.first = atlasFrame.GetIntAttribute("width");
+        size.second = atlasFrame.GetIntAttribute("height");
+      } else if (fs.ReadBinaryFile(exportDir + "/" + resource.GetFile(),
+                                   fileContent)) {
+        gd::PngCodec::DecodeSize(fileContent, size.first, size.second);
+      }
+    }
+
+    it = imagesSizes.insert(std::make_pair(resourceName, size)).first;
+  }
+
+  width = it->second.first;
+  height = it->second.second;
+  return width != 0 && height != 0;
+}
+
+}  // namespace gd
@@ -0,0 +1,84 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SPRITEINSTANCESBOUNDS_H
+#define GDCORE_SPRITEINSTANCESBOUNDS_H
+#include <map>
+#include <utility>
+
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class AbstractFileSystem;
+class InitialInstance;
+class Sprite;
+class SpriteObject;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Compute, at export, the rectangles of the objects that the game
+ * engine will create from the initial instances of sprite objects.
+ *
+ * The size of images is read (only once for each image) from their PNG files
+ * in the export directory, or from their frame for images packed in a
+ * texture atlas (see gd::SpriteTextureAtlasesBuilder).
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API SpriteInstancesBounds {
+ public:
+  /**
+   * \param exportDir The directory where resources were exported.
+   */
+  SpriteInstancesBounds(const gd::Project& project_,
+                        gd::AbstractFileSystem& fs_,
+                        const gd::String& exportDir_)
+      : project(project_), fs(fs_), exportDir(exportDir_){};
+
+  /**
+   * \brief Return the sprite displayed by the object created from an
+   * instance when the scene starts, or nullptr if it can't be known at export
+   * (for example when it depends on the angle of the instance).
+   */
+  static const gd::Sprite* GetInitialSprite(
+      const gd::SpriteObject& spriteObject,
+      const gd::InitialInstance& instance);
+
+  /**
+   * \brief Compute the rectangle of the object created from an instance,
+   * like the game engine does (see `getDrawableX` and `getWidth` of
+   * `gdjs.SpriteRuntimeObject`). The rotation of the instance is ignored.
+   *
+   * \return false if the rectangle can't be known at export.
+   */
+  bool ComputeBounds(const gd::SpriteObject& spriteObject,
+                     const gd::InitialInstance& instance,
+                     double& x,
+                     double& y,
+                     double& width,
+                     double& height);
+
+  /**
+   * \brief Read the size of an image resource (the size of its frame if it's
+   * packed in a texture atlas).
+   *
+   * \return false if the file can't be read or is not a PNG image.
+   */
+  bool GetImageSize(const gd::String& resourceName,
+                    unsigned int& width,
+                    unsigned int& height);
+
+ private:
+  const gd::Project& project;
+  gd::AbstractFileSystem& fs;
+  gd::String exportDir;
+  std::map<gd::String, std::pair<unsigned int, unsigned int>> imagesSizes;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SPRITEINSTANCESBOUNDS_H
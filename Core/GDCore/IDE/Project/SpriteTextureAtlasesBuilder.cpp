@@ -0,0 +1,298 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/SpriteTextureAtlasesBuilder.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/NewNameGenerator.h"
+#include "GDCore/IDE/Project/ArbitraryObjectsWorker.h"
+#include "GDCore/IDE/ProjectTreeShaker.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/Localization.h"
+#include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/PngCodec.h"
+#include "GDCore/Tools/RectanglesPacker.h"
+
+namespace {
+
+/**
+ * Find the sprites of objects, and the scenes using each image.
+ */
+class SpritesCollector : public gd::ArbitraryObjectsWorker {
+ public:
+  SpritesCollector(){};
+  virtual ~SpritesCollector(){};
+
+  /**
+   * The name of the scene owning the objects being visited (empty for
+   * objects shared by all the scenes).
+   */
+  gd::String currentGroupName;
+
+  std::vector<gd::Sprite*> sprites;
+  std::map<gd::String, std::set<gd::String>> imageGroupNames;
+
+ private:
+  void DoVisitObject(gd::Object& object) override {
+    auto* spriteConfiguration =
+        dynamic_cast<gd::SpriteObject*>(&object.GetConfiguration());
+    if (!spriteConfiguration) return;
+
+    for (std::size_t a = 0; a < spriteConfiguration->GetAnimationsCount();
+         ++a) {
+      gd::Animation& animation = spriteConfiguration->GetAnimation(a);
+      for (std::size_t d = 0; d < animation.GetDirectionsCount(); ++d) {
+        gd::Direction& direction = animation.GetDirection(d);
+        for (std::size_t s = 0; s < direction.GetSpritesCount(); ++s) {
+          gd::Sprite& sprite = direction.GetSprite(s);
+          sprites.push_back(&sprite);
+          imageGroupNames[sprite.GetImageName()].insert(currentGroupName);
+        }
+      }
+    }
+  }
+};
+
+struct PackedImage {
+  gd::String resourceName;
+  gd::RgbaImage image;
+};
+
+struct AtlasPage {
+  AtlasPage(int pageSize) : packer(pageSize, pageSize){};
+
+  gd::RectanglesPacker packer;
+  /// The images packed in the page, with their (extruded) placement.
+  std::vector<std::pair<const PackedImage*, gd::RectanglesPacker::Rectangle>>
+      placements;
+};
+
+bool IsPngFile(const gd::String& file) {
+  return file.size() > 4 &&
+         file.substr(file.size() - 4).LowerCase() == ".png";
+}
+
+/**
+ * Copy an image in the page, at the given (extruded) placement, repeating its
+ * borders on one pixel around it.
+ */
+void CopyExtrudedImage(const gd::RgbaImage& image,
+                       const gd::RectanglesPacker::Rectangle& placement,
+                       gd::RgbaImage& page) {
+  for (int y = 0; y < placement.height; ++y) {
+    int sourceY = std::min(std::max(y - 1, 0), (int)image.height - 1);
+    for (int x = 0; x < placement.width; ++x) {
+      int sourceX = std::min(std::max(x - 1, 0), (int)image.width - 1);
+      const unsigned char* source = image.GetPixel(sourceX, sourceY);
+      unsigned char* destination =
+          page.GetPixel(placement.x + x, placement.y + y);
+      std::copy(source, source + 4, destination);
+    }
+  }
+}
+
+gd::String GetAtlasFrameMetadata(
+    const gd::RectanglesPacker::Rectangle& placement) {
+  gd::SerializerElement metadata;
+  gd::SerializerElement& atlasFrame = metadata.AddChild("atlasFrame");
+  atlasFrame.SetAttribute("x", placement.x + 1);
+  atlasFrame.SetAttribute("y", placement.y + 1);
+  atlasFrame.SetAttribute("width", placement.width - 2);
+  atlasFrame.SetAttribute("height", placement.height - 2);
+  return gd::Serializer::ToJSON(metadata);
+}
+
+}  // namespace
+
+namespace gd {
+
+std::size_t SpriteTextureAtlasesBuilder::BuildTextureAtlases(
+    gd::Project& project,
+    gd::AbstractFileSystem& fs,
+    const gd::String& pagesDirectory,
+    int pageSize,
+    int maxImageSize) {
+  SpritesCollector collector;
+  collector.Launch(project);
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    collector.currentGroupName = project.GetLayout(i).GetName();
+    collector.Launch(project.GetLayout(i));
+  }
+  collector.currentGroupName = "";
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    auto& eventsFunctionsExtension = project.GetEventsFunctionsExtension(e);
+    for (auto&& eventsBasedObject :
+         eventsFunctionsExtension.GetEventsBasedObjects().GetInternalVector()) {
+      collector.Launch(*eventsBasedObject);
+    }
+  }
+
+  // Read the images, grouped by the scene using them and by their smoothing
+  // (which is a setting of the whole texture at runtime).
+  gd::ResourcesManager& resourcesManager = project.GetResourcesManager();
+  gd::String projectDirectory = fs.DirNameFrom(project.GetProjectFile());
+  std::map<std::pair<gd::String, bool>, std::vector<PackedImage>> groups;
+  std::size_t pngImagesCount = 0;
+  std::size_t readImagesCount = 0;
+  for (const auto& it : collector.imageGroupNames) {
+    const gd::String& resourceName = it.first;
+    if (!resourcesManager.HasResource(resourceName)) continue;
+
+    const auto* imageResource = dynamic_cast<const gd::ImageResource*>(
+        &resourcesManager.GetResource(resourceName));
+    if (!imageResource || !imageResource->GetMetadata().empty() ||
+        !IsPngFile(imageResource->GetFile()))
+      continue;
+
+    pngImagesCount++;
+    gd::String file = imageResource->GetFile();
+    fs.MakeAbsolute(file, projectDirectory);
+    std::string fileContent;
+    if (!fs.ReadBinaryFile(file, fileContent)) continue;
+    readImagesCount++;
+
+    PackedImage packedImage;
+    packedImage.resourceName = resourceName;
+    if (!gd::PngCodec::Decode(fileContent, packedImage.image) ||
+        packedImage.image.width > (unsigned int)maxImageSize ||
+        packedImage.image.height > (unsigned int)maxImageSize ||
+        packedImage.image.width + 2 > (unsigned int)pageSize ||
+        packedImage.image.height + 2 > (unsigned int)pageSize)
+      continue;
+
+    const gd::String& groupName =
+        it.second.size() == 1 ? *it.second.begin() : "";
+    groups[std::make_pair(groupName, imageResource->IsSmooth())].push_back(
+        std::move(packedImage));
+  }
+  if (pngImagesCount > 0 && readImagesCount == 0) {
+    gd::LogWarning(
+        _("Texture atlases were not built, as images could not be read (the "
+          "file system may not support binary files)."));
+    return 0;
+  }
+
+  std::map<gd::String, gd::String> frameResourceNames;
+  std::size_t pagesCount = 0;
+  for (auto& it : groups) {
+    std::vector<PackedImage>& images = it.second;
+    if (images.size() < 2) continue;
+
+    // Pack the largest images first, which gives denser pages.
+    std::sort(images.begin(),
+              images.end(),
+              [](const PackedImage& a, const PackedImage& b) {
+                if (a.image.height != b.image.height)
+                  return a.image.height > b.image.height;
+                if (a.image.width != b.image.width)
+                  return a.image.width > b.image.width;
+                return a.resourceName < b.resourceName;
+              });
+
+    std::vector<std::unique_ptr<AtlasPage>> pages;
+    for (const auto& packedImage : images) {
+      int width = packedImage.image.width + 2;
+      int height = packedImage.image.height + 2;
+      gd::RectanglesPacker::Rectangle placement;
+      bool inserted = false;
+      for (auto& page : pages) {
+        if (page->packer.Insert(width, height, placement)) {
+          page->placements.push_back(std::make_pair(&packedImage, placement));
+          inserted = true;
+          break;
+        }
+      }
+      if (!inserted) {
+        pages.push_back(gd::make_unique<AtlasPage>(pageSize));
+        pages.back()->packer.Insert(width, height, placement);
+        pages.back()->placements.push_back(
+            std::make_pair(&packedImage, placement));
+      }
+    }
+
+    for (const auto& page : pages) {
+      // A page with a single image would not save anything.
+      if (page->placements.size() < 2) continue;
+
+      int pageWidth = 0, pageHeight = 0;
+      for (const auto& placement : page->placements) {
+        pageWidth =
+            std::max(pageWidth, placement.second.x + placement.second.width);
+        pageHeight =
+            std::max(pageHeight, placement.second.y + placement.second.height);
+      }
+
+      gd::RgbaImage pageImage(pageWidth, pageHeight);
+      for (const auto& placement : page->placements)
+        CopyExtrudedImage(
+            placement.first->image, placement.second, pageImage);
+
+      gd::String pageFile = gd::NewNameGenerator::Generate(
+          "texture-atlas-" + gd::String::From(pagesCount + 1),
+          [&fs, &pagesDirectory](const gd::String& name) {
+            return fs.FileExists(pagesDirectory + "/" + name + ".png");
+          }) + ".png";
+      pageFile = pagesDirectory + "/" + pageFile;
+      if (!fs.WriteBinaryFile(pageFile, gd::PngCodec::Encode(pageImage)))
+        continue;
+      pagesCount++;
+
+      for (const auto& placement : page->placements) {
+        const gd::String& resourceName = placement.first->resourceName;
+        std::unique_ptr<gd::Resource> frameResource(
+            resourcesManager.GetResource(resourceName).Clone());
+        frameResource->SetName(gd::NewNameGenerator::Generate(
+            resourceName + "-atlas-frame",
+            [&resourcesManager](const gd::String& name) {
+              return resourcesManager.HasResource(name);
+            }));
+        frameResource->SetFile(pageFile);
+        frameResource->SetMetadata(GetAtlasFrameMetadata(placement.second));
+        resourcesManager.AddResource(*frameResource);
+        frameResourceNames[resourceName] = frameResource->GetName();
+      }
+    }
+  }
+
+  for (gd::Sprite* sprite : collector.sprites) {
+    auto frameResourceName = frameResourceNames.find(sprite->GetImageName());
+    if (frameResourceName != frameResourceNames.end())
+      sprite->SetImageName(frameResourceName->second);
+  }
+
+  // Original images that are not used anymore are removed, so that they are
+  // neither exported nor loaded by the game.
+  if (!frameResourceNames.empty()) {
+    for (const gd::String& resourceName :
+         gd::ProjectTreeShaker::FindUnusedResources(project)) {
+      if (frameResourceNames.count(resourceName))
+        resourcesManager.RemoveResource(resourceName);
+    }
+  }
+
+  return pagesCount;
+}
+
+}  // namespace gd
@@ -0,0 +1,68 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_SPRITETEXTUREATLASESBUILDER_H
+#define GDCORE_SPRITETEXTUREATLASESBUILDER_H
+#include <cstddef>
+
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class AbstractFileSystem;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Pack the images of the sprite objects of a project into texture
+ * atlases, so that games load (and the renderer binds) fewer textures.
+ *
+ * Images of sprites are grouped by the scene using them (images used by
+ * global objects or by several scenes are put together) and by their
+ * smoothing setting, then packed into pages. For each packed image, a new
+ * image resource is added, pointing to the page, with the position of the
+ * image in its metadata (`{"atlasFrame": {"x", "y", "width", "height"}}`).
+ * Sprites are then changed to use these resources. The original resources
+ * are removed, unless they are still used by other objects or by events
+ * (see gd::ProjectTreeShaker::FindUnusedResources).
+ *
+ * Only PNG images are packed. Images are not trimmed nor rotated, and their
+ * borders are extruded by one pixel to avoid bleeding when they are scaled.
+ *
+ * This is meant to be used on a copy of the project being exported, before
+ * its resources are copied to the export directory: the files of resources
+ * are read relatively to the project file, and pages are written with an
+ * absolute path, so that they are copied with the other resources (and the
+ * removed original images are not).
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API SpriteTextureAtlasesBuilder {
+ public:
+  /**
+   * \brief Build the texture atlases of the sprite objects of the project.
+   *
+   * \param fs The file system used to read images and write pages. Nothing is
+   * done (and a warning is logged) if it does not support binary files.
+   * \param pagesDirectory The directory where pages are written.
+   * \param pageSize The maximum width and height of a page.
+   * \param maxImageSize Images with a larger width or height are not packed.
+   * \return The number of pages that were written.
+   *
+   * \see gd::AbstractFileSystem::ReadBinaryFile
+   */
+  static std::size_t BuildTextureAtlases(gd::Project& project,
+                                         gd::AbstractFileSystem& fs,
+                                         const gd::String& pagesDirectory,
+                                         int pageSize = 2048,
+                                         int maxImageSize = 512);
+
+ private:
+  SpriteTextureAtlasesBuilder();
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SPRITETEXTUREATLASESBUILDER_H
@@ -0,0 +1,396 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Project/StaticPlatformsMerger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Project/SpriteInstancesBounds.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+const gd::String StaticPlatformsMerger::platformBehaviorType =
+    "PlatformBehavior::PlatformBehavior";
+const gd::String StaticPlatformsMerger::mergedPlatformsLayerName =
+    "__MergedPlatforms";
+
+namespace {
+
+/**
+ * \brief Find the names of the objects and groups that can be modified by
+ * events.
+ */
+class ModifiedObjectsFinder : public gd::ReadOnlyArbitraryEventsWorker {
+ public:
+  ModifiedObjectsFinder(const gd::Platform& platform_)
+      : platform(platform_), hasJavaScriptCode(false){};
+  virtual ~ModifiedObjectsFinder(){};
+
+  const std::set<gd::String>& GetModifiedObjectsNames() const {
+    return modifiedObjectsNames;
+  }
+
+  bool HasJavaScriptCode() const { return hasJavaScriptCode; }
+
+ private:
+  void DoVisitEvent(const gd::BaseEvent& event) override {
+    if (event.GetType() == "BuiltinCommonInstructions::JsCode")
+      hasJavaScriptCode = true;
+  }
+
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    // Conditions of the platform behavior extension are about the platforms
+    // the characters are on, which are replaced by the merged ones.
+    if (isCondition && instruction.GetType().find("PlatformBehavior::") != 0)
+      return;
+
+    const gd::InstructionMetadata& metadata =
+        isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                          platform, instruction.GetType())
+                    : gd::MetadataProvider::GetActionMetadata(
+                          platform, instruction.GetType());
+    for (std::size_t i = 0; i < instruction.GetParametersCount() &&
+                            i < metadata.GetParametersCount();
+         ++i) {
+      if (gd::ParameterMetadata::IsObject(metadata.GetParameter(i).GetType()))
+        modifiedObjectsNames.insert(
+            instruction.GetParameter(i).GetPlainString());
+    }
+  }
+
+  const gd::Platform& platform;
+  std::set<gd::String> modifiedObjectsNames;
+  bool hasJavaScriptCode;
+};
+
+class InstancesCollector : public gd::InitialInstanceFunctor {
+ public:
+  InstancesCollector(){};
+  virtual ~InstancesCollector(){};
+
+  void operator()(gd::InitialInstance& instance) override {
+    instances.push_back(&instance);
+  }
+
+  std::vector<gd::InitialInstance*> instances;
+};
+
+struct Rectangle {
+  double x;
+  double y;
+  double width;
+  double height;
+};
+
+/**
+ * \brief The static platforms with the same properties, which can be merged
+ * together.
+ */
+struct StaticPlatforms {
+  std::vector<gd::Object*> objects;
+  std::vector<Rectangle> rectangles;
+  const gd::Sprite* sprite = nullptr;
+};
+
+bool AreEqual(double a, double b) { return std::abs(a - b) < 0.001; }
+
+/**
+ * \brief Merge the rectangles that are next to each other (or overlapping) on
+ * the same rows, then (if asked) the resulting rows that are next to each
+ * other on the same columns.
+ */
+std::vector<Rectangle> MergeRectangles(std::vector<Rectangle> rectangles,
+                                       bool mergeVertically) {
+  std::sort(rectangles.begin(),
+            rectangles.end(),
+            [](const Rectangle& a, const Rectangle& b) {
+              return std::tie(a.y, a.height, a.x) <
+                     std::tie(b.y, b.height, b.x);
+            });
+  std::vector<Rectangle> rows;
+  for (const Rectangle& rectangle : rectangles) {
+    if (!rows.empty()) {
+      Rectangle& row = rows.back();
+      if (AreEqual(row.y, rectangle.y) &&
+          AreEqual(row.height, rectangle.height) &&
+          rectangle.x <= row.x + row.width + 0.001) {
+        row.width = std::max(row.width, rectangle.x + rectangle.width - row.x);
+        continue;
+      }
+    }
+    rows.push_back(rectangle);
+  }
+  if (!mergeVertically) return rows;
+
+  std::sort(
+      rows.begin(), rows.end(), [](const Rectangle& a, const Rectangle& b) {
+        return std::tie(a.x, a.width, a.y) < std::tie(b.x, b.width, b.y);
+      });
+  std::vector<Rectangle> columns;
+  for (const Rectangle& row : rows) {
+    if (!columns.empty()) {
+      Rectangle& column = columns.back();
+      if (AreEqual(column.x, row.x) && AreEqual(column.width, row.width) &&
+          row.y <= column.y + column.height + 0.001) {
+        column.height =
+            std::max(column.height, row.y + row.height - column.y);
+        continue;
+      }
+    }
+    columns.push_back(row);
+  }
+  return columns;
+}
+
+bool IsModified(const gd::Project& project,
+                const gd::Layout& layout,
+                const gd::String& objectName,
+                const std::set<gd::String>& modifiedObjectsNames) {
+  if (modifiedObjectsNames.count(objectName)) return true;
+
+  for (const gd::ObjectGroupsContainer* groups :
+       {&layout.GetObjectGroups(), &project.GetObjectGroups()}) {
+    for (std::size_t i = 0; i < groups->size(); ++i) {
+      const gd::ObjectGroup& group = groups->Get(i);
+      if (group.Find(objectName) && modifiedObjectsNames.count(group.GetName()))
+        return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * \brief Return the platform behavior of an object if it's a static platform.
+ */
+const gd::Behavior* GetStaticPlatformBehavior(
+    const gd::Project& project,
+    const gd::Layout& layout,
+    const gd::Object& object,
+    const std::set<gd::String>& modifiedObjectsNames) {
+  if (!dynamic_cast<const gd::SpriteObject*>(&object.GetConfiguration()))
+    return nullptr;
+
+  // Other behaviors could move the object.
+  const std::vector<gd::String> behaviorNames = object.GetAllBehaviorNames();
+  if (behaviorNames.size() != 1) return nullptr;
+  const gd::Behavior& behavior = object.GetBehavior(behaviorNames[0]);
+  if (behavior.GetTypeName() != StaticPlatformsMerger::platformBehaviorType)
+    return nullptr;
+
+  if (IsModified(project, layout, object.GetName(), modifiedObjectsNames))
+    return nullptr;
+
+  return &behavior;
+}
+
+gd::String GetUnusedObjectName(const gd::Project& project,
+                               const gd::Layout& layout,
+                               const gd::String& baseName) {
+  gd::String name = baseName;
+  for (std::size_t i = 2;
+       layout.HasObjectNamed(name) || project.HasObjectNamed(name);
+       ++i)
+    name = baseName + gd::String::From(i);
+
+  return name;
+}
+
+/**
+ * \brief Add the object with the instances covering the merged rectangles.
+ */
+void AddMergedPlatforms(gd::Project& project,
+                        gd::Layout& layout,
+                        const gd::String& layerName,
+                        const StaticPlatforms& platforms,
+                        const std::vector<Rectangle>& rectangles) {
+  const gd::Object& firstObject = *platforms.objects[0];
+  gd::Object& mergedObject =
+      layout.InsertObject(firstObject, layout.GetObjectsCount());
+  mergedObject.SetName(GetUnusedObjectName(
+      project, layout, "__MergedPlatform" + firstObject.GetName()));
+  mergedObject.GetVariables().Clear();
+  mergedObject.GetEffects().Clear();
+
+  // The automatic collision mask of an image with its origin at the top-left
+  // corner is stretched to the size of each instance.
+  gd::Sprite sprite = *platforms.sprite;
+  sprite.GetOrigin().SetX(0);
+  sprite.GetOrigin().SetY(0);
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  animation.GetDirection(0).AddSprite(sprite);
+  auto& spriteObject =
+      dynamic_cast<gd::SpriteObject&>(mergedObject.GetConfiguration());
+  spriteObject.RemoveAllAnimations();
+  spriteObject.AddAnimation(animation);
+
+  for (const Rectangle& rectangle : rectangles) {
+    gd::InitialInstance& instance =
+        layout.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName(mergedObject.GetName());
+    instance.SetLayer(layerName);
+    instance.SetX(rectangle.x);
+    instance.SetY(rectangle.y);
+    instance.SetHasCustomSize(true);
+    instance.SetCustomWidth(rectangle.width);
+    instance.SetCustomHeight(rectangle.height);
+  }
+}
+
+std::size_t MergeLayoutStaticPlatforms(
+    gd::Project& project,
+    gd::Layout& layout,
+    const std::set<gd::String>& modifiedObjectsNames,
+    gd::SpriteInstancesBounds& instancesBounds) {
+  std::map<gd::String, const gd::Behavior*> platformBehaviors;
+  for (const auto& object : layout.GetObjects()) {
+    const gd::Behavior* behavior = GetStaticPlatformBehavior(
+        project, layout, *object, modifiedObjectsNames);
+    if (behavior) platformBehaviors[object->GetName()] = behavior;
+  }
+  if (platformBehaviors.empty()) return 0;
+
+  InstancesCollector collector;
+  layout.GetInitialInstances().IterateOverInstances(collector);
+
+  std::map<gd::String, std::vector<Rectangle>> rectanglesByObject;
+  std::map<gd::String, const gd::Sprite*> spritesByObject;
+  std::set<gd::String> unmergeableObjectsNames;
+  for (const gd::InitialInstance* instance : collector.instances) {
+    const gd::String& objectName = instance->GetObjectName();
+    if (!platformBehaviors.count(objectName) ||
+        unmergeableObjectsNames.count(objectName))
+      continue;
+
+    const auto& spriteObject = dynamic_cast<const gd::SpriteObject&>(
+        layout.GetObject(objectName).GetConfiguration());
+    const gd::Sprite* sprite =
+        gd::SpriteInstancesBounds::GetInitialSprite(spriteObject, *instance);
+    Rectangle rectangle;
+    if (std::fmod(instance->GetAngle(), 360) != 0 || !sprite ||
+        !sprite->IsCollisionMaskAutomatic() ||
+        !instancesBounds.ComputeBounds(spriteObject,
+                                       *instance,
+                                       rectangle.x,
+                                       rectangle.y,
+                                       rectangle.width,
+                                       rectangle.height)) {
+      unmergeableObjectsNames.insert(objectName);
+      continue;
+    }
+
+    rectanglesByObject[objectName].push_back(rectangle);
+    if (!spritesByObject.count(objectName))
+      spritesByObject[objectName] = sprite;
+  }
+
+  std::map<std::tuple<gd::String, bool, double>, StaticPlatforms>
+      platformsByProperties;
+  for (auto& it : rectanglesByObject) {
+    if (unmergeableObjectsNames.count(it.first)) continue;
+
+    const gd::SerializerElement& content =
+        platformBehaviors[it.first]->GetContent();
+    StaticPlatforms& platforms = platformsByProperties[std::make_tuple(
+        content.GetStringAttribute("platformType", "NormalPlatform"),
+        content.GetBoolAttribute("canBeGrabbed", true),
+        content.GetDoubleAttribute("yGrabOffset"))];
+    platforms.objects.push_back(&layout.GetObject(it.first));
+    platforms.rectangles.insert(
+        platforms.rectangles.end(), it.second.begin(), it.second.end());
+    if (!platforms.sprite) platforms.sprite = spritesByObject[it.first];
+  }
+
+  std::size_t mergedInstancesCount = 0;
+  gd::String layerName;
+  for (const auto& it : platformsByProperties) {
+    const StaticPlatforms& platforms = it.second;
+    // Jumpthru platforms can only be crossed from below by characters, so
+    // platforms on top of each other are kept.
+    std::vector<Rectangle> rectangles = MergeRectangles(
+        platforms.rectangles, std::get<0>(it.first) != "Jumpthru");
+    if (rectangles.size() >= platforms.rectangles.size()) continue;
+
+    if (layerName.empty()) {
+      layerName = StaticPlatformsMerger::mergedPlatformsLayerName;
+      for (std::size_t i = 2; layout.HasLayerNamed(layerName); ++i)
+        layerName = StaticPlatformsMerger::mergedPlatformsLayerName +
+                    gd::String::From(i);
+      layout.InsertNewLayer(layerName, layout.GetLayersCount());
+      layout.GetLayer(layerName).SetVisibility(false);
+    }
+
+    AddMergedPlatforms(project, layout, layerName, platforms, rectangles);
+    for (gd::Object* object : platforms.objects)
+      object->RemoveBehavior(object->GetAllBehaviorNames()[0]);
+    mergedInstancesCount += platforms.rectangles.size();
+  }
+
+  return mergedInstancesCount;
+}
+
+}  // namespace
+
+std::size_t StaticPlatformsMerger::MergeProjectStaticPlatforms(
+    gd::Project& project,
+    gd::AbstractFileSystem& fs,
+    const gd::String& exportDir) {
+  ModifiedObjectsFinder finder(project.GetCurrentPlatform());
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    finder.Launch(project.GetLayout(i).GetEvents());
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i)
+    finder.Launch(project.GetExternalEvents(i).GetEvents());
+  if (finder.HasJavaScriptCode()) return 0;
+
+  // Instances of external layouts can be created in any scene, with the
+  // platform behavior.
+  std::set<gd::String> modifiedObjectsNames = finder.GetModifiedObjectsNames();
+  for (std::size_t i = 0; i < project.GetExternalLayoutsCount(); ++i) {
+    InstancesCollector collector;
+    project.GetExternalLayout(i).GetInitialInstances().IterateOverInstances(
+        collector);
+    for (const gd::InitialInstance* instance : collector.instances)
+      modifiedObjectsNames.insert(instance->GetObjectName());
+  }
+
+  gd::SpriteInstancesBounds instancesBounds(project, fs, exportDir);
+  std::size_t mergedInstancesCount = 0;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    mergedInstancesCount += MergeLayoutStaticPlatforms(
+        project, project.GetLayout(i), modifiedObjectsNames, instancesBounds);
+  }
+
+  return mergedInstancesCount;
+}
+
+}  // namespace gd
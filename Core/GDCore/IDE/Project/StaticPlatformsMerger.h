@@ -0,0 +1,69 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_STATICPLATFORMSMERGER_H
+#define GDCORE_STATICPLATFORMSMERGER_H
+#include <cstddef>
+
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class AbstractFileSystem;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Merge the adjacent platforms of the scenes that never move into
+ * larger platforms, so that the platformer characters have less platforms to
+ * test collisions with (in particular in levels made of tiles).
+ *
+ * A scene object is a static platform if it's a sprite object whose only
+ * behavior is the platform behavior and which is never used by actions
+ * (directly or with a group), by instructions of the platform behavior
+ * extension or by external layouts. Nothing is done if the project has
+ * JavaScript code events, as they could modify any object.
+ *
+ * The instances of static platforms having the same platform properties are
+ * merged into rectangles (jumpthru platforms only horizontally). For each of
+ * these groups, a new object is added to the scene, with the platform
+ * behavior and an instance for each rectangle, on a hidden layer. The
+ * platform behavior is then removed from the merged objects, whose instances
+ * are kept to be displayed (and are still usable by the other conditions).
+ * Instances must not be rotated and must use their automatic collision mask.
+ * Otherwise, their object is not merged.
+ *
+ * This is meant to be used on a copy of the project being exported, after the
+ * resources were copied to the export directory (the size of images is read
+ * from their files) and before events are stripped.
+ *
+ * \note Behaviors are recognized by their type, as they are declared by the
+ * PlatformBehavior extension.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API StaticPlatformsMerger {
+ public:
+  /**
+   * \brief Merge the static platforms of all the scenes of the project.
+   *
+   * \param fs The file system used to read the size of images.
+   * \param exportDir The directory where resources were exported.
+   * \return The number of instances that were merged.
+   */
+  static std::size_t MergeProjectStaticPlatforms(gd::Project& project,
+                                                 gd::AbstractFileSystem& fs,
+                                                 const gd::String& exportDir);
+
+  static const gd::String platformBehaviorType;
+  static const gd::String mergedPlatformsLayerName;
+
+ private:
+  StaticPlatformsMerger();
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_STATICPLATFORMSMERGER_H
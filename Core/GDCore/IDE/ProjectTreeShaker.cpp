@@ -0,0 +1,535 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectTreeShaker.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Extensions/Metadata/ParameterMetadata.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
+#include "GDCore/IDE/Project/ResourcesInUseHelper.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/PropertyDescriptor.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+namespace {
+
+/**
+ * \brief Collect the strings that events can use as a reference to an
+ * element: instruction types, parameters, and the names and texts of
+ * expressions.
+ *
+ * Collecting more strings than actual references only keeps more elements.
+ */
+class ReferencesFinder : public gd::ReadOnlyArbitraryEventsWorker,
+                         public gd::ExpressionParser2NodeWorker {
+ public:
+  ReferencesFinder(std::set<gd::String>& references_)
+      : references(references_), hasJavaScriptCode(false){};
+  virtual ~ReferencesFinder(){};
+
+  bool HasJavaScriptCode() const { return hasJavaScriptCode; }
+
+ private:
+  void DoVisitEvent(const gd::BaseEvent& event) override {
+    if (event.GetType() == "BuiltinCommonInstructions::JsCode")
+      hasJavaScriptCode = true;
+
+    for (const auto& expressionAndMetadata :
+         event.GetAllExpressionsWithMetadata())
+      VisitExpression(*expressionAndMetadata.first);
+  }
+
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override {
+    references.insert(instruction.GetType());
+    for (const gd::Expression& parameter : instruction.GetParameters())
+      VisitExpression(parameter);
+  }
+
+  void VisitExpression(const gd::Expression& expression) {
+    references.insert(expression.GetPlainString());
+    gd::ExpressionNode* rootNode = expression.GetRootNode();
+    if (rootNode) rootNode->Visit(*this);
+  }
+
+  void OnVisitSubExpressionNode(SubExpressionNode& node) override {
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode& node) override {
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode& node) override {
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode& node) override {}
+  void OnVisitTextNode(TextNode& node) override {
+    references.insert(node.text);
+  }
+  void OnVisitVariableNode(VariableNode& node) override {
+    references.insert(node.name);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode& node) override {
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode& node) override {
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode& node) override {
+    references.insert(node.identifierName);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode& node) override {
+    references.insert(node.objectName);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode& node) override {
+    references.insert(node.objectName);
+    references.insert(node.functionName);
+    for (auto& parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode& node) override {}
+
+  std::set<gd::String>& references;
+  bool hasJavaScriptCode;
+};
+
+/**
+ * \brief Find the references in events.
+ *
+ * \return true if the events have JavaScript code events.
+ */
+bool FindReferences(const gd::EventsList& events,
+                    std::set<gd::String>& references) {
+  ReferencesFinder finder(references);
+  finder.Launch(events);
+  return finder.HasJavaScriptCode();
+}
+
+bool FindReferences(const gd::EventsFunctionsContainer& eventsFunctions,
+                    std::set<gd::String>& references) {
+  bool hasJavaScriptCode = false;
+  for (const auto& eventsFunction : eventsFunctions.GetInternalVector()) {
+    if (FindReferences(eventsFunction->GetEvents(), references))
+      hasJavaScriptCode = true;
+  }
+  return hasJavaScriptCode;
+}
+
+class InstancesObjectsFinder : public gd::InitialInstanceFunctor {
+ public:
+  InstancesObjectsFinder(std::set<gd::String>& references_)
+      : references(references_){};
+  virtual ~InstancesObjectsFinder(){};
+
+  void operator()(gd::InitialInstance& instance) override {
+    references.insert(instance.GetObjectName());
+  }
+
+  std::set<gd::String>& references;
+};
+
+/**
+ * \brief Call a function for all the objects containers of the project
+ * (global objects first, then scenes and events based objects).
+ */
+template <class Function>
+void IterateOverObjectsContainers(gd::Project& project, Function function) {
+  function(static_cast<gd::ObjectsContainer&>(project));
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+    function(static_cast<gd::ObjectsContainer&>(project.GetLayout(i)));
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    auto& eventsBasedObjects =
+        project.GetEventsFunctionsExtension(e).GetEventsBasedObjects();
+    for (std::size_t i = 0; i < eventsBasedObjects.size(); ++i)
+      function(static_cast<gd::ObjectsContainer&>(eventsBasedObjects.at(i)));
+  }
+}
+
+/**
+ * \brief Find the references in the properties of the behaviors of objects.
+ */
+void FindBehaviorsPropertiesReferences(gd::Project& project,
+                                       std::set<gd::String>& references) {
+  IterateOverObjectsContainers(
+      project, [&references](gd::ObjectsContainer& container) {
+        for (const auto& object : container.GetObjects()) {
+          for (const gd::String& behaviorName :
+               object->GetAllBehaviorNames()) {
+            for (const auto& property :
+                 object->GetBehavior(behaviorName).GetProperties())
+              references.insert(property.second.GetValue());
+          }
+        }
+      });
+}
+
+template <class T>
+std::size_t GetSerializedSize(const T& element) {
+  gd::SerializerElement serializedElement;
+  element.SerializeTo(serializedElement);
+  return gd::Serializer::ToJSON(serializedElement).size();
+}
+
+bool IsObjectReferenced(
+    const gd::String& objectName,
+    const std::set<gd::String>& references,
+    const std::vector<gd::ObjectGroupsContainer*>& groupsContainers) {
+  if (references.count(objectName)) return true;
+
+  for (const gd::ObjectGroupsContainer* groups : groupsContainers) {
+    for (std::size_t i = 0; i < groups->size(); ++i) {
+      const gd::ObjectGroup& group = groups->Get(i);
+      if (group.Find(objectName) && references.count(group.GetName()))
+        return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+gd::String TreeShakingResult::GetReport() const {
+  gd::String report =
+      gd::String::From(removedObjects.size()) + " objects, " +
+      gd::String::From(removedBehaviors.size()) + " behaviors, " +
+      gd::String::From(removedEventsFunctions.size()) +
+      " events functions and " + gd::String::From(removedResources.size()) +
+      " resources were removed (" + gd::String::From(removedDataSize) +
+      " bytes of data and " + gd::String::From(removedFilesSize) +
+      " bytes of files).";
+
+  auto addList = [&report](const gd::String& title,
+                           const std::vector<gd::String>& names) {
+    if (names.empty()) return;
+    report += "\n" + title + ":";
+    for (const gd::String& name : names) report += "\n- " + name;
+  };
+  addList("Objects", removedObjects);
+  addList("Behaviors", removedBehaviors);
+  addList("Events functions", removedEventsFunctions);
+  addList("Resources", removedResources);
+  return report;
+}
+
+TreeShakingResult ProjectTreeShaker::ShakeProject(gd::Project& project,
+                                                 gd::AbstractFileSystem& fs) {
+  TreeShakingResult result;
+
+  // Find the references made by scenes, which are the roots of the game.
+  std::set<gd::String> references;
+  bool scenesHaveJavaScriptCode = false;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    if (FindReferences(project.GetLayout(i).GetEvents(), references))
+      scenesHaveJavaScriptCode = true;
+
+    InstancesObjectsFinder instancesObjectsFinder(references);
+    project.GetLayout(i).GetInitialInstances().IterateOverInstances(
+        instancesObjectsFinder);
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    if (FindReferences(project.GetExternalEvents(i).GetEvents(), references))
+      scenesHaveJavaScriptCode = true;
+  }
+  for (std::size_t i = 0; i < project.GetExternalLayoutsCount(); ++i) {
+    InstancesObjectsFinder instancesObjectsFinder(references);
+    project.GetExternalLayout(i).GetInitialInstances().IterateOverInstances(
+        instancesObjectsFinder);
+  }
+  FindBehaviorsPropertiesReferences(project, references);
+
+  // Remove the objects of scenes and the global objects that are not
+  // referenced (objects of events based objects are all kept).
+  if (!scenesHaveJavaScriptCode) {
+    std::vector<gd::ObjectGroupsContainer*> groupsContainers;
+    groupsContainers.push_back(&project.GetObjectGroups());
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i)
+      groupsContainers.push_back(&project.GetLayout(i).GetObjectGroups());
+
+    std::vector<std::pair<gd::ObjectsContainer*, gd::String>> containers;
+    containers.push_back(std::make_pair(&project, ""));
+    for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+      gd::Layout& layout = project.GetLayout(i);
+      containers.push_back(std::make_pair(&layout, layout.GetName() + "/"));
+    }
+    for (auto& containerAndPrefix : containers) {
+      gd::ObjectsContainer& container = *containerAndPrefix.first;
+      std::vector<gd::String> unusedObjectsNames;
+      for (const auto& object : container.GetObjects()) {
+        if (!IsObjectReferenced(
+                object->GetName(), references, groupsContainers))
+          unusedObjectsNames.push_back(object->GetName());
+      }
+
+      for (const gd::String& objectName : unusedObjectsNames) {
+        result.removedDataSize +=
+            GetSerializedSize(container.GetObject(objectName));
+        container.RemoveObject(objectName);
+        for (gd::ObjectGroupsContainer* groups : groupsContainers) {
+          for (std::size_t i = 0; i < groups->size(); ++i)
+            groups->Get(i).RemoveObject(objectName);
+        }
+        result.removedObjects.push_back(containerAndPrefix.second +
+                                        objectName);
+      }
+    }
+  }
+
+  // Find the events functions and the behaviors that are reachable, until
+  // no new one is found.
+  std::set<gd::String> usedBehaviorTypes;
+  IterateOverObjectsContainers(
+      project, [&usedBehaviorTypes](gd::ObjectsContainer& container) {
+        for (const auto& object : container.GetObjects()) {
+          for (const gd::String& behaviorName : object->GetAllBehaviorNames())
+            usedBehaviorTypes.insert(
+                object->GetBehavior(behaviorName).GetTypeName());
+        }
+      });
+
+  std::set<gd::String> extensionsWithJavaScriptCode;
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const gd::EventsFunctionsExtension& extension =
+        project.GetEventsFunctionsExtension(e);
+    const auto& eventsBasedObjects = extension.GetEventsBasedObjects();
+    for (std::size_t i = 0; i < eventsBasedObjects.size(); ++i) {
+      if (FindReferences(eventsBasedObjects.at(i).GetEventsFunctions(),
+                         references))
+        extensionsWithJavaScriptCode.insert(extension.GetName());
+    }
+  }
+
+  std::set<const gd::EventsFunction*> reachableEventsFunctions;
+  std::set<const gd::EventsBasedBehavior*> reachableBehaviors;
+  bool hasFoundReachableElements = true;
+  while (hasFoundReachableElements) {
+    hasFoundReachableElements = false;
+    for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+         ++e) {
+      const gd::EventsFunctionsExtension& extension =
+          project.GetEventsFunctionsExtension(e);
+      const gd::String& extensionName = extension.GetName();
+      bool isWholeExtensionReachable =
+          scenesHaveJavaScriptCode ||
+          extensionsWithJavaScriptCode.count(extensionName);
+
+      for (const auto& eventsFunction : extension.GetInternalVector()) {
+        const gd::String& functionName = eventsFunction->GetName();
+        if (reachableEventsFunctions.count(eventsFunction.get()) ||
+            !(isWholeExtensionReachable ||
+              gd::EventsFunctionsExtension::IsExtensionLifecycleEventsFunction(
+                  functionName) ||
+              references.count(extensionName + "::" + functionName)))
+          continue;
+
+        reachableEventsFunctions.insert(eventsFunction.get());
+        hasFoundReachableElements = true;
+        if (FindReferences(eventsFunction->GetEvents(), references))
+          extensionsWithJavaScriptCode.insert(extensionName);
+        // Actions changing a value use the function getting it.
+        if (eventsFunction->GetFunctionType() ==
+            gd::EventsFunction::ActionWithOperator)
+          references.insert(extensionName +
+                            "::" + eventsFunction->GetGetterName());
+      }
+
+      const auto& eventsBasedBehaviors = extension.GetEventsBasedBehaviors();
+      for (std::size_t i = 0; i < eventsBasedBehaviors.size(); ++i) {
+        const gd::EventsBasedBehavior& eventsBasedBehavior =
+            eventsBasedBehaviors.at(i);
+        if (reachableBehaviors.count(&eventsBasedBehavior) ||
+            !(isWholeExtensionReachable ||
+              usedBehaviorTypes.count(extensionName + "::" +
+                                      eventsBasedBehavior.GetName())))
+          continue;
+
+        reachableBehaviors.insert(&eventsBasedBehavior);
+        hasFoundReachableElements = true;
+        if (FindReferences(eventsBasedBehavior.GetEventsFunctions(),
+                           references))
+          extensionsWithJavaScriptCode.insert(extensionName);
+        for (const auto& property :
+             eventsBasedBehavior.GetPropertyDescriptors().GetInternalVector()) {
+          if (property->GetType() == "Behavior" &&
+              !property->GetExtraInfo().empty())
+            usedBehaviorTypes.insert(property->GetExtraInfo()[0]);
+        }
+      }
+    }
+  }
+
+  // Remove the unreachable free events functions and behaviors.
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    gd::EventsFunctionsExtension& extension =
+        project.GetEventsFunctionsExtension(e);
+    std::vector<gd::String> unreachableFunctionsNames;
+    for (const auto& eventsFunction : extension.GetInternalVector()) {
+      if (!reachableEventsFunctions.count(eventsFunction.get()))
+        unreachableFunctionsNames.push_back(eventsFunction->GetName());
+    }
+    for (const gd::String& functionName : unreachableFunctionsNames) {
+      result.removedDataSize +=
+          GetSerializedSize(extension.GetEventsFunction(functionName));
+      extension.RemoveEventsFunction(functionName);
+      result.removedEventsFunctions.push_back(extension.GetName() +
+                                              "::" + functionName);
+    }
+
+    auto& eventsBasedBehaviors = extension.GetEventsBasedBehaviors();
+    std::vector<gd::String> unreachableBehaviorsNames;
+    for (std::size_t i = 0; i < eventsBasedBehaviors.size(); ++i) {
+      if (!reachableBehaviors.count(&eventsBasedBehaviors.at(i)))
+        unreachableBehaviorsNames.push_back(
+            eventsBasedBehaviors.at(i).GetName());
+    }
+    for (const gd::String& behaviorName : unreachableBehaviorsNames) {
+      result.removedDataSize +=
+          GetSerializedSize(eventsBasedBehaviors.Get(behaviorName));
+      eventsBasedBehaviors.Remove(behaviorName);
+      result.removedBehaviors.push_back(extension.GetName() +
+                                        "::" + behaviorName);
+    }
+  }
+
+  // Remove the resources that are not used by the remaining elements.
+  gd::ResourcesManager& resourcesManager = project.GetResourcesManager();
+  std::vector<gd::String> unusedResourcesNames = FindUnusedResources(project);
+  gd::String projectDirectory = fs.DirNameFrom(project.GetProjectFile());
+  std::vector<gd::String> removedFiles;
+  for (const gd::String& resourceName : unusedResourcesNames) {
+    const gd::Resource& resource = resourcesManager.GetResource(resourceName);
+    result.removedDataSize += GetSerializedSize(resource);
+    gd::String file = resource.GetFile();
+    fs.MakeAbsolute(file, projectDirectory);
+    removedFiles.push_back(file);
+
+    resourcesManager.RemoveResource(resourceName);
+    result.removedResources.push_back(resourceName);
+  }
+  for (const gd::FileStatus& status : fs.StatFiles(removedFiles))
+    result.removedFilesSize += status.size;
+
+  return result;
+}
+
+std::vector<gd::String> ProjectTreeShaker::FindUnusedResources(
+    gd::Project& project) {
+  // Resources can be used by their name in JavaScript code, which can't be
+  // analyzed.
+  std::set<gd::String> references;
+  bool hasJavaScriptCode = false;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    if (FindReferences(project.GetLayout(i).GetEvents(), references))
+      hasJavaScriptCode = true;
+  }
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    if (FindReferences(project.GetExternalEvents(i).GetEvents(), references))
+      hasJavaScriptCode = true;
+  }
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const gd::EventsFunctionsExtension& extension =
+        project.GetEventsFunctionsExtension(e);
+    if (FindReferences(extension, references)) hasJavaScriptCode = true;
+    const auto& eventsBasedBehaviors = extension.GetEventsBasedBehaviors();
+    for (std::size_t i = 0; i < eventsBasedBehaviors.size(); ++i) {
+      if (FindReferences(eventsBasedBehaviors.at(i).GetEventsFunctions(),
+                         references))
+        hasJavaScriptCode = true;
+    }
+    const auto& eventsBasedObjects = extension.GetEventsBasedObjects();
+    for (std::size_t i = 0; i < eventsBasedObjects.size(); ++i) {
+      if (FindReferences(eventsBasedObjects.at(i).GetEventsFunctions(),
+                         references))
+        hasJavaScriptCode = true;
+    }
+  }
+  if (hasJavaScriptCode) return std::vector<gd::String>();
+  FindBehaviorsPropertiesReferences(project, references);
+
+  gd::ResourcesInUseHelper resourcesInUse;
+  project.ExposeResources(resourcesInUse);
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    gd::EventsFunctionsExtension& extension =
+        project.GetEventsFunctionsExtension(e);
+    auto& eventsBasedBehaviors = extension.GetEventsBasedBehaviors();
+    for (std::size_t i = 0; i < eventsBasedBehaviors.size(); ++i) {
+      for (auto& eventsFunction : eventsBasedBehaviors.at(i)
+                                      .GetEventsFunctions()
+                                      .GetInternalVector())
+        gd::LaunchResourceWorkerOnEvents(
+            project, eventsFunction->GetEvents(), resourcesInUse);
+    }
+    auto& eventsBasedObjects = extension.GetEventsBasedObjects();
+    for (std::size_t i = 0; i < eventsBasedObjects.size(); ++i) {
+      gd::EventsBasedObject& eventsBasedObject = eventsBasedObjects.at(i);
+      for (auto& eventsFunction :
+           eventsBasedObject.GetEventsFunctions().GetInternalVector())
+        gd::LaunchResourceWorkerOnEvents(
+            project, eventsFunction->GetEvents(), resourcesInUse);
+      for (auto& object : eventsBasedObject.GetObjects())
+        object->GetConfiguration().ExposeResources(resourcesInUse);
+    }
+  }
+
+  // Only the kinds of resources known by gd::ResourcesInUseHelper can be
+  // removed.
+  static const std::vector<gd::String> removableKinds = {"image",
+                                                         "audio",
+                                                         "font",
+                                                         "json",
+                                                         "tilemap",
+                                                         "tileset",
+                                                         "video",
+                                                         "bitmapFont"};
+  const gd::ResourcesManager& resourcesManager = project.GetResourcesManager();
+  std::vector<gd::String> unusedResourcesNames;
+  for (const auto& resource : resourcesManager.GetAllResources()) {
+    const gd::String& kind = resource->GetKind();
+    if (std::find(removableKinds.begin(), removableKinds.end(), kind) !=
+            removableKinds.end() &&
+        !resourcesInUse.GetAll(kind).count(resource->GetName()) &&
+        !references.count(resource->GetName()))
+      unusedResourcesNames.push_back(resource->GetName());
+  }
+
+  return unusedResourcesNames;
+}
+
+}  // namespace gd
@@ -0,0 +1,133 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PROJECTTREESHAKER_H
+#define GDCORE_PROJECTTREESHAKER_H
+#include <cstddef>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class Project;
+class AbstractFileSystem;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief The elements removed from a project by gd::ProjectTreeShaker.
+ */
+class GD_CORE_API TreeShakingResult {
+ public:
+  TreeShakingResult() : removedDataSize(0), removedFilesSize(0){};
+
+  /**
+   * \brief The names of the removed objects, prefixed by the name of their
+   * scene ("Scene/Object") if they are not global.
+   */
+  const std::vector<gd::String>& GetRemovedObjects() const {
+    return removedObjects;
+  }
+
+  /**
+   * \brief The types of the removed events based behaviors.
+   */
+  const std::vector<gd::String>& GetRemovedBehaviors() const {
+    return removedBehaviors;
+  }
+
+  /**
+   * \brief The full names ("Extension::Function") of the removed free events
+   * functions.
+   */
+  const std::vector<gd::String>& GetRemovedEventsFunctions() const {
+    return removedEventsFunctions;
+  }
+
+  /**
+   * \brief The names of the removed resources.
+   */
+  const std::vector<gd::String>& GetRemovedResources() const {
+    return removedResources;
+  }
+
+  /**
+   * \brief The size, in bytes, of the removed elements serialized in JSON.
+   */
+  std::size_t GetRemovedDataSize() const { return removedDataSize; }
+
+  /**
+   * \brief The size, in bytes, of the files of the removed resources (only
+   * the ones whose size is known by the file system).
+   */
+  std::size_t GetRemovedFilesSize() const { return removedFilesSize; }
+
+  /**
+   * \brief Return a human readable report listing the removed elements.
+   */
+  gd::String GetReport() const;
+
+ private:
+  friend class ProjectTreeShaker;
+
+  std::vector<gd::String> removedObjects;
+  std::vector<gd::String> removedBehaviors;
+  std::vector<gd::String> removedEventsFunctions;
+  std::vector<gd::String> removedResources;
+  std::size_t removedDataSize;
+  std::size_t removedFilesSize;
+};
+
+/**
+ * \brief Tool class removing from a project the elements that the game can't
+ * use, so that they are not exported.
+ *
+ * Elements are kept when they are reachable from the scenes:
+ * - objects having instances (in scenes or external layouts) or referenced by
+ * the events of scenes or external events (by their name or the name of one
+ * of their groups), or by the properties of behaviors,
+ * - free events functions called by reachable events, or being lifecycle
+ * functions,
+ * - events based behaviors used by remaining objects or required by other
+ * reachable behaviors (all their functions are kept),
+ * - resources used by remaining elements, or whose name is written in events
+ * or in the properties of behaviors.
+ *
+ * Names of objects and resources built at runtime (in expressions) can't be
+ * known: this is only meant to be used on a copy of the project being
+ * exported, when asked by the user. Objects and events functions are all
+ * kept if scenes have JavaScript code events, and all the events functions
+ * of an extension are kept if it has reachable JavaScript code events.
+ * Resources are all kept if any remaining events have JavaScript code events.
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ProjectTreeShaker {
+ public:
+  /**
+   * \brief Remove the unreachable elements of the project.
+   *
+   * \param fs The file system giving the size of the files of the removed
+   * resources (with gd::AbstractFileSystem::StatFiles).
+   */
+  static TreeShakingResult ShakeProject(gd::Project& project,
+                                        gd::AbstractFileSystem& fs);
+
+  /**
+   * \brief Return the names of the resources that are not used by the
+   * project, nor written in its events or in the properties of behaviors.
+   *
+   * Nothing is returned if the project has JavaScript code events, as they
+   * can use any resource by its name.
+   */
+  static std::vector<gd::String> FindUnusedResources(gd::Project& project);
+
+ private:
+  ProjectTreeShaker(){};
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PROJECTTREESHAKER_H
@@ -113,6 +113,11 @@ InitialInstance& InitialInstance::ResetPersistentUuid() {
   return *this;
 }
 
+const gd::String& InitialInstance::GetPersistentUuid() const {
+  if (persistentUuid.empty()) persistentUuid = UUID::MakeUuid4();
+  return persistentUuid;
+}
+
 std::map<gd::String, gd::PropertyDescriptor>
 InitialInstance::GetCustomProperties(gd::Project& project, gd::Layout& layout) {
   // Find an object
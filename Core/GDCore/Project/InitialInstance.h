@@ -263,6 +263,12 @@ class GD_CORE_API InitialInstance {
    * the same initial instance between serialization.
    */
   InitialInstance& ResetPersistentUuid();
+
+  /**
+   * \brief Get the persistent UUID of the instance. It's also given to the
+   * object created from the instance in the game.
+   */
+  const gd::String& GetPersistentUuid() const;
   ///@}
 
  private:
@@ -15,6 +15,9 @@
 #include <vector>
 
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Serialization.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
@@ -34,6 +37,7 @@
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerHash.h"
 #include "GDCore/String.h"
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
@@ -67,6 +71,9 @@ Project::Project()
       sizeOnStartupMode("adaptWidth"),
       projectUuid(""),
       useDeprecatedZeroAsDefaultZOrder(false),
+      reorderConditionsByCost(false),
+      shareExternalEventsCode(false),
+      eventsFunctionsInliningMaxCodeGrowth(0),
       useExternalSourceFiles(false),
       isPlayableWithKeyboard(false),
       isPlayableWithGamepad(false),
@@ -687,6 +694,15 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   }
   // end of compatibility code
 
+  SetReorderConditionsByCost(
+      propElement.GetBoolAttribute("reorderConditionsByCost", false));
+  SetShareExternalEventsCode(
+      propElement.GetBoolAttribute("shareExternalEventsCode", false));
+  int inliningMaxCodeGrowth = propElement.GetIntAttribute(
+      "eventsFunctionsInliningMaxCodeGrowth", 0);
+  SetEventsFunctionsInliningMaxCodeGrowth(
+      inliningMaxCodeGrowth > 0 ? inliningMaxCodeGrowth : 0);
+
   // Compatibility with GD <= 5.0.0-beta101
   if (!propElement.HasAttribute("projectUuid") &&
       !propElement.HasChild("projectUuid")) {
@@ -921,6 +937,17 @@ void Project::SerializeTo(SerializerElement& element) const {
   }
   // end of compatibility code
 
+  if (reorderConditionsByCost) {
+    propElement.SetAttribute("reorderConditionsByCost", true);
+  }
+  if (shareExternalEventsCode) {
+    propElement.SetAttribute("shareExternalEventsCode", true);
+  }
+  if (eventsFunctionsInliningMaxCodeGrowth != 0) {
+    propElement.SetAttribute("eventsFunctionsInliningMaxCodeGrowth",
+                             (int)eventsFunctionsInliningMaxCodeGrowth);
+  }
+
   extensionProperties.SerializeTo(propElement.AddChild("extensionProperties"));
 
   SerializerElement& platformsElement = propElement.AddChild("platforms");
@@ -980,6 +1007,122 @@ void Project::SerializeTo(SerializerElement& element) const {
         externalSourceFilesElement.AddChild("sourceFile"));
 }
 
+namespace {
+bool SerializeEventsContentTo(const gd::EventsList& events,
+                              const std::vector<gd::String>& path,
+                              std::size_t pathIndex,
+                              SerializerElement& element) {
+  if (pathIndex == path.size()) {
+    EventsListSerialization::SerializeEventsTo(events, element);
+    return true;
+  }
+
+  const gd::BaseEvent* event = nullptr;
+  const gd::EventsList* list = &events;
+  for (; pathIndex < path.size(); ++pathIndex) {
+    if (!list) return false;
+
+    std::size_t index = path[pathIndex].To<std::size_t>();
+    if (gd::String::From(index) != path[pathIndex] || index >= list->size())
+      return false;
+
+    event = &list->GetEvent(index);
+    list = event->CanHaveSubEvents() ? &event->GetSubEvents() : nullptr;
+  }
+
+  EventsListSerialization::SerializeEventTo(*event, element);
+  return true;
+}
+
+bool SerializeScopeContentTo(const gd::ObjectsContainer& objects,
+                             const gd::VariablesContainer& variables,
+                             const std::vector<gd::String>& path,
+                             std::size_t pathIndex,
+                             SerializerElement& element) {
+  if (pathIndex + 1 == path.size() && path[pathIndex] == "variables") {
+    variables.SerializeTo(element);
+    return true;
+  }
+  if (pathIndex + 2 == path.size() && path[pathIndex] == "objects" &&
+      objects.HasObjectNamed(path[pathIndex + 1])) {
+    objects.GetObject(path[pathIndex + 1]).SerializeTo(element);
+    return true;
+  }
+
+  return false;
+}
+
+gd::String UnescapeContentHashPathSegment(const gd::String& segment) {
+  // "%" and "/" are ASCII characters, so UTF-8 bytes can be compared.
+  const std::string& escapedName = segment.Raw();
+  std::string name;
+  for (std::size_t i = 0; i < escapedName.size(); ++i) {
+    if (escapedName.compare(i, 3, "%25") == 0) {
+      name += '%';
+      i += 2;
+    } else if (escapedName.compare(i, 3, "%2F") == 0) {
+      name += '/';
+      i += 2;
+    } else {
+      name += escapedName[i];
+    }
+  }
+
+  return gd::String::FromUTF8(name);
+}
+}  // namespace
+
+gd::String Project::EscapeContentHashPathSegment(const gd::String& name) {
+  return name.FindAndReplace("%", "%25").FindAndReplace("/", "%2F");
+}
+
+gd::String Project::ComputeContentHash(const gd::String& path) const {
+  std::vector<gd::String> parts;
+  if (!path.empty()) parts = path.Split(U'/');
+  for (gd::String& part : parts) part = UnescapeContentHashPathSegment(part);
+
+  SerializerElement element;
+  bool found = false;
+  if (parts.empty()) {
+    SerializeTo(element);
+    found = true;
+  } else if (parts[0] == "layouts" && parts.size() >= 2 &&
+             HasLayoutNamed(parts[1])) {
+    const gd::Layout& layout = GetLayout(parts[1]);
+    if (parts.size() == 2) {
+      layout.SerializeTo(element);
+      found = true;
+    } else if (parts.size() == 3 && parts[2] == "instances") {
+      layout.GetInitialInstances().SerializeTo(element);
+      found = true;
+    } else if (parts[2] == "events") {
+      found = SerializeEventsContentTo(layout.GetEvents(), parts, 3, element);
+    } else {
+      found = SerializeScopeContentTo(
+          layout, layout.GetVariables(), parts, 2, element);
+    }
+  } else if (parts[0] == "externalEvents" && parts.size() >= 2 &&
+             HasExternalEventsNamed(parts[1])) {
+    const gd::ExternalEvents& externalEvents = GetExternalEvents(parts[1]);
+    if (parts.size() == 2) {
+      externalEvents.SerializeTo(element);
+      found = true;
+    } else if (parts[2] == "events") {
+      found = SerializeEventsContentTo(
+          externalEvents.GetEvents(), parts, 3, element);
+    }
+  } else if (parts[0] == "eventsFunctionsExtensions" && parts.size() == 2 &&
+             HasEventsFunctionsExtensionNamed(parts[1])) {
+    GetEventsFunctionsExtension(parts[1]).SerializeTo(element);
+    found = true;
+  } else {
+    found = SerializeScopeContentTo(*this, GetVariables(), parts, 0, element);
+  }
+
+  if (!found) return "";
+  return SerializerHash::ToString(SerializerHash::ComputeHash(element));
+}
+
 bool Project::ValidateName(const gd::String& name) {
   if (name.empty()) return false;
 
@@ -1108,6 +1251,10 @@ void Project::Init(const gd::Project& game) {
   sizeOnStartupMode = game.sizeOnStartupMode;
   projectUuid = game.projectUuid;
   useDeprecatedZeroAsDefaultZOrder = game.useDeprecatedZeroAsDefaultZOrder;
+  reorderConditionsByCost = game.reorderConditionsByCost;
+  shareExternalEventsCode = game.shareExternalEventsCode;
+  eventsFunctionsInliningMaxCodeGrowth =
+      game.eventsFunctionsInliningMaxCodeGrowth;
 
   author = game.author;
   authorIds = game.authorIds;
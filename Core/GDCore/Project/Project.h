@@ -401,6 +401,60 @@ class GD_CORE_API Project : public ObjectsContainer {
     useDeprecatedZeroAsDefaultZOrder = enable;
   }
 
+  /**
+   * \brief Return true if the generated code can evaluate the conditions of
+   * events in a different order than the one of the events sheet, so that the
+   * cheapest are evaluated first.
+   *
+   * \see gd::ConditionsReorderer
+   */
+  bool GetReorderConditionsByCost() const { return reorderConditionsByCost; }
+
+  /**
+   * \brief Set if the generated code can evaluate the conditions of events in
+   * a different order than the one of the events sheet (false by default).
+   */
+  void SetReorderConditionsByCost(bool enable) {
+    reorderConditionsByCost = enable;
+  }
+
+  /**
+   * \brief Return true if the external events linked by scenes are generated
+   * once, in functions shared by the scenes, instead of being copied in the
+   * code of each scene linking them.
+   *
+   * \see gd::SharedExternalEventsFinder
+   */
+  bool GetShareExternalEventsCode() const { return shareExternalEventsCode; }
+
+  /**
+   * \brief Set if the external events linked by scenes are generated once, in
+   * functions shared by the scenes (false by default).
+   */
+  void SetShareExternalEventsCode(bool enable) {
+    shareExternalEventsCode = enable;
+  }
+
+  /**
+   * \brief Return the number of characters of code that can be added to the
+   * code of each scene by inlining the expression events functions it calls.
+   * 0 if the functions must not be inlined.
+   *
+   * \see gd::EventsFunctionsInliner
+   */
+  std::size_t GetEventsFunctionsInliningMaxCodeGrowth() const {
+    return eventsFunctionsInliningMaxCodeGrowth;
+  }
+
+  /**
+   * \brief Set the number of characters of code that can be added to the code
+   * of each scene by inlining the expression events functions it calls (0 by
+   * default, to not inline functions).
+   */
+  void SetEventsFunctionsInliningMaxCodeGrowth(std::size_t maxCodeGrowth) {
+    eventsFunctionsInliningMaxCodeGrowth = maxCodeGrowth;
+  }
+
   /**
    * \brief Change the project UUID.
    */
@@ -602,6 +656,43 @@ class GD_CORE_API Project : public ObjectsContainer {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Compute the hash of the content of a part of the project, to know
+   * if it was changed since the last time the hash was computed.
+   *
+   * Only the requested part is serialized to compute the hash, which does not
+   * change when the project is saved and loaded again. The hash is not
+   * cached: it's computed again at each call, in a time proportional to the
+   * size of the part, so callers should keep it rather than calling this
+   * method repeatedly, and ask for the smallest parts they need.
+   *
+   * \note Hashes are not cached in the nodes of the project because they
+   * could not be invalidated reliably: the project is mostly changed through
+   * the references returned by its getters (GetVariables, GetEvents,
+   * GetObject...) rather than through setters of the nodes owning them.
+   *
+   * \param path The part of the project, as names separated by "/" (names
+   * containing "/" must be escaped with EscapeContentHashPathSegment):
+   * - "" for the whole project,
+   * - "layouts/<name>", "externalEvents/<name>" or
+   * "eventsFunctionsExtensions/<name>",
+   * - "objects/<name>" or "variables" (global or after "layouts/<name>/"),
+   * - "layouts/<name>/instances",
+   * - "layouts/<name>/events" or "externalEvents/<name>/events", followed by
+   * the indices of an event and its sub-events (like "events/2/0").
+   * \return The hash as a string of hexadecimal digits, or an empty string if
+   * the path does not exist.
+   *
+   * \see gd::SerializerHash
+   */
+  gd::String ComputeContentHash(const gd::String& path) const;
+
+  /**
+   * \brief Escape a name to be used as a segment of the path given to
+   * ComputeContentHash ("%" and "/" are percent-encoded).
+   */
+  static gd::String EscapeContentHashPathSegment(const gd::String& name);
+
   /**
    * Get the major version of GDevelop used to save the project.
    */
@@ -1047,6 +1138,14 @@ class GD_CORE_API Project : public ObjectsContainer {
                                           ///< instead of the highest Z order
                                           ///< found on the layer at the scene
                                           ///< startup.
+  bool reorderConditionsByCost;  ///< If true, the cheapest conditions are
+                                 ///< evaluated first.
+  bool shareExternalEventsCode;  ///< If true, linked external events are
+                                 ///< generated in shared functions.
+  std::size_t eventsFunctionsInliningMaxCodeGrowth;  ///< The code that can be
+                                                     ///< added to each scene
+                                                     ///< by inlining events
+                                                     ///< functions.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
   gd::VariablesContainer variables;  ///< Initial global variables
   std::vector<std::unique_ptr<gd::ExternalLayout> >
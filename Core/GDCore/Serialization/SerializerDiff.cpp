@@ -0,0 +1,322 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/SerializerDiff.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+
+namespace gd {
+
+namespace {
+
+/**
+ * Return, for each value, true if it's part of the longest increasing
+ * subsequence of the values.
+ */
+std::vector<bool> GetLongestIncreasingSubsequence(
+    const std::vector<std::size_t>& values) {
+  // For each length, the index of the smallest value ending a subsequence of
+  // this length.
+  std::vector<std::size_t> tails;
+  std::vector<std::size_t> previous(values.size(), values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    auto tail = std::lower_bound(
+        tails.begin(), tails.end(), values[i], [&values](std::size_t index,
+                                                         std::size_t value) {
+          return values[index] < value;
+        });
+    if (tail != tails.begin()) previous[i] = *(tail - 1);
+    if (tail == tails.end())
+      tails.push_back(i);
+    else
+      *tail = i;
+  }
+
+  std::vector<bool> isInSubsequence(values.size(), false);
+  if (tails.empty()) return isInSubsequence;
+  for (std::size_t i = tails.back(); i < values.size(); i = previous[i])
+    isInSubsequence[i] = true;
+
+  return isInSubsequence;
+}
+
+bool AreKeysValid(const std::vector<gd::String>& keys) {
+  std::set<gd::String> uniqueKeys;
+  for (const gd::String& key : keys) {
+    if (key.empty() || !uniqueKeys.insert(key).second) return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+bool SerializerDiff::AreValuesEqual(const SerializerValue& value,
+                                    const SerializerValue& otherValue) {
+  bool isNumber = value.IsInt() || value.IsDouble();
+  bool otherIsNumber = otherValue.IsInt() || otherValue.IsDouble();
+  if (isNumber || otherIsNumber)
+    return isNumber && otherIsNumber &&
+           value.GetDouble() == otherValue.GetDouble();
+
+  if (value.IsBoolean() || otherValue.IsBoolean())
+    return value.IsBoolean() && otherValue.IsBoolean() &&
+           value.GetBool() == otherValue.GetBool();
+
+  return value.GetString() == otherValue.GetString();
+}
+
+SerializerElement SerializerDiff::ComputePatch(const SerializerElement& from,
+                                               const SerializerElement& to) {
+  SerializerElement patch;
+  if (from.valueUndefined != to.valueUndefined ||
+      from.isArray != to.isArray || from.arrayOf != to.arrayOf) {
+    patch.AddChild("replace") = to;
+    return patch;
+  }
+
+  if (!to.valueUndefined &&
+      !AreValuesEqual(from.elementValue, to.elementValue))
+    patch.AddChild("value").SetValue(to.elementValue);
+
+  for (const auto& attribute : to.attributes) {
+    auto fromAttribute = from.attributes.find(attribute.first);
+    if (fromAttribute == from.attributes.end() ||
+        !AreValuesEqual(fromAttribute->second, attribute.second))
+      patch.AddChild("attributes").attributes[attribute.first] =
+          attribute.second;
+  }
+  for (const auto& attribute : from.attributes) {
+    if (to.attributes.find(attribute.first) != to.attributes.end()) continue;
+
+    SerializerElement& removedAttributes = patch.AddChild("removedAttributes");
+    removedAttributes.ConsiderAsArrayOf("name");
+    removedAttributes.AddChild("name").SetStringValue(attribute.first);
+  }
+
+  ComputeChildrenPatch(from, to, patch);
+  return patch;
+}
+
+void SerializerDiff::ComputeChildrenPatch(const SerializerElement& from,
+                                          const SerializerElement& to,
+                                          SerializerElement& patch) {
+  gd::String identifier = GetChildrenIdentifier(from, to);
+  std::vector<gd::String> fromKeys = GetChildrenKeys(from, identifier);
+  std::vector<gd::String> toKeys = GetChildrenKeys(to, identifier);
+
+  std::map<gd::String, std::size_t> toIndices;
+  for (std::size_t i = 0; i < toKeys.size(); ++i) toIndices[toKeys[i]] = i;
+
+  SerializerElement childrenPatch;
+  childrenPatch.SetAttribute("identifier", identifier);
+
+  // Find the children that are kept, in their original order. Children of
+  // objects must also keep their name.
+  std::vector<std::size_t> keptFromIndices;
+  std::vector<std::size_t> keptToIndices;
+  std::set<std::size_t> keptToIndicesSet;
+  for (std::size_t i = 0; i < fromKeys.size(); ++i) {
+    auto toIndex = toIndices.find(fromKeys[i]);
+    if (toIndex != toIndices.end() &&
+        (from.isArray ||
+         from.children[i].first == to.children[toIndex->second].first)) {
+      keptFromIndices.push_back(i);
+      keptToIndices.push_back(toIndex->second);
+      keptToIndicesSet.insert(toIndex->second);
+    } else {
+      SerializerElement& removed = childrenPatch.AddChild("removed");
+      removed.ConsiderAsArrayOf("key");
+      removed.AddChild("key").SetStringValue(fromKeys[i]);
+    }
+  }
+
+  // The largest set of kept children already in the right order stays in
+  // place, the others are moved.
+  std::vector<bool> isInPlace = GetLongestIncreasingSubsequence(keptToIndices);
+  for (std::size_t i = 0; i < keptFromIndices.size(); ++i) {
+    const gd::String& key = fromKeys[keptFromIndices[i]];
+    if (!isInPlace[i]) {
+      SerializerElement& moved = childrenPatch.AddChild("moved");
+      moved.ConsiderAsArrayOf("child");
+      moved.AddChild("child")
+          .SetAttribute("key", key)
+          .SetAttribute("index", static_cast<int>(keptToIndices[i]));
+    }
+
+    SerializerElement childPatch =
+        ComputePatch(*from.children[keptFromIndices[i]].second,
+                     *to.children[keptToIndices[i]].second);
+    if (!IsEmpty(childPatch)) {
+      SerializerElement& changed = childrenPatch.AddChild("changed");
+      changed.ConsiderAsArrayOf("child");
+      SerializerElement& change = changed.AddChild("child");
+      change.SetAttribute("key", key);
+      change.AddChild("patch") = childPatch;
+    }
+  }
+
+  for (std::size_t i = 0; i < toKeys.size(); ++i) {
+    if (keptToIndicesSet.find(i) != keptToIndicesSet.end()) continue;
+
+    SerializerElement& inserted = childrenPatch.AddChild("inserted");
+    inserted.ConsiderAsArrayOf("child");
+    SerializerElement& insertion = inserted.AddChild("child");
+    insertion.SetAttribute("key", toKeys[i])
+        .SetAttribute("index", static_cast<int>(i))
+        .SetAttribute("name", to.children[i].first);
+    insertion.AddChild("element") = *to.children[i].second;
+  }
+
+  if (!childrenPatch.GetAllChildren().empty())
+    patch.AddChild("children") = childrenPatch;
+}
+
+void SerializerDiff::ApplyPatch(SerializerElement& element,
+                                const SerializerElement& patch) {
+  if (patch.HasChild("replace")) {
+    element = patch.GetChild("replace");
+    return;
+  }
+
+  if (patch.HasChild("value"))
+    element.SetValue(patch.GetChild("value").GetValue());
+
+  if (patch.HasChild("attributes")) {
+    const SerializerElement& attributes = patch.GetChild("attributes");
+    for (const auto& attribute : attributes.attributes) {
+      element.RemoveChild(attribute.first);
+      element.attributes[attribute.first] = attribute.second;
+    }
+    // Attributes are stored as children when the patch is read from JSON.
+    for (const auto& child : attributes.children) {
+      element.RemoveChild(child.first);
+      element.attributes[child.first] = child.second->GetValue();
+    }
+  }
+  if (patch.HasChild("removedAttributes")) {
+    for (const auto& child : patch.GetChild("removedAttributes").children)
+      element.attributes.erase(child.second->GetStringValue());
+  }
+
+  if (patch.HasChild("children"))
+    ApplyChildrenPatch(element, patch.GetChild("children"));
+}
+
+void SerializerDiff::ApplyChildrenPatch(SerializerElement& element,
+                                        const SerializerElement& patch) {
+  std::vector<gd::String> keys =
+      GetChildrenKeys(element, patch.GetStringAttribute("identifier"));
+  std::map<gd::String, std::size_t> indices;
+  for (std::size_t i = 0; i < keys.size(); ++i) indices[keys[i]] = i;
+
+  if (patch.HasChild("changed")) {
+    for (const auto& change : patch.GetChild("changed").children) {
+      auto index = indices.find(change.second->GetStringAttribute("key"));
+      if (index != indices.end())
+        ApplyPatch(*element.children[index->second].second,
+                   change.second->GetChild("patch"));
+    }
+  }
+
+  // Children inserted or moved, with the index where they must be.
+  std::vector<std::pair<
+      std::size_t,
+      std::pair<gd::String, std::shared_ptr<SerializerElement> > > >
+      insertions;
+  std::set<std::size_t> removedIndices;
+  if (patch.HasChild("removed")) {
+    for (const auto& removed : patch.GetChild("removed").children) {
+      auto index = indices.find(removed.second->GetStringValue());
+      if (index != indices.end()) removedIndices.insert(index->second);
+    }
+  }
+  if (patch.HasChild("moved")) {
+    for (const auto& moved : patch.GetChild("moved").children) {
+      auto index = indices.find(moved.second->GetStringAttribute("key"));
+      if (index == indices.end()) continue;
+
+      removedIndices.insert(index->second);
+      insertions.push_back(
+          std::make_pair(moved.second->GetIntAttribute("index"),
+                         element.children[index->second]));
+    }
+  }
+  if (patch.HasChild("inserted")) {
+    for (const auto& inserted : patch.GetChild("inserted").children) {
+      std::shared_ptr<SerializerElement> child(
+          new SerializerElement(inserted.second->GetChild("element")));
+      insertions.push_back(std::make_pair(
+          inserted.second->GetIntAttribute("index"),
+          std::make_pair(inserted.second->GetStringAttribute("name"), child)));
+    }
+  }
+
+  std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement> > >
+      children;
+  for (std::size_t i = 0; i < element.children.size(); ++i) {
+    if (removedIndices.find(i) == removedIndices.end())
+      children.push_back(element.children[i]);
+  }
+
+  // Inserting in the order of the final indices puts each child at its place,
+  // as the children before it are already there.
+  std::stable_sort(
+      insertions.begin(),
+      insertions.end(),
+      [](const decltype(insertions)::value_type& insertion,
+         const decltype(insertions)::value_type& otherInsertion) {
+        return insertion.first < otherInsertion.first;
+      });
+  for (auto& insertion : insertions) {
+    children.insert(
+        children.begin() + std::min(insertion.first, children.size()),
+        insertion.second);
+  }
+
+  element.children = children;
+  element.ResetLastIndexedChild();
+}
+
+gd::String SerializerDiff::GetChildrenIdentifier(
+    const SerializerElement& from, const SerializerElement& to) {
+  std::vector<gd::String> identifiers;
+  if (from.isArray) {
+    identifiers.push_back("persistentUuid");
+    identifiers.push_back("name");
+  } else {
+    identifiers.push_back("childName");
+  }
+
+  for (const gd::String& identifier : identifiers) {
+    if (AreKeysValid(GetChildrenKeys(from, identifier)) &&
+        AreKeysValid(GetChildrenKeys(to, identifier)))
+      return identifier;
+  }
+
+  return "index";
+}
+
+std::vector<gd::String> SerializerDiff::GetChildrenKeys(
+    const SerializerElement& element, const gd::String& identifier) {
+  std::vector<gd::String> keys;
+  for (std::size_t i = 0; i < element.children.size(); ++i) {
+    if (identifier == "index")
+      keys.push_back(gd::String::From(i));
+    else if (identifier == "childName")
+      keys.push_back(element.children[i].first);
+    else
+      keys.push_back(
+          element.children[i].second->GetStringAttribute(identifier));
+  }
+
+  return keys;
+}
+
+}  // namespace gd
@@ -0,0 +1,91 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SERIALIZERDIFF_H
+#define GDCORE_SERIALIZERDIFF_H
+#include <vector>
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief Compute the changes between two gd::SerializerElement trees, and
+ * apply them to another tree.
+ *
+ * The changes are a patch, which is itself a gd::SerializerElement, so that it
+ * can be stored or sent using gd::Serializer::ToJSON. A patch only contains
+ * what was changed:
+ * - the new value of the element,
+ * - the attributes that were set or removed,
+ * - the edit script of the children: the children that were removed,
+ *   inserted, moved or changed (with their own patch).
+ *
+ * Children of arrays are identified by their "persistentUuid" or "name" (for
+ * example, instances and objects), so that inserting an element at the
+ * beginning of an array is not seen as a change of all the following ones.
+ * When children can't be identified this way, they are identified by their
+ * name (in objects) or by their index (in arrays).
+ *
+ * \see gd::SerializerElement
+ */
+class GD_CORE_API SerializerDiff {
+ public:
+  /**
+   * \brief Compute the patch transforming the element \a from into \a to.
+   *
+   * \return The patch, which has no children if the elements are equal.
+   */
+  static SerializerElement ComputePatch(const SerializerElement& from,
+                                        const SerializerElement& to);
+
+  /**
+   * \brief Apply a patch computed by ComputePatch to an element, which must be
+   * equal to the element the patch was computed from.
+   */
+  static void ApplyPatch(SerializerElement& element,
+                         const SerializerElement& patch);
+
+  /**
+   * \brief Return true if the patch does not change anything.
+   */
+  static bool IsEmpty(const SerializerElement& patch) {
+    return patch.GetAllChildren().empty() && patch.GetAllAttributes().empty();
+  }
+
+  /**
+   * \brief Return true if both values are equal (the type of numbers is
+   * ignored).
+   */
+  static bool AreValuesEqual(const SerializerValue& value,
+                             const SerializerValue& otherValue);
+
+ private:
+  static void ComputeChildrenPatch(const SerializerElement& from,
+                                   const SerializerElement& to,
+                                   SerializerElement& patch);
+  static void ApplyChildrenPatch(SerializerElement& element,
+                                 const SerializerElement& patch);
+
+  /**
+   * \brief Return the attribute identifying the children of both elements
+   * ("persistentUuid", "name"), or "childName" if they are identified by their
+   * name, or "index".
+   */
+  static gd::String GetChildrenIdentifier(const SerializerElement& from,
+                                          const SerializerElement& to);
+
+  /**
+   * \brief Return the keys identifying the children of the element.
+   */
+  static std::vector<gd::String> GetChildrenKeys(
+      const SerializerElement& element, const gd::String& identifier);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SERIALIZERDIFF_H
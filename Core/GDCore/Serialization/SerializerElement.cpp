@@ -6,10 +6,18 @@ namespace gd {
 
 SerializerElement SerializerElement::nullElement;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true),
+      isArray(false),
+      lastIndexedChildIndex(0),
+      lastIndexedChildPosition(0) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      isArray(false),
+      lastIndexedChildIndex(0),
+      lastIndexedChildPosition(0) {}
 
 SerializerElement::~SerializerElement() {}
 
@@ -173,16 +181,26 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
+  // Start from the last child that was returned if possible, so that
+  // iterating on the children is not quadratic.
   std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
+  std::size_t i = 0;
+  if (lastIndexedChildIndex <= index &&
+      lastIndexedChildPosition < children.size()) {
+    currentIndex = lastIndexedChildIndex;
+    i = lastIndexedChildPosition;
+  }
+  for (; i < children.size(); ++i) {
     if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
 
     if (children[i].first == arrayOf || children[i].first.empty() ||
         (!deprecatedArrayOf.empty() &&
          children[i].first == deprecatedArrayOf)) {
-      if (index == currentIndex)
+      if (index == currentIndex) {
+        lastIndexedChildIndex = index;
+        lastIndexedChildPosition = i;
         return *children[i].second;
-      else
+      } else
         currentIndex++;
     }
   }
@@ -263,6 +281,7 @@ bool SerializerElement::HasChild(const gd::String& name,
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  ResetLastIndexedChild();
   for (size_t i = 0; i < children.size();) {
     if (children[i].first == name)
       children.erase(children.begin() + i);
@@ -276,6 +295,7 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   elementValue = other.elementValue;
   attributes = other.attributes;
 
+  ResetLastIndexedChild();
   children.clear();
   for (const auto& child : other.children) {
     children.push_back(
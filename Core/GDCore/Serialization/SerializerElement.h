@@ -373,6 +373,7 @@ class GD_CORE_API SerializerElement {
     ConsiderAsArray();
     arrayOf = name;
     deprecatedArrayOf = deprecatedName;
+    ResetLastIndexedChild();
   };
 
   /**
@@ -394,8 +395,11 @@ class GD_CORE_API SerializerElement {
   /**
    * \brief Get a child of the element using its name.
    *
+   * \note Unlike GetChild(std::size_t), the returned child is not remembered,
+   * so the element can be read by several threads at the same time with this
+   * method.
    * \param name The name of the child.
-   * \param name The index of the child, in case of an array.
+   * \param index The index of the child, in case of an array.
    */
   SerializerElement &GetChild(gd::String name,
                               std::size_t index = 0,
@@ -405,7 +409,13 @@ class GD_CORE_API SerializerElement {
    * \brief Get a child of the element using its index (when the element is
    * considered as an array).
    *
-   * \param name The index of the child
+   * \note Getting the children one after the other (like in a loop on the
+   * children) is O(1) for each child, other accesses are O(number of
+   * children).
+   * \warning This is not thread-safe, even if the element is const: the last
+   * returned child is remembered. An element must not be read by several
+   * threads at the same time.
+   * \param index The index of the child
    */
   SerializerElement &GetChild(std::size_t index) const;
 
@@ -455,6 +465,15 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
+  /**
+   * Forget the last child returned by GetChild(std::size_t). Must be called
+   * when children are removed or replaced.
+   */
+  void ResetLastIndexedChild() const {
+    lastIndexedChildIndex = 0;
+    lastIndexedChildPosition = 0;
+  };
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -465,6 +484,12 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+  mutable std::size_t lastIndexedChildIndex;  ///< The index of the last child
+                                              ///< returned by GetChild(index).
+  mutable std::size_t lastIndexedChildPosition;  ///< The position of this
+                                                 ///< child in children.
+
+  friend class SerializerDiff;
 };
 
 }  // namespace gd
@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/SerializerHash.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerValue.h"
+
+namespace gd {
+
+namespace {
+// 64 bits FNV-1a, which gives the same results on all platforms (unlike
+// std::hash).
+const std::uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+const std::uint64_t fnvPrime = 1099511628211ULL;
+
+std::uint64_t Combine(std::uint64_t hash, const void* data, std::size_t size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= fnvPrime;
+  }
+  return hash;
+}
+
+std::uint64_t Combine(std::uint64_t hash, std::uint64_t value) {
+  unsigned char bytes[8];
+  for (std::size_t i = 0; i < 8; ++i) bytes[i] = (value >> (i * 8)) & 0xFF;
+  return Combine(hash, bytes, 8);
+}
+
+std::uint64_t Combine(std::uint64_t hash, const gd::String& str) {
+  hash = Combine(hash, str.Raw().data(), str.Raw().size());
+  // The size avoids collisions between strings put one after the other.
+  return Combine(hash, static_cast<std::uint64_t>(str.Raw().size()));
+}
+
+std::uint64_t Combine(std::uint64_t hash, char type) {
+  return Combine(hash, &type, 1);
+}
+}  // namespace
+
+std::uint64_t SerializerHash::ComputeHash(const SerializerValue& value) {
+  std::uint64_t hash = fnvOffsetBasis;
+  if (value.IsBoolean()) {
+    hash = Combine(hash, 'b');
+    return Combine(hash, static_cast<std::uint64_t>(value.GetBool()));
+  }
+  if (value.IsInt() || value.IsDouble()) {
+    double number = value.GetDouble();
+    if (number == 0) number = 0;  // -0 and 0 are the same number.
+    std::uint64_t bits;
+    std::memcpy(&bits, &number, sizeof(bits));
+    hash = Combine(hash, 'n');
+    return Combine(hash, bits);
+  }
+
+  hash = Combine(hash, 's');
+  return Combine(hash, value.GetString());
+}
+
+std::uint64_t SerializerHash::ComputeHash(const SerializerElement& element) {
+  // Same rules as gd::Serializer::ToJSON: the value is written instead of the
+  // children if it's defined.
+  if (!element.IsValueUndefined()) return ComputeHash(element.GetValue());
+
+  std::uint64_t hash = fnvOffsetBasis;
+  if (element.ConsideredAsArray()) {
+    // The name of the children of arrays is not saved.
+    hash = Combine(hash, 'a');
+    for (const auto& child : element.GetAllChildren())
+      hash = Combine(hash, ComputeHash(*child.second));
+
+    return hash;
+  }
+
+  std::vector<std::pair<gd::String, std::uint64_t>> members;
+  for (const auto& attribute : element.GetAllAttributes())
+    members.push_back(
+        std::make_pair(attribute.first, ComputeHash(attribute.second)));
+  for (const auto& child : element.GetAllChildren())
+    members.push_back(std::make_pair(child.first, ComputeHash(*child.second)));
+  std::stable_sort(
+      members.begin(),
+      members.end(),
+      [](const std::pair<gd::String, std::uint64_t>& member,
+         const std::pair<gd::String, std::uint64_t>& otherMember) {
+        return member.first.Raw() < otherMember.first.Raw();
+      });
+
+  hash = Combine(hash, 'o');
+  for (const auto& member : members) {
+    hash = Combine(hash, member.first);
+    hash = Combine(hash, member.second);
+  }
+
+  return hash;
+}
+
+gd::String SerializerHash::ToString(std::uint64_t hash) {
+  static const char digits[] = "0123456789abcdef";
+  std::string str(16, '0');
+  for (std::size_t i = 0; i < 16; ++i) {
+    str[15 - i] = digits[hash & 0xF];
+    hash >>= 4;
+  }
+
+  return gd::String::FromUTF8(str);
+}
+
+}  // namespace gd
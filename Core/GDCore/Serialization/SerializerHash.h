@@ -0,0 +1,56 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SERIALIZERHASH_H
+#define GDCORE_SERIALIZERHASH_H
+#include <cstdint>
+
+#include "GDCore/String.h"
+
+namespace gd {
+class SerializerElement;
+class SerializerValue;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Compute content hashes of gd::SerializerElement trees.
+ *
+ * The hash of an element is a combination of the hashes of its children (like
+ * a Merkle tree), so two elements having the same hash can be considered as
+ * equal, and comparing the hashes of their children tells which ones changed.
+ *
+ * Hashes only depend on what is written by gd::Serializer::ToJSON, so that
+ * they are the same after a project is saved and loaded again:
+ * - attributes are considered as children,
+ * - the order of the children of objects is ignored (but not the order of the
+ *   children of arrays),
+ * - numbers are compared whatever their type.
+ *
+ * \see gd::Project::ComputeContentHash
+ */
+class GD_CORE_API SerializerHash {
+ public:
+  /**
+   * \brief Return the hash of the content of the element.
+   */
+  static std::uint64_t ComputeHash(const SerializerElement& element);
+
+  /**
+   * \brief Return the hash of a value.
+   */
+  static std::uint64_t ComputeHash(const SerializerValue& value);
+
+  /**
+   * \brief Return the hash as a string of 16 hexadecimal digits.
+   */
+  static gd::String ToString(std::uint64_t hash);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_SERIALIZERHASH_H
@@ -0,0 +1,121 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/CodeTemplate.h"
+
+#include <algorithm>
+
+namespace gd {
+
+constexpr std::size_t CodeTemplate::noPlaceholder;
+
+CodeTemplate::CodeTemplate(const gd::String& templateCode_,
+                           const std::vector<gd::String>& placeholders)
+    : templateCode(templateCode_) {
+  // Placeholders are searched on the raw UTF-8 bytes: a valid UTF-8
+  // placeholder can only match at the start of a character, so this is safe.
+  // Candidates are bucketed by their first byte and sorted by decreasing
+  // length so that the longest placeholder is always the one matching.
+  std::vector<std::size_t> candidatesByFirstByte[256];
+  for (std::size_t i = 0; i < placeholders.size(); ++i) {
+    const std::string& placeholder = placeholders[i].Raw();
+    if (placeholder.empty()) continue;
+
+    candidatesByFirstByte[static_cast<unsigned char>(placeholder[0])]
+        .push_back(i);
+  }
+  for (auto& candidates : candidatesByFirstByte) {
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [&placeholders](std::size_t a, std::size_t b) {
+                       return placeholders[a].Raw().size() >
+                              placeholders[b].Raw().size();
+                     });
+  }
+
+  const std::string& code = templateCode.Raw();
+  std::size_t literalStart = 0;
+  std::size_t pos = 0;
+  while (pos < code.size()) {
+    const auto& candidates =
+        candidatesByFirstByte[static_cast<unsigned char>(code[pos])];
+
+    std::size_t matchedIndex = noPlaceholder;
+    for (std::size_t candidate : candidates) {
+      const std::string& placeholder = placeholders[candidate].Raw();
+      if (code.compare(pos, placeholder.size(), placeholder) == 0) {
+        matchedIndex = candidate;
+        break;
+      }
+    }
+
+    if (matchedIndex == noPlaceholder) {
+      pos++;
+      continue;
+    }
+
+    segments.push_back(Segment{literalStart, pos - literalStart, matchedIndex});
+    pos += placeholders[matchedIndex].Raw().size();
+    literalStart = pos;
+  }
+
+  segments.push_back(
+      Segment{literalStart, code.size() - literalStart, noPlaceholder});
+}
+
+gd::String CodeTemplate::Render(
+    std::initializer_list<gd::String> values) const {
+  std::vector<const gd::String*> valuesPtrs;
+  valuesPtrs.reserve(values.size());
+  for (const gd::String& value : values) valuesPtrs.push_back(&value);
+
+  return RenderValues(valuesPtrs.data(), valuesPtrs.size());
+}
+
+gd::String CodeTemplate::RenderValues(const gd::String* const* values,
+                                      std::size_t valuesCount) const {
+  const std::string& code = templateCode.Raw();
+  auto getValueSize = [&](std::size_t index) -> std::size_t {
+    return index < valuesCount ? values[index]->Raw().size() : 0;
+  };
+
+  // Compute the final size first to do a single allocation.
+  std::size_t outputSize = 0;
+  for (const Segment& segment : segments) {
+    outputSize += segment.length;
+    if (segment.placeholderIndex != noPlaceholder)
+      outputSize += getValueSize(segment.placeholderIndex);
+  }
+
+  gd::String output;
+  std::string& rawOutput = output.Raw();
+  rawOutput.reserve(outputSize);
+  for (const Segment& segment : segments) {
+    rawOutput.append(code, segment.start, segment.length);
+    if (segment.placeholderIndex != noPlaceholder &&
+        segment.placeholderIndex < valuesCount)
+      rawOutput.append(values[segment.placeholderIndex]->Raw());
+  }
+
+  return output;
+}
+
+gd::String CodeTemplate::Substitute(
+    const gd::String& templateCode,
+    std::initializer_list<std::pair<gd::String, gd::String>> replacements) {
+  std::vector<gd::String> placeholders;
+  std::vector<const gd::String*> valuesPtrs;
+  placeholders.reserve(replacements.size());
+  valuesPtrs.reserve(replacements.size());
+  for (const auto& replacement : replacements) {
+    placeholders.push_back(replacement.first);
+    valuesPtrs.push_back(&replacement.second);
+  }
+
+  return CodeTemplate(templateCode, placeholders)
+      .RenderValues(valuesPtrs.data(), valuesPtrs.size());
+}
+
+}  // namespace gd
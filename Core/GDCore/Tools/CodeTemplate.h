@@ -0,0 +1,93 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_CODETEMPLATE_H
+#define GDCORE_CODETEMPLATE_H
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief A template of code (or of any text) where placeholders are replaced
+ * by values.
+ *
+ * The template is parsed once into literal and placeholder segments, and
+ * rendered in a single linear pass. This replaces chains of
+ * gd::String::FindAndReplace, which rescan the whole (growing) string for
+ * each placeholder.
+ *
+ * Placeholders can be any non empty string. When several placeholders could
+ * match at the same position, the longest one wins (so "PROPERTIES_CODE" and
+ * "SHARED_PROPERTIES_CODE" can be used in the same template). Values are
+ * inserted as is: placeholders contained in a value are never replaced.
+ *
+ * Usage example:
+ * \code
+ * static const gd::CodeTemplate codeTemplate(
+ *     "NAMESPACE.CLASSNAME = class CLASSNAME {}",
+ *     {"NAMESPACE", "CLASSNAME"});
+ * gd::String code = codeTemplate.Render({codeNamespace, className});
+ * \endcode
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API CodeTemplate {
+ public:
+  /**
+   * \brief Parse the template, searching for the given placeholders.
+   */
+  CodeTemplate(const gd::String& templateCode,
+               const std::vector<gd::String>& placeholders);
+
+  /**
+   * \brief Render the template, replacing each placeholder by the value given
+   * at the same position as in the placeholders passed to the constructor.
+   *
+   * Missing values are considered as empty strings.
+   */
+  gd::String Render(std::initializer_list<gd::String> values) const;
+
+  /**
+   * \brief Parse and render the template in one go, for templates that are
+   * used only once (for example, read from a file).
+   */
+  static gd::String Substitute(
+      const gd::String& templateCode,
+      std::initializer_list<std::pair<gd::String, gd::String>> replacements);
+
+  /**
+   * \brief Return the number of placeholders occurrences found in the
+   * template.
+   */
+  std::size_t GetPlaceholdersOccurrencesCount() const {
+    std::size_t count = 0;
+    for (auto& segment : segments)
+      if (segment.placeholderIndex != noPlaceholder) count++;
+    return count;
+  }
+
+ private:
+  struct Segment {
+    std::size_t start;  ///< Start of the literal, in bytes, in templateCode.
+    std::size_t length;  ///< Length of the literal, in bytes.
+    std::size_t placeholderIndex;  ///< Placeholder following the literal, if any.
+  };
+
+  gd::String RenderValues(const gd::String* const* values,
+                          std::size_t valuesCount) const;
+
+  static constexpr std::size_t noPlaceholder = static_cast<std::size_t>(-1);
+
+  gd::String templateCode;
+  std::vector<Segment> segments;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_CODETEMPLATE_H
@@ -0,0 +1,869 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/PngCodec.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+
+const unsigned char pngSignature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+// Tables of the deflate format (RFC 1951).
+const unsigned short lengthBases[29] = {3,  4,  5,  6,   7,   8,   9,   10,
+                                        11, 13, 15, 17,  19,  23,  27,  31,
+                                        35, 43, 51, 59,  67,  83,  99,  115,
+                                        131, 163, 195, 227, 258};
+const unsigned char lengthExtraBits[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                           1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                           4, 4, 4, 4, 5, 5, 5, 5, 0};
+const unsigned short distanceBases[30] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const unsigned char distanceExtraBits[30] = {0, 0, 0,  0,  1,  1,  2,  2,
+                                             3, 3, 4,  4,  5,  5,  6,  6,
+                                             7, 7, 8,  8,  9,  9,  10, 10,
+                                             11, 11, 12, 12, 13, 13};
+const unsigned char codeLengthsOrder[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+uint32_t Crc32(const unsigned char* data, std::size_t size, uint32_t crc = 0) {
+  static uint32_t table[256];
+  static bool tableComputed = false;
+  if (!tableComputed) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+    tableComputed = true;
+  }
+
+  crc = crc ^ 0xffffffffu;
+  for (std::size_t i = 0; i < size; i++)
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  return crc ^ 0xffffffffu;
+}
+
+uint32_t Adler32(const unsigned char* data, std::size_t size) {
+  uint32_t a = 1, b = 0;
+  for (std::size_t i = 0; i < size; i++) {
+    a = (a + data[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+uint32_t ReadUint32(const unsigned char* data) {
+  return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+         ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+void WriteUint32(std::string& output, uint32_t value) {
+  output.push_back((char)((value >> 24) & 0xff));
+  output.push_back((char)((value >> 16) & 0xff));
+  output.push_back((char)((value >> 8) & 0xff));
+  output.push_back((char)(value & 0xff));
+}
+
+/**
+ * Read bits, least significant bit first, as done by deflate.
+ */
+class BitReader {
+ public:
+  BitReader(const unsigned char* data_, std::size_t size_)
+      : data(data_), size(size_), position(0), bitBuffer(0), bitCount(0),
+        error(false){};
+
+  int Bits(int count) {
+    while (bitCount < count) {
+      if (position >= size) {
+        error = true;
+        return 0;
+      }
+      bitBuffer |= (uint32_t)data[position++] << bitCount;
+      bitCount += 8;
+    }
+
+    int value = (int)(bitBuffer & ((1u << count) - 1));
+    bitBuffer >>= count;
+    bitCount -= count;
+    return value;
+  }
+
+  void AlignToByte() {
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+  const unsigned char* data;
+  std::size_t size;
+  std::size_t position;
+  uint32_t bitBuffer;
+  int bitCount;
+  bool error;
+};
+
+/**
+ * A canonical Huffman code, stored as the number of codes of each length and
+ * the symbols ordered by code.
+ */
+struct Huffman {
+  short counts[16];
+  std::vector<short> symbols;
+};
+
+bool BuildHuffman(Huffman& huffman, const short* lengths, int symbolsCount) {
+  for (int length = 0; length < 16; length++) huffman.counts[length] = 0;
+  for (int symbol = 0; symbol < symbolsCount; symbol++)
+    huffman.counts[lengths[symbol]]++;
+
+  // Check that the code is not over-subscribed (incomplete codes are allowed).
+  int left = 1;
+  for (int length = 1; length < 16; length++) {
+    left <<= 1;
+    left -= huffman.counts[length];
+    if (left < 0) return false;
+  }
+
+  short offsets[16];
+  offsets[1] = 0;
+  for (int length = 1; length < 15; length++)
+    offsets[length + 1] = offsets[length] + huffman.counts[length];
+
+  huffman.symbols.assign(symbolsCount, 0);
+  for (int symbol = 0; symbol < symbolsCount; symbol++)
+    if (lengths[symbol] != 0)
+      huffman.symbols[offsets[lengths[symbol]]++] = symbol;
+
+  return true;
+}
+
+int DecodeSymbol(BitReader& reader, const Huffman& huffman) {
+  int code = 0;   // Bits read so far.
+  int first = 0;  // First code of the current length.
+  int index = 0;  // Index of the first symbol of the current length.
+  for (int length = 1; length < 16; length++) {
+    code |= reader.Bits(1);
+    if (reader.error) return -1;
+
+    int count = huffman.counts[length];
+    if (code - count < first) return huffman.symbols[index + (code - first)];
+    index += count;
+    first += count;
+    first <<= 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+bool InflateBlock(BitReader& reader,
+                  std::vector<unsigned char>& output,
+                  const Huffman& literals,
+                  const Huffman& distances) {
+  while (true) {
+    int symbol = DecodeSymbol(reader, literals);
+    if (symbol < 0) return false;
+    if (symbol < 256) {
+      output.push_back((unsigned char)symbol);
+      continue;
+    }
+    if (symbol == 256) return true;
+
+    symbol -= 257;
+    if (symbol >= 29) return false;
+    std::size_t length =
+        lengthBases[symbol] + reader.Bits(lengthExtraBits[symbol]);
+
+    int distanceSymbol = DecodeSymbol(reader, distances);
+    if (distanceSymbol < 0 || distanceSymbol >= 30) return false;
+    std::size_t distance = distanceBases[distanceSymbol] +
+                           reader.Bits(distanceExtraBits[distanceSymbol]);
+    if (reader.error || distance > output.size()) return false;
+
+    std::size_t start = output.size() - distance;
+    for (std::size_t i = 0; i < length; i++)
+      output.push_back(output[start + i]);
+  }
+}
+
+bool Inflate(BitReader& reader, std::vector<unsigned char>& output) {
+  bool isLastBlock = false;
+  while (!isLastBlock) {
+    isLastBlock = reader.Bits(1) == 1;
+    int type = reader.Bits(2);
+    if (reader.error) return false;
+
+    if (type == 0) {
+      // Stored block
+      reader.AlignToByte();
+      if (reader.position + 4 > reader.size) return false;
+      const unsigned char* header = reader.data + reader.position;
+      unsigned int length = header[0] | (header[1] << 8);
+      unsigned int lengthComplement = header[2] | (header[3] << 8);
+      if (length != (~lengthComplement & 0xffff)) return false;
+      reader.position += 4;
+      if (reader.position + length > reader.size) return false;
+
+      output.insert(output.end(),
+                    reader.data + reader.position,
+                    reader.data + reader.position + length);
+      reader.position += length;
+    } else if (type == 1) {
+      // Fixed Huffman codes
+      static Huffman fixedLiterals, fixedDistances;
+      static bool fixedCodesBuilt = false;
+      if (!fixedCodesBuilt) {
+        short lengths[288];
+        int symbol = 0;
+        for (; symbol < 144; symbol++) lengths[symbol] = 8;
+        for (; symbol < 256; symbol++) lengths[symbol] = 9;
+        for (; symbol < 280; symbol++) lengths[symbol] = 7;
+        for (; symbol < 288; symbol++) lengths[symbol] = 8;
+        BuildHuffman(fixedLiterals, lengths, 288);
+        for (symbol = 0; symbol < 30; symbol++) lengths[symbol] = 5;
+        BuildHuffman(fixedDistances, lengths, 30);
+        fixedCodesBuilt = true;
+      }
+
+      if (!InflateBlock(reader, output, fixedLiterals, fixedDistances))
+        return false;
+    } else if (type == 2) {
+      // Dynamic Huffman codes
+      int literalsCount = reader.Bits(5) + 257;
+      int distancesCount = reader.Bits(5) + 1;
+      int codeLengthsCount = reader.Bits(4) + 4;
+      if (reader.error || literalsCount > 286 || distancesCount > 30)
+        return false;
+
+      short lengths[320] = {0};
+      for (int i = 0; i < codeLengthsCount; i++)
+        lengths[codeLengthsOrder[i]] = reader.Bits(3);
+      Huffman codeLengths;
+      if (reader.error || !BuildHuffman(codeLengths, lengths, 19))
+        return false;
+
+      int index = 0;
+      while (index < literalsCount + distancesCount) {
+        int symbol = DecodeSymbol(reader, codeLengths);
+        if (symbol < 0) return false;
+        if (symbol < 16) {
+          lengths[index++] = symbol;
+          continue;
+        }
+
+        short repeatedLength = 0;
+        int repeatCount = 0;
+        if (symbol == 16) {
+          if (index == 0) return false;
+          repeatedLength = lengths[index - 1];
+          repeatCount = 3 + reader.Bits(2);
+        } else if (symbol == 17) {
+          repeatCount = 3 + reader.Bits(3);
+        } else {
+          repeatCount = 11 + reader.Bits(7);
+        }
+        if (reader.error ||
+            index + repeatCount > literalsCount + distancesCount)
+          return false;
+        while (repeatCount--) lengths[index++] = repeatedLength;
+      }
+
+      Huffman literals, distances;
+      if (lengths[256] == 0 ||
+          !BuildHuffman(literals, lengths, literalsCount) ||
+          !BuildHuffman(distances, lengths + literalsCount, distancesCount))
+        return false;
+
+      if (!InflateBlock(reader, output, literals, distances)) return false;
+    } else {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Write bits, least significant bit first, as done by deflate.
+ */
+class BitWriter {
+ public:
+  BitWriter(std::vector<unsigned char>& output_)
+      : output(output_), bitBuffer(0), bitCount(0){};
+
+  void Bits(uint32_t value, int count) {
+    bitBuffer |= value << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+      output.push_back((unsigned char)(bitBuffer & 0xff));
+      bitBuffer >>= 8;
+      bitCount -= 8;
+    }
+  }
+
+  /**
+   * Write a Huffman code, which is stored most significant bit first.
+   */
+  void Code(uint32_t code, int length) {
+    uint32_t reversed = 0;
+    for (int i = 0; i < length; i++) {
+      reversed = (reversed << 1) | (code & 1);
+      code >>= 1;
+    }
+    Bits(reversed, length);
+  }
+
+  void Flush() {
+    if (bitCount > 0) output.push_back((unsigned char)(bitBuffer & 0xff));
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+ private:
+  std::vector<unsigned char>& output;
+  uint32_t bitBuffer;
+  int bitCount;
+};
+
+void WriteFixedLiteral(BitWriter& writer, int symbol) {
+  if (symbol < 144)
+    writer.Code(0x30 + symbol, 8);
+  else if (symbol < 256)
+    writer.Code(0x190 + symbol - 144, 9);
+  else if (symbol < 280)
+    writer.Code(symbol - 256, 7);
+  else
+    writer.Code(0xc0 + symbol - 280, 8);
+}
+
+void WriteMatch(BitWriter& writer, int length, int distance) {
+  int lengthSymbol = 28;
+  while (lengthBases[lengthSymbol] > length) lengthSymbol--;
+  WriteFixedLiteral(writer, 257 + lengthSymbol);
+  writer.Bits(length - lengthBases[lengthSymbol],
+              lengthExtraBits[lengthSymbol]);
+
+  int distanceSymbol = 29;
+  while (distanceBases[distanceSymbol] > distance) distanceSymbol--;
+  writer.Code(distanceSymbol, 5);
+  writer.Bits(distance - distanceBases[distanceSymbol],
+              distanceExtraBits[distanceSymbol]);
+}
+
+/**
+ * Compress with a single deflate block using the fixed Huffman codes, and
+ * matches found with hash chains.
+ */
+void Deflate(const std::vector<unsigned char>& data,
+             std::vector<unsigned char>& output) {
+  const int windowSize = 32768;
+  const int hashSize = 1 << 15;
+  const int maxChainLength = 64;
+  const int minMatchLength = 3;
+  const int maxMatchLength = 258;
+
+  std::vector<int> heads(hashSize, -1);
+  std::vector<int> previous(data.size(), -1);
+  auto hash = [&data](std::size_t position) {
+    return ((data[position] << 10) ^ (data[position + 1] << 5) ^
+            data[position + 2]) &
+           (hashSize - 1);
+  };
+
+  BitWriter writer(output);
+  writer.Bits(1, 1);  // Last block
+  writer.Bits(1, 2);  // Fixed Huffman codes
+
+  std::size_t position = 0;
+  while (position < data.size()) {
+    int bestLength = 0;
+    int bestDistance = 0;
+    if (position + minMatchLength <= data.size()) {
+      int h = hash(position);
+      int candidate = heads[h];
+      int chainLength = 0;
+      std::size_t maxLength =
+          std::min<std::size_t>(maxMatchLength, data.size() - position);
+      while (candidate >= 0 && chainLength++ < maxChainLength &&
+             (int)position - candidate <= windowSize) {
+        std::size_t length = 0;
+        while (length < maxLength &&
+               data[candidate + length] == data[position + length])
+          length++;
+        if ((int)length > bestLength) {
+          bestLength = (int)length;
+          bestDistance = (int)position - candidate;
+          if (length == maxLength) break;
+        }
+        candidate = previous[candidate];
+      }
+
+      previous[position] = heads[h];
+      heads[h] = (int)position;
+    }
+
+    if (bestLength >= minMatchLength) {
+      WriteMatch(writer, bestLength, bestDistance);
+      // Register the positions skipped by the match in the hash chains.
+      for (std::size_t i = position + 1;
+           i < position + bestLength && i + minMatchLength <= data.size();
+           i++) {
+        int h = hash(i);
+        previous[i] = heads[h];
+        heads[h] = (int)i;
+      }
+      position += bestLength;
+    } else {
+      WriteFixedLiteral(writer, data[position]);
+      position++;
+    }
+  }
+
+  WriteFixedLiteral(writer, 256);
+  writer.Flush();
+}
+
+int PaethPredictor(int a, int b, int c) {
+  int p = a + b - c;
+  int pa = std::abs(p - a);
+  int pb = std::abs(p - b);
+  int pc = std::abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  if (pb <= pc) return b;
+  return c;
+}
+
+/**
+ * Revert the filter of a scanline, using the previous (already unfiltered)
+ * scanline, which is null for the first line.
+ */
+bool Unfilter(int filterType,
+              unsigned char* line,
+              const unsigned char* previousLine,
+              std::size_t length,
+              std::size_t bytesPerPixel) {
+  for (std::size_t i = 0; i < length; i++) {
+    int a = i >= bytesPerPixel ? line[i - bytesPerPixel] : 0;
+    int b = previousLine ? previousLine[i] : 0;
+    int c = previousLine && i >= bytesPerPixel
+                ? previousLine[i - bytesPerPixel]
+                : 0;
+    switch (filterType) {
+      case 0:
+        break;
+      case 1:
+        line[i] += a;
+        break;
+      case 2:
+        line[i] += b;
+        break;
+      case 3:
+        line[i] += (a + b) / 2;
+        break;
+      case 4:
+        line[i] += PaethPredictor(a, b, c);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+struct PngHeader {
+  unsigned int width = 0;
+  unsigned int height = 0;
+  int bitDepth = 0;
+  int colorType = 0;
+  int interlaceMethod = 0;
+  std::vector<unsigned char> palette;  ///< RGBA entries.
+  bool hasTransparentColor = false;
+  unsigned int transparentColor[3] = {0, 0, 0};  ///< Gray or RGB samples.
+
+  int GetChannelsCount() const {
+    switch (colorType) {
+      case 0:
+        return 1;
+      case 2:
+        return 3;
+      case 3:
+        return 1;
+      case 4:
+        return 2;
+      case 6:
+        return 4;
+      default:
+        return 0;
+    }
+  }
+};
+
+unsigned int GetSample(const unsigned char* line,
+                       std::size_t sampleIndex,
+                       int bitDepth) {
+  if (bitDepth == 8) return line[sampleIndex];
+  if (bitDepth == 16)
+    return (line[sampleIndex * 2] << 8) | line[sampleIndex * 2 + 1];
+
+  std::size_t bitIndex = sampleIndex * bitDepth;
+  int shift = 8 - bitDepth - (int)(bitIndex % 8);
+  return (line[bitIndex / 8] >> shift) & ((1 << bitDepth) - 1);
+}
+
+/**
+ * Convert a scanline to RGBA pixels of the image.
+ */
+void ConvertLine(const PngHeader& header,
+                 const unsigned char* line,
+                 unsigned int lineWidth,
+                 gd::RgbaImage& image,
+                 unsigned int y,
+                 unsigned int xStart,
+                 unsigned int xStep) {
+  const int channels = header.GetChannelsCount();
+  const int bitDepth = header.bitDepth;
+  const unsigned int maxSampleValue = (1u << bitDepth) - 1;
+  auto toByte = [&](unsigned int sample) -> unsigned char {
+    if (bitDepth == 16) return sample >> 8;
+    if (bitDepth == 8) return sample;
+    return sample * 255 / maxSampleValue;
+  };
+
+  for (unsigned int i = 0; i < lineWidth; i++) {
+    unsigned char* pixel = image.GetPixel(xStart + i * xStep, y);
+    std::size_t sampleIndex = (std::size_t)i * channels;
+    if (header.colorType == 3) {
+      unsigned int index = GetSample(line, sampleIndex, bitDepth);
+      if (index * 4 + 3 < header.palette.size()) {
+        for (int c = 0; c < 4; c++) pixel[c] = header.palette[index * 4 + c];
+      } else {
+        pixel[0] = pixel[1] = pixel[2] = 0;
+        pixel[3] = 255;
+      }
+    } else if (header.colorType == 0 || header.colorType == 4) {
+      unsigned int gray = GetSample(line, sampleIndex, bitDepth);
+      pixel[0] = pixel[1] = pixel[2] = toByte(gray);
+      if (header.colorType == 4)
+        pixel[3] = toByte(GetSample(line, sampleIndex + 1, bitDepth));
+      else
+        pixel[3] = header.hasTransparentColor &&
+                           gray == header.transparentColor[0]
+                       ? 0
+                       : 255;
+    } else {
+      unsigned int r = GetSample(line, sampleIndex, bitDepth);
+      unsigned int g = GetSample(line, sampleIndex + 1, bitDepth);
+      unsigned int b = GetSample(line, sampleIndex + 2, bitDepth);
+      pixel[0] = toByte(r);
+      pixel[1] = toByte(g);
+      pixel[2] = toByte(b);
+      if (header.colorType == 6)
+        pixel[3] = toByte(GetSample(line, sampleIndex + 3, bitDepth));
+      else
+        pixel[3] = header.hasTransparentColor &&
+                           r == header.transparentColor[0] &&
+                           g == header.transparentColor[1] &&
+                           b == header.transparentColor[2]
+                       ? 0
+                       : 255;
+    }
+  }
+}
+
+/**
+ * Unfilter and convert the pixels of a (sub) image, which is the whole image
+ * or an Adam7 pass.
+ */
+bool DecodePass(const PngHeader& header,
+                const std::vector<unsigned char>& data,
+                std::size_t& position,
+                unsigned int xStart,
+                unsigned int yStart,
+                unsigned int xStep,
+                unsigned int yStep,
+                gd::RgbaImage& image) {
+  if (xStart >= header.width || yStart >= header.height) return true;
+
+  const unsigned int passWidth = (header.width - xStart + xStep - 1) / xStep;
+  const unsigned int passHeight =
+      (header.height - yStart + yStep - 1) / yStep;
+  const std::size_t bitsPerPixel =
+      (std::size_t)header.GetChannelsCount() * header.bitDepth;
+  const std::size_t lineLength = (passWidth * bitsPerPixel + 7) / 8;
+  const std::size_t bytesPerPixel = std::max<std::size_t>(1, bitsPerPixel / 8);
+
+  std::vector<unsigned char> previousLine, line(lineLength);
+  for (unsigned int passY = 0; passY < passHeight; passY++) {
+    if (position + 1 + lineLength > data.size()) return false;
+
+    int filterType = data[position];
+    line.assign(data.begin() + position + 1,
+                data.begin() + position + 1 + lineLength);
+    position += 1 + lineLength;
+    if (!Unfilter(filterType,
+                  line.data(),
+                  previousLine.empty() ? nullptr : previousLine.data(),
+                  lineLength,
+                  bytesPerPixel))
+      return false;
+
+    ConvertLine(header,
+                line.data(),
+                passWidth,
+                image,
+                yStart + passY * yStep,
+                xStart,
+                xStep);
+    previousLine.swap(line);
+    line.resize(lineLength);
+  }
+
+  return true;
+}
+
+}  // namespace
+
+namespace gd {
+
+bool PngCodec::ZlibDecompress(const unsigned char* data,
+                              std::size_t size,
+                              std::vector<unsigned char>& output) {
+  if (size < 6) return false;
+  int compressionMethod = data[0] & 0x0f;
+  bool hasPresetDictionary = (data[1] & 0x20) != 0;
+  if (compressionMethod != 8 || hasPresetDictionary ||
+      ((data[0] << 8) | data[1]) % 31 != 0)
+    return false;
+
+  BitReader reader(data + 2, size - 2);
+  if (!Inflate(reader, output)) return false;
+
+  reader.AlignToByte();
+  if (reader.position + 4 > reader.size) return false;
+  return ReadUint32(reader.data + reader.position) ==
+         Adler32(output.data(), output.size());
+}
+
+std::vector<unsigned char> PngCodec::ZlibCompress(
+    const std::vector<unsigned char>& data) {
+  std::vector<unsigned char> output;
+  output.push_back(0x78);  // Deflate with a 32K window
+  output.push_back(0x01);  // Fastest compression level, valid checksum
+  Deflate(data, output);
+
+  uint32_t adler = Adler32(data.data(), data.size());
+  output.push_back((adler >> 24) & 0xff);
+  output.push_back((adler >> 16) & 0xff);
+  output.push_back((adler >> 8) & 0xff);
+  output.push_back(adler & 0xff);
+  return output;
+}
+
+bool PngCodec::DecodeSize(const std::string& fileContent,
+                          unsigned int& width,
+                          unsigned int& height) {
+  const unsigned char* data =
+      reinterpret_cast<const unsigned char*>(fileContent.data());
+  // The header chunk is always the first one.
+  if (fileContent.size() < 8 + 8 + 13) return false;
+  for (int i = 0; i < 8; i++)
+    if (data[i] != pngSignature[i]) return false;
+  if (ReadUint32(data + 8) != 13 ||
+      std::string(reinterpret_cast<const char*>(data + 12), 4) != "IHDR")
+    return false;
+
+  width = ReadUint32(data + 16);
+  height = ReadUint32(data + 20);
+  return true;
+}
+
+bool PngCodec::Decode(const std::string& fileContent, gd::RgbaImage& image) {
+  const unsigned char* data =
+      reinterpret_cast<const unsigned char*>(fileContent.data());
+  const std::size_t size = fileContent.size();
+  if (size < 8) return false;
+  for (int i = 0; i < 8; i++)
+    if (data[i] != pngSignature[i]) return false;
+
+  PngHeader header;
+  std::vector<unsigned char> compressedData;
+  bool hasHeader = false;
+  std::size_t position = 8;
+  while (position + 12 <= size) {
+    uint32_t length = ReadUint32(data + position);
+    std::string type(reinterpret_cast<const char*>(data + position + 4), 4);
+    if (length > size - position - 12) return false;
+    const unsigned char* chunk = data + position + 8;
+    if (Crc32(data + position + 4, length + 4) !=
+        ReadUint32(chunk + length))
+      return false;
+    position += length + 12;
+
+    if (type == "IHDR") {
+      if (length != 13) return false;
+      header.width = ReadUint32(chunk);
+      header.height = ReadUint32(chunk + 4);
+      header.bitDepth = chunk[8];
+      header.colorType = chunk[9];
+      header.interlaceMethod = chunk[12];
+      hasHeader = true;
+      header.palette.clear();
+    } else if (type == "PLTE") {
+      if (length % 3 != 0) return false;
+      for (uint32_t i = 0; i < length / 3; i++) {
+        header.palette.push_back(chunk[i * 3]);
+        header.palette.push_back(chunk[i * 3 + 1]);
+        header.palette.push_back(chunk[i * 3 + 2]);
+        header.palette.push_back(255);
+      }
+    } else if (type == "tRNS") {
+      if (header.colorType == 3) {
+        for (uint32_t i = 0; i < length && i * 4 + 3 < header.palette.size();
+             i++)
+          header.palette[i * 4 + 3] = chunk[i];
+      } else if (header.colorType == 0 && length >= 2) {
+        header.hasTransparentColor = true;
+        header.transparentColor[0] = (chunk[0] << 8) | chunk[1];
+      } else if (header.colorType == 2 && length >= 6) {
+        header.hasTransparentColor = true;
+        for (int c = 0; c < 3; c++)
+          header.transparentColor[c] = (chunk[c * 2] << 8) | chunk[c * 2 + 1];
+      }
+    } else if (type == "IDAT") {
+      compressedData.insert(compressedData.end(), chunk, chunk + length);
+    } else if (type == "IEND") {
+      break;
+    } else if (!(type[0] & 0x20)) {
+      return false;  // Unknown critical chunk
+    }
+  }
+
+  if (!hasHeader || header.width == 0 || header.height == 0 ||
+      header.GetChannelsCount() == 0 || header.interlaceMethod > 1)
+    return false;
+  const int bitDepth = header.bitDepth;
+  if (bitDepth != 1 && bitDepth != 2 && bitDepth != 4 && bitDepth != 8 &&
+      bitDepth != 16)
+    return false;
+  if ((header.colorType == 3 && bitDepth == 16) ||
+      (header.colorType != 0 && header.colorType != 3 && bitDepth < 8))
+    return false;
+  if (header.colorType == 3 && header.palette.empty()) return false;
+  // Don't try to allocate images that are obviously too large.
+  if ((uint64_t)header.width * header.height > (1u << 28)) return false;
+
+  std::vector<unsigned char> decompressedData;
+  if (!ZlibDecompress(
+          compressedData.data(), compressedData.size(), decompressedData))
+    return false;
+
+  image = gd::RgbaImage(header.width, header.height);
+  std::size_t dataPosition = 0;
+  if (header.interlaceMethod == 0)
+    return DecodePass(
+        header, decompressedData, dataPosition, 0, 0, 1, 1, image);
+
+  const unsigned int adam7XStart[7] = {0, 4, 0, 2, 0, 1, 0};
+  const unsigned int adam7YStart[7] = {0, 0, 4, 0, 2, 0, 1};
+  const unsigned int adam7XStep[7] = {8, 8, 4, 4, 2, 2, 1};
+  const unsigned int adam7YStep[7] = {8, 8, 8, 4, 4, 2, 2};
+  for (int pass = 0; pass < 7; pass++) {
+    if (!DecodePass(header,
+                    decompressedData,
+                    dataPosition,
+                    adam7XStart[pass],
+                    adam7YStart[pass],
+                    adam7XStep[pass],
+                    adam7YStep[pass],
+                    image))
+      return false;
+  }
+  return true;
+}
+
+std::string PngCodec::Encode(const gd::RgbaImage& image) {
+  // Filter each line with the filter giving the smallest sum of absolute
+  // differences, which usually compresses best.
+  const std::size_t lineLength = (std::size_t)image.width * 4;
+  std::vector<unsigned char> filteredData;
+  filteredData.reserve((lineLength + 1) * image.height);
+  std::vector<unsigned char> candidate(lineLength), bestCandidate(lineLength);
+  for (unsigned int y = 0; y < image.height; y++) {
+    const unsigned char* line = &image.pixels[y * lineLength];
+    const unsigned char* previousLine =
+        y > 0 ? &image.pixels[(y - 1) * lineLength] : nullptr;
+
+    int bestFilterType = 0;
+    uint64_t bestSum = UINT64_MAX;
+    for (int filterType = 0; filterType < 5; filterType++) {
+      uint64_t sum = 0;
+      for (std::size_t i = 0; i < lineLength; i++) {
+        int a = i >= 4 ? line[i - 4] : 0;
+        int b = previousLine ? previousLine[i] : 0;
+        int c = previousLine && i >= 4 ? previousLine[i - 4] : 0;
+        int predictor = 0;
+        if (filterType == 1)
+          predictor = a;
+        else if (filterType == 2)
+          predictor = b;
+        else if (filterType == 3)
+          predictor = (a + b) / 2;
+        else if (filterType == 4)
+          predictor = PaethPredictor(a, b, c);
+
+        unsigned char value = (unsigned char)(line[i] - predictor);
+        candidate[i] = value;
+        sum += value < 128 ? value : 256 - value;
+      }
+
+      if (sum < bestSum) {
+        bestSum = sum;
+        bestFilterType = filterType;
+        bestCandidate.swap(candidate);
+      }
+    }
+
+    filteredData.push_back((unsigned char)bestFilterType);
+    filteredData.insert(
+        filteredData.end(), bestCandidate.begin(), bestCandidate.end());
+  }
+
+  std::string output(reinterpret_cast<const char*>(pngSignature), 8);
+  auto writeChunk = [&output](const char* type,
+                              const std::vector<unsigned char>& chunkData) {
+    WriteUint32(output, (uint32_t)chunkData.size());
+    std::size_t typePosition = output.size();
+    output.append(type, 4);
+    output.append(chunkData.begin(), chunkData.end());
+    WriteUint32(output,
+                Crc32(reinterpret_cast<const unsigned char*>(output.data()) +
+                          typePosition,
+                      chunkData.size() + 4));
+  };
+
+  std::vector<unsigned char> headerData;
+  for (uint32_t value : {image.width, image.height}) {
+    headerData.push_back((value >> 24) & 0xff);
+    headerData.push_back((value >> 16) & 0xff);
+    headerData.push_back((value >> 8) & 0xff);
+    headerData.push_back(value & 0xff);
+  }
+  headerData.push_back(8);  // Bit depth
+  headerData.push_back(6);  // RGBA
+  headerData.push_back(0);  // Compression method
+  headerData.push_back(0);  // Filter method
+  headerData.push_back(0);  // No interlacing
+
+  writeChunk("IHDR", headerData);
+  writeChunk("IDAT", ZlibCompress(filteredData));
+  writeChunk("IEND", std::vector<unsigned char>());
+  return output;
+}
+
+}  // namespace gd
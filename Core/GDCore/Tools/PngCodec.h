@@ -0,0 +1,90 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_PNGCODEC_H
+#define GDCORE_PNGCODEC_H
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief An image stored in memory, with 8 bits per channel RGBA pixels.
+ *
+ * \ingroup Tools
+ */
+struct GD_CORE_API RgbaImage {
+  RgbaImage() : width(0), height(0){};
+  RgbaImage(unsigned int width_, unsigned int height_)
+      : width(width_), height(height_), pixels(width_ * height_ * 4, 0){};
+
+  unsigned char* GetPixel(unsigned int x, unsigned int y) {
+    return &pixels[(y * width + x) * 4];
+  }
+  const unsigned char* GetPixel(unsigned int x, unsigned int y) const {
+    return &pixels[(y * width + x) * 4];
+  }
+
+  unsigned int width;
+  unsigned int height;
+  std::vector<unsigned char> pixels;  ///< The RGBA values, row by row.
+};
+
+/**
+ * \brief A self-contained PNG decoder and encoder, used by the exporter to
+ * process images without relying on an external library.
+ *
+ * All the standard color types, bit depths and interlacing are supported when
+ * decoding. Images are always encoded as non-interlaced 8 bits RGBA.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API PngCodec {
+ public:
+  /**
+   * \brief Decode a PNG file.
+   *
+   * \param data The content of the file.
+   * \param image Filled with the decoded pixels.
+   * \return false if the file is not a valid (or not supported) PNG file.
+   */
+  static bool Decode(const std::string& data, gd::RgbaImage& image);
+
+  /**
+   * \brief Read the size of the image of a PNG file, without decoding it.
+   *
+   * \return false if the file is not a PNG file.
+   */
+  static bool DecodeSize(const std::string& data,
+                         unsigned int& width,
+                         unsigned int& height);
+
+  /**
+   * \brief Encode an image as a PNG file.
+   *
+   * \return The content of the file.
+   */
+  static std::string Encode(const gd::RgbaImage& image);
+
+  /**
+   * \brief Decompress data compressed with the zlib format.
+   *
+   * \return false if the data is not valid.
+   */
+  static bool ZlibDecompress(const unsigned char* data,
+                             std::size_t size,
+                             std::vector<unsigned char>& output);
+
+  /**
+   * \brief Compress data with the zlib format.
+   */
+  static std::vector<unsigned char> ZlibCompress(
+      const std::vector<unsigned char>& data);
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_PNGCODEC_H
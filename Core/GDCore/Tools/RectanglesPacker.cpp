@@ -0,0 +1,115 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/RectanglesPacker.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+namespace gd {
+
+RectanglesPacker::RectanglesPacker(int width_, int height_)
+    : width(width_), height(height_) {
+  freeRectangles.push_back(Rectangle(0, 0, width, height));
+}
+
+bool RectanglesPacker::Insert(int rectangleWidth,
+                              int rectangleHeight,
+                              Rectangle& placement) {
+  if (rectangleWidth <= 0 || rectangleHeight <= 0) return false;
+
+  int bestShortSideFit = INT_MAX;
+  int bestLongSideFit = INT_MAX;
+  bool found = false;
+  for (const auto& freeRectangle : freeRectangles) {
+    if (freeRectangle.width < rectangleWidth ||
+        freeRectangle.height < rectangleHeight)
+      continue;
+
+    int leftoverHorizontal = freeRectangle.width - rectangleWidth;
+    int leftoverVertical = freeRectangle.height - rectangleHeight;
+    int shortSideFit = std::min(leftoverHorizontal, leftoverVertical);
+    int longSideFit = std::max(leftoverHorizontal, leftoverVertical);
+    if (shortSideFit < bestShortSideFit ||
+        (shortSideFit == bestShortSideFit && longSideFit < bestLongSideFit)) {
+      placement = Rectangle(
+          freeRectangle.x, freeRectangle.y, rectangleWidth, rectangleHeight);
+      bestShortSideFit = shortSideFit;
+      bestLongSideFit = longSideFit;
+      found = true;
+    }
+  }
+  if (!found) return false;
+
+  SplitFreeRectangles(placement);
+  PruneFreeRectangles();
+  usedRectangles.push_back(placement);
+  return true;
+}
+
+void RectanglesPacker::SplitFreeRectangles(const Rectangle& placed) {
+  std::vector<Rectangle> newFreeRectangles;
+  for (const auto& free : freeRectangles) {
+    if (placed.x >= free.x + free.width || placed.x + placed.width <= free.x ||
+        placed.y >= free.y + free.height ||
+        placed.y + placed.height <= free.y) {
+      newFreeRectangles.push_back(free);
+      continue;
+    }
+
+    // Keep the (maximal) parts of the free rectangle around the placed one.
+    if (placed.x > free.x)
+      newFreeRectangles.push_back(
+          Rectangle(free.x, free.y, placed.x - free.x, free.height));
+    if (placed.x + placed.width < free.x + free.width)
+      newFreeRectangles.push_back(
+          Rectangle(placed.x + placed.width,
+                    free.y,
+                    free.x + free.width - (placed.x + placed.width),
+                    free.height));
+    if (placed.y > free.y)
+      newFreeRectangles.push_back(
+          Rectangle(free.x, free.y, free.width, placed.y - free.y));
+    if (placed.y + placed.height < free.y + free.height)
+      newFreeRectangles.push_back(
+          Rectangle(free.x,
+                    placed.y + placed.height,
+                    free.width,
+                    free.y + free.height - (placed.y + placed.height)));
+  }
+  freeRectangles.swap(newFreeRectangles);
+}
+
+void RectanglesPacker::PruneFreeRectangles() {
+  // Remove the free rectangles that are contained in another one.
+  std::vector<bool> removed(freeRectangles.size(), false);
+  for (std::size_t i = 0; i < freeRectangles.size(); ++i) {
+    if (removed[i]) continue;
+    for (std::size_t j = 0; j < freeRectangles.size(); ++j) {
+      if (i == j || removed[j]) continue;
+      if (freeRectangles[j].Contains(freeRectangles[i])) {
+        removed[i] = true;
+        break;
+      }
+    }
+  }
+
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < freeRectangles.size(); ++i)
+    if (!removed[i]) freeRectangles[kept++] = freeRectangles[i];
+  freeRectangles.resize(kept);
+}
+
+double RectanglesPacker::GetOccupancy() const {
+  if (width <= 0 || height <= 0) return 0;
+
+  double usedArea = 0;
+  for (const auto& rectangle : usedRectangles)
+    usedArea += (double)rectangle.width * rectangle.height;
+  return usedArea / ((double)width * height);
+}
+
+}  // namespace gd
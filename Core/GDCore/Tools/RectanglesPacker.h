@@ -0,0 +1,75 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_RECTANGLESPACKER_H
+#define GDCORE_RECTANGLESPACKER_H
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief Pack rectangles into a fixed size area, without rotating them.
+ *
+ * Rectangles are placed using the "MaxRects" algorithm with the "best short
+ * side fit" heuristic: the list of maximal free rectangles is kept, and each
+ * rectangle is put where it leaves the smallest leftover along one side.
+ *
+ * \ingroup Tools
+ */
+class GD_CORE_API RectanglesPacker {
+ public:
+  struct Rectangle {
+    Rectangle() : x(0), y(0), width(0), height(0){};
+    Rectangle(int x_, int y_, int width_, int height_)
+        : x(x_), y(y_), width(width_), height(height_){};
+
+    bool Contains(const Rectangle& other) const {
+      return other.x >= x && other.y >= y &&
+             other.x + other.width <= x + width &&
+             other.y + other.height <= y + height;
+    }
+
+    int x;
+    int y;
+    int width;
+    int height;
+  };
+
+  RectanglesPacker(int width, int height);
+
+  /**
+   * \brief Find a place for a rectangle of the given size.
+   *
+   * \param placement Filled with the position of the rectangle.
+   * \return false if there is not enough space left.
+   */
+  bool Insert(int width, int height, Rectangle& placement);
+
+  /**
+   * \brief Return the rectangles that were inserted.
+   */
+  const std::vector<Rectangle>& GetUsedRectangles() const {
+    return usedRectangles;
+  }
+
+  /**
+   * \brief Return the ratio of the area that is covered by the inserted
+   * rectangles.
+   */
+  double GetOccupancy() const;
+
+ private:
+  void SplitFreeRectangles(const Rectangle& placed);
+  void PruneFreeRectangles();
+
+  int width;
+  int height;
+  std::vector<Rectangle> freeRectangles;
+  std::vector<Rectangle> usedRectangles;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_RECTANGLESPACKER_H
@@ -10,6 +10,7 @@
 #define GDCORE_SPTRLIST
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace gd {
@@ -19,8 +20,10 @@ class SPtrList {
  public:
   SPtrList();
   SPtrList(const SPtrList<T>&);
+  SPtrList(SPtrList<T>&&) = default;
   virtual ~SPtrList(){};
   SPtrList<T>& operator=(const SPtrList<T>& rhs);
+  SPtrList<T>& operator=(SPtrList<T>&& rhs) = default;
 
   /**
    * \brief Insert the specified element to the list
@@ -32,6 +35,16 @@ class SPtrList {
    */
   T& Insert(const T& element, size_t position = (size_t)-1);
 
+  /**
+   * \brief Insert the specified element to the list
+   * \note The element passed by parameter is moved into the list.
+   * \param element The element that must be moved and inserted into the list
+   * \param position Insertion position. If the position is invalid, the object
+   * is inserted at the end of the objects list. \return A reference to the
+   * element in the list
+   */
+  T& Insert(T&& element, size_t position = (size_t)-1);
+
   /**
    * \brief Insert the specified element to the list.
    * \note The element passed by parameter is not copied.
@@ -42,6 +42,17 @@ T& SPtrList<T>::Insert(const T& evt, size_t position) {
   return *element;
 }
 
+template <typename T>
+T& SPtrList<T>::Insert(T&& evt, size_t position) {
+  std::shared_ptr<T> element = std::make_shared<T>(std::move(evt));
+  if (position < elements.size())
+    elements.insert(elements.begin() + position, element);
+  else
+    elements.push_back(element);
+
+  return *element;
+}
+
 template <typename T>
 void SPtrList<T>::Insert(std::shared_ptr<T> element, size_t position) {
   if (position < elements.size())
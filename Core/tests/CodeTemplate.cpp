@@ -0,0 +1,72 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the code templates.
+ */
+#include "GDCore/Tools/CodeTemplate.h"
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("CodeTemplate", "[common]") {
+  SECTION("Basics") {
+    gd::CodeTemplate codeTemplate("NAMESPACE.CLASSNAME = class CLASSNAME {};",
+                                  {"NAMESPACE", "CLASSNAME"});
+    REQUIRE(codeTemplate.GetPlaceholdersOccurrencesCount() == 3);
+    REQUIRE(codeTemplate.Render({"gdjs.evtsExt", "MyBehavior"}) ==
+            "gdjs.evtsExt.MyBehavior = class MyBehavior {};");
+    REQUIRE(codeTemplate.Render({"a", "b"}) == "a.b = class b {};");
+  }
+
+  SECTION("Empty templates and missing placeholders") {
+    gd::CodeTemplate emptyTemplate("", {"A"});
+    REQUIRE(emptyTemplate.Render({"value"}) == "");
+
+    gd::CodeTemplate noPlaceholderTemplate("Nothing to replace", {"A", ""});
+    REQUIRE(noPlaceholderTemplate.GetPlaceholdersOccurrencesCount() == 0);
+    REQUIRE(noPlaceholderTemplate.Render({"value", "other"}) ==
+            "Nothing to replace");
+
+    gd::CodeTemplate onlyPlaceholderTemplate("A", {"A"});
+    REQUIRE(onlyPlaceholderTemplate.Render({"value"}) == "value");
+    REQUIRE(onlyPlaceholderTemplate.Render({}) == "");
+  }
+
+  SECTION("Longest placeholder wins") {
+    gd::CodeTemplate codeTemplate(
+        "PROPERTIES_CODE|SHARED_PROPERTIES_CODE|INITIALIZE_PROPERTIES_CODE",
+        {"PROPERTIES_CODE",
+         "SHARED_PROPERTIES_CODE",
+         "INITIALIZE_PROPERTIES_CODE"});
+    REQUIRE(codeTemplate.Render({"1", "2", "3"}) == "1|2|3");
+  }
+
+  SECTION("Placeholders glued to other text") {
+    gd::CodeTemplate codeTemplate("_EXTENSION_NAME_CLASSNAMESharedData",
+                                  {"EXTENSION_NAME", "CLASSNAME"});
+    REQUIRE(codeTemplate.Render({"Ext", "Behavior"}) ==
+            "_Ext_BehaviorSharedData");
+  }
+
+  SECTION("Values are never substituted again") {
+    gd::CodeTemplate codeTemplate("NAME FULL_NAME", {"NAME", "FULL_NAME"});
+    REQUIRE(codeTemplate.Render({"FULL_NAME", "NAME"}) == "FULL_NAME NAME");
+  }
+
+  SECTION("UTF8") {
+    gd::CodeTemplate codeTemplate(u8"Ça va NAME? 😀NAME😀",
+                                  {"NAME"});
+    REQUIRE(codeTemplate.Render({u8"Éric"}) == u8"Ça va Éric? 😀Éric😀");
+  }
+
+  SECTION("Substitute") {
+    REQUIRE(gd::CodeTemplate::Substitute(
+                "<!-- GDJS_CODE_FILES -->\n{}/*GDJS_ADDITIONAL_SPEC*/",
+                {{"<!-- GDJS_CODE_FILES -->", "<script></script>"},
+                 {"{}/*GDJS_ADDITIONAL_SPEC*/", "{a: 1}"}}) ==
+            "<script></script>\n{a: 1}");
+  }
+}
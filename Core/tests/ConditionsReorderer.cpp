@@ -0,0 +1,162 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the order in which conditions are evaluated when they
+ * are reordered by cost.
+ */
+#include "GDCore/Events/CodeGeneration/ConditionsReorderer.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/InstructionsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+}  // namespace
+
+TEST_CASE("ConditionsReorderer", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Layout1", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+  layout.InsertNewObject(
+      project, "MyExtension::Sprite", "MyOtherSpriteObject", 1);
+
+  gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+  gd::Instruction pickingCondition =
+      MakeInstruction("MyExtension::IsSomething", {"MySpriteObject"});
+  gd::Instruction otherPickingCondition =
+      MakeInstruction("MyExtension::IsSomething", {"MyOtherSpriteObject"});
+  gd::Instruction cheapCondition =
+      MakeInstruction("MyExtension::IsCheapToCheck", {"1"});
+  gd::Instruction cheapConditionUsingObjects = MakeInstruction(
+      "MyExtension::IsCheapToCheck", {"MySpriteObject.GetObjectNumber()"});
+  gd::Instruction conditionWithSideEffect =
+      MakeInstruction("MyExtension::IsSomethingWithSideEffect", {});
+
+  SECTION("Conditions kinds") {
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                codeGenerator, cheapCondition) ==
+            gd::ConditionsReorderer::Movable);
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                codeGenerator, pickingCondition) ==
+            gd::ConditionsReorderer::UsingObjects);
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                codeGenerator, cheapConditionUsingObjects) ==
+            gd::ConditionsReorderer::UsingObjects);
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                codeGenerator, conditionWithSideEffect) ==
+            gd::ConditionsReorderer::Fixed);
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                codeGenerator,
+                MakeInstruction("MyExtension::UnknownCondition", {})) ==
+            gd::ConditionsReorderer::Fixed);
+  }
+
+  SECTION("Conditions calling functions with side effects are fixed") {
+    project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+    gd::EventsCodeGenerator projectCodeGenerator(project, layout, platform);
+
+    // Functions of events functions extensions can run any events.
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                projectCodeGenerator,
+                MakeInstruction("MyExtension::IsCheapToCheck",
+                                {"MyEventsExtension::MyFunction() + 1"})) ==
+            gd::ConditionsReorderer::Fixed);
+    // Functions that are not pure can have side effects...
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                projectCodeGenerator,
+                MakeInstruction("MyExtension::IsCheapToCheck",
+                                {"MyExtension::GetNumber()"})) ==
+            gd::ConditionsReorderer::Fixed);
+    // ...unlike pure functions.
+    REQUIRE(gd::ConditionsReorderer::GetConditionKind(
+                projectCodeGenerator,
+                MakeInstruction("MyExtension::IsCheapToCheck",
+                                {"MyExtension::GetVariableAsNumber(MyVar)"})) ==
+            gd::ConditionsReorderer::Movable);
+
+    gd::InstructionsList conditions;
+    conditions.Insert(pickingCondition);
+    conditions.Insert(MakeInstruction("MyExtension::IsCheapToCheck",
+                                      {"MyEventsExtension::MyFunction()"}));
+    conditions.Insert(cheapCondition);
+    REQUIRE(gd::ConditionsReorderer::GetEvaluationOrder(projectCodeGenerator,
+                                                        conditions) ==
+            std::vector<std::size_t>({0, 1, 2}));
+  }
+
+  SECTION("Conditions are not reordered by default") {
+    gd::InstructionsList conditions;
+    conditions.Insert(pickingCondition);
+    conditions.Insert(cheapCondition);
+
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+            std::vector<std::size_t>({0, 1}));
+  }
+
+  SECTION("Cheap conditions are evaluated first") {
+    gd::InstructionsList conditions;
+    conditions.Insert(pickingCondition);
+    conditions.Insert(otherPickingCondition);
+    conditions.Insert(cheapCondition);
+
+    codeGenerator.SetReorderConditionsByCost(true);
+    REQUIRE(codeGenerator.GetConditionsEvaluationOrder(conditions) ==
+            std::vector<std::size_t>({2, 0, 1}));
+  }
+
+  SECTION("Conditions using objects keep their order") {
+    gd::InstructionsList conditions;
+    conditions.Insert(otherPickingCondition);
+    conditions.Insert(pickingCondition);
+    conditions.Insert(cheapConditionUsingObjects);
+    conditions.Insert(cheapCondition);
+
+    REQUIRE(gd::ConditionsReorderer::GetEvaluationOrder(codeGenerator,
+                                                        conditions) ==
+            std::vector<std::size_t>({3, 0, 1, 2}));
+  }
+
+  SECTION("Conditions are not moved across conditions with side effects") {
+    gd::InstructionsList conditions;
+    conditions.Insert(pickingCondition);
+    conditions.Insert(conditionWithSideEffect);
+    conditions.Insert(otherPickingCondition);
+    conditions.Insert(cheapCondition);
+
+    REQUIRE(gd::ConditionsReorderer::GetEvaluationOrder(codeGenerator,
+                                                        conditions) ==
+            std::vector<std::size_t>({0, 1, 3, 2}));
+  }
+
+  SECTION("Conditions are reordered when enabled in the project") {
+    project.SetReorderConditionsByCost(true);
+    gd::EventsCodeGenerator projectCodeGenerator(project, layout, platform);
+
+    gd::InstructionsList conditions;
+    conditions.Insert(pickingCondition);
+    conditions.Insert(cheapCondition);
+    REQUIRE(projectCodeGenerator.GetConditionsEvaluationOrder(conditions) ==
+            std::vector<std::size_t>({1, 0}));
+  }
+}
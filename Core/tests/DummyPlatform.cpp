@@ -152,6 +152,53 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
       .AddParameter("object", _("Object 2 parameter"))
       .SetFunctionName("doSomethingWithObjects");
 
+  extension
+      ->AddCondition("IsCheapToCheck",
+                     "Check something cheap",
+                     "This checks a number",
+                     "_PARAM0_ is cheap",
+                     "",
+                     "",
+                     "")
+      .AddParameter("expression", "Number")
+      .MarkAsSideEffectFree()
+      .MarkAsCheapToEvaluate()
+      .SetFunctionName("isCheapToCheck");
+
+  extension
+      ->AddCondition("IsSomethingWithSideEffect",
+                     "Check something and change it",
+                     "This checks something and changes it",
+                     "Something with side effect",
+                     "",
+                     "",
+                     "")
+      .MarkAsCheapToEvaluate()
+      .SetFunctionName("isSomethingWithSideEffect");
+
+  extension
+      ->AddAction("SetVariable",
+                  "Set a variable",
+                  "This changes the value of a scene variable",
+                  "Set _PARAM0_ to _PARAM1_",
+                  "",
+                  "",
+                  "")
+      .AddParameter("scenevar", "Scene variable")
+      .AddParameter("expression", "Value")
+      .SetFunctionName("setVariable");
+
+  extension
+      ->AddAction("CreateObjectInList",
+                  "Create an object",
+                  "This creates an object and adds it to the objects list",
+                  "Create _PARAM0_",
+                  "",
+                  "",
+                  "")
+      .AddParameter("objectListOrEmptyIfJustDeclared", _("Object to create"))
+      .SetFunctionName("createObjectInList");
+
   extension
       ->AddAction("DoSomethingWithResources",
                   "Do something with resources",
@@ -171,6 +218,7 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
   extension
       ->AddExpression(
           "GetVariableAsNumber", "Get me a variable value", "", "", "")
+      .SetPure()
       .AddParameter("scenevar", "Scene variable")
       .SetFunctionName("returnVariable");
   extension->AddStrExpression("ToString", "ToString", "", "", "")
@@ -194,6 +242,7 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
                       "",
                       "",
                       "")
+      .SetPure()
       .AddParameter("globalvar", "Global variable")
       .SetFunctionName("returnVariable");
   extension
@@ -247,7 +296,20 @@ void SetupProjectWithDummyPlatform(gd::Project& project,
       .AddParameter("object", _("Object"), "Sprite")
       .AddParameter("objectvar", _("Variable"))
       .SetFunctionName("returnVariable");
+  object
+      .AddCondition("IsSomething",
+                    "Check something on the object",
+                    "This checks something on the object",
+                    "_PARAM0_ is something",
+                    "",
+                    "",
+                    "")
+      .AddParameter("object", _("Object"), "Sprite")
+      .MarkAsSideEffectFree()
+      .MarkAsExpensiveToEvaluate()
+      .SetFunctionName("isSomething");
   object.AddExpression("GetObjectNumber", "Get number from object", "", "", "")
+      .SetPure()
       .AddParameter("object", _("Object"), "Sprite")
       .SetFunctionName("getObjectNumber");
   object
@@ -183,6 +183,38 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c7.IsSameObjectsList("c5.empty1", c5) == false);
   }
 
+  SECTION("Objects lists sharing") {
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c5);
+    c6.AllowObjectsListsSharing({"c1.object2"});
+    c6.ObjectsListNeeded("c5.object1");
+    c6.ObjectsListNeeded("c1.object2");
+    c6.ObjectsListNeeded("c6.object1");
+
+    // Lists that are only read are the ones of the parent:
+    REQUIRE(c6.GetContextDepth() == 3);
+    REQUIRE(c6.IsSameObjectsList("c5.object1", c5) == true);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c5.object1") == 2);
+
+    // Modified lists and lists not declared by parents are not shared:
+    REQUIRE(c6.IsSameObjectsList("c1.object2", c5) == false);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c1.object2") == 3);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c6.object1") == 3);
+
+    // The sharing is kept by contexts reusing the context:
+    gd::EventsCodeGenerationContext c7;
+    c7.Reuse(c6);
+    c7.ObjectsListNeeded("c2.object1");
+    REQUIRE(c7.IsSameObjectsList("c2.object1", c2) == true);
+
+    // ...but not by children contexts:
+    gd::EventsCodeGenerationContext c8;
+    c8.InheritsFrom(c6);
+    c8.ObjectsListNeeded("c5.object1");
+    REQUIRE(c8.IsSameObjectsList("c5.object1", c6) == false);
+    REQUIRE(c8.GetLastDepthObjectListWasNeeded("c5.object1") == 4);
+  }
+
   SECTION("Async") {
     gd::EventsCodeGenerationContext c1;
     c1.ObjectsListNeeded("c1.object1");
@@ -9,12 +9,37 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <memory>
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/VersionWrapper.h"
 #include "catch.hpp"
 
+namespace {
+class EventsCodeGeneratorWithProfiling : public gd::EventsCodeGenerator {
+ public:
+  EventsCodeGeneratorWithProfiling(const gd::Project& project,
+                                   const gd::Layout& layout,
+                                   const gd::Platform& platform)
+      : gd::EventsCodeGenerator(project, layout, platform){};
+
+ protected:
+  virtual gd::String GenerateEventsProfilingSectionBegin(
+      std::size_t sectionId) override {
+    return "begin" + gd::String::From(sectionId);
+  };
+  virtual gd::String GenerateEventsProfilingSectionEnd(
+      std::size_t sectionId) override {
+    return "end" + gd::String::From(sectionId);
+  };
+};
+}  // namespace
+
 TEST_CASE("EventsCodeGenerator", "[common][events]") {
   SECTION("Basics") {
     gd::Project project;
@@ -31,4 +56,91 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+
+  SECTION("Events profiling sections") {
+    gd::Platform platform;
+    platform.EnableExtensionLoadingLogs(false);
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "BuiltinCommonInstructions", "Common instructions", "", "", "");
+    extension
+        ->AddEvent("Standard",
+                   "Standard event",
+                   "",
+                   "",
+                   "",
+                   std::make_shared<gd::StandardEvent>())
+        .SetCodeGenerator([](gd::BaseEvent& event,
+                             gd::EventsCodeGenerator& codeGenerator,
+                             gd::EventsCodeGenerationContext& context) {
+          gd::StandardEvent& standardEvent =
+              dynamic_cast<gd::StandardEvent&>(event);
+          return codeGenerator.GenerateActionsListCode(
+                     standardEvent.GetActions(), context) +
+                 codeGenerator.GenerateEventsListCode(
+                     standardEvent.GetSubEvents(), context);
+        });
+    platform.AddExtension(extension);
+
+    gd::Project project;
+    project.AddPlatform(platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+
+    gd::EventsList events;
+    gd::StandardEvent& event = dynamic_cast<gd::StandardEvent&>(
+        events.InsertNewEvent(project, "BuiltinCommonInstructions::Standard"));
+    gd::StandardEvent& subEvent =
+        dynamic_cast<gd::StandardEvent&>(event.GetSubEvents().InsertNewEvent(
+            project, "BuiltinCommonInstructions::Standard"));
+    gd::Instruction action;
+    action.SetType("MyAction");
+    subEvent.GetActions().Insert(action);
+
+    unsigned int maxDepthLevelReached = 0;
+    {
+      // Nothing is generated by default.
+      EventsCodeGeneratorWithProfiling codeGenerator(
+          project, layout, platform);
+      gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+      gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+      REQUIRE(code.find("begin") == gd::String::npos);
+      REQUIRE(codeGenerator.GetEventsProfilingSections().empty());
+    }
+    {
+      EventsCodeGeneratorWithProfiling codeGenerator(
+          project, layout, platform);
+      codeGenerator.SetGenerateEventsProfilingCode(true);
+      gd::EventsCodeGenerationContext context(&maxDepthLevelReached);
+      gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+
+      // Sections are added when their code is done, so inner sections first.
+      const auto& sections = codeGenerator.GetEventsProfilingSections();
+      REQUIRE(sections.size() == 3);
+      REQUIRE(sections[0].kind == "actions");
+      REQUIRE(sections[0].eventPath == "0.0");
+      REQUIRE(sections[0].eventType == "BuiltinCommonInstructions::Standard");
+      REQUIRE(sections[0].sentence == "MyAction");
+      REQUIRE(sections[1].kind == "event");
+      REQUIRE(sections[1].eventPath == "0.0");
+      REQUIRE(sections[2].kind == "event");
+      REQUIRE(sections[2].eventPath == "0");
+
+      // Sections are properly nested.
+      REQUIRE(code.find("begin2") < code.find("begin1"));
+      REQUIRE(code.find("begin1") < code.find("begin0"));
+      REQUIRE(code.find("begin0") < code.find("end0"));
+      REQUIRE(code.find("end0") < code.find("end1"));
+      REQUIRE(code.find("end1") < code.find("end2"));
+
+      gd::SerializerElement element;
+      codeGenerator.SerializeEventsProfilingSectionsTo(element);
+      REQUIRE(element.GetChildrenCount() == 3);
+      REQUIRE(element.GetChild(0).GetStringAttribute("kind") == "actions");
+      REQUIRE(element.GetChild(0).GetStringAttribute("sentence") ==
+              "MyAction");
+      REQUIRE(element.GetChild(2).GetIntAttribute("id") == 2);
+      REQUIRE(element.GetChild(2).GetStringAttribute("eventPath") == "0");
+    }
+  }
 }
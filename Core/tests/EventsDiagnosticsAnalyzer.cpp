@@ -0,0 +1,172 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the validation of the events of a whole project.
+ */
+#include "GDCore/IDE/Events/EventsDiagnosticsAnalyzer.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+gd::StandardEvent& InsertStandardEvent(gd::Project& project,
+                                       gd::EventsList& events) {
+  return dynamic_cast<gd::StandardEvent&>(
+      events.InsertNewEvent(project,
+                            "BuiltinCommonInstructions::Standard",
+                            events.GetEventsCount()));
+}
+}  // namespace
+
+TEST_CASE("EventsDiagnosticsAnalyzer", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+  auto& otherLayout = project.InsertNewLayout("OtherScene", 1);
+
+  auto& event = InsertStandardEvent(project, layout.GetEvents());
+  event.GetActions().Insert(
+      MakeInstruction("MyExtension::DoSomething", {"1 +"}));
+  auto& subEvent = InsertStandardEvent(project, event.GetSubEvents());
+  subEvent.GetConditions().Insert(MakeInstruction(
+      "MyExtension::IsCheapToCheck", {"MySpriteObject.GetObjectNumber()"}));
+  subEvent.GetActions().Insert(MakeInstruction(
+      "MyExtension::DoSomethingWithObjects", {"MySpriteObject", "Unknown"}));
+  InsertStandardEvent(project, otherLayout.GetEvents())
+      .GetActions()
+      .Insert(MakeInstruction("MyExtension::DoSomething", {"2"}));
+
+  SECTION("Errors are found with the path of their event") {
+    gd::EventsDiagnosticsAnalyzer analyzer(platform);
+    const auto& diagnostics = analyzer.AnalyzeProject(project);
+
+    REQUIRE(diagnostics.size() == 2);
+    REQUIRE(diagnostics[0].GetEventPath() == "layouts/Scene/events/0");
+    REQUIRE(diagnostics[0].GetInstructionType() == "MyExtension::DoSomething");
+    REQUIRE(diagnostics[0].GetParameterIndex() == 0);
+    REQUIRE(diagnostics[0].GetExpression() == "1 +");
+    REQUIRE(diagnostics[1].GetEventPath() == "layouts/Scene/events/0/0");
+    REQUIRE(diagnostics[1].GetInstructionType() ==
+            "MyExtension::DoSomethingWithObjects");
+    REQUIRE(diagnostics[1].GetParameterIndex() == 1);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 2);
+  }
+
+  SECTION("Unknown instructions are reported") {
+    InsertStandardEvent(project, otherLayout.GetEvents())
+        .GetActions()
+        .Insert(MakeInstruction("MyExtension::UnknownAction", {}));
+
+    gd::EventsDiagnosticsAnalyzer analyzer(platform);
+    const auto& diagnostics = analyzer.AnalyzeProject(project);
+    REQUIRE(diagnostics.size() == 3);
+    REQUIRE(diagnostics[2].GetEventPath() == "layouts/OtherScene/events/1");
+    REQUIRE(diagnostics[2].GetInstructionType() ==
+            "MyExtension::UnknownAction");
+  }
+
+  SECTION("External events are validated with their associated layout") {
+    auto& externalEvents = project.InsertNewExternalEvents("External", 0);
+    InsertStandardEvent(project, externalEvents.GetEvents())
+        .GetActions()
+        .Insert(MakeInstruction("MyExtension::DoSomething",
+                                {"MySpriteObject.GetObjectNumber()"}));
+
+    gd::EventsDiagnosticsAnalyzer analyzer(platform);
+    // Unknown objects can't be reported without an associated layout.
+    REQUIRE(analyzer.AnalyzeProject(project).size() == 2);
+
+    externalEvents.SetAssociatedLayout("OtherScene");
+    const auto& diagnostics = analyzer.AnalyzeProject(project);
+    REQUIRE(diagnostics.size() == 3);
+    REQUIRE(diagnostics[2].GetEventPath() ==
+            "externalEvents/External/events/0");
+
+    externalEvents.SetAssociatedLayout("Scene");
+    REQUIRE(analyzer.AnalyzeProject(project).size() == 2);
+  }
+
+  SECTION("Only the events lists that changed are validated again") {
+    gd::EventsDiagnosticsAnalyzer analyzer(platform);
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 2);
+
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 0);
+    REQUIRE(analyzer.GetDiagnostics().size() == 2);
+
+    // Fix the error of the first event.
+    event.GetActions()[0].SetParameter(0, gd::Expression("1 + 2"));
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 1);
+    REQUIRE(analyzer.GetDiagnostics().size() == 1);
+
+    // Adding the missing object makes the events valid.
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Unknown", 1);
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 1);
+    REQUIRE(analyzer.GetDiagnostics().empty());
+
+    // Global objects are used by all the layouts.
+    project.InsertNewObject(project, "MyExtension::Sprite", "GlobalObject", 0);
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 2);
+
+    analyzer.ClearCache();
+    analyzer.AnalyzeProject(project);
+    REQUIRE(analyzer.GetValidatedEventsListsCount() == 2);
+  }
+
+  SECTION("Results are the same with several threads") {
+    for (std::size_t i = 0; i < 20; ++i) {
+      auto& newLayout =
+          project.InsertNewLayout("Scene" + gd::String::From(i), 2 + i);
+      for (std::size_t j = 0; j < 10; ++j) {
+        InsertStandardEvent(project, newLayout.GetEvents())
+            .GetActions()
+            .Insert(MakeInstruction("MyExtension::DoSomething",
+                                    {j % 3 == 0 ? "1 +" : "1"}));
+      }
+    }
+
+    gd::EventsDiagnosticsAnalyzer analyzer(platform);
+    analyzer.SetThreadsCount(1);
+    std::vector<gd::EventsDiagnostic> diagnostics =
+        analyzer.AnalyzeProject(project);
+
+    gd::EventsDiagnosticsAnalyzer parallelAnalyzer(platform);
+    parallelAnalyzer.SetThreadsCount(4);
+    const auto& parallelDiagnostics = parallelAnalyzer.AnalyzeProject(project);
+    REQUIRE(parallelAnalyzer.GetValidatedEventsListsCount() == 22);
+    REQUIRE(diagnostics.size() == 2 + 20 * 4);
+    REQUIRE(parallelDiagnostics.size() == diagnostics.size());
+    for (std::size_t i = 0; i < diagnostics.size(); ++i) {
+      REQUIRE(parallelDiagnostics[i].GetEventPath() ==
+              diagnostics[i].GetEventPath());
+      REQUIRE(parallelDiagnostics[i].GetMessage() ==
+              diagnostics[i].GetMessage());
+    }
+  }
+}
@@ -0,0 +1,199 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the inlining of expression events functions at their
+ * calls.
+ */
+#include "GDCore/Events/CodeGeneration/EventsFunctionsInliner.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+void AddEventsFunctionsExtensionToPlatform(gd::Platform& platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "MyEventsExtension", "My events extension", "", "", "");
+  extension->AddExpression("Double", "Double", "", "", "")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("expression", "Value")
+      .SetFunctionName("doubleFunction");
+  extension->AddExpression("Square", "Square", "", "", "")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("expression", "Value")
+      .SetFunctionName("squareFunction");
+  extension->AddExpression("Scale", "Scale", "", "", "")
+      .AddCodeOnlyParameter("currentScene", "")
+      .AddParameter("expression", "Value")
+      .SetFunctionName("scale");
+  extension->AddExpression("Random", "Random", "", "", "")
+      .AddCodeOnlyParameter("currentScene", "")
+      .SetFunctionName("randomFunction");
+  platform.AddExtension(extension);
+
+  std::shared_ptr<gd::PlatformExtension> advancedExtension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  advancedExtension->SetExtensionInformation(
+      "BuiltinAdvanced", "Advanced", "", "", "");
+  advancedExtension->AddExpression("GetArgumentAsNumber", "", "", "", "")
+      .AddParameter("functionParameterName", "Parameter name")
+      .SetFunctionName("getArgument");
+  advancedExtension->AddExpression("Random", "", "", "", "")
+      .AddParameter("expression", "Maximum")
+      .SetFunctionName("random");
+  advancedExtension->AddExpression("abs", "", "", "", "")
+      .SetPure()
+      .AddParameter("expression", "Value")
+      .SetFunctionName("abs");
+  platform.AddExtension(advancedExtension);
+}
+
+gd::EventsFunction& AddReturningFunction(
+    gd::EventsFunctionsExtension& eventsExtension,
+    const gd::String& name,
+    const gd::String& returnedExpression) {
+  gd::EventsFunction& eventsFunction =
+      eventsExtension.InsertNewEventsFunction(name, 0);
+  eventsFunction.SetFunctionType(gd::EventsFunction::Expression);
+  eventsFunction.GetParameters().push_back(
+      gd::ParameterMetadata().SetName("Value").SetType("expression"));
+
+  gd::Instruction action;
+  action.SetType("SetReturnNumber");
+  action.SetParametersCount(1);
+  action.SetParameter(0, gd::Expression(returnedExpression));
+  gd::StandardEvent event;
+  event.GetActions().Insert(action);
+  eventsFunction.GetEvents().InsertEvent(event);
+
+  return eventsFunction;
+}
+}  // namespace
+
+TEST_CASE("EventsFunctionsInliner", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  AddEventsFunctionsExtensionToPlatform(platform);
+  auto& layout = project.InsertNewLayout("Scene", 0);
+
+  auto& eventsExtension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  AddReturningFunction(
+      eventsExtension, "Double", "GetArgumentAsNumber(\"Value\") * 2");
+  AddReturningFunction(
+      eventsExtension,
+      "Square",
+      "GetArgumentAsNumber(\"Value\") * GetArgumentAsNumber(\"Value\")");
+  AddReturningFunction(eventsExtension,
+                       "Scale",
+                       "GetArgumentAsNumber(\"Value\") * 1000000 + 1000000");
+  AddReturningFunction(eventsExtension, "Random", "Random(10)")
+      .GetParameters()
+      .clear();
+
+  auto generateExpressionCode = [&](const gd::String& expression) {
+    unsigned int maxDepth = 0;
+    gd::EventsCodeGenerationContext context(&maxDepth);
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    return gd::ExpressionCodeGenerator::GenerateExpressionCode(
+        codeGenerator, context, "number", expression);
+  };
+
+  SECTION("Functions are not inlined by default") {
+    REQUIRE(generateExpressionCode("MyEventsExtension::Double(3)")
+                .find("doubleFunction(") != gd::String::npos);
+  }
+
+  SECTION("Functions returning an expression are inlined") {
+    project.SetEventsFunctionsInliningMaxCodeGrowth(100);
+
+    REQUIRE(generateExpressionCode("1 + MyEventsExtension::Double(3)") ==
+            "1 + ((3) * 2)");
+    REQUIRE(generateExpressionCode(
+                "MyEventsExtension::Double(MyExtension::GetNumber()) * 3") ==
+            "((getNumber()) * 2) * 3");
+  }
+
+  SECTION("Arguments are not evaluated more than once") {
+    project.SetEventsFunctionsInliningMaxCodeGrowth(100);
+
+    REQUIRE(generateExpressionCode("MyEventsExtension::Square(3)") ==
+            "((3) * (3))");
+    REQUIRE(generateExpressionCode(
+                "MyEventsExtension::Square(MyExtension::GetNumber())")
+                .find("squareFunction(") != gd::String::npos);
+  }
+
+  SECTION("Functions calling functions that are not pure are not inlined") {
+    project.SetEventsFunctionsInliningMaxCodeGrowth(100);
+
+    REQUIRE(generateExpressionCode("MyEventsExtension::Random()")
+                .find("randomFunction(") != gd::String::npos);
+  }
+
+  SECTION("Functions are only inlined while the code growth is allowed") {
+    project.SetEventsFunctionsInliningMaxCodeGrowth(1);
+
+    // Inlining code shorter than the call is always allowed.
+    REQUIRE(generateExpressionCode("MyEventsExtension::Double(3)") ==
+            "((3) * 2)");
+    REQUIRE(generateExpressionCode("MyEventsExtension::Scale(3)") ==
+            "scale(\"\", 3)");
+  }
+
+  SECTION("Returned expressions are checked") {
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    std::vector<gd::String> argumentsUsages;
+
+    REQUIRE(gd::EventsFunctionsInliner::GetInlinableReturnedExpression(
+                codeGenerator,
+                eventsExtension.GetEventsFunction("Square"),
+                argumentsUsages) ==
+            "GetArgumentAsNumber(\"Value\") * GetArgumentAsNumber(\"Value\")");
+    REQUIRE(argumentsUsages.size() == 2);
+    REQUIRE(argumentsUsages[0] == "Value");
+    REQUIRE(argumentsUsages[1] == "Value");
+
+    auto& withVariable =
+        AddReturningFunction(eventsExtension, "WithVariable", "MyVariable");
+    REQUIRE(gd::EventsFunctionsInliner::GetInlinableReturnedExpression(
+                codeGenerator, withVariable, argumentsUsages)
+                .empty());
+
+    auto& withPureFunction = AddReturningFunction(
+        eventsExtension,
+        "WithPureFunction",
+        "abs(GetArgumentAsNumber(\"Value\") - 1)");
+    REQUIRE_FALSE(gd::EventsFunctionsInliner::GetInlinableReturnedExpression(
+                      codeGenerator, withPureFunction, argumentsUsages)
+                      .empty());
+
+    auto& withCondition = AddReturningFunction(
+        eventsExtension, "WithCondition", "GetArgumentAsNumber(\"Value\")");
+    gd::Instruction condition;
+    condition.SetType("MyExtension::IsSomething");
+    dynamic_cast<gd::StandardEvent&>(withCondition.GetEvents().GetEvent(0))
+        .GetConditions()
+        .Insert(condition);
+    REQUIRE(gd::EventsFunctionsInliner::GetInlinableReturnedExpression(
+                codeGenerator, withCondition, argumentsUsages)
+                .empty());
+  }
+}
@@ -6,8 +6,11 @@
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
 
 #include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionConstantFolder.h"
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Layout.h"
@@ -452,7 +455,7 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
                   codeGenerator, context, "scenevar", "myVariable[ \"hello\" + "
             "\"world\" ]", "")
-              == "getLayoutVariable(myVariable).getChild(\"hello\" + \"world\")");
+              == "getLayoutVariable(myVariable).getChild(\"helloworld\")");
     }
     SECTION("object variable") {
       REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
@@ -656,4 +659,179 @@ TEST_CASE("ExpressionCodeGenerator", "[common][events]") {
             "toString(+(-(getNumberWith3Params(12, \"hello world\", "
             "0))))).getChild(\"grandChild\")");
   }
+  SECTION("Constant folding") {
+    SECTION("number operations") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "1 + 2 * 3", "") == "7");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "(1 + 2) / 4", "") ==
+              "0.75");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "-(2)", "") == "(-2)");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "0.1 + 0.2", "") ==
+              "0.30000000000000004");
+    }
+    SECTION("division by zero is not folded") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "1 / 0", "") == "1 / 0");
+    }
+    SECTION("text concatenation") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "string", "\"a\" + \"b\"", "") ==
+              "\"ab\"");
+    }
+    SECTION("constant parameters") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumberWith2Params(1 + 1, \"a\" + \"b\")",
+                  "") == "getNumberWith2Params(2, \"ab\")");
+    }
+    SECTION("impure functions are not evaluated") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() * 2",
+                  "") == "getNumber() * 2");
+    }
+    SECTION("additions and subtractions are evaluated from left to right") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "number", "1 - 2 + 3", "") == "2");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() - 1 - 2",
+                  "") == "getNumber() - 1 - 2");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() - 0 + 2",
+                  "") == "getNumber() - 0 + 2");
+    }
+    SECTION("identities") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumber() * 1 + 0",
+                  "") == "getNumber()");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "1 * (MyExtension::GetNumber() - 0)",
+                  "") == "(getNumber())");
+    }
+  }
+  SECTION("Loop invariants") {
+    gd::RepeatEvent loopEvent;
+    gd::Instruction action;
+    action.SetType("MyExtension::SetVariable");
+    action.SetParametersCount(2);
+    action.SetParameter(0, gd::Expression("writtenVariable"));
+    action.SetParameter(1, gd::Expression("1"));
+    loopEvent.GetActions().Insert(action);
+
+    gd::LoopInvariants loopInvariants("invariant");
+    loopInvariants.FindWrittenVariables(codeGenerator, loopEvent);
+    context.SetLoopInvariants(&loopInvariants);
+
+    SECTION("variables are hoisted") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "scenevar",
+                  "myVariable.myChild",
+                  "") == "invariant0.getChild(\"myChild\")");
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator, context, "scenevar", "myVariable", "") ==
+              "invariant0");
+      REQUIRE(loopInvariants.GetHoistedCodes().size() == 1);
+      REQUIRE(loopInvariants.GetHoistedCodes()[0].second ==
+              "getLayoutVariable(myVariable)");
+    }
+    SECTION("pure functions of unmodified variables are hoisted") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetVariableAsNumber(myVariable) + "
+                  "MyExtension::GetVariableAsNumber(writtenVariable)",
+                  "") == "invariant0 + returnVariable(invariant1)");
+      REQUIRE(loopInvariants.GetHoistedCodes().size() == 2);
+      REQUIRE(loopInvariants.GetHoistedCodes()[0].second ==
+              "returnVariable(getLayoutVariable(myVariable))");
+      REQUIRE(loopInvariants.GetHoistedCodes()[1].second ==
+              "getLayoutVariable(writtenVariable)");
+    }
+    SECTION("impure functions are not hoisted") {
+      REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                  codeGenerator,
+                  context,
+                  "number",
+                  "MyExtension::GetNumberWith2Params(1, \"a\")",
+                  "") == "getNumberWith2Params(1, \"a\")");
+      REQUIRE(loopInvariants.GetHoistedCodes().empty());
+    }
+  }
+}
+
+TEST_CASE("ExpressionConstantFolder", "[common][events]") {
+  typedef gd::ExpressionConstantFolder::Value Value;
+
+  SECTION("Number functions") {
+    Value result;
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "cos", {Value(0.0)}, result));
+    REQUIRE(result.isNumber);
+    REQUIRE(result.number == 1);
+
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "round", {Value(-2.5)}, result));
+    REQUIRE(result.number == -2);
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "round", {Value(2.5)}, result));
+    REQUIRE(result.number == 3);
+
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "mod", {Value(-1.0), Value(3.0)}, result));
+    REQUIRE(result.number == 2);
+
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "clamp", {Value(5.0), Value(0.0), Value(2.0)}, result));
+    REQUIRE(result.number == 2);
+  }
+
+  SECTION("Text functions") {
+    Value result;
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "ToString", {Value(-12.0)}, result));
+    REQUIRE_FALSE(result.isNumber);
+    REQUIRE(result.string == "-12");
+
+    REQUIRE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "StrLength", {Value(gd::String(u8"h\u00e9llo"))}, result));
+    REQUIRE(result.number == 5);
+  }
+
+  SECTION("Not evaluated") {
+    Value result;
+    // Unknown function
+    REQUIRE_FALSE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "MyExtension::GetNumber", {}, result));
+    // Wrong parameters
+    REQUIRE_FALSE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "cos", {Value(gd::String("0"))}, result));
+    // Non finite result
+    REQUIRE_FALSE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "sqrt", {Value(-1.0)}, result));
+    // Not an integer (JavaScript formatting is not reproduced)
+    REQUIRE_FALSE(gd::ExpressionConstantFolder::EvaluateFunction(
+        "ToString", {Value(0.5)}, result));
+  }
 }
@@ -0,0 +1,172 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ExpressionCompletionIndex.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionCompletionIndex", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout1 = project.InsertNewLayout("Layout1", 0);
+  auto& object =
+      layout1.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+  object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+  object.GetVariables().InsertNew("MyObjectVariable", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MyOtherObject", 1);
+  layout1.GetVariables().InsertNew("MySceneVariable", 0);
+  project.GetVariables().InsertNew("MyGlobalVariable", 0);
+
+  gd::ExpressionCompletionIndex index(platform);
+
+  auto getNames = [&](const gd::ExpressionCompletionDescription& description,
+                      size_t maxCount) {
+    std::vector<gd::String> names;
+    for (const auto& candidate : index.GetCompletionCandidatesFor(
+             description,
+             project,
+             layout1,
+             project.GetVariables(),
+             layout1.GetVariables(),
+             maxCount))
+      names.push_back(candidate.GetName());
+    return names;
+  };
+
+  SECTION("Match scores") {
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("Get", "Get") >
+            gd::ExpressionCompletionIndex::ComputeMatchScore("Get", "GetX"));
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("Get", "GetX") >
+            gd::ExpressionCompletionIndex::ComputeMatchScore("get", "GetX"));
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("get", "GetX") >
+            gd::ExpressionCompletionIndex::ComputeMatchScore("get", "GetXY"));
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("get", "GetXY") >
+            gd::ExpressionCompletionIndex::ComputeMatchScore("get", "ToGet"));
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("get", "ToGet") >
+            gd::ExpressionCompletionIndex::ComputeMatchScore("gt", "GetX"));
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("gt", "GetX") >=
+            0);
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("tg", "GetX") ==
+            -1);
+    REQUIRE(gd::ExpressionCompletionIndex::ComputeMatchScore("", "GetX") ==
+            0);
+  }
+
+  SECTION("Free expressions") {
+    // Matches of the prefix first, filtered by type.
+    std::vector<gd::String> names =
+        getNames(gd::ExpressionCompletionDescription::ForExpression(
+                     "number", "MyExtension::GetNumber", 0, 0),
+                 3);
+    REQUIRE(names.size() == 3);
+    REQUIRE(names[0] == "MyExtension::GetNumber");
+    REQUIRE(names[1] == "MyExtension::GetNumberWith2Params");
+    REQUIRE(names[2] == "MyExtension::GetNumberWith3Params");
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForExpression(
+                         "string", "MyExtension::GetNumber", 0, 0),
+                     3)
+                .empty());
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForExpression(
+                         "string", "myextension::tostr", 0, 0),
+                     3) == std::vector<gd::String>{"MyExtension::ToString"});
+
+    // Fuzzy matches, with the better matches first.
+    names = getNames(gd::ExpressionCompletionDescription::ForExpression(
+                         "number", "getnmber", 0, 0),
+                     100);
+    REQUIRE(names.size() >= 3);
+    REQUIRE(names[0] == "MyExtension::GetNumber");
+
+    // All expressions are returned for an empty prefix.
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForExpression(
+                         "number|string", "", 0, 0),
+                     1000)
+                .size() > 5);
+  }
+
+  SECTION("Object and behavior expressions") {
+    std::vector<gd::String> names =
+        getNames(gd::ExpressionCompletionDescription::ForExpression(
+                     "number", "GetObjectNum", 0, 0, "MyObject"),
+                 10);
+    REQUIRE(names.size() == 2);
+    REQUIRE(names[0] == "GetObjectNumber");
+    REQUIRE(names[1] == "GetObjectVariableAsNumber");
+
+    names = getNames(gd::ExpressionCompletionDescription::ForExpression(
+                         "string", "", 0, 0, "MyObject", "MyBehavior"),
+                     10);
+    REQUIRE(names.size() >= 1);
+    for (const gd::String& name : names)
+      REQUIRE(name.find("GetBehaviorString") != gd::String::npos);
+  }
+
+  SECTION("Objects, behaviors and variables") {
+    std::vector<gd::String> expectedObjectNames{"MyObject", "MyOtherObject"};
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForObject(
+                         "object", "myo", 0, 0),
+                     10) == expectedObjectNames);
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForObject(
+                         "object", "other", 0, 0),
+                     10) == std::vector<gd::String>{"MyOtherObject"});
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForBehavior(
+                         "myb", 0, 0, "MyObject"),
+                     10) == std::vector<gd::String>{"MyBehavior"});
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "scenevar", "My", 0, 0),
+                     10) == std::vector<gd::String>{"MySceneVariable"});
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "globalvar", "My", 0, 0),
+                     10) == std::vector<gd::String>{"MyGlobalVariable"});
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "objectvar", "", 0, 0, "MyObject"),
+                     10) == std::vector<gd::String>{"MyObjectVariable"});
+  }
+
+  SECTION("Updated objects and variables") {
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForObject(
+                         "object", "MyNew", 0, 0),
+                     10)
+                .empty());
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "scenevar", "MyNew", 0, 0),
+                     10)
+                .empty());
+
+    // Changed containers are indexed again.
+    auto& newObject = layout1.InsertNewObject(
+        project, "MyExtension::Sprite", "MyNewObject", 0);
+    layout1.GetVariables().InsertNew("MyNewSceneVariable", 0);
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForObject(
+                         "object", "MyNew", 0, 0),
+                     10) == std::vector<gd::String>{"MyNewObject"});
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "scenevar", "MyNew", 0, 0),
+                     10) == std::vector<gd::String>{"MyNewSceneVariable"});
+
+    newObject.GetVariables().InsertNew("MyNewObjectVariable", 0);
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "objectvar", "", 0, 0, "MyNewObject"),
+                     10) == std::vector<gd::String>{"MyNewObjectVariable"});
+
+    layout1.RemoveObject("MyNewObject");
+    layout1.GetVariables().Remove("MyNewSceneVariable");
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForObject(
+                         "object", "MyNew", 0, 0),
+                     10)
+                .empty());
+    REQUIRE(getNames(gd::ExpressionCompletionDescription::ForVariable(
+                         "scenevar", "MyNew", 0, 0),
+                     10)
+                .empty());
+  }
+}
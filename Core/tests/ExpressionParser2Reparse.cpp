@@ -0,0 +1,212 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief Describe the locations, diagnostics and parents of all the nodes, to
+ * compare trees.
+ */
+class NodesDescriber : public gd::ExpressionParser2NodeWorker {
+ public:
+  NodesDescriber(){};
+  virtual ~NodesDescriber(){};
+
+  static gd::String Describe(gd::ExpressionNode& node) {
+    NodesDescriber describer;
+    describer.Add(node, nullptr);
+    node.Visit(describer);
+    return describer.output;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(gd::SubExpressionNode& node) override {
+    Add(*node.expression, nullptr);
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(gd::OperatorNode& node) override {
+    Add(*node.leftHandSide, &node);
+    node.leftHandSide->Visit(*this);
+    Add(*node.rightHandSide, &node);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(gd::UnaryOperatorNode& node) override {
+    Add(*node.factor, &node);
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(gd::NumberNode& node) override {}
+  void OnVisitTextNode(gd::TextNode& node) override {}
+  void OnVisitVariableNode(gd::VariableNode& node) override {
+    Add(node.nameLocation);
+    for (auto* child = node.child.get(); child; child = child->child.get()) {
+      Add(*child, nullptr);
+      child->Visit(*this);
+    }
+  }
+  void OnVisitVariableAccessorNode(gd::VariableAccessorNode& node) override {
+    Add(node.nameLocation);
+    Add(node.dotLocation);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      gd::VariableBracketAccessorNode& node) override {
+    Add(*node.expression, nullptr);
+    node.expression->Visit(*this);
+  }
+  void OnVisitIdentifierNode(gd::IdentifierNode& node) override {
+    Add(node.identifierNameLocation);
+    Add(node.identifierNameDotLocation);
+    Add(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(
+      gd::ObjectFunctionNameNode& node) override {
+    Add(node.objectNameLocation);
+    Add(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(gd::FunctionCallNode& node) override {
+    Add(node.functionNameLocation);
+    Add(node.openingParenthesisLocation);
+    Add(node.closingParenthesisLocation);
+    for (auto& parameter : node.parameters) {
+      Add(*parameter, &node);
+      parameter->Visit(*this);
+    }
+  }
+  void OnVisitEmptyNode(gd::EmptyNode& node) override {}
+
+ private:
+  void Add(gd::ExpressionNode& node, gd::ExpressionNode* parent) {
+    output += "{";
+    Add(node.location);
+    if (parent && node.parent != parent) output += "wrong parent ";
+    if (node.diagnostic && node.diagnostic->IsError())
+      output += node.diagnostic->GetMessage() + " " +
+                gd::String::From(node.diagnostic->GetStartPosition()) + "-" +
+                gd::String::From(node.diagnostic->GetEndPosition());
+    output += "}";
+  }
+
+  void Add(const gd::ExpressionParserLocation& location) {
+    if (!location.IsValid()) {
+      output += "[] ";
+      return;
+    }
+    output += "[" + gd::String::From(location.GetStartPosition()) + "," +
+              gd::String::From(location.GetEndPosition()) + "] ";
+  }
+
+  gd::String output;
+};
+}  // namespace
+
+TEST_CASE("ExpressionParser2 - Reparsing edited expressions",
+          "[common][events]") {
+  gd::ExpressionParser2 parser;
+
+  // Check that reparsing after an edit gives the same tree as parsing the
+  // whole new expression.
+  auto testReparse = [&parser](const gd::String& expression,
+                               size_t editStartPosition,
+                               size_t editEndPosition,
+                               const gd::String& replacement) {
+    gd::String newExpression =
+        expression.substr(0, editStartPosition) + replacement +
+        expression.substr(editEndPosition);
+    auto expectedNode = parser.ParseExpression(newExpression);
+    REQUIRE(expectedNode != nullptr);
+
+    auto node = parser.ReparseExpression(expression,
+                                         parser.ParseExpression(expression),
+                                         editStartPosition,
+                                         editEndPosition,
+                                         replacement);
+    REQUIRE(node != nullptr);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            gd::ExpressionParser2NodePrinter::PrintNode(*expectedNode));
+    REQUIRE(NodesDescriber::Describe(*node) ==
+            NodesDescriber::Describe(*expectedNode));
+  };
+
+  SECTION("Edits in parameters") {
+    gd::String expression = "MyFunction(1 + 2, \"abc\", Obj.Var) + 3";
+    testReparse(expression, 11, 12, "42");
+    testReparse(expression, 15, 16, "");
+    testReparse(expression, 20, 20, "de");
+    testReparse(expression, 26, 29, "OtherObject");
+    testReparse(expression, 11, 16, "  ToString(4)  ");
+    testReparse("f(a, )", 5, 5, "b");
+    testReparse("f(g(1, 2), 3)", 7, 8, "2 * 5");
+  }
+
+  SECTION("Edits in parentheses") {
+    gd::String expression = "(1 + (2 * 3)) / 4";
+    testReparse(expression, 6, 7, "22");
+    testReparse(expression, 1, 2, "-1");
+    testReparse(expression, 9, 11, "Var[\"a\"]");
+  }
+
+  SECTION("Nodes outside of the edit are reused") {
+    gd::String expression = "MyFunction(1 + 2, \"abc\", Obj.Var) + 3";
+    auto node = parser.ParseExpression(expression);
+    auto* operatorNode = dynamic_cast<gd::OperatorNode*>(node.get());
+    REQUIRE(operatorNode != nullptr);
+    auto* functionNode =
+        dynamic_cast<gd::FunctionCallNode*>(operatorNode->leftHandSide.get());
+    REQUIRE(functionNode != nullptr);
+    REQUIRE(functionNode->parameters.size() == 3);
+    gd::ExpressionNode* textNode = functionNode->parameters[1].get();
+    gd::ExpressionNode* variableNode = functionNode->parameters[2].get();
+    gd::ExpressionNode* numberNode = operatorNode->rightHandSide.get();
+
+    node = parser.ReparseExpression(expression, std::move(node), 11, 12, "42");
+    REQUIRE(node.get() == operatorNode);
+    REQUIRE(operatorNode->leftHandSide.get() == functionNode);
+    REQUIRE(functionNode->parameters[1].get() == textNode);
+    REQUIRE(functionNode->parameters[2].get() == variableNode);
+    REQUIRE(operatorNode->rightHandSide.get() == numberNode);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            "MyFunction(42 + 2, \"abc\", Obj.Var) + 3");
+  }
+
+  SECTION("Nodes outside of the edited parentheses are reused") {
+    gd::String expression = "(1 + (2 * 3)) / 4";
+    auto node = parser.ParseExpression(expression);
+    auto* operatorNode = dynamic_cast<gd::OperatorNode*>(node.get());
+    REQUIRE(operatorNode != nullptr);
+    gd::ExpressionNode* subExpressionNode = operatorNode->leftHandSide.get();
+    gd::ExpressionNode* numberNode = operatorNode->rightHandSide.get();
+
+    node = parser.ReparseExpression(expression, std::move(node), 6, 7, "22");
+    REQUIRE(node.get() == operatorNode);
+    REQUIRE(operatorNode->leftHandSide.get() == subExpressionNode);
+    REQUIRE(operatorNode->rightHandSide.get() == numberNode);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            "(1 + (22 * 3)) / 4");
+  }
+
+  SECTION("Edits changing the structure of the expression") {
+    gd::String expression = "MyFunction(1 + 2, \"abc\") + (3)";
+    // New parameters or parentheses, and texts opened or closed.
+    testReparse(expression, 16, 16, ", 5");
+    testReparse(expression, 12, 12, "(");
+    testReparse(expression, 16, 17, ")");
+    testReparse(expression, 18, 18, "\"");
+    testReparse(expression, 11, 16, "");
+    testReparse(expression, 23, 24, "");
+    testReparse(expression, 0, 30, "1");
+    testReparse(expression, 30, 30, " +");
+  }
+
+  SECTION("Edits with errors") {
+    testReparse("f(1 +, 2)", 5, 5, " 2");
+    testReparse("f(1 + 2, 2)", 5, 7, "");
+    testReparse("f(1 + 2, 2", 7, 7, "0");
+    testReparse("f(a b, 2) + c d", 4, 5, "c");
+    testReparse("f(\"é\", 2) + 3", 3, 4, "àà");
+  }
+}
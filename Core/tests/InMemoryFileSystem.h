@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_TESTS_INMEMORYFILESYSTEM_H
+#define GDCORE_TESTS_INMEMORYFILESYSTEM_H
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/String.h"
+
+/**
+ * \brief A file system keeping files in memory, for the tests of the export
+ * stages reading and writing images.
+ *
+ * Paths are only handled with slashes, and directories always exist.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path){};
+  virtual bool DirExists(const gd::String& path) { return true; };
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t slashPosition = file.find_last_of("/");
+    return slashPosition == gd::String::npos ? file
+                                             : file.substr(slashPosition + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t slashPosition = file.find_last_of("/");
+    return slashPosition == gd::String::npos ? ""
+                                             : file.substr(0, slashPosition);
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    if (!FileExists(file)) return false;
+    files[destination] = files[file];
+    return true;
+  }
+  virtual bool ClearDir(const gd::String& directory) { return true; }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file] = content.Raw();
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    return gd::String::FromUTF8(files[file]);
+  }
+  virtual bool ReadBinaryFile(const gd::String& file, std::string& content) {
+    if (!FileExists(file)) return false;
+    content = files[file];
+    return true;
+  }
+  virtual bool WriteBinaryFile(const gd::String& file,
+                               const std::string& content) {
+    files[file] = content;
+    return true;
+  }
+  virtual std::vector<gd::FileStatus> StatFiles(
+      const std::vector<gd::String>& paths) {
+    std::vector<gd::FileStatus> statuses(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+      auto file = files.find(paths[i]);
+      statuses[i].fileExists = file != files.end();
+      statuses[i].dirExists = true;
+      statuses[i].size = file != files.end() ? file->second.size() : 0;
+    }
+    return statuses;
+  }
+  virtual gd::String GetTempDir() { return "/tmp/"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return std::vector<gd::String>();
+  }
+
+  std::map<gd::String, std::string> files;
+};
+
+#endif  // GDCORE_TESTS_INMEMORYFILESYSTEM_H
@@ -0,0 +1,110 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the analysis of the expressions that can be hoisted out
+ * of loops.
+ */
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/RepeatEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+}  // namespace
+
+TEST_CASE("LoopInvariants", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Layout1", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+
+  SECTION("Hoisted codes are named and only hoisted once") {
+    gd::LoopInvariants loopInvariants("invariant");
+    REQUIRE(loopInvariants.Hoist("getA()") == "invariant0");
+    REQUIRE(loopInvariants.Hoist("getB()") == "invariant1");
+    REQUIRE(loopInvariants.Hoist("getA()") == "invariant0");
+
+    const auto& hoistedCodes = loopInvariants.GetHoistedCodes();
+    REQUIRE(hoistedCodes.size() == 2);
+    REQUIRE(hoistedCodes[0].first == "invariant0");
+    REQUIRE(hoistedCodes[0].second == "getA()");
+    REQUIRE(hoistedCodes[1].first == "invariant1");
+    REQUIRE(hoistedCodes[1].second == "getB()");
+  }
+
+  SECTION("Actions write the variables given to them") {
+    gd::RepeatEvent loopEvent;
+    loopEvent.SetRepeatExpression("MyExtension::GetVariableAsNumber(Count)");
+    loopEvent.GetConditions().Insert(
+        MakeInstruction("MyExtension::IsSomething", {"MySpriteObject"}));
+    loopEvent.GetActions().Insert(
+        MakeInstruction("MyExtension::SetVariable", {"Written", "1"}));
+    loopEvent.GetActions().Insert(MakeInstruction(
+        "MyExtension::DoSomethingWithObjects",
+        {"MySpriteObject", "MySpriteObject"}));
+
+    gd::LoopInvariants loopInvariants("invariant");
+    loopInvariants.FindWrittenVariables(codeGenerator, loopEvent);
+    REQUIRE_FALSE(loopInvariants.IsVariableValueInvariant("Written", false));
+    REQUIRE(loopInvariants.IsVariableValueInvariant("Count", false));
+    REQUIRE(loopInvariants.IsVariableValueInvariant("Written", true));
+  }
+
+  SECTION("Sub-events are analyzed") {
+    gd::RepeatEvent loopEvent;
+    gd::StandardEvent subEvent;
+    subEvent.GetActions().Insert(
+        MakeInstruction("MyExtension::SetVariable", {"Written.Child", "1"}));
+    loopEvent.GetSubEvents().InsertEvent(subEvent);
+
+    gd::LoopInvariants loopInvariants("invariant");
+    loopInvariants.FindWrittenVariables(codeGenerator, loopEvent);
+    REQUIRE_FALSE(loopInvariants.IsVariableValueInvariant("Written", false));
+    REQUIRE(loopInvariants.IsVariableValueInvariant("Other", false));
+  }
+
+  SECTION("Unknown events can modify any variable") {
+    gd::RepeatEvent loopEvent;
+    gd::LinkEvent subEvent;
+    subEvent.SetTarget("External events");
+    loopEvent.GetSubEvents().InsertEvent(subEvent);
+
+    gd::LoopInvariants loopInvariants("invariant");
+    loopInvariants.FindWrittenVariables(codeGenerator, loopEvent);
+    REQUIRE_FALSE(loopInvariants.IsVariableValueInvariant("Other", false));
+    REQUIRE_FALSE(loopInvariants.IsVariableValueInvariant("Other", true));
+  }
+
+  SECTION("Variables values are not hoisted without a project") {
+    gd::EventsCodeGenerator functionCodeGenerator(platform, project, layout);
+    gd::RepeatEvent loopEvent;
+
+    gd::LoopInvariants loopInvariants("invariant");
+    loopInvariants.FindWrittenVariables(functionCodeGenerator, loopEvent);
+    REQUIRE_FALSE(loopInvariants.IsVariableValueInvariant("Other", false));
+  }
+}
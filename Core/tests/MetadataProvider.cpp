@@ -0,0 +1,71 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the metadata of instructions found by
+ * gd::MetadataProvider.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+#include <memory>
+
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "catch.hpp"
+
+namespace {
+std::shared_ptr<gd::PlatformExtension> CreateExtension(
+    const gd::String& actionFullName) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(
+      "MyExtension", "My testing extension", "", "", "");
+  extension->AddAction("DoSomething", actionFullName, "", "", "", "", "");
+  extension->AddCondition(
+      "DoSomething", "Check something", "", "", "", "", "");
+
+  return extension;
+}
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  SECTION("Instructions metadata is found again when extensions change") {
+    gd::Platform platform;
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyExtension::DoSomething")));
+
+    // Actions and conditions with the same type are not mixed up.
+    platform.AddExtension(CreateExtension("Do something"));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform,
+                                                    "MyExtension::DoSomething")
+                .GetFullName() == "Do something");
+    REQUIRE(gd::MetadataProvider::GetConditionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetFullName() == "Check something");
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform,
+                                                    "MyExtension::DoSomething")
+                .GetFullName() == "Do something");
+
+    // Replacing the extension forgets the metadata of the previous one.
+    platform.AddExtension(CreateExtension("Do something else"));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform,
+                                                    "MyExtension::DoSomething")
+                .GetFullName() == "Do something else");
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetExtension()
+                .GetName() == "MyExtension");
+
+    platform.RemoveExtension("MyExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(platform,
+                                                "MyExtension::DoSomething")));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(
+            platform, "MyExtension::DoSomething")));
+  }
+}
@@ -0,0 +1,118 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the analysis of the objects lists modified by events.
+ */
+#include "GDCore/Events/CodeGeneration/ModifiedObjectsListsFinder.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/ForEachEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+}  // namespace
+
+TEST_CASE("ModifiedObjectsListsFinder", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto& layout = project.InsertNewLayout("Layout1", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+  layout.InsertNewObject(
+      project, "MyExtension::Sprite", "MyOtherSpriteObject", 1);
+  auto& group = layout.GetObjectGroups().InsertNew("AllObjects");
+  group.AddObject("MySpriteObject");
+  group.AddObject("MyOtherSpriteObject");
+
+  auto findModifiedObjectsLists = [&](const gd::BaseEvent& event,
+                                      std::set<gd::String>& modifiedLists) {
+    return gd::ModifiedObjectsListsFinder::FindModifiedObjectsLists(
+        platform, project, layout, event, modifiedLists);
+  };
+
+  SECTION("Conditions filter the objects lists") {
+    gd::StandardEvent event;
+    event.GetConditions().Insert(
+        MakeInstruction("MyExtension::IsSomething", {"AllObjects"}));
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE(findModifiedObjectsLists(event, modifiedLists));
+    REQUIRE(modifiedLists == std::set<gd::String>(
+                                 {"MySpriteObject", "MyOtherSpriteObject"}));
+  }
+
+  SECTION("Actions only read the objects lists") {
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("MyExtension::DoSomethingWithObjects",
+                        {"MySpriteObject", "MyOtherSpriteObject"}));
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::DoSomething", {"MySpriteObject.GetObjectNumber()"}));
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE(findModifiedObjectsLists(event, modifiedLists));
+    REQUIRE(modifiedLists.empty());
+  }
+
+  SECTION("Actions can modify the objects lists given to them") {
+    gd::StandardEvent event;
+    event.GetActions().Insert(
+        MakeInstruction("MyExtension::CreateObjectInList", {"MySpriteObject"}));
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE(findModifiedObjectsLists(event, modifiedLists));
+    REQUIRE(modifiedLists == std::set<gd::String>({"MySpriteObject"}));
+  }
+
+  SECTION("Functions can modify the objects lists given to them") {
+    gd::StandardEvent event;
+    event.GetActions().Insert(MakeInstruction(
+        "MyExtension::DoSomething",
+        {"MyExtension::GetNumberWith2Params(MySpriteObject.GetObjectNumber(), "
+         "MySpriteObject.GetObjectStringWith2ObjectParam(MyOtherSpriteObject, "
+         "MyOtherSpriteObject))"}));
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE(findModifiedObjectsLists(event, modifiedLists));
+    REQUIRE(modifiedLists == std::set<gd::String>({"MyOtherSpriteObject"}));
+  }
+
+  SECTION("Sub-events are not analyzed") {
+    gd::StandardEvent event;
+    gd::StandardEvent subEvent;
+    subEvent.GetConditions().Insert(
+        MakeInstruction("MyExtension::IsSomething", {"MySpriteObject"}));
+    event.GetSubEvents().InsertEvent(subEvent);
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE(findModifiedObjectsLists(event, modifiedLists));
+    REQUIRE(modifiedLists.empty());
+  }
+
+  SECTION("Only standard events are supported") {
+    gd::ForEachEvent event;
+    event.SetObjectToPick("MySpriteObject");
+
+    std::set<gd::String> modifiedLists;
+    REQUIRE_FALSE(findModifiedObjectsLists(event, modifiedLists));
+  }
+}
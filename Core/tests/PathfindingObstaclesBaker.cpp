@@ -0,0 +1,205 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the baking of the obstacles for pathfinding.
+ */
+#include "GDCore/IDE/Project/PathfindingObstaclesBaker.h"
+
+#include <map>
+#include <string>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/PngCodec.h"
+#include "InMemoryFileSystem.h"
+#include "catch.hpp"
+
+namespace {
+void AddPathfindingExtensionToPlatform(gd::Platform& platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "PathfindingBehavior", "Pathfinding", "", "", "");
+  extension->AddBehavior(
+      "PathfindingBehavior",
+      "Pathfinding",
+      "Pathfinding",
+      "",
+      "",
+      "",
+      "PathfindingBehavior",
+      gd::make_unique<gd::Behavior>(
+          "Behavior", gd::PathfindingObstaclesBaker::pathfindingBehaviorType),
+      gd::make_unique<gd::BehaviorsSharedData>());
+  extension->AddBehavior(
+      "PathfindingObstacleBehavior",
+      "Obstacle for pathfinding",
+      "PathfindingObstacle",
+      "",
+      "",
+      "",
+      "PathfindingObstacleBehavior",
+      gd::make_unique<gd::Behavior>(
+          "Behavior", gd::PathfindingObstaclesBaker::obstacleBehaviorType),
+      gd::make_unique<gd::BehaviorsSharedData>());
+  platform.AddExtension(extension);
+}
+
+gd::Object& AddObstacleObject(gd::Project& project,
+                              gd::ObjectsContainer& container,
+                              const gd::String& name,
+                              const gd::String& image) {
+  gd::Object& object =
+      container.InsertNewObject(project, "MyExtension::Sprite", name, 0);
+  auto& spriteObject =
+      dynamic_cast<gd::SpriteObject&>(object.GetConfiguration());
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  gd::Sprite sprite;
+  sprite.SetImageName(image);
+  sprite.GetOrigin().SetX(10);
+  sprite.GetOrigin().SetY(5);
+  animation.GetDirection(0).AddSprite(sprite);
+  spriteObject.AddAnimation(animation);
+
+  object.AddNewBehavior(project,
+                        gd::PathfindingObstaclesBaker::obstacleBehaviorType,
+                        "PathfindingObstacle");
+  return object;
+}
+
+gd::InitialInstance& AddInstance(gd::Layout& layout,
+                                 const gd::String& objectName,
+                                 double x,
+                                 double y) {
+  gd::InitialInstance& instance =
+      layout.GetInitialInstances().InsertNewInitialInstance();
+  instance.SetObjectName(objectName);
+  instance.SetX(x);
+  instance.SetY(y);
+  return instance;
+}
+}  // namespace
+
+TEST_CASE("PathfindingObstaclesBaker", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  AddPathfindingExtensionToPlatform(platform);
+  InMemoryFileSystem fs;
+  fs.WriteBinaryFile("/export/wall.png",
+                     gd::PngCodec::Encode(gd::RgbaImage(40, 20)));
+  project.GetResourcesManager().AddResource("wall", "wall.png", "image");
+
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  AddObstacleObject(project, layout, "Wall", "wall");
+  gd::Object& character =
+      layout.InsertNewObject(project, "MyExtension::Sprite", "Character", 1);
+  gd::Behavior* pathfinding = character.AddNewBehavior(
+      project,
+      gd::PathfindingObstaclesBaker::pathfindingBehaviorType,
+      "Pathfinding");
+  pathfinding->GetContent().SetAttribute("cellWidth", 20);
+  pathfinding->GetContent().SetAttribute("cellHeight", 10);
+
+  gd::InitialInstance& wall = AddInstance(layout, "Wall", 50, 45);
+  gd::InitialInstance& resizedWall = AddInstance(layout, "Wall", -30, 0);
+  resizedWall.SetHasCustomSize(true);
+  resizedWall.SetCustomWidth(80);
+  resizedWall.SetCustomHeight(10);
+  AddInstance(layout, "Character", 0, 0);
+  layout.UpdateBehaviorsSharedData(project);
+
+  SECTION("Obstacles are baked in the shared data of their behavior") {
+    REQUIRE(gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+                project, fs, "/export") == 2);
+
+    const gd::SerializerElement& bakedObstacles =
+        layout.GetBehaviorSharedData("PathfindingObstacle")
+            .GetContent()
+            .GetChild("bakedObstacles");
+    REQUIRE(bakedObstacles.GetDoubleAttribute("cellSize") == 40);
+
+    const gd::SerializerElement& obstacles =
+        bakedObstacles.GetChild("obstacles");
+    obstacles.ConsiderAsArrayOf("obstacle");
+    REQUIRE(obstacles.GetChildrenCount() == 2);
+    const gd::SerializerElement& wallObstacle = obstacles.GetChild(0);
+    REQUIRE(wallObstacle.GetStringAttribute("persistentUuid") ==
+            wall.GetPersistentUuid());
+    REQUIRE(wallObstacle.GetDoubleAttribute("x") == 40);
+    REQUIRE(wallObstacle.GetDoubleAttribute("y") == 40);
+    REQUIRE(wallObstacle.GetDoubleAttribute("width") == 40);
+    REQUIRE(wallObstacle.GetDoubleAttribute("height") == 20);
+
+    // The origin is scaled with the custom size.
+    const gd::SerializerElement& resizedWallObstacle = obstacles.GetChild(1);
+    REQUIRE(resizedWallObstacle.GetDoubleAttribute("x") == -50);
+    REQUIRE(resizedWallObstacle.GetDoubleAttribute("y") == -2.5);
+    REQUIRE(resizedWallObstacle.GetDoubleAttribute("width") == 80);
+    REQUIRE(resizedWallObstacle.GetDoubleAttribute("height") == 10);
+
+    // The first wall covers the cells (1;1) to (2;1), the second one the
+    // cells (-2;-1) to (0;0).
+    const gd::SerializerElement& cells = bakedObstacles.GetChild("cells");
+    cells.ConsiderAsArrayOf("cell");
+    REQUIRE(cells.GetChildrenCount() == 2 + 6);
+    std::map<std::pair<int, int>, int> cellObstacles;
+    for (std::size_t i = 0; i < cells.GetChildrenCount(); ++i) {
+      const gd::SerializerElement& cell = cells.GetChild(i);
+      const gd::SerializerElement& indices = cell.GetChild("obstacles");
+      indices.ConsiderAsArrayOf("index");
+      REQUIRE(indices.GetChildrenCount() == 1);
+      cellObstacles[std::make_pair(cell.GetIntAttribute("x"),
+                                   cell.GetIntAttribute("y"))] =
+          indices.GetChild(0).GetIntValue();
+    }
+    REQUIRE(cellObstacles[std::make_pair(1, 1)] == 0);
+    REQUIRE(cellObstacles[std::make_pair(2, 1)] == 0);
+    REQUIRE(cellObstacles[std::make_pair(-2, -1)] == 1);
+    REQUIRE(cellObstacles[std::make_pair(0, 0)] == 1);
+  }
+
+  SECTION("Obstacles with an unknown size are not baked") {
+    layout.GetInitialInstances().RemoveInitialInstancesOfObject("Wall");
+    AddObstacleObject(project, layout, "MissingImageWall", "missing");
+    AddInstance(layout, "MissingImageWall", 0, 0);
+    AddInstance(layout, "Wall", 0, 0).SetRawDoubleProperty("animation", 1);
+    layout.UpdateBehaviorsSharedData(project);
+
+    REQUIRE(gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+                project, fs, "/export") == 1);
+  }
+
+  SECTION("Scenes without pathfinding are not baked") {
+    layout.RemoveObject("Character");
+    REQUIRE(gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+                project, fs, "/export") == 0);
+    REQUIRE(!layout.GetBehaviorSharedData("PathfindingObstacle")
+                 .GetContent()
+                 .HasChild("bakedObstacles"));
+  }
+
+  SECTION("Large obstacles are not baked") {
+    resizedWall.SetCustomWidth(4000);
+    REQUIRE(gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+                project, fs, "/export", 64) == 1);
+  }
+}
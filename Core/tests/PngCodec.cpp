@@ -0,0 +1,183 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the PNG decoder/encoder and the rectangles packer
+ * used to build texture atlases.
+ */
+#include "GDCore/Tools/PngCodec.h"
+
+#include <string>
+#include <vector>
+
+#include "GDCore/Tools/RectanglesPacker.h"
+#include "catch.hpp"
+
+namespace {
+gd::RgbaImage CreateGradientImage(unsigned int width, unsigned int height) {
+  gd::RgbaImage image(width, height);
+  for (unsigned int y = 0; y < height; ++y) {
+    for (unsigned int x = 0; x < width; ++x) {
+      unsigned char* pixel = image.GetPixel(x, y);
+      pixel[0] = x * 255 / width;
+      pixel[1] = y * 255 / height;
+      pixel[2] = (x * y) % 256;
+      pixel[3] = (x + y) % 3 == 0 ? 0 : 255;
+    }
+  }
+  return image;
+}
+
+bool Overlap(const gd::RectanglesPacker::Rectangle& a,
+             const gd::RectanglesPacker::Rectangle& b) {
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height &&
+         b.y < a.y + a.height;
+}
+}  // namespace
+
+TEST_CASE("PngCodec", "[common]") {
+  SECTION("Zlib decompression") {
+    // Compressed with zlib, using fixed Huffman codes.
+    const unsigned char fixedCodesData[] = {
+        120, 218, 11,  46,  40,  202, 44,  73,  85,  48,  80,  200, 79,  83,
+        72,  204, 203, 204, 77,  44,  201, 204, 207, 83,  48,  208, 81,  8,
+        134, 72,  24,  162, 74,  24,  194, 37,  140, 80,  37,  140, 224, 18,
+        198, 184, 140, 50,  193, 101, 148, 41,  46,  163, 204, 112, 25,  101,
+        142, 203, 40,  11,  92,  70,  89,  226, 244, 160, 1,   46,  179, 12,
+        13,  49,  12,  3,   0,   35,  214, 99,  61};
+    std::vector<unsigned char> output;
+    REQUIRE(gd::PngCodec::ZlibDecompress(
+        fixedCodesData, sizeof(fixedCodesData), output));
+    std::string text(output.begin(), output.end());
+    REQUIRE(text.size() == 302);
+    REQUIRE(text.substr(0, 50) ==
+            "Sprite 0 of animation 0, Sprite 1 of animation 1, ");
+    REQUIRE(text.substr(276) == "Sprite 11 of animation 2, ");
+
+    // Compressed with zlib, using dynamic Huffman codes.
+    const unsigned char dynamicCodesData[] = {
+        120, 218, 37,  201, 177, 17,  0,   48,  12,  194, 192, 89,  37,  236,
+        253, 87,  8,   190, 80,  168, 224, 25,  84,  132, 108, 2,   44,  115,
+        233, 250, 167, 116, 134, 249, 226, 3,   194, 127, 18,  96};
+    output.clear();
+    REQUIRE(gd::PngCodec::ZlibDecompress(
+        dynamicCodesData, sizeof(dynamicCodesData), output));
+    REQUIRE(std::string(output.begin(), output.end()) ==
+            "adabbbabaaceccaaaeadaaeaaaabbbcbbaabaaabcaaeadab");
+
+    // Corrupted data is detected by the checksum.
+    std::vector<unsigned char> corruptedData(
+        dynamicCodesData, dynamicCodesData + sizeof(dynamicCodesData));
+    corruptedData.back() ^= 1;
+    output.clear();
+    REQUIRE(!gd::PngCodec::ZlibDecompress(
+        corruptedData.data(), corruptedData.size(), output));
+  }
+
+  SECTION("Zlib round trip") {
+    std::vector<unsigned char> data;
+    for (int i = 0; i < 5000; ++i) data.push_back((i % 7) * (i % 13));
+    for (int i = 0; i < 300; ++i) data.push_back(i * 31 % 256);
+
+    std::vector<unsigned char> compressed = gd::PngCodec::ZlibCompress(data);
+    REQUIRE(compressed.size() < data.size() / 2);
+
+    std::vector<unsigned char> output;
+    REQUIRE(gd::PngCodec::ZlibDecompress(
+        compressed.data(), compressed.size(), output));
+    REQUIRE(output == data);
+
+    std::vector<unsigned char> empty;
+    compressed = gd::PngCodec::ZlibCompress(empty);
+    output.clear();
+    REQUIRE(gd::PngCodec::ZlibDecompress(
+        compressed.data(), compressed.size(), output));
+    REQUIRE(output.empty());
+  }
+
+  SECTION("Decoding") {
+    // A 8x8 PNG filled with magenta (the placeholder texture of the game
+    // engine).
+    const unsigned char pngData[] = {
+        137, 80,  78,  71,  13, 10,  26,  10,  0,   0,   0,   13,  73,  72,
+        68,  82,  0,   0,   0,  8,   0,   0,   0,   8,   8,   6,   0,   0,
+        0,   196, 15,  190, 139, 0,  0,   0,   20,  73,  68,  65,  84,  40,
+        83,  99,  252, 207, 240, 255, 63,  3,   30,  192, 56,  50,  20,  0,
+        0,   164, 195, 23,  241, 152, 180, 185, 112, 0,   0,   0,   0,   73,
+        69,  78,  68,  174, 66,  96,  130};
+    gd::RgbaImage image;
+    REQUIRE(gd::PngCodec::Decode(
+        std::string(reinterpret_cast<const char*>(pngData), sizeof(pngData)),
+        image));
+    REQUIRE(image.width == 8);
+    REQUIRE(image.height == 8);
+    for (unsigned int y = 0; y < 8; ++y) {
+      for (unsigned int x = 0; x < 8; ++x) {
+        const unsigned char* pixel = image.GetPixel(x, y);
+        REQUIRE(pixel[0] == 255);
+        REQUIRE(pixel[1] == 0);
+        REQUIRE(pixel[2] == 255);
+        REQUIRE(pixel[3] == 255);
+      }
+    }
+
+    unsigned int width = 0;
+    unsigned int height = 0;
+    REQUIRE(gd::PngCodec::DecodeSize(
+        std::string(reinterpret_cast<const char*>(pngData), 40),
+        width,
+        height));
+    REQUIRE(width == 8);
+    REQUIRE(height == 8);
+
+    REQUIRE(!gd::PngCodec::Decode("Not a PNG file", image));
+    REQUIRE(!gd::PngCodec::DecodeSize("Not a PNG file", width, height));
+    REQUIRE(!gd::PngCodec::Decode(
+        std::string(reinterpret_cast<const char*>(pngData), 40), image));
+  }
+
+  SECTION("Encoding round trip") {
+    gd::RgbaImage image = CreateGradientImage(37, 23);
+    std::string pngFile = gd::PngCodec::Encode(image);
+
+    gd::RgbaImage decodedImage;
+    REQUIRE(gd::PngCodec::Decode(pngFile, decodedImage));
+    REQUIRE(decodedImage.width == 37);
+    REQUIRE(decodedImage.height == 23);
+    REQUIRE(decodedImage.pixels == image.pixels);
+  }
+}
+
+TEST_CASE("RectanglesPacker", "[common]") {
+  SECTION("Rectangles are packed without overlapping") {
+    gd::RectanglesPacker packer(128, 128);
+    std::vector<gd::RectanglesPacker::Rectangle> placements;
+    for (int i = 0; i < 20; ++i) {
+      gd::RectanglesPacker::Rectangle placement;
+      REQUIRE(packer.Insert(10 + (i % 4) * 5, 12 + (i % 3) * 4, placement));
+      REQUIRE(placement.x >= 0);
+      REQUIRE(placement.y >= 0);
+      REQUIRE(placement.x <= 128 - placement.width);
+      REQUIRE(placement.y <= 128 - placement.height);
+      for (const auto& otherPlacement : placements)
+        REQUIRE(!Overlap(placement, otherPlacement));
+      placements.push_back(placement);
+    }
+    REQUIRE(packer.GetUsedRectangles().size() == 20);
+  }
+
+  SECTION("Area is filled before failing") {
+    gd::RectanglesPacker packer(64, 64);
+    gd::RectanglesPacker::Rectangle placement;
+    for (int i = 0; i < 16; ++i)
+      REQUIRE(packer.Insert(16, 16, placement));
+    REQUIRE(packer.GetOccupancy() == Approx(1));
+    REQUIRE(!packer.Insert(1, 1, placement));
+
+    gd::RectanglesPacker smallPacker(10, 10);
+    REQUIRE(!smallPacker.Insert(11, 2, placement));
+    REQUIRE(!smallPacker.Insert(0, 2, placement));
+  }
+}
@@ -0,0 +1,176 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the geometry tools used for collision masks.
+ */
+#include "GDCore/Extensions/Builtin/SpriteExtension/Polygon2dTools.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "GDCore/Extensions/Builtin/SpriteExtension/Polygon2d.h"
+#include "catch.hpp"
+
+namespace {
+Polygon2d CreatePolygon(const std::vector<gd::Vector2f>& vertices) {
+  Polygon2d polygon;
+  polygon.vertices = vertices;
+  return polygon;
+}
+
+double ComputeTotalArea(const std::vector<Polygon2d>& polygons) {
+  double area = 0;
+  for (const auto& polygon : polygons)
+    area += std::abs(gd::Polygon2dTools::ComputeSignedArea(polygon));
+  return area;
+}
+
+// A "L" shape, made of 6 vertices (the last corner being concave).
+Polygon2d CreateLShape() {
+  return CreatePolygon({gd::Vector2f(0, 0),
+                        gd::Vector2f(20, 0),
+                        gd::Vector2f(20, 10),
+                        gd::Vector2f(10, 10),
+                        gd::Vector2f(10, 20),
+                        gd::Vector2f(0, 20)});
+}
+}  // namespace
+
+TEST_CASE("Polygon2dTools", "[common]") {
+  SECTION("Signed area") {
+    Polygon2d rectangle = Polygon2d::CreateRectangle(10, 20);
+    REQUIRE(gd::Polygon2dTools::ComputeSignedArea(rectangle) == Approx(200));
+
+    std::reverse(rectangle.vertices.begin(), rectangle.vertices.end());
+    REQUIRE(gd::Polygon2dTools::ComputeSignedArea(rectangle) == Approx(-200));
+  }
+
+  SECTION("Collinear vertices removal") {
+    Polygon2d polygon = CreatePolygon({gd::Vector2f(0, 0),
+                                       gd::Vector2f(5, 0),
+                                       gd::Vector2f(10, 0),
+                                       gd::Vector2f(10, 10),
+                                       gd::Vector2f(10, 10),
+                                       gd::Vector2f(0, 10)});
+    Polygon2d cleaned =
+        gd::Polygon2dTools::RemoveCollinearVertices(polygon);
+    REQUIRE(cleaned.vertices.size() == 4);
+    REQUIRE(cleaned.IsConvex());
+  }
+
+  SECTION("Vertices simplification") {
+    // A circle with a lot of vertices.
+    Polygon2d circle;
+    for (int i = 0; i < 360; ++i) {
+      double angle = i * 3.14159265358979 / 180;
+      circle.vertices.push_back(
+          gd::Vector2f(100 * std::cos(angle), 100 * std::sin(angle)));
+    }
+
+    Polygon2d simplified =
+        gd::Polygon2dTools::SimplifyVertices(circle, 0.5);
+    REQUIRE(simplified.vertices.size() < 60);
+    REQUIRE(simplified.vertices.size() > 8);
+    REQUIRE(simplified.IsConvex());
+    double circleArea = gd::Polygon2dTools::ComputeSignedArea(circle);
+    REQUIRE(gd::Polygon2dTools::ComputeSignedArea(simplified) ==
+            Approx(circleArea).epsilon(0.01));
+
+    // Nothing is removed with a zero tolerance, except collinear points.
+    Polygon2d rectangle = CreatePolygon({gd::Vector2f(0, 0),
+                                         gd::Vector2f(5, 0.1),
+                                         gd::Vector2f(10, 0),
+                                         gd::Vector2f(10, 10),
+                                         gd::Vector2f(0, 10)});
+    REQUIRE(gd::Polygon2dTools::SimplifyVertices(rectangle, 0)
+                .vertices.size() == 5);
+    REQUIRE(gd::Polygon2dTools::SimplifyVertices(rectangle, 0.5)
+                .vertices.size() == 4);
+
+    // Polygons are never simplified to less than 3 vertices.
+    Polygon2d flatTriangle = CreatePolygon(
+        {gd::Vector2f(0, 0), gd::Vector2f(10, 0), gd::Vector2f(5, 0.1)});
+    REQUIRE(gd::Polygon2dTools::SimplifyVertices(flatTriangle, 1)
+                .vertices.size() == 3);
+  }
+
+  SECTION("Convex decomposition of a convex polygon") {
+    Polygon2d rectangle = Polygon2d::CreateRectangle(10, 20);
+    auto polygons =
+        gd::Polygon2dTools::DecomposeIntoConvexPolygons(rectangle);
+    REQUIRE(polygons.size() == 1);
+    REQUIRE(polygons[0].vertices.size() == 4);
+  }
+
+  SECTION("Convex decomposition of a concave polygon") {
+    Polygon2d lShape = CreateLShape();
+    REQUIRE(!lShape.IsConvex());
+
+    auto polygons = gd::Polygon2dTools::DecomposeIntoConvexPolygons(lShape);
+    REQUIRE(polygons.size() == 2);
+    for (const auto& polygon : polygons) {
+      REQUIRE(polygon.IsConvex());
+      REQUIRE(gd::Polygon2dTools::ComputeSignedArea(polygon) > 0);
+    }
+    REQUIRE(ComputeTotalArea(polygons) == Approx(300));
+
+    // The orientation of the vertices is kept.
+    std::reverse(lShape.vertices.begin(), lShape.vertices.end());
+    polygons = gd::Polygon2dTools::DecomposeIntoConvexPolygons(lShape);
+    REQUIRE(polygons.size() == 2);
+    for (const auto& polygon : polygons) {
+      REQUIRE(polygon.IsConvex());
+      REQUIRE(gd::Polygon2dTools::ComputeSignedArea(polygon) < 0);
+    }
+    REQUIRE(ComputeTotalArea(polygons) == Approx(300));
+  }
+
+  SECTION("Convex decomposition of a star") {
+    Polygon2d star;
+    for (int i = 0; i < 10; ++i) {
+      double angle = i * 2 * 3.14159265358979 / 10;
+      double radius = i % 2 == 0 ? 100 : 40;
+      star.vertices.push_back(
+          gd::Vector2f(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+
+    auto polygons = gd::Polygon2dTools::DecomposeIntoConvexPolygons(star);
+    // Hertel-Mehlhorn gives at most 4 times the optimal number of parts.
+    REQUIRE(polygons.size() >= 5);
+    REQUIRE(polygons.size() <= 8);
+    for (const auto& polygon : polygons) REQUIRE(polygon.IsConvex());
+    REQUIRE(ComputeTotalArea(polygons) ==
+            Approx(std::abs(gd::Polygon2dTools::ComputeSignedArea(star))));
+  }
+
+  SECTION("Self-intersecting polygons are kept unchanged") {
+    Polygon2d bowTie = CreatePolygon({gd::Vector2f(0, 0),
+                                      gd::Vector2f(10, 10),
+                                      gd::Vector2f(10, 0),
+                                      gd::Vector2f(0, 10)});
+    auto polygons = gd::Polygon2dTools::DecomposeIntoConvexPolygons(bowTie);
+    REQUIRE(polygons.size() == 1);
+    REQUIRE(polygons[0].vertices.size() == 4);
+  }
+
+  SECTION("Collision mask optimization") {
+    Polygon2d lShapeWithExtraVertices = CreatePolygon({gd::Vector2f(0, 0),
+                                                       gd::Vector2f(10, 0.1),
+                                                       gd::Vector2f(20, 0),
+                                                       gd::Vector2f(20, 10),
+                                                       gd::Vector2f(10, 10),
+                                                       gd::Vector2f(10, 20),
+                                                       gd::Vector2f(0, 20)});
+    auto collisionMask = gd::Polygon2dTools::OptimizeCollisionMask(
+        {lShapeWithExtraVertices, Polygon2d::CreateRectangle(5, 5)}, 0.5);
+    REQUIRE(collisionMask.size() == 3);
+    for (const auto& polygon : collisionMask) {
+      REQUIRE(polygon.IsConvex());
+      REQUIRE(polygon.vertices.size() == 4);
+    }
+    REQUIRE(ComputeTotalArea(collisionMask) == Approx(325));
+  }
+}
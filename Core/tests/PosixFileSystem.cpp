@@ -0,0 +1,124 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the file system working on the files of the computer.
+ */
+#if !defined(EMSCRIPTEN) && !defined(_WIN32)
+#include "GDCore/IDE/PosixFileSystem.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+TEST_CASE("PosixFileSystem", "[common]") {
+  gd::PosixFileSystem fs(4);
+
+  SECTION("Paths") {
+    REQUIRE(fs.FileNameFrom("/a/b/c.png") == "c.png");
+    REQUIRE(fs.FileNameFrom("c.png") == "c.png");
+    REQUIRE(fs.DirNameFrom("/a/b/c.png") == "/a/b");
+    REQUIRE(fs.DirNameFrom("/c.png") == "/");
+    REQUIRE(fs.DirNameFrom("c.png") == ".");
+    REQUIRE(fs.IsAbsolute("/a/b"));
+    REQUIRE(!fs.IsAbsolute("a/b"));
+
+    gd::String filename = "../c/./d.png";
+    fs.MakeAbsolute(filename, "/a/b");
+    REQUIRE(filename == "/a/c/d.png");
+    filename = "/e/f.png";
+    fs.MakeAbsolute(filename, "/a/b");
+    REQUIRE(filename == "/e/f.png");
+
+    filename = "/a/c/d.png";
+    fs.MakeRelative(filename, "/a/b");
+    REQUIRE(filename == "../c/d.png");
+    filename = "/a/b/c/d.png";
+    fs.MakeRelative(filename, "/a/b/");
+    REQUIRE(filename == "c/d.png");
+  }
+
+  SECTION("Files") {
+    char directoryTemplate[] = "/tmp/GDPosixFileSystemXXXXXX";
+    REQUIRE(mkdtemp(directoryTemplate) != nullptr);
+    gd::String directory = directoryTemplate;
+
+    // Directories are created when writing and copying files.
+    REQUIRE(fs.WriteToFile(directory + "/a/b/file.txt", u8"Content Ԙ"));
+    REQUIRE(fs.ReadFile(directory + "/a/b/file.txt") == u8"Content Ԙ");
+    REQUIRE(fs.FileExists(directory + "/a/b/file.txt"));
+    REQUIRE(!fs.DirExists(directory + "/a/b/file.txt"));
+    REQUIRE(fs.DirExists(directory + "/a/b"));
+    REQUIRE(fs.CopyFile(directory + "/a/b/file.txt",
+                        directory + "/c/copy.txt"));
+    REQUIRE(fs.ReadFile(directory + "/c/copy.txt") == u8"Content Ԙ");
+
+    std::string binaryContent(200 * 1024, '\0');
+    for (std::size_t i = 0; i < binaryContent.size(); ++i)
+      binaryContent[i] = static_cast<char>(i % 251);
+    REQUIRE(fs.WriteBinaryFile(directory + "/image.png", binaryContent));
+
+    std::vector<gd::FileCopyRequest> copyRequests;
+    for (std::size_t i = 0; i < 10; ++i) {
+      copyRequests.push_back(gd::FileCopyRequest(
+          directory + "/image.png",
+          directory + "/images/image" + gd::String::From(i) + ".png"));
+    }
+    copyRequests.push_back(gd::FileCopyRequest(directory + "/missing.png",
+                                               directory + "/images/m.png"));
+    fs.MkDirs({directory + "/images"});
+    std::vector<bool> copyResults = fs.CopyFiles(copyRequests);
+    REQUIRE(copyResults.size() == 11);
+    for (std::size_t i = 0; i < 10; ++i) {
+      REQUIRE(copyResults[i]);
+      std::string copiedContent;
+      REQUIRE(
+          fs.ReadBinaryFile(copyRequests[i].destination, copiedContent));
+      REQUIRE(copiedContent == binaryContent);
+    }
+    REQUIRE(!copyResults[10]);
+
+    std::vector<gd::FileStatus> statuses = fs.StatFiles(
+        {directory + "/images/image3.png", directory + "/images",
+         directory + "/images/m.png"});
+    REQUIRE(statuses.size() == 3);
+    REQUIRE(statuses[0].fileExists);
+    REQUIRE(!statuses[0].dirExists);
+    REQUIRE(statuses[0].size == binaryContent.size());
+    REQUIRE(!statuses[1].fileExists);
+    REQUIRE(statuses[1].dirExists);
+    REQUIRE(!statuses[2].fileExists);
+    REQUIRE(!statuses[2].dirExists);
+
+    REQUIRE(fs.ReadDir(directory + "/images", ".PNG").size() == 10);
+    REQUIRE(fs.ReadDir(directory + "/images", ".txt").empty());
+
+    std::atomic<std::size_t> succeededWritesCount(0);
+    fs.WriteFilesAsync(
+        {gd::FileWriteRequest(directory + "/async/1.txt", "1"),
+         gd::FileWriteRequest(directory + "/async/2.txt", "2")},
+        [&succeededWritesCount](const std::vector<bool>& results) {
+          for (bool result : results)
+            if (result) succeededWritesCount++;
+        });
+    fs.WaitForAsyncOperations();
+    REQUIRE(succeededWritesCount == 2);
+    REQUIRE(fs.ReadFile(directory + "/async/2.txt") == "2");
+
+    REQUIRE(fs.ClearDir(directory));
+    REQUIRE(fs.DirExists(directory));
+    REQUIRE(fs.ReadDir(directory).empty());
+    fs.MkDir(directory + "/d/e");
+    REQUIRE(fs.DirExists(directory + "/d/e"));
+    REQUIRE(fs.ClearDir(directory));
+    rmdir(directoryTemplate);
+  }
+}
+#endif
@@ -0,0 +1,193 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the removal of the unreachable elements of a project.
+ */
+#include "GDCore/IDE/ProjectTreeShaker.h"
+
+#include <algorithm>
+#include <string>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsFunction.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "InMemoryFileSystem.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const std::vector<gd::String>& parameters) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(parameters.size());
+  for (std::size_t i = 0; i < parameters.size(); ++i)
+    instruction.SetParameter(i, gd::Expression(parameters[i]));
+
+  return instruction;
+}
+
+gd::StandardEvent& InsertStandardEvent(gd::Project& project,
+                                       gd::EventsList& events) {
+  return dynamic_cast<gd::StandardEvent&>(
+      events.InsertNewEvent(project,
+                            "BuiltinCommonInstructions::Standard",
+                            events.GetEventsCount()));
+}
+
+bool Contains(const std::vector<gd::String>& names, const gd::String& name) {
+  return std::find(names.begin(), names.end(), name) != names.end();
+}
+}  // namespace
+
+TEST_CASE("ProjectTreeShaker", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.SetProjectFile("/game/game.json");
+  InMemoryFileSystem fs;
+  fs.WriteBinaryFile("/game/used.png", std::string(100, ' '));
+  fs.WriteBinaryFile("/game/unused.png", std::string(1000, ' '));
+  project.GetResourcesManager().AddResource("used", "used.png", "image");
+  project.GetResourcesManager().AddResource("unused", "unused.png", "image");
+  project.GetResourcesManager().AddResource("byName", "byName.png", "image");
+
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  gd::Object& instancedObject =
+      layout.InsertNewObject(project, "MyExtension::Sprite", "Instanced", 0);
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  gd::Sprite sprite;
+  sprite.SetImageName("used");
+  animation.GetDirection(0).AddSprite(sprite);
+  dynamic_cast<gd::SpriteObject&>(instancedObject.GetConfiguration())
+      .AddAnimation(animation);
+  layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+      "Instanced");
+  layout.InsertNewObject(project, "MyExtension::Sprite", "UsedInEvents", 1);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "Grouped", 2);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "Unused", 3);
+  project.InsertNewObject(project, "MyExtension::Sprite", "GlobalUnused", 0);
+  layout.GetObjectGroups().InsertNew("MyGroup").AddObject("Grouped");
+  layout.GetObjectGroups().InsertNew("UnusedGroup").AddObject("Unused");
+
+  gd::EventsFunctionsExtension& extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  extension.InsertNewEventsFunction("Called", 0);
+  extension.InsertNewEventsFunction("NotCalled", 1);
+  extension.InsertNewEventsFunction("onFirstSceneLoaded", 2);
+  gd::EventsFunction& calledByFunction =
+      extension.InsertNewEventsFunction("CalledByFunction", 3);
+  calledByFunction.SetFunctionType(gd::EventsFunction::Expression);
+  InsertStandardEvent(project,
+                      extension.GetEventsFunction("Called").GetEvents())
+      .GetActions()
+      .Insert(MakeInstruction("MyExtension::DoSomething",
+                              {"MyEventsExtension::CalledByFunction()"}));
+
+  gd::EventsBasedBehavior& usedBehavior =
+      extension.GetEventsBasedBehaviors().InsertNew("UsedBehavior", 0);
+  usedBehavior.GetPropertyDescriptors()
+      .InsertNew("Required", 0)
+      .SetType("Behavior")
+      .AddExtraInfo("MyEventsExtension::RequiredBehavior");
+  extension.GetEventsBasedBehaviors().InsertNew("RequiredBehavior", 1);
+  extension.GetEventsBasedBehaviors().InsertNew("UnusedBehavior", 2);
+  instancedObject.AddNewBehavior(
+      project, "MyEventsExtension::UsedBehavior", "UsedBehavior");
+
+  gd::StandardEvent& event = InsertStandardEvent(project, layout.GetEvents());
+  event.GetActions().Insert(MakeInstruction(
+      "MyExtension::DoSomethingWithObjects", {"UsedInEvents", "MyGroup"}));
+  event.GetActions().Insert(MakeInstruction("MyEventsExtension::Called", {}));
+  event.GetActions().Insert(
+      MakeInstruction("MyExtension::DoSomething", {"\"byName\""}));
+
+  SECTION("Unreachable elements are removed") {
+    gd::TreeShakingResult result =
+        gd::ProjectTreeShaker::ShakeProject(project, fs);
+
+    REQUIRE(result.GetRemovedObjects().size() == 2);
+    REQUIRE(Contains(result.GetRemovedObjects(), "GlobalUnused"));
+    REQUIRE(Contains(result.GetRemovedObjects(), "Scene/Unused"));
+    REQUIRE(!project.HasObjectNamed("GlobalUnused"));
+    REQUIRE(!layout.HasObjectNamed("Unused"));
+    REQUIRE(layout.HasObjectNamed("Instanced"));
+    REQUIRE(layout.HasObjectNamed("UsedInEvents"));
+    REQUIRE(layout.HasObjectNamed("Grouped"));
+    REQUIRE(!layout.GetObjectGroups().Get("UnusedGroup").Find("Unused"));
+    REQUIRE(layout.GetObjectGroups().Get("MyGroup").Find("Grouped"));
+
+    REQUIRE(result.GetRemovedEventsFunctions() ==
+            std::vector<gd::String>{"MyEventsExtension::NotCalled"});
+    REQUIRE(extension.HasEventsFunctionNamed("Called"));
+    REQUIRE(extension.HasEventsFunctionNamed("CalledByFunction"));
+    REQUIRE(extension.HasEventsFunctionNamed("onFirstSceneLoaded"));
+    REQUIRE(!extension.HasEventsFunctionNamed("NotCalled"));
+
+    REQUIRE(result.GetRemovedBehaviors() ==
+            std::vector<gd::String>{"MyEventsExtension::UnusedBehavior"});
+    REQUIRE(extension.GetEventsBasedBehaviors().Has("UsedBehavior"));
+    REQUIRE(extension.GetEventsBasedBehaviors().Has("RequiredBehavior"));
+
+    REQUIRE(result.GetRemovedResources() ==
+            std::vector<gd::String>{"unused"});
+    REQUIRE(project.GetResourcesManager().HasResource("used"));
+    REQUIRE(project.GetResourcesManager().HasResource("byName"));
+    REQUIRE(!project.GetResourcesManager().HasResource("unused"));
+
+    REQUIRE(result.GetRemovedFilesSize() == 1000);
+    REQUIRE(result.GetRemovedDataSize() > 0);
+    REQUIRE(result.GetReport().find("Scene/Unused") != gd::String::npos);
+  }
+
+  SECTION("Resources are kept when events have JavaScript code") {
+    // JavaScript code can use resources by their name.
+    gd::BaseEvent javaScriptCodeEvent;
+    javaScriptCodeEvent.SetType("BuiltinCommonInstructions::JsCode");
+    extension.GetEventsFunction("Called").GetEvents().InsertEvent(
+        javaScriptCodeEvent);
+
+    gd::TreeShakingResult result =
+        gd::ProjectTreeShaker::ShakeProject(project, fs);
+    REQUIRE(result.GetRemovedObjects().size() == 2);
+    REQUIRE(result.GetRemovedResources().empty());
+    REQUIRE(project.GetResourcesManager().HasResource("unused"));
+    REQUIRE(result.GetRemovedFilesSize() == 0);
+    REQUIRE(gd::ProjectTreeShaker::FindUnusedResources(project).empty());
+  }
+
+  SECTION("Nothing is removed from a project only using its elements") {
+    layout.RemoveObject("Unused");
+    project.RemoveObject("GlobalUnused");
+    extension.RemoveEventsFunction("NotCalled");
+    extension.GetEventsBasedBehaviors().Remove("UnusedBehavior");
+    project.GetResourcesManager().RemoveResource("unused");
+
+    gd::TreeShakingResult result =
+        gd::ProjectTreeShaker::ShakeProject(project, fs);
+    REQUIRE(result.GetRemovedObjects().empty());
+    REQUIRE(result.GetRemovedEventsFunctions().empty());
+    REQUIRE(result.GetRemovedBehaviors().empty());
+    REQUIRE(result.GetRemovedResources().empty());
+    REQUIRE(result.GetRemovedDataSize() == 0);
+  }
+}
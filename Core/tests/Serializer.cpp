@@ -81,6 +81,23 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
   }
 
+  SECTION("Accessing children of arrays in any order") {
+    SerializerElement element = Serializer::FromJSON("[0, 1, 2, 3]");
+
+    REQUIRE(element.GetChild(2).GetIntValue() == 2);
+    REQUIRE(element.GetChild(0).GetIntValue() == 0);
+    REQUIRE(element.GetChild(3).GetIntValue() == 3);
+    REQUIRE(element.GetChild(1).GetIntValue() == 1);
+
+    element.AddChild("").SetIntValue(4);
+    REQUIRE(element.GetChild(4).GetIntValue() == 4);
+    REQUIRE(element.GetChild(2).GetIntValue() == 2);
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.GetChild(3).GetIntValue() == 3);
+    REQUIRE(copiedElement.GetChild(0).GetIntValue() == 0);
+  }
+
   SECTION("Multiline strings") {
     SerializerElement element;
 
@@ -0,0 +1,152 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the computation and the application of patches between
+ * serialized elements.
+ */
+#include "GDCore/Serialization/SerializerDiff.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+gd::String ApplyPatchThroughJSON(const gd::String& fromJSON,
+                                 const gd::String& toJSON) {
+  SerializerElement from = Serializer::FromJSON(fromJSON);
+  SerializerElement to = Serializer::FromJSON(toJSON);
+  gd::String patchJSON =
+      Serializer::ToJSON(SerializerDiff::ComputePatch(from, to));
+
+  SerializerDiff::ApplyPatch(from, Serializer::FromJSON(patchJSON));
+  return Serializer::ToJSON(from);
+}
+}  // namespace
+
+TEST_CASE("SerializerDiff", "[common]") {
+  SECTION("Equal elements") {
+    SerializerElement element = Serializer::FromJSON(
+        "{\"a\": 1, \"b\": [{\"name\": \"c\"}, 2], \"d\": \"e\"}");
+    SerializerElement otherElement = element;
+
+    REQUIRE(SerializerDiff::IsEmpty(
+        SerializerDiff::ComputePatch(element, otherElement)));
+  }
+
+  SECTION("Values, attributes and children of objects") {
+    SerializerElement from;
+    from.SetAttribute("removedAttribute", true);
+    from.SetAttribute("changedAttribute", 1);
+    from.AddChild("removedChild").SetStringValue("a");
+    from.AddChild("changedChild").SetDoubleValue(1.5);
+    SerializerElement to;
+    to.SetAttribute("changedAttribute", 2);
+    to.SetAttribute("addedAttribute", "b");
+    to.AddChild("changedChild").SetDoubleValue(2.5);
+    to.AddChild("addedChild").AddChild("grandChild").SetBoolValue(true);
+
+    SerializerElement patch = SerializerDiff::ComputePatch(from, to);
+    REQUIRE_FALSE(SerializerDiff::IsEmpty(patch));
+    REQUIRE(Serializer::ToJSON(patch).find("changedChild") != gd::String::npos);
+
+    SerializerDiff::ApplyPatch(from, patch);
+    REQUIRE(Serializer::ToJSON(from) == Serializer::ToJSON(to));
+    REQUIRE(SerializerDiff::IsEmpty(SerializerDiff::ComputePatch(from, to)));
+  }
+
+  SECTION("Children of arrays are identified by their name") {
+    SerializerElement from = Serializer::FromJSON(
+        "[{\"name\": \"A\", \"x\": 1}, {\"name\": \"B\", \"x\": 2}, "
+        "{\"name\": \"C\", \"x\": 3}]");
+    SerializerElement to = Serializer::FromJSON(
+        "[{\"name\": \"New\", \"x\": 0}, {\"name\": \"A\", \"x\": 1}, "
+        "{\"name\": \"B\", \"x\": 2}, {\"name\": \"C\", \"x\": 3}]");
+
+    // Inserting a child does not change the following ones.
+    SerializerElement patch = SerializerDiff::ComputePatch(from, to);
+    const SerializerElement& childrenPatch = patch.GetChild("children");
+    REQUIRE(childrenPatch.GetStringAttribute("identifier") == "name");
+    REQUIRE(childrenPatch.HasChild("inserted"));
+    REQUIRE_FALSE(childrenPatch.HasChild("changed"));
+    REQUIRE_FALSE(childrenPatch.HasChild("removed"));
+    REQUIRE_FALSE(childrenPatch.HasChild("moved"));
+
+    SerializerDiff::ApplyPatch(from, patch);
+    REQUIRE(Serializer::ToJSON(from) == Serializer::ToJSON(to));
+  }
+
+  SECTION("Moved children") {
+    SerializerElement from = Serializer::FromJSON(
+        "[{\"persistentUuid\": \"1\"}, {\"persistentUuid\": \"2\"}, "
+        "{\"persistentUuid\": \"3\"}, {\"persistentUuid\": \"4\"}]");
+    SerializerElement to = Serializer::FromJSON(
+        "[{\"persistentUuid\": \"2\"}, {\"persistentUuid\": \"3\"}, "
+        "{\"persistentUuid\": \"4\", \"x\": 5}, {\"persistentUuid\": \"1\"}]");
+
+    SerializerElement patch = SerializerDiff::ComputePatch(from, to);
+    const SerializerElement& childrenPatch = patch.GetChild("children");
+    REQUIRE(childrenPatch.GetStringAttribute("identifier") ==
+            "persistentUuid");
+    REQUIRE(childrenPatch.GetChild("moved").GetChildrenCount() == 1);
+    REQUIRE(childrenPatch.GetChild("changed").GetChildrenCount() == 1);
+
+    SerializerDiff::ApplyPatch(from, patch);
+    REQUIRE(Serializer::ToJSON(from) == Serializer::ToJSON(to));
+  }
+
+  SECTION("Children identified by their index") {
+    REQUIRE(ApplyPatchThroughJSON("[1, 2, 3, 4]", "[1, 5, 3]") ==
+            "[1,5,3]");
+    REQUIRE(ApplyPatchThroughJSON("[1, 2]", "[1, 2, {\"a\": [3]}]") ==
+            "[1,2,{\"a\":[3]}]");
+    REQUIRE(ApplyPatchThroughJSON("[{\"name\": \"a\"}, {\"name\": \"a\"}]",
+                                  "[{\"name\": \"a\"}, {\"name\": \"b\"}]") ==
+            "[{\"name\":\"a\"},{\"name\":\"b\"}]");
+  }
+
+  SECTION("Patches stored as JSON") {
+    gd::String from =
+        "{\"a\": 1, \"b\": \"c\", \"d\": [{\"name\": \"e\", \"f\": true}, "
+        "{\"name\": \"g\", \"h\": [1, 2]}], \"i\": {\"j\": 1.5}}";
+    gd::String to =
+        "{\"a\": 2, \"d\": [{\"name\": \"g\", \"h\": [1, 3]}, "
+        "{\"name\": \"k\"}, {\"name\": \"e\", \"f\": false}], \"i\": [], "
+        "\"l\": \"m\"}";
+
+    REQUIRE(ApplyPatchThroughJSON(from, to) ==
+            Serializer::ToJSON(Serializer::FromJSON(to)));
+  }
+
+  SECTION("Projects") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Player", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Enemy", 1);
+    SerializerElement from;
+    project.SerializeTo(from);
+
+    project.InsertNewLayout("Other scene", 0);
+    layout.GetObject("Enemy").SetName("Boss");
+    layout.MoveObject(1, 0);
+    SerializerElement to;
+    project.SerializeTo(to);
+
+    SerializerElement patch = SerializerDiff::ComputePatch(from, to);
+    REQUIRE(Serializer::ToJSON(patch).size() <
+            Serializer::ToJSON(to).size() / 2);
+
+    SerializerDiff::ApplyPatch(from, patch);
+    REQUIRE(Serializer::ToJSON(from) == Serializer::ToJSON(to));
+  }
+}
@@ -0,0 +1,167 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the content hashes of serialized elements and of
+ * projects.
+ */
+#include "GDCore/Serialization/SerializerHash.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+std::uint64_t HashJSON(const gd::String& json) {
+  return SerializerHash::ComputeHash(Serializer::FromJSON(json));
+}
+}  // namespace
+
+TEST_CASE("SerializerHash", "[common]") {
+  SECTION("Hashes of elements") {
+    REQUIRE(HashJSON("{\"a\": 1, \"b\": [1, 2]}") ==
+            HashJSON("{\"b\": [1, 2], \"a\": 1.0}"));
+    REQUIRE(HashJSON("{\"a\": 1, \"b\": [1, 2]}") !=
+            HashJSON("{\"a\": 1, \"b\": [2, 1]}"));
+    REQUIRE(HashJSON("{\"a\": 1}") != HashJSON("{\"a\": \"1\"}"));
+    REQUIRE(HashJSON("{\"a\": true}") != HashJSON("{\"a\": 1}"));
+    REQUIRE(HashJSON("{\"ab\": \"c\"}") != HashJSON("{\"a\": \"bc\"}"));
+    REQUIRE(HashJSON("[]") != HashJSON("{}"));
+    REQUIRE(SerializerHash::ToString(0xfedcba9876543210ULL) ==
+            "fedcba9876543210");
+    REQUIRE(SerializerHash::ToString(1) == "0000000000000001");
+  }
+
+  SECTION("Hashes are the same for attributes and children") {
+    SerializerElement element;
+    element.SetAttribute("name", "MyObject");
+    element.SetAttribute("x", 1.5);
+    element.AddChild("variables").ConsiderAsArrayOf("variable");
+    element.GetChild("variables").AddChild("variable").SetIntValue(3);
+
+    REQUIRE(SerializerHash::ComputeHash(element) ==
+            SerializerHash::ComputeHash(
+                Serializer::FromJSON(Serializer::ToJSON(element))));
+  }
+
+  SECTION("Hashes of the parts of a project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.GetVariables().InsertNew("GlobalVariable", 0).SetValue(1);
+    gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Player", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "Enemy", 1);
+    layout.GetInitialInstances().InsertNewInitialInstance().SetObjectName(
+        "Player");
+    layout.GetEvents()
+        .InsertNewEvent(project, "BuiltinCommonInstructions::Standard")
+        .GetSubEvents()
+        .InsertNewEvent(project, "BuiltinCommonInstructions::Standard");
+    layout.GetEvents().InsertNewEvent(project,
+                                      "BuiltinCommonInstructions::Standard");
+    project.InsertNewLayout("Other scene", 1);
+
+    std::vector<gd::String> paths = {"",
+                                     "variables",
+                                     "layouts/Scene",
+                                     "layouts/Scene/objects/Player",
+                                     "layouts/Scene/objects/Enemy",
+                                     "layouts/Scene/instances",
+                                     "layouts/Scene/variables",
+                                     "layouts/Scene/events",
+                                     "layouts/Scene/events/0",
+                                     "layouts/Scene/events/0/0",
+                                     "layouts/Scene/events/1",
+                                     "layouts/Other scene"};
+    std::map<gd::String, gd::String> hashes;
+    for (const gd::String& path : paths) {
+      hashes[path] = project.ComputeContentHash(path);
+      REQUIRE(hashes[path].size() == 16);
+    }
+
+    REQUIRE(project.ComputeContentHash("layouts/Unknown scene").empty());
+    REQUIRE(project.ComputeContentHash("layouts/Scene/objects/Unknown").empty());
+    REQUIRE(project.ComputeContentHash("layouts/Scene/events/2").empty());
+    REQUIRE(project.ComputeContentHash("layouts/Scene/events/1/0").empty());
+    REQUIRE(project.ComputeContentHash("layouts/Scene/events/a").empty());
+    REQUIRE(project.ComputeContentHash("objects/Player").empty());
+
+    SECTION("Names are escaped in paths") {
+      REQUIRE(gd::Project::EscapeContentHashPathSegment("Menus/Options 100%") ==
+              "Menus%2FOptions 100%25");
+
+      project.InsertNewLayout("Menus/Options", project.GetLayoutsCount());
+      project.InsertNewLayout("Loading 100%", project.GetLayoutsCount());
+      REQUIRE(project.ComputeContentHash("layouts/Menus%2FOptions").size() ==
+              16);
+      REQUIRE(project.ComputeContentHash("layouts/Menus/Options").empty());
+      REQUIRE(project.ComputeContentHash("layouts/Loading 100%25") ==
+              project.ComputeContentHash(
+                  "layouts/" +
+                  gd::Project::EscapeContentHashPathSegment("Loading 100%")));
+      REQUIRE(project.ComputeContentHash("layouts/Loading 100%25") !=
+              project.ComputeContentHash("layouts/Menus%2FOptions"));
+    }
+
+    SECTION("Hashes are the same after the project is saved and loaded") {
+      SerializerElement element;
+      project.SerializeTo(element);
+      gd::Project loadedProject;
+      loadedProject.AddPlatform(platform);
+      loadedProject.UnserializeFrom(
+          Serializer::FromJSON(Serializer::ToJSON(element)));
+
+      // The whole project is not compared, as the platforms are not loaded
+      // (the test platform is not registered in gd::PlatformManager).
+      for (const gd::String& path : paths) {
+        if (!path.empty())
+          REQUIRE(loadedProject.ComputeContentHash(path) == hashes[path]);
+      }
+    }
+
+    SECTION("Only the hashes of the changed parts are changed") {
+      layout.GetEvents()
+          .GetEvent(0)
+          .GetSubEvents()
+          .GetEvent(0)
+          .SetDisabled(true);
+
+      REQUIRE(project.ComputeContentHash("") != hashes[""]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene") !=
+              hashes["layouts/Scene"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/events") !=
+              hashes["layouts/Scene/events"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/events/0") !=
+              hashes["layouts/Scene/events/0"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/events/0/0") !=
+              hashes["layouts/Scene/events/0/0"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/events/1") ==
+              hashes["layouts/Scene/events/1"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/objects/Player") ==
+              hashes["layouts/Scene/objects/Player"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/instances") ==
+              hashes["layouts/Scene/instances"]);
+      REQUIRE(project.ComputeContentHash("layouts/Other scene") ==
+              hashes["layouts/Other scene"]);
+      REQUIRE(project.ComputeContentHash("variables") == hashes["variables"]);
+
+      layout.GetObject("Enemy").GetVariables().InsertNew("Life", 0);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/objects/Enemy") !=
+              hashes["layouts/Scene/objects/Enemy"]);
+      REQUIRE(project.ComputeContentHash("layouts/Scene/objects/Player") ==
+              hashes["layouts/Scene/objects/Player"]);
+    }
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the search of the external events that can be generated
+ * in functions shared by the scenes.
+ */
+#include "GDCore/Events/CodeGeneration/SharedExternalEventsFinder.h"
+
+#include "GDCore/Events/Builtin/GroupEvent.h"
+#include "GDCore/Events/Builtin/LinkEvent.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::LinkEvent MakeLink(const gd::String& target) {
+  gd::LinkEvent linkEvent;
+  linkEvent.SetTarget(target);
+  return linkEvent;
+}
+}  // namespace
+
+TEST_CASE("SharedExternalEventsFinder", "[common][events]") {
+  gd::Project project;
+  auto& layout = project.InsertNewLayout("Scene", 0);
+  auto& externalEvents = project.InsertNewExternalEvents("Library", 0);
+  externalEvents.GetEvents().InsertEvent(gd::StandardEvent());
+
+  SECTION("External events linked once at the root are called") {
+    layout.GetEvents().InsertEvent(gd::StandardEvent());
+    layout.GetEvents().InsertEvent(MakeLink("Library"));
+
+    auto externalEventsToCall =
+        gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                 layout);
+    REQUIRE(externalEventsToCall.size() == 1);
+    REQUIRE(externalEventsToCall.count("Library") == 1);
+  }
+
+  SECTION("External events linked in groups are called") {
+    gd::GroupEvent groupEvent;
+    groupEvent.GetSubEvents().InsertEvent(MakeLink("Library"));
+    layout.GetEvents().InsertEvent(groupEvent);
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .count("Library") == 1);
+  }
+
+  SECTION("External events linked in sub-events are copied") {
+    gd::StandardEvent parentEvent;
+    parentEvent.GetSubEvents().InsertEvent(MakeLink("Library"));
+    layout.GetEvents().InsertEvent(parentEvent);
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .empty());
+  }
+
+  SECTION("External events linked several times are copied") {
+    layout.GetEvents().InsertEvent(MakeLink("Library"));
+    layout.GetEvents().InsertEvent(MakeLink("Library"));
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .empty());
+  }
+
+  SECTION("External events partially linked are copied") {
+    gd::LinkEvent linkEvent = MakeLink("Library");
+    linkEvent.SetIncludeEventsGroup("Group");
+    layout.GetEvents().InsertEvent(linkEvent);
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .empty());
+  }
+
+  SECTION("External events containing links are copied") {
+    auto& otherExternalEvents =
+        project.InsertNewExternalEvents("OtherLibrary", 1);
+    otherExternalEvents.GetEvents().InsertEvent(MakeLink("Library"));
+    layout.GetEvents().InsertEvent(MakeLink("OtherLibrary"));
+
+    REQUIRE_FALSE(
+        gd::SharedExternalEventsFinder::CanBeShared(otherExternalEvents));
+    REQUIRE(gd::SharedExternalEventsFinder::CanBeShared(externalEvents));
+
+    // The links inside the copied external events are also found.
+    auto externalEventsToCall =
+        gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                 layout);
+    REQUIRE(externalEventsToCall.size() == 1);
+    REQUIRE(externalEventsToCall.count("Library") == 1);
+  }
+
+  SECTION("Links forming a cycle are handled") {
+    auto& otherExternalEvents =
+        project.InsertNewExternalEvents("OtherLibrary", 1);
+    otherExternalEvents.GetEvents().InsertEvent(MakeLink("OtherLibrary"));
+    layout.GetEvents().InsertEvent(MakeLink("OtherLibrary"));
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .empty());
+  }
+
+  SECTION("Disabled links are ignored") {
+    gd::LinkEvent disabledLinkEvent = MakeLink("Library");
+    disabledLinkEvent.SetDisabled(true);
+    layout.GetEvents().InsertEvent(disabledLinkEvent);
+    layout.GetEvents().InsertEvent(MakeLink("Library"));
+
+    REQUIRE(gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                     layout)
+                .count("Library") == 1);
+  }
+}
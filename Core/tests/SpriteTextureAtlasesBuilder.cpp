@@ -0,0 +1,181 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the packing of sprites images into texture atlases.
+ */
+#include "GDCore/IDE/Project/SpriteTextureAtlasesBuilder.h"
+
+#include <string>
+
+#include "DummyPlatform.h"
+#include "GDCore/IDE/Project/SpriteInstancesBounds.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/PngCodec.h"
+#include "InMemoryFileSystem.h"
+#include "catch.hpp"
+
+namespace {
+void AddImage(gd::Project& project,
+              InMemoryFileSystem& fs,
+              const gd::String& name,
+              unsigned int width,
+              unsigned int height,
+              unsigned char red) {
+  gd::RgbaImage image(width, height);
+  for (unsigned int y = 0; y < height; ++y) {
+    for (unsigned int x = 0; x < width; ++x) {
+      unsigned char* pixel = image.GetPixel(x, y);
+      pixel[0] = red;
+      pixel[1] = x;
+      pixel[2] = y;
+      pixel[3] = 255;
+    }
+  }
+  fs.WriteBinaryFile("/game/" + name + ".png", gd::PngCodec::Encode(image));
+  project.GetResourcesManager().AddResource(name, name + ".png", "image");
+}
+
+gd::Sprite& AddSpriteObject(gd::Project& project,
+                            gd::ObjectsContainer& container,
+                            const gd::String& name,
+                            const std::vector<gd::String>& images) {
+  gd::Object& object =
+      container.InsertNewObject(project, "MyExtension::Sprite", name, 0);
+  auto& spriteObject =
+      dynamic_cast<gd::SpriteObject&>(object.GetConfiguration());
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  for (const auto& image : images) {
+    gd::Sprite sprite;
+    sprite.SetImageName(image);
+    animation.GetDirection(0).AddSprite(sprite);
+  }
+  spriteObject.AddAnimation(animation);
+  return spriteObject.GetAnimation(0).GetDirection(0).GetSprite(0);
+}
+
+gd::Sprite& GetSprite(gd::Object& object, std::size_t index) {
+  auto& spriteObject =
+      dynamic_cast<gd::SpriteObject&>(object.GetConfiguration());
+  return spriteObject.GetAnimation(0).GetDirection(0).GetSprite(index);
+}
+}  // namespace
+
+TEST_CASE("SpriteTextureAtlasesBuilder", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  project.SetProjectFile("/game/game.json");
+  InMemoryFileSystem fs;
+  AddImage(project, fs, "Image1", 10, 20, 1);
+  AddImage(project, fs, "Image2", 30, 5, 2);
+  AddImage(project, fs, "Image3", 8, 8, 3);
+  AddImage(project, fs, "LargeImage", 600, 2, 4);
+  project.GetResourcesManager().AddResource(
+      "NotAPng", "not-a-png.jpg", "image");
+
+  auto& layout1 = project.InsertNewLayout("Layout1", 0);
+  auto& layout2 = project.InsertNewLayout("Layout2", 1);
+  AddSpriteObject(project,
+                  layout1,
+                  "Object1",
+                  {"Image1", "Image2", "LargeImage", "NotAPng"});
+  AddSpriteObject(project, layout2, "Object2", {"Image3"});
+  project.GetLoadingScreen().SetBackgroundImageResourceName("Image2");
+
+  REQUIRE(gd::SpriteTextureAtlasesBuilder::BuildTextureAtlases(
+              project, fs, "/atlases") == 1);
+  REQUIRE(fs.FileExists("/atlases/texture-atlas-1.png"));
+
+  // Images of the first layout are packed together...
+  gd::Object& object1 = layout1.GetObject("Object1");
+  REQUIRE(GetSprite(object1, 0).GetImageName() == "Image1-atlas-frame");
+  REQUIRE(GetSprite(object1, 1).GetImageName() == "Image2-atlas-frame");
+  // ...except images that are too large or not PNG files.
+  REQUIRE(GetSprite(object1, 2).GetImageName() == "LargeImage");
+  REQUIRE(GetSprite(object1, 3).GetImageName() == "NotAPng");
+  // The image of the second layout is alone, so not packed.
+  REQUIRE(GetSprite(layout2.GetObject("Object2"), 0).GetImageName() ==
+          "Image3");
+
+  // Original resources are removed, unless they are still used.
+  REQUIRE(!project.GetResourcesManager().HasResource("Image1"));
+  REQUIRE(project.GetResourcesManager().HasResource("Image2"));
+  REQUIRE(project.GetResourcesManager().HasResource("Image3"));
+  REQUIRE(project.GetResourcesManager().HasResource("LargeImage"));
+
+  // Frames resources are using the atlas page, with the position of the
+  // image in their metadata.
+  std::string pageFile = fs.files["/atlases/texture-atlas-1.png"];
+  gd::RgbaImage page;
+  REQUIRE(gd::PngCodec::Decode(pageFile, page));
+
+  for (const gd::String name : {"Image1", "Image2"}) {
+    const gd::Resource& frameResource =
+        project.GetResourcesManager().GetResource(name + "-atlas-frame");
+    REQUIRE(frameResource.GetKind() == "image");
+    REQUIRE(frameResource.GetFile() == "/atlases/texture-atlas-1.png");
+
+    gd::SerializerElement metadata =
+        gd::Serializer::FromJSON(frameResource.GetMetadata());
+    const gd::SerializerElement& atlasFrame = metadata.GetChild("atlasFrame");
+    int x = atlasFrame.GetIntAttribute("x");
+    int y = atlasFrame.GetIntAttribute("y");
+    int width = atlasFrame.GetIntAttribute("width");
+    int height = atlasFrame.GetIntAttribute("height");
+    REQUIRE(width == (name == "Image1" ? 10 : 30));
+    REQUIRE(height == (name == "Image1" ? 20 : 5));
+
+    // The size of the frame is used by export stages reading images sizes.
+    unsigned int imageWidth = 0;
+    unsigned int imageHeight = 0;
+    REQUIRE(gd::SpriteInstancesBounds(project, fs, "/export")
+                .GetImageSize(name + "-atlas-frame", imageWidth, imageHeight));
+    REQUIRE(imageWidth == width);
+    REQUIRE(imageHeight == height);
+
+    // The image is copied in the page, with its borders extruded.
+    unsigned char red = name == "Image1" ? 1 : 2;
+    REQUIRE(page.GetPixel(x, y)[0] == red);
+    REQUIRE(page.GetPixel(x + width - 1, y + height - 1)[1] == width - 1);
+    REQUIRE(page.GetPixel(x + width - 1, y + height - 1)[2] == height - 1);
+    REQUIRE(page.GetPixel(x - 1, y - 1)[0] == red);
+    REQUIRE(page.GetPixel(x + width, y + height)[1] == width - 1);
+  }
+
+  // Nothing is done if the file system does not support binary files.
+  gd::Project otherProject;
+  SetupProjectWithDummyPlatform(otherProject, platform);
+  otherProject.SetProjectFile("/game/game.json");
+  otherProject.GetResourcesManager().AddResource(
+      "Image1", "Image1.png", "image");
+  otherProject.GetResourcesManager().AddResource(
+      "Image2", "Image2.png", "image");
+  AddSpriteObject(otherProject,
+                  otherProject.InsertNewLayout("Layout1", 0),
+                  "Object1",
+                  {"Image1", "Image2"});
+  class TextOnlyFileSystem : public InMemoryFileSystem {
+   public:
+    virtual bool ReadBinaryFile(const gd::String& file,
+                                std::string& content) {
+      return false;
+    }
+  } textOnlyFs;
+  textOnlyFs.files = fs.files;
+  REQUIRE(gd::SpriteTextureAtlasesBuilder::BuildTextureAtlases(
+              otherProject, textOnlyFs, "/atlases") == 0);
+  REQUIRE(otherProject.GetResourcesManager().HasResource("Image1"));
+}
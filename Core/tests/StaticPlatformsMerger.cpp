@@ -0,0 +1,210 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the merging of static platforms.
+ */
+#include "GDCore/IDE/Project/StaticPlatformsMerger.h"
+
+#include <string>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/BehaviorsSharedData.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectGroup.h"
+#include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/PngCodec.h"
+#include "InMemoryFileSystem.h"
+#include "catch.hpp"
+
+namespace {
+class InstancesCollector : public gd::InitialInstanceFunctor {
+ public:
+  InstancesCollector(const gd::String& objectName_)
+      : objectName(objectName_){};
+  virtual ~InstancesCollector(){};
+
+  void operator()(gd::InitialInstance& instance) override {
+    if (instance.GetObjectName() == objectName) instances.push_back(&instance);
+  }
+
+  gd::String objectName;
+  std::vector<gd::InitialInstance*> instances;
+};
+
+void AddPlatformExtensionToPlatform(gd::Platform& platform) {
+  std::shared_ptr<gd::PlatformExtension> extension =
+      std::shared_ptr<gd::PlatformExtension>(new gd::PlatformExtension);
+  extension->SetExtensionInformation(
+      "PlatformBehavior", "Platform", "", "", "");
+  extension->AddBehavior(
+      "PlatformBehavior",
+      "Platform",
+      "Platform",
+      "",
+      "",
+      "",
+      "PlatformBehavior",
+      gd::make_unique<gd::Behavior>(
+          "Behavior", gd::StaticPlatformsMerger::platformBehaviorType),
+      gd::make_unique<gd::BehaviorsSharedData>());
+  platform.AddExtension(extension);
+}
+
+gd::Object& AddPlatformObject(gd::Project& project,
+                              gd::Layout& layout,
+                              const gd::String& name,
+                              const gd::String& platformType) {
+  gd::Object& object =
+      layout.InsertNewObject(project, "MyExtension::Sprite", name, 0);
+  auto& spriteObject =
+      dynamic_cast<gd::SpriteObject&>(object.GetConfiguration());
+  gd::Animation animation;
+  animation.SetDirectionsCount(1);
+  gd::Sprite sprite;
+  sprite.SetImageName("tile");
+  animation.GetDirection(0).AddSprite(sprite);
+  spriteObject.AddAnimation(animation);
+
+  object
+      .AddNewBehavior(project,
+                      gd::StaticPlatformsMerger::platformBehaviorType,
+                      "Platform")
+      ->GetContent()
+      .SetAttribute("platformType", platformType);
+  return object;
+}
+
+void AddTiles(gd::Layout& layout,
+              const gd::String& objectName,
+              double x,
+              double y,
+              std::size_t columns,
+              std::size_t rows) {
+  for (std::size_t column = 0; column < columns; ++column) {
+    for (std::size_t row = 0; row < rows; ++row) {
+      gd::InitialInstance& instance =
+          layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName(objectName);
+      instance.SetX(x + column * 32);
+      instance.SetY(y + row * 32);
+    }
+  }
+}
+
+std::vector<gd::InitialInstance*> GetInstancesOf(gd::Layout& layout,
+                                                 const gd::String& objectName) {
+  InstancesCollector collector(objectName);
+  layout.GetInitialInstances().IterateOverInstances(collector);
+  return collector.instances;
+}
+}  // namespace
+
+TEST_CASE("StaticPlatformsMerger", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  AddPlatformExtensionToPlatform(platform);
+  InMemoryFileSystem fs;
+  fs.WriteBinaryFile("/export/tile.png",
+                     gd::PngCodec::Encode(gd::RgbaImage(32, 32)));
+  project.GetResourcesManager().AddResource("tile", "tile.png", "image");
+
+  gd::Layout& layout = project.InsertNewLayout("Scene", 0);
+  AddPlatformObject(project, layout, "Ground", "NormalPlatform");
+  AddPlatformObject(project, layout, "Bridge", "Jumpthru");
+  AddPlatformObject(project, layout, "MovingPlatform", "NormalPlatform");
+  AddPlatformObject(project, layout, "RotatedPlatform", "NormalPlatform");
+  AddTiles(layout, "Ground", 0, 100, 4, 2);
+  AddTiles(layout, "Bridge", 300, 0, 2, 2);
+  AddTiles(layout, "MovingPlatform", 0, 0, 2, 1);
+  AddTiles(layout, "RotatedPlatform", 500, 0, 2, 1);
+  AddTiles(layout, "RotatedPlatform", 564, 0, 1, 1);
+  gd::InitialInstance& rotatedInstance =
+      layout.GetInitialInstances().InsertNewInitialInstance();
+  rotatedInstance.SetObjectName("RotatedPlatform");
+  rotatedInstance.SetAngle(45);
+
+  auto& event = dynamic_cast<gd::StandardEvent&>(
+      layout.GetEvents().InsertNewEvent(
+          project, "BuiltinCommonInstructions::Standard", 0));
+  gd::Instruction action;
+  action.SetType("MyExtension::DoSomethingWithObjects");
+  action.SetParametersCount(2);
+  action.SetParameter(0, gd::Expression("MovingPlatform"));
+  event.GetActions().Insert(action);
+
+  SECTION("Static platforms are merged") {
+    REQUIRE(gd::StaticPlatformsMerger::MergeProjectStaticPlatforms(
+                project, fs, "/export") == 8 + 4);
+
+    REQUIRE(layout.HasLayerNamed("__MergedPlatforms"));
+    REQUIRE(!layout.GetLayer("__MergedPlatforms").GetVisibility());
+
+    // Merged objects are still displayed, but are no longer platforms.
+    REQUIRE(!layout.GetObject("Ground").HasBehaviorNamed("Platform"));
+    REQUIRE(!layout.GetObject("Bridge").HasBehaviorNamed("Platform"));
+    REQUIRE(layout.GetObject("MovingPlatform").HasBehaviorNamed("Platform"));
+    REQUIRE(layout.GetObject("RotatedPlatform").HasBehaviorNamed("Platform"));
+    REQUIRE(layout.GetObject("__MergedPlatformBridge")
+                .GetBehavior("Platform")
+                .GetContent()
+                .GetStringAttribute("platformType") == "Jumpthru");
+
+    std::vector<gd::InitialInstance*> mergedGround =
+        GetInstancesOf(layout, "__MergedPlatformGround");
+    REQUIRE(mergedGround.size() == 1);
+    REQUIRE(mergedGround[0]->GetLayer() == "__MergedPlatforms");
+    REQUIRE(mergedGround[0]->GetX() == 0);
+    REQUIRE(mergedGround[0]->GetY() == 100);
+    REQUIRE(mergedGround[0]->HasCustomSize());
+    REQUIRE(mergedGround[0]->GetCustomWidth() == 128);
+    REQUIRE(mergedGround[0]->GetCustomHeight() == 64);
+
+    // Jumpthru platforms are only merged in rows.
+    std::vector<gd::InitialInstance*> mergedBridge =
+        GetInstancesOf(layout, "__MergedPlatformBridge");
+    REQUIRE(mergedBridge.size() == 2);
+    REQUIRE(mergedBridge[0]->GetCustomWidth() == 64);
+    REQUIRE(mergedBridge[0]->GetCustomHeight() == 32);
+  }
+
+  SECTION("Platforms used by actions through a group are not merged") {
+    layout.GetObjectGroups().InsertNew("Platforms").AddObject("Ground");
+    event.GetActions()[0].SetParameter(1, gd::Expression("Platforms"));
+
+    REQUIRE(gd::StaticPlatformsMerger::MergeProjectStaticPlatforms(
+                project, fs, "/export") == 4);
+    REQUIRE(layout.GetObject("Ground").HasBehaviorNamed("Platform"));
+    REQUIRE(!layout.HasObjectNamed("__MergedPlatformGround"));
+  }
+
+  SECTION("Platforms used in external layouts are not merged") {
+    project.InsertNewExternalLayout("ExternalLayout", 0)
+        .GetInitialInstances()
+        .InsertNewInitialInstance()
+        .SetObjectName("Bridge");
+
+    REQUIRE(gd::StaticPlatformsMerger::MergeProjectStaticPlatforms(
+                project, fs, "/export") == 8);
+    REQUIRE(layout.GetObject("Bridge").HasBehaviorNamed("Platform"));
+  }
+}
@@ -9,6 +9,23 @@ namespace gdjs {
   }
   declare var rbush: any;
 
+  /**
+   * The obstacles of the initial instances of a scene, computed when the game
+   * was exported (see `gd::PathfindingObstaclesBaker`), and the cells of the
+   * grid covered by each of them.
+   */
+  type BakedObstaclesData = {
+    cellSize: float;
+    obstacles: Array<{
+      persistentUuid: string;
+      x: float;
+      y: float;
+      width: float;
+      height: float;
+    }>;
+    cells: Array<{ x: integer; y: integer; obstacles: integer[] }>;
+  };
+
   /**
    * PathfindingObstaclesManager manages the common objects shared by objects
    * having a pathfinding behavior: In particular, the obstacles behaviors are
@@ -20,6 +37,21 @@ namespace gdjs {
   export class PathfindingObstaclesManager {
     _obstaclesRBush: any;
 
+    // Obstacles baked at export are stored in a grid instead of the RBush,
+    // so that they don't have to be inserted when the scene starts.
+    _bakedCellSize: float = 0;
+    _bakedObstaclesData: BakedObstaclesData['obstacles'] = [];
+    /** The behavior of each baked obstacle, or null if not claimed. */
+    _bakedObstacles: Array<PathfindingObstacleRuntimeBehavior | null> = [];
+    /** The baked obstacles not claimed yet, by their persistent UUID. */
+    _unclaimedBakedObstacles = new Map<string, integer>();
+    /** The indices of the baked obstacles, by column and row of the grid. */
+    _bakedCells = new Map<integer, Map<integer, integer[]>>();
+    _loadedBakedObstaclesData: BakedObstaclesData[] = [];
+    /** The last search having returned each baked obstacle. */
+    _bakedObstaclesSearchIds: integer[] = [];
+    _searchId: integer = 0;
+
     constructor(instanceContainer: gdjs.RuntimeInstanceContainer) {
       this._obstaclesRBush = new rbush();
     }
@@ -60,9 +92,94 @@ namespace gdjs {
     removeObstacle(
       pathfindingObstacleBehavior: PathfindingObstacleRuntimeBehavior
     ) {
+      const bakedObstacleIndex =
+        pathfindingObstacleBehavior._bakedObstacleIndex;
+      if (bakedObstacleIndex !== -1) {
+        // The obstacle is now handled like other obstacles, if added again.
+        this._bakedObstacles[bakedObstacleIndex] = null;
+        pathfindingObstacleBehavior._bakedObstacleIndex = -1;
+        return;
+      }
       this._obstaclesRBush.remove(pathfindingObstacleBehavior.currentRBushAABB);
     }
 
+    /**
+     * Add the obstacles baked at export to the grid (only once for each data).
+     * @param bakedObstaclesData The baked obstacles of the shared data of an
+     * obstacle behavior, if any.
+     */
+    loadBakedObstacles(bakedObstaclesData: BakedObstaclesData | null) {
+      if (
+        !bakedObstaclesData ||
+        this._loadedBakedObstaclesData.includes(bakedObstaclesData) ||
+        (this._bakedCellSize !== 0 &&
+          this._bakedCellSize !== bakedObstaclesData.cellSize)
+      ) {
+        return;
+      }
+      this._loadedBakedObstaclesData.push(bakedObstaclesData);
+      this._bakedCellSize = bakedObstaclesData.cellSize;
+
+      const firstIndex = this._bakedObstaclesData.length;
+      for (const obstacleData of bakedObstaclesData.obstacles) {
+        this._unclaimedBakedObstacles.set(
+          obstacleData.persistentUuid,
+          this._bakedObstaclesData.length
+        );
+        this._bakedObstaclesData.push(obstacleData);
+        this._bakedObstacles.push(null);
+        this._bakedObstaclesSearchIds.push(0);
+      }
+      for (const cell of bakedObstaclesData.cells) {
+        let column = this._bakedCells.get(cell.x);
+        if (!column) {
+          column = new Map<integer, integer[]>();
+          this._bakedCells.set(cell.x, column);
+        }
+        let indices = column.get(cell.y);
+        if (!indices) {
+          indices = [];
+          column.set(cell.y, indices);
+        }
+        for (const index of cell.obstacles) {
+          indices.push(firstIndex + index);
+        }
+      }
+    }
+
+    /**
+     * Use the obstacle baked at export for the instance from which the object
+     * of the behavior was created, if it has not moved since.
+     * @return true if the obstacle was baked, false if it must be added.
+     */
+    claimBakedObstacle(
+      pathfindingObstacleBehavior: PathfindingObstacleRuntimeBehavior
+    ): boolean {
+      const owner = pathfindingObstacleBehavior.owner;
+      if (!owner.persistentUuid) {
+        return false;
+      }
+      const index = this._unclaimedBakedObstacles.get(owner.persistentUuid);
+      if (index === undefined) {
+        return false;
+      }
+      this._unclaimedBakedObstacles.delete(owner.persistentUuid);
+
+      const obstacleData = this._bakedObstaclesData[index];
+      const epsilon = 0.01;
+      if (
+        Math.abs(owner.getDrawableX() - obstacleData.x) > epsilon ||
+        Math.abs(owner.getDrawableY() - obstacleData.y) > epsilon ||
+        Math.abs(owner.getWidth() - obstacleData.width) > epsilon ||
+        Math.abs(owner.getHeight() - obstacleData.height) > epsilon
+      ) {
+        return false;
+      }
+      this._bakedObstacles[index] = pathfindingObstacleBehavior;
+      pathfindingObstacleBehavior._bakedObstacleIndex = index;
+      return true;
+    }
+
     /**
      * Returns all the platforms around the specified object.
      * @param maxMovementLength The maximum distance, in pixels, the object is going to do.
@@ -92,6 +209,56 @@ namespace gdjs {
       nearbyObstacles.forEach((nearbyObstacle) =>
         result.push(nearbyObstacle.behavior)
       );
+
+      if (this._bakedCellSize === 0) {
+        return;
+      }
+      // Obstacles covering several cells must only be returned once.
+      const searchId = ++this._searchId;
+      const cellSize = this._bakedCellSize;
+      const maxCellX = Math.floor((x + radius) / cellSize);
+      const maxCellY = Math.floor((y + radius) / cellSize);
+      for (
+        let cellX = Math.floor((x - radius) / cellSize);
+        cellX <= maxCellX;
+        ++cellX
+      ) {
+        const column = this._bakedCells.get(cellX);
+        if (!column) {
+          continue;
+        }
+        for (
+          let cellY = Math.floor((y - radius) / cellSize);
+          cellY <= maxCellY;
+          ++cellY
+        ) {
+          const indices = column.get(cellY);
+          if (!indices) {
+            continue;
+          }
+          for (let i = 0; i < indices.length; ++i) {
+            const index = indices[i];
+            const behavior = this._bakedObstacles[index];
+            if (
+              !behavior ||
+              this._bakedObstaclesSearchIds[index] === searchId
+            ) {
+              continue;
+            }
+            this._bakedObstaclesSearchIds[index] = searchId;
+
+            const obstacleData = this._bakedObstaclesData[index];
+            if (
+              obstacleData.x <= x + radius &&
+              obstacleData.x + obstacleData.width >= x - radius &&
+              obstacleData.y <= y + radius &&
+              obstacleData.y + obstacleData.height >= y - radius
+            ) {
+              result.push(behavior);
+            }
+          }
+        }
+      }
     }
   }
 
@@ -108,6 +275,8 @@ namespace gdjs {
     _oldHeight: float = 0;
     _manager: PathfindingObstaclesManager;
     _registeredInManager: boolean = false;
+    /** The index of the obstacle in the grid baked at export, if any. */
+    _bakedObstacleIndex: integer = -1;
     currentRBushAABB: gdjs.BehaviorRBushAABB<
       PathfindingObstacleRuntimeBehavior
     > | null = null;
@@ -121,6 +290,12 @@ namespace gdjs {
       this._impassable = behaviorData.impassable;
       this._cost = behaviorData.cost;
       this._manager = PathfindingObstaclesManager.getManager(instanceContainer);
+      const sharedData: any = instanceContainer.getInitialSharedDataForBehavior(
+        behaviorData.name
+      );
+      this._manager.loadBakedObstacles(
+        sharedData ? sharedData.bakedObstacles || null : null
+      );
 
       //Note that we can't use getX(), getWidth()... of owner here:
       //The owner is not yet fully constructed.
@@ -149,7 +324,15 @@ namespace gdjs {
         this._registeredInManager = false;
       } else {
         if (this.activated() && !this._registeredInManager) {
-          this._manager.addObstacle(this);
+          if (this._manager.claimBakedObstacle(this)) {
+            // The obstacle is already in the grid, at its position.
+            this._oldX = this.owner.getX();
+            this._oldY = this.owner.getY();
+            this._oldWidth = this.owner.getWidth();
+            this._oldHeight = this.owner.getHeight();
+          } else {
+            this._manager.addObstacle(this);
+          }
           this._registeredInManager = true;
         }
       }
@@ -6,6 +6,7 @@
 #include "BehaviorCodeGenerator.h"
 
 #include "EventsCodeGenerator.h"
+#include "GDCore/Tools/CodeTemplate.h"
 
 namespace gdjs {
 
@@ -158,7 +159,8 @@ gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorTemplateCode(
     std::function<gd::String()> generateSharedPropertiesCode,
     std::function<gd::String()> generateMethodsCode,
     std::function<gd::String()> generateUpdateFromBehaviorDataCode) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
 CODE_NAMESPACE = CODE_NAMESPACE || {};
 
 /**
@@ -217,134 +219,161 @@ CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.getSharedData = function(instanceConta
 METHODS_CODE
 
 gdjs.registerBehavior("EXTENSION_NAME::BEHAVIOR_NAME", CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME);
-)jscode_template")
-      .FindAndReplace("EXTENSION_NAME", extensionName)
-      .FindAndReplace("BEHAVIOR_NAME", eventsBasedBehavior.GetName())
-      .FindAndReplace("BEHAVIOR_FULL_NAME", eventsBasedBehavior.GetFullName())
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("INITIALIZE_SHARED_PROPERTIES_CODE",
-                      generateInitializeSharedPropertiesCode())
-      .FindAndReplace("INITIALIZE_PROPERTIES_CODE",
-                      generateInitializePropertiesCode())
-      .FindAndReplace("UPDATE_FROM_BEHAVIOR_DATA_CODE", generateUpdateFromBehaviorDataCode())
-      // It must be done before PROPERTIES_CODE.
-      .FindAndReplace("SHARED_PROPERTIES_CODE", generateSharedPropertiesCode())
-      .FindAndReplace("PROPERTIES_CODE", generatePropertiesCode())
-      .FindAndReplace("METHODS_CODE", generateMethodsCode());
-  ;
+)jscode_template",
+      {"EXTENSION_NAME",
+       "BEHAVIOR_NAME",
+       "BEHAVIOR_FULL_NAME",
+       "RUNTIME_BEHAVIOR_CLASSNAME",
+       "CODE_NAMESPACE",
+       "INITIALIZE_SHARED_PROPERTIES_CODE",
+       "INITIALIZE_PROPERTIES_CODE",
+       "UPDATE_FROM_BEHAVIOR_DATA_CODE",
+       "SHARED_PROPERTIES_CODE",
+       "PROPERTIES_CODE",
+       "METHODS_CODE"});
+  return codeTemplate.Render({extensionName,
+                             eventsBasedBehavior.GetName(),
+                             eventsBasedBehavior.GetFullName(),
+                             eventsBasedBehavior.GetName(),
+                             codeNamespace,
+                             generateInitializeSharedPropertiesCode(),
+                             generateInitializePropertiesCode(),
+                             generateUpdateFromBehaviorDataCode(),
+                             generateSharedPropertiesCode(),
+                             generatePropertiesCode(),
+                             generateMethodsCode()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateInitializePropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._behaviorData.PROPERTY_NAME = behaviorData.PROPERTY_NAME !== undefined ? behaviorData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this._behaviorData.PROPERTY_NAME = behaviorData.PROPERTY_NAME !== undefined ? behaviorData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 
 gd::String BehaviorCodeGenerator::GenerateInitializeSharedPropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this.PROPERTY_NAME = sharedData.PROPERTY_NAME !== undefined ? sharedData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this.PROPERTY_NAME = sharedData.PROPERTY_NAME !== undefined ? sharedData.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 
 gd::String
 BehaviorCodeGenerator::GenerateInitializePropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._behaviorData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this._behaviorData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 
 gd::String
 BehaviorCodeGenerator::GenerateInitializeSharedPropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 
 gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorPropertyTemplateCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this._behaviorData.PROPERTY_NAME !== undefined ? this._behaviorData.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this._behaviorData.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("GETTER_NAME",
-                      GetBehaviorPropertyGetterName(property.GetName()))
-      .FindAndReplace("SETTER_NAME",
-                      GetBehaviorPropertySetterName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetBehaviorPropertyToggleFunctionName(property.GetName()),
-                     GetBehaviorPropertyGetterName(property.GetName()),
-                     GetBehaviorPropertySetterName(property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME",
+       "GETTER_NAME",
+       "SETTER_NAME",
+       "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  gd::String togglePropertyCode =
+      property.GetType() == "Boolean"
+          ? GenerateToggleBooleanPropertyTemplateCode(
+                GetBehaviorPropertyToggleFunctionName(property.GetName()),
+                GetBehaviorPropertyGetterName(property.GetName()),
+                GetBehaviorPropertySetterName(property.GetName()))
+          : "";
+  return codeTemplate.Render({property.GetName(),
+                             GetBehaviorPropertyGetterName(property.GetName()),
+                             GetBehaviorPropertySetterName(property.GetName()),
+                             GeneratePropertyValueCode(property),
+                             togglePropertyCode});
 }
 
 gd::String BehaviorCodeGenerator::GenerateToggleBooleanPropertyTemplateCode(
     const gd::String &toggleFunctionName, const gd::String &getterName,
     const gd::String &setterName) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
   TOGGLE_NAME() {
     this.SETTER_NAME(!this.GETTER_NAME());
-  })jscode_template")
-      .FindAndReplace("TOGGLE_NAME", toggleFunctionName)
-      .FindAndReplace("GETTER_NAME", getterName)
-      .FindAndReplace("SETTER_NAME", setterName);
+  })jscode_template",
+      {"TOGGLE_NAME", "GETTER_NAME", "SETTER_NAME"});
+  return codeTemplate.Render({toggleFunctionName,
+                             getterName,
+                             setterName});
 }
 
 gd::String BehaviorCodeGenerator::GenerateRuntimeBehaviorSharedPropertyTemplateCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this.PROPERTY_NAME !== undefined ? this.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("GETTER_NAME",
-                      GetBehaviorSharedPropertyGetterInternalName(property.GetName()))
-      .FindAndReplace("SETTER_NAME",
-                      GetBehaviorSharedPropertySetterInternalName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetBehaviorSharedPropertyToggleFunctionInternalName(property.GetName()),
-                     GetBehaviorSharedPropertyGetterInternalName(property.GetName()),
-                     GetBehaviorSharedPropertySetterInternalName(property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME",
+       "GETTER_NAME",
+       "SETTER_NAME",
+       "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  const gd::String getterName =
+      GetBehaviorSharedPropertyGetterInternalName(property.GetName());
+  const gd::String setterName =
+      GetBehaviorSharedPropertySetterInternalName(property.GetName());
+  gd::String togglePropertyCode =
+      property.GetType() == "Boolean"
+          ? GenerateToggleBooleanPropertyTemplateCode(
+                GetBehaviorSharedPropertyToggleFunctionInternalName(
+                    property.GetName()),
+                getterName,
+                setterName)
+          : "";
+  return codeTemplate.Render({property.GetName(),
+                             getterName,
+                             setterName,
+                             GeneratePropertyValueCode(property),
+                             togglePropertyCode});
 }
 
 gd::String BehaviorCodeGenerator::GenerateUpdatePropertyFromBehaviorDataCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
     if (oldBehaviorData.PROPERTY_NAME !== newBehaviorData.PROPERTY_NAME)
-      this._behaviorData.PROPERTY_NAME = newBehaviorData.PROPERTY_NAME;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+      this._behaviorData.PROPERTY_NAME = newBehaviorData.PROPERTY_NAME;)jscode_template",
+      {"PROPERTY_NAME"});
+  return codeTemplate.Render({property.GetName()});
 }
 
 gd::String BehaviorCodeGenerator::GeneratePropertyValueCode(
@@ -369,29 +398,31 @@ gd::String BehaviorCodeGenerator::
     GenerateBehaviorOnDestroyToDeprecatedOnOwnerRemovedFromScene(
         const gd::EventsBasedBehavior& eventsBasedBehavior,
         const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.prototype.onDestroy = function() {
   // Redirect call to onOwnerRemovedFromScene (the old name of onDestroy)
   if (this.onOwnerRemovedFromScene) this.onOwnerRemovedFromScene();
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace);
+)jscode_template",
+      {"RUNTIME_BEHAVIOR_CLASSNAME", "CODE_NAMESPACE"});
+  return codeTemplate.Render({eventsBasedBehavior.GetName(),
+                             codeNamespace});
 }
 
 gd::String BehaviorCodeGenerator::GenerateDefaultDoStepPreEventsFunctionCode(
     const gd::EventsBasedBehavior& eventsBasedBehavior,
     const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_BEHAVIOR_CLASSNAME.prototype.doStepPreEvents = function() {
   PRELUDE_CODE
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_BEHAVIOR_CLASSNAME",
-                      eventsBasedBehavior.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("PRELUDE_CODE", GenerateDoStepPreEventsPreludeCode());
+)jscode_template",
+      {"RUNTIME_BEHAVIOR_CLASSNAME", "CODE_NAMESPACE", "PRELUDE_CODE"});
+  return codeTemplate.Render({eventsBasedBehavior.GetName(),
+                             codeNamespace,
+                             GenerateDoStepPreEventsPreludeCode()});
 }
 
 gd::String BehaviorCodeGenerator::GenerateDoStepPreEventsPreludeCode() {
@@ -9,6 +9,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
@@ -26,6 +27,7 @@
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 
@@ -65,16 +67,24 @@ gd::String EventsCodeGenerator::GenerateEventsListCompleteFunctionCode(
   gd::String globalObjectLists = allObjectsDeclarationsAndResets.first;
   gd::String globalObjectListsReset = allObjectsDeclarationsAndResets.second;
 
-  // "Booleans" used by conditions
-  gd::String globalConditionsBooleans =
-      codeGenerator.GenerateAllConditionsBooleanDeclarations();
+  // Storage for the measures of the events, when profiled.
+  gd::String eventsProfilingSectionsDeclaration;
+  if (codeGenerator.GenerateEventsProfilingCode()) {
+    eventsProfilingSectionsDeclaration =
+        codeGenerator.GetCodeNamespaceAccessor() +
+        "eventsProfilingSections = gdjs.EventsProfilingSections.register(" +
+        ConvertToStringExplicit(codeGenerator.GetCodeNamespace()) + ", " +
+        gd::String::From(
+            codeGenerator.GetEventsProfilingSections().size()) +
+        ");\n";
+  }
 
   gd::String output =
       // clang-format off
       codeGenerator.GetCodeNamespace() + " = {};\n" +
+      eventsProfilingSectionsDeclaration +
       globalDeclarations +
-      globalObjectLists + "\n" +
-      globalConditionsBooleans + "\n\n" +
+      globalObjectLists + "\n\n" +
       codeGenerator.GetCustomCodeOutsideMain() + "\n\n" +
       fullyQualifiedFunctionName + " = function(" +
         functionArgumentsCode +
@@ -95,10 +105,19 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
     const gd::Layout& scene,
     const gd::String& codeNamespace,
     std::set<gd::String>& includeFiles,
-    bool compilationForRuntime) {
+    bool compilationForRuntime,
+    gd::SerializerElement* eventsProfilingSections,
+    const std::map<gd::String, gd::String>* sharedExternalEventsFunctions) {
   EventsCodeGenerator codeGenerator(project, scene);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  if (eventsProfilingSections) {
+    codeGenerator.SetGenerateEventsProfilingCode(true);
+    codeGenerator.AddIncludeFile("events-profiling.js");
+  }
+  if (sharedExternalEventsFunctions)
+    codeGenerator.SetSharedExternalEventsFunctions(
+        *sharedExternalEventsFunctions);
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -109,6 +128,36 @@ gd::String EventsCodeGenerator::GenerateLayoutCode(
       "",
       "return;\n");
 
+  if (eventsProfilingSections)
+    codeGenerator.SerializeEventsProfilingSectionsTo(*eventsProfilingSections);
+
+  includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
+                      codeGenerator.GetIncludeFiles().end());
+  return output;
+}
+
+gd::String EventsCodeGenerator::GenerateSharedExternalEventsCode(
+    const gd::Project& project,
+    const gd::Layout& scene,
+    const gd::ExternalEvents& externalEvents,
+    const gd::String& codeNamespace,
+    std::set<gd::String>& includeFiles,
+    bool compilationForRuntime) {
+  EventsCodeGenerator codeGenerator(project, scene);
+  codeGenerator.SetCodeNamespace(codeNamespace);
+  codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+
+  // The "Trigger once" conditions use the triggers of the scene: the function
+  // must not start a new frame for them, as the scene does it.
+  gd::String output = GenerateEventsListCompleteFunctionCode(
+      codeGenerator,
+      codeGenerator.GetCodeNamespaceAccessor() + "func",
+      "runtimeScene",
+      "",
+      externalEvents.GetEvents(),
+      "",
+      "return;\n");
+
   includeFiles.insert(codeGenerator.GetIncludeFiles().begin(),
                       codeGenerator.GetIncludeFiles().end());
   return output;
@@ -133,6 +182,8 @@ gd::String EventsCodeGenerator::GenerateEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetReorderConditionsByCost(
+      project.GetReorderConditionsByCost());
 
   gd::String output = GenerateEventsListCompleteFunctionCode(
       codeGenerator,
@@ -174,6 +225,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetReorderConditionsByCost(
+      project.GetReorderConditionsByCost());
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -242,6 +295,8 @@ gd::String EventsCodeGenerator::GenerateObjectEventsFunctionCode(
   EventsCodeGenerator codeGenerator(globalObjectsAndGroups, objectsAndGroups);
   codeGenerator.SetCodeNamespace(codeNamespace);
   codeGenerator.SetGenerateCodeForRuntime(compilationForRuntime);
+  codeGenerator.SetReorderConditionsByCost(
+      project.GetReorderConditionsByCost());
 
   // Generate the code setting up the context of the function.
   gd::String fullPreludeCode =
@@ -639,19 +694,17 @@ EventsCodeGenerator::GenerateAllObjectsDeclarationsAndResets(
   return std::make_pair(globalObjectLists, globalObjectListsReset);
 }
 
-gd::String EventsCodeGenerator::GenerateAllConditionsBooleanDeclarations() {
-  gd::String globalConditionsBooleans;
-  for (unsigned int i = 0; i <= GetMaxCustomConditionsDepth(); ++i) {
-    globalConditionsBooleans += GetCodeNamespaceAccessor() + "conditionTrue_" +
-                                gd::String::From(i) + " = {val:false};\n";
-    for (std::size_t j = 0; j <= GetMaxConditionsListsSize(); ++j) {
-      globalConditionsBooleans += GetCodeNamespaceAccessor() + "condition" +
-                                  gd::String::From(j) + "IsTrue_" +
-                                  gd::String::From(i) + " = {val:false};\n";
-    }
+gd::String EventsCodeGenerator::GenerateConditionsBooleansDeclarations()
+    const {
+  if (conditionsBooleans.empty()) return "";
+
+  gd::String declarations;
+  for (const gd::String& boolean : conditionsBooleans) {
+    declarations += declarations.empty() ? "let " : ", ";
+    declarations += boolean + " = false";
   }
 
-  return globalConditionsBooleans;
+  return declarations + ";\n";
 }
 
 gd::String EventsCodeGenerator::GenerateObjectFunctionCall(
@@ -728,8 +781,8 @@ gd::String EventsCodeGenerator::GenerateFreeCondition(
     predicat = GenerateNegatedPredicat(predicat);
 
   // Generate condition code
-  return GenerateBooleanFullName(returnBoolean, context) +
-         ".val = " + predicat + ";\n";
+  return GenerateBooleanFullName(returnBoolean, context) + " = " + predicat +
+         ";\n";
 }
 
 gd::String EventsCodeGenerator::GenerateObjectCondition(
@@ -766,7 +819,7 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
   conditionCode += "    if ( " + predicat + " ) {\n";
   conditionCode += "        " +
                    GenerateBooleanFullName(returnBoolean, context) +
-                   ".val = true;\n";
+                   " = true;\n";
   conditionCode += "        " + GetObjectListName(objectName, context) +
                    "[k] = " + GetObjectListName(objectName, context) + "[i];\n";
   conditionCode += "        ++k;\n";
@@ -821,7 +874,7 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
     conditionCode += "    if ( " + predicat + " ) {\n";
     conditionCode += "        " +
                      GenerateBooleanFullName(returnBoolean, context) +
-                     ".val = true;\n";
+                     " = true;\n";
     conditionCode += "        " + GetObjectListName(objectName, context) +
                      "[k] = " + GetObjectListName(objectName, context) +
                      "[i];\n";
@@ -1050,8 +1103,13 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
 gd::String EventsCodeGenerator::GenerateAllInstancesGetterCode(
     const gd::String& objectName, gd::EventsCodeGenerationContext& context) {
   if (HasProjectAndLayout()) {
-    return "runtimeScene.getObjects(" + ConvertToStringExplicit(objectName) +
-           ")";
+    gd::String getterCode = "runtimeScene.getObjects(" +
+                            ConvertToStringExplicit(objectName) + ")";
+    // The scene always gives the same array of instances for an object.
+    if (context.GetLoopInvariants())
+      return context.GetLoopInvariants()->Hoist(getterCode);
+
+    return getterCode;
   } else {
     return "eventsFunctionContext.getObjects(" +
            ConvertToStringExplicit(objectName) + ")";
@@ -1067,8 +1125,17 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // stress on the JS engines, we generate a new function for each list of
   // events.
 
+  // The booleans of the conditions are local to the generated function, and
+  // so are the booleans that custom conditions set.
+  std::set<gd::String> parentConditionsBooleans;
+  parentConditionsBooleans.swap(conditionsBooleans);
+  std::map<size_t, gd::String> parentUpperScopeBooleans;
+  parentUpperScopeBooleans.swap(upperScopeBooleans);
   gd::String code =
       gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+  code = GenerateConditionsBooleansDeclarations() + code;
+  conditionsBooleans.swap(parentConditionsBooleans);
+  upperScopeBooleans.swap(parentUpperScopeBooleans);
 
   gd::String parametersCode = GenerateEventsParameters(context);
 
@@ -1079,9 +1146,8 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
       GetCodeNamespaceAccessor() + "eventsList" + uniqueId;
 
   // The only local parameters are runtimeScene and context.
-  // List of objects, conditions booleans and any variables used by events
-  // are stored in static variables that are globally available by the whole
-  // code.
+  // List of objects and any variables used by events are stored in static
+  // variables that are globally available by the whole code.
   AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
                            ") {\n" + code + "\n" + "};");
 
@@ -1100,19 +1166,27 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
     outputCode += GenerateBooleanInitializationToFalse(
         "condition" + gd::String::From(i) + "IsTrue", context);
 
+  // Booleans are named after the position of the condition in the
+  // evaluation order, so that the last one is the result of the list.
+  std::vector<std::size_t> order = GetConditionsEvaluationOrder(conditions);
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     if (cId != 0)
       outputCode +=
           "if ( " +
           GenerateBooleanFullName(
               "condition" + gd::String::From(cId - 1) + "IsTrue", context) +
-          ".val ) {\n";
+          " ) {\n";
 
+    gd::Instruction& condition = conditions[order[cId]];
     gd::String conditionCode =
-        GenerateConditionCode(conditions[cId],
+        GenerateConditionCode(condition,
                               "condition" + gd::String::From(cId) + "IsTrue",
                               context);
-    if (!conditions[cId].GetType().empty()) {
+    if (GenerateEventsProfilingCode() && IsEventsFunctionCall(condition)) {
+      conditionCode = WrapWithEventsProfilingCode(
+          conditionCode, "functionCall", condition.GetType());
+    }
+    if (!condition.GetType().empty()) {
       outputCode += "{\n";
       outputCode += conditionCode;
       outputCode += "}";
@@ -1125,6 +1199,11 @@ gd::String EventsCodeGenerator::GenerateConditionsListCode(
 
   maxConditionsListsSize = std::max(maxConditionsListsSize, conditions.size());
 
+  if (GenerateEventsProfilingCode() && !conditions.empty()) {
+    outputCode = WrapWithEventsProfilingCode(
+        outputCode, "conditions", GetInstructionsSentence(conditions, true));
+  }
+
   return outputCode;
 }
 
@@ -1339,22 +1418,34 @@ gd::String EventsCodeGenerator::GenerateReferenceToUpperScopeBoolean(
     return "/* Code generation error: the referenced boolean can't exist as "
            "the context has a condition depth of 0. */";
 
-  return GenerateBooleanFullName(referenceName, context) + " = " +
-         GetCodeNamespaceAccessor() + referencedBoolean + "_" +
-         gd::String::From(context.GetCurrentConditionDepth() - 1) + ";\n";
+  // The custom condition directly sets the boolean of the parent conditions
+  // list, so that booleans don't have to be passed by reference.
+  upperScopeBooleans[context.GetCurrentConditionDepth()] =
+      referencedBoolean + "_" +
+      gd::String::From(context.GetCurrentConditionDepth() - 1);
+  return "";
 }
 
 gd::String EventsCodeGenerator::GenerateBooleanInitializationToFalse(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
-  return GenerateBooleanFullName(boolName, context) + ".val = false;\n";
+  return GenerateBooleanFullName(boolName, context) + " = false;\n";
 }
 
 gd::String EventsCodeGenerator::GenerateBooleanFullName(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
-  return GetCodeNamespaceAccessor() + boolName + "_" +
-         gd::String::From(context.GetCurrentConditionDepth());
+  if (boolName == "conditionTrue") {
+    auto upperScopeBoolean =
+        upperScopeBooleans.find(context.GetCurrentConditionDepth());
+    if (upperScopeBoolean != upperScopeBooleans.end())
+      return upperScopeBoolean->second;
+  }
+
+  gd::String fullName =
+      boolName + "_" + gd::String::From(context.GetCurrentConditionDepth());
+  conditionsBooleans.insert(fullName);
+  return fullName;
 }
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
@@ -1373,6 +1464,20 @@ gd::String EventsCodeGenerator::GenerateProfilerSectionEnd(
          ConvertToStringExplicit(section) + "); }";
 }
 
+gd::String EventsCodeGenerator::GenerateEventsProfilingSectionBegin(
+    std::size_t sectionId) {
+  gd::String id = gd::String::From(sectionId);
+  return "const eventsProfilingStart" + id +
+         " = gdjs.EventsProfilingSections.now();";
+}
+
+gd::String EventsCodeGenerator::GenerateEventsProfilingSectionEnd(
+    std::size_t sectionId) {
+  gd::String id = gd::String::From(sectionId);
+  return GetCodeNamespaceAccessor() + "eventsProfilingSections.end(" + id +
+         ", eventsProfilingStart" + id + ");";
+}
+
 EventsCodeGenerator::EventsCodeGenerator(const gd::Project& project,
                                          const gd::Layout& layout)
     : gd::EventsCodeGenerator(project, layout, JsPlatform::Get()) {}
@@ -5,6 +5,7 @@
  */
 #ifndef EVENTSCODEGENERATOR_H
 #define EVENTSCODEGENERATOR_H
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -23,6 +24,7 @@ class BehaviorMetadata;
 class InstructionMetadata;
 class ExpressionCodeGenerationInformation;
 class EventsCodeGenerationContext;
+class SerializerElement;
 }  // namespace gd
 
 namespace gdjs {
@@ -43,14 +45,46 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
    * \param includeFiles Will be filled with the necessary include files.
    * \param compilationForRuntime Set this to true if the code is generated for
    * runtime.
+   * \param eventsProfilingSections If not null, the code is instrumented to
+   * measure the time spent in each event, and the measured sections are
+   * serialized in this element.
+   * \param sharedExternalEventsFunctions If not null, the functions to call
+   * for the linked external events, instead of copying them in the events (see
+   * gd::SharedExternalEventsFinder).
    *
    * \return JavaScript code
    */
-  static gd::String GenerateLayoutCode(const gd::Project& project,
-                                       const gd::Layout& scene,
-                                       const gd::String& codeNamespace,
-                                       std::set<gd::String>& includeFiles,
-                                       bool compilationForRuntime = false);
+  static gd::String GenerateLayoutCode(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime = false,
+      gd::SerializerElement* eventsProfilingSections = nullptr,
+      const std::map<gd::String, gd::String>* sharedExternalEventsFunctions =
+          nullptr);
+
+  /**
+   * Generate JavaScript for executing external events, in a function shared
+   * by the scenes linking them. The function takes the scene as parameter.
+   *
+   * \param project Project the external events belong to.
+   * \param scene The scene giving the objects used by the external events.
+   * \param externalEvents The external events to generate the code for.
+   * \param codeNamespace Where to store the function and its context.
+   * \param includeFiles Will be filled with the necessary include files.
+   * \param compilationForRuntime Set this to true if the code is generated for
+   * runtime.
+   *
+   * \return JavaScript code
+   */
+  static gd::String GenerateSharedExternalEventsCode(
+      const gd::Project& project,
+      const gd::Layout& scene,
+      const gd::ExternalEvents& externalEvents,
+      const gd::String& codeNamespace,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime = false);
 
   /**
    * Generate JavaScript for executing events of an events based function.
@@ -165,6 +199,11 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   /**
    * \brief Generate the full name for accessing to a boolean variable used for
    * conditions.
+   *
+   * Booleans are local variables of the function generated for the events
+   * list (see GenerateEventsListCode). The "conditionTrue" boolean of a
+   * custom condition is directly the boolean of the parent conditions list
+   * it must set (see GenerateReferenceToUpperScopeBoolean).
    */
   virtual gd::String GenerateBooleanFullName(
       const gd::String& boolName,
@@ -307,6 +346,14 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
 
   virtual gd::String GenerateBadObject() { return "null"; }
 
+  virtual gd::String GenerateConversionToNumber(const gd::String& valueCode) {
+    return "(Number(" + valueCode + ") || 0)";
+  }
+
+  virtual gd::String GenerateConversionToString(const gd::String& valueCode) {
+    return "(\"\" + " + valueCode + ")";
+  }
+
   virtual gd::String GenerateObject(const gd::String& objectName,
                                     const gd::String& type,
                                     gd::EventsCodeGenerationContext& context);
@@ -329,6 +376,9 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   virtual gd::String GenerateProfilerSectionBegin(const gd::String& section);
   virtual gd::String GenerateProfilerSectionEnd(const gd::String& section);
 
+  virtual gd::String GenerateEventsProfilingSectionBegin(std::size_t sectionId);
+  virtual gd::String GenerateEventsProfilingSectionEnd(std::size_t sectionId);
+
  private:
   static gd::String GenerateEventsListCompleteFunctionCode(
       gdjs::EventsCodeGenerator& codeGenerator,
@@ -339,15 +389,6 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       gd::String functionPostEventsCode,
       gd::String functionReturnCode);
 
-  /**
-   * \brief Generate the declarations of all the booleans required to run
-   * events.
-   *
-   * This should be called after generating events list code, so that the code
-   * generator knows all the booleans to be declared.
-   */
-  gd::String GenerateAllConditionsBooleanDeclarations();
-
   /**
    * \brief Generate the declarations of all the objects list arrays.
    *
@@ -421,6 +462,12 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
   gd::String codeNamespace;  ///< Optional namespace for the generated code,
                              ///< used when generating events function.
  private:
+  /**
+   * \brief Generate the declarations of the booleans used by the conditions
+   * of the events list being generated, as local variables.
+   */
+  gd::String GenerateConditionsBooleansDeclarations() const;
+
   /**
    * \brief Generate the "eventsFunctionContext" object that allow a function
    * to provides access objects, object creation and access to arguments from
@@ -435,6 +482,13 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       bool isAsync,
       const gd::String& thisObjectName = "",
       const gd::String& thisBehaviorName = "");
+
+  std::set<gd::String>
+      conditionsBooleans;  ///< The booleans used by the conditions of the
+                           ///< events list being generated.
+  std::map<size_t, gd::String>
+      upperScopeBooleans;  ///< For each condition depth, the boolean to be
+                           ///< set by the custom condition being generated.
 };
 
 }  // namespace gdjs
@@ -0,0 +1,250 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "EventsCodeMinifier.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace gdjs {
+
+const gd::String EventsCodeMinifier::verbatimBegin = "/*gdjs-verbatim*/";
+const gd::String EventsCodeMinifier::verbatimEnd = "/*gdjs-end-verbatim*/";
+
+namespace {
+bool IsWordChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '_' || c == '$' ||
+         static_cast<unsigned char>(c) >= 0x80;
+}
+
+std::size_t GetWordEnd(const std::string& code, std::size_t position) {
+  while (position < code.size() && IsWordChar(code[position])) ++position;
+  return position;
+}
+
+/**
+ * Return the namespaces declared in the code (`gdjs.Scene1Code = {};` lines).
+ */
+std::vector<std::string> FindDeclaredNamespaces(const std::string& code) {
+  static const std::string declarationEnd = " = {};";
+  std::vector<std::string> namespaces;
+  std::size_t lineStart = 0;
+  while (lineStart < code.size()) {
+    std::size_t lineEnd = code.find('\n', lineStart);
+    if (lineEnd == std::string::npos) lineEnd = code.size();
+
+    std::size_t nameEnd = lineStart;
+    while (nameEnd < lineEnd &&
+           (IsWordChar(code[nameEnd]) || code[nameEnd] == '.'))
+      ++nameEnd;
+    if (code.compare(lineStart, 5, "gdjs.") == 0 &&
+        lineEnd - nameEnd == declarationEnd.size() &&
+        code.compare(nameEnd, declarationEnd.size(), declarationEnd) == 0)
+      namespaces.push_back(code.substr(lineStart, nameEnd - lineStart));
+
+    lineStart = lineEnd + 1;
+  }
+
+  return namespaces;
+}
+
+bool IsReservedWord(const std::string& word) {
+  static const std::set<std::string> reservedWords = {
+      "do",    "if",    "in",    "for",   "let",   "new",   "try",
+      "var",   "case",  "else",  "enum",  "eval",  "null",  "this",
+      "true",  "void",  "with",  "await", "break", "catch", "class",
+      "const", "false", "super", "throw", "while", "yield"};
+  return reservedWords.count(word) != 0;
+}
+}  // namespace
+
+gd::String EventsCodeMinifier::GetShortName(
+    const std::set<std::string>& usedIdentifiers) {
+  static const std::string firstChars =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  static const std::string otherChars = firstChars + "0123456789_$";
+
+  while (true) {
+    std::size_t index = nextShortNameIndex++;
+    std::string name(1, firstChars[index % firstChars.size()]);
+    index /= firstChars.size();
+    while (index > 0) {
+      index--;
+      name += otherChars[index % otherChars.size()];
+      index /= otherChars.size();
+    }
+
+    if (!usedIdentifiers.count(name) && !IsReservedWord(name))
+      return gd::String::FromUTF8(name);
+  }
+}
+
+gd::String EventsCodeMinifier::RemoveVerbatimMarks(const gd::String& code) {
+  std::string output = code.Raw();
+  for (const std::string& mark :
+       {verbatimBegin.Raw() + "\n", "\n" + verbatimEnd.Raw()}) {
+    for (std::size_t position = output.find(mark);
+         position != std::string::npos;
+         position = output.find(mark, position)) {
+      output.erase(position, mark.size());
+    }
+  }
+
+  return gd::String::FromUTF8(output);
+}
+
+gd::String EventsCodeMinifier::Minify(const gd::String& code_) {
+  const std::string& code = code_.Raw();
+  const std::string& begin = verbatimBegin.Raw();
+  const std::string& end = verbatimEnd.Raw();
+  originalNames.clear();
+  nextShortNameIndex = 0;
+
+  std::vector<std::string> namespaces = FindDeclaredNamespaces(code);
+  if (namespaces.empty()) return code_;
+
+  // Short names must not hide any identifier used by the code, and the
+  // members used by the code written by users must keep their names.
+  std::set<std::string> usedIdentifiers;
+  for (std::size_t i = 0; i < code.size();) {
+    if (!IsWordChar(code[i])) {
+      ++i;
+      continue;
+    }
+    std::size_t wordEnd = GetWordEnd(code, i);
+    usedIdentifiers.insert(code.substr(i, wordEnd - i));
+    i = wordEnd;
+  }
+  std::set<std::string> keptMembers;
+  for (std::size_t verbatimStart = code.find(begin);
+       verbatimStart != std::string::npos;
+       verbatimStart = code.find(begin, verbatimStart + 1)) {
+    std::size_t verbatimEnd = code.find(end, verbatimStart);
+    if (verbatimEnd == std::string::npos) verbatimEnd = code.size();
+
+    for (const std::string& codeNamespace : namespaces) {
+      std::string prefix = codeNamespace + ".";
+      for (std::size_t usage = code.find(prefix, verbatimStart);
+           usage != std::string::npos && usage < verbatimEnd;
+           usage = code.find(prefix, usage + 1)) {
+        std::size_t memberStart = usage + prefix.size();
+        keptMembers.insert(
+            code.substr(usage, GetWordEnd(code, memberStart) - usage));
+      }
+    }
+  }
+
+  std::map<std::string, gd::String> shortNames;
+  std::vector<gd::String> declaredNames;
+  std::string output;
+  output.reserve(code.size());
+  bool pendingSpace = false;
+  bool pendingNewLine = false;
+  auto write = [&output, &pendingSpace, &pendingNewLine](
+                   const std::string& token) {
+    if (!output.empty() && (pendingSpace || pendingNewLine)) {
+      char previous = output.back();
+      char next = token[0];
+      if (pendingNewLine && previous != '{' && previous != ';' &&
+          previous != ',' && previous != '(' && previous != '\n')
+        // New lines are kept where they could end a statement.
+        output += '\n';
+      else if ((IsWordChar(previous) && IsWordChar(next)) ||
+               ((previous == '+' || previous == '-') && previous == next))
+        output += ' ';
+    }
+    pendingSpace = false;
+    pendingNewLine = false;
+    output += token;
+  };
+
+  std::size_t i = 0;
+  while (i < code.size()) {
+    char c = code[i];
+    char next = i + 1 < code.size() ? code[i + 1] : '\0';
+    if (code.compare(i, begin.size(), begin) == 0) {
+      std::size_t verbatimEnd = code.find(end, i);
+      if (verbatimEnd == std::string::npos) verbatimEnd = code.size();
+      pendingNewLine = false;
+      pendingSpace = false;
+      output += code.substr(i + begin.size(),
+                            verbatimEnd - i - begin.size());
+      i = std::min(verbatimEnd + end.size(), code.size());
+    } else if (c == '\n') {
+      pendingNewLine = true;
+      ++i;
+    } else if (c == ' ' || c == '\t' || c == '\r') {
+      pendingSpace = true;
+      ++i;
+    } else if (c == '/' && next == '/') {
+      i = code.find('\n', i);
+      if (i == std::string::npos) i = code.size();
+      pendingSpace = true;
+    } else if (c == '/' && next == '*') {
+      std::size_t commentEnd = code.find("*/", i + 2);
+      i = commentEnd == std::string::npos ? code.size() : commentEnd + 2;
+      pendingSpace = true;
+    } else if (c == '"' || c == '\'' || c == '`') {
+      std::size_t stringEnd = i + 1;
+      while (stringEnd < code.size() && code[stringEnd] != c)
+        stringEnd += code[stringEnd] == '\\' ? 2 : 1;
+      stringEnd = std::min(stringEnd + 1, code.size());
+      write(code.substr(i, stringEnd - i));
+      i = stringEnd;
+    } else if (IsWordChar(c)) {
+      std::size_t wordEnd = GetWordEnd(code, i);
+      bool isMember = i > 0 && code[i - 1] == '.';
+      bool isRenamed = false;
+      for (const std::string& codeNamespace : namespaces) {
+        if (isMember || code.compare(i, codeNamespace.size(), codeNamespace) ||
+            i + codeNamespace.size() >= code.size() ||
+            code[i + codeNamespace.size()] != '.')
+          continue;
+
+        std::size_t memberStart = i + codeNamespace.size() + 1;
+        std::size_t memberEnd = GetWordEnd(code, memberStart);
+        std::string name = code.substr(i, memberEnd - i);
+        if (memberEnd == memberStart ||
+            code.compare(memberStart, memberEnd - memberStart, "func") == 0 ||
+            keptMembers.count(name))
+          continue;
+
+        auto shortName = shortNames.find(name);
+        if (shortName == shortNames.end()) {
+          gd::String newShortName = GetShortName(usedIdentifiers);
+          shortName =
+              shortNames.insert(std::make_pair(name, newShortName)).first;
+          declaredNames.push_back(newShortName);
+          originalNames[newShortName] = gd::String::FromUTF8(name);
+        }
+        write(shortName->second.Raw());
+        i = memberEnd;
+        isRenamed = true;
+        break;
+      }
+      if (!isRenamed) {
+        write(code.substr(i, wordEnd - i));
+        i = wordEnd;
+      }
+    } else {
+      write(std::string(1, c));
+      ++i;
+    }
+  }
+
+  if (declaredNames.empty()) return gd::String::FromUTF8(output);
+
+  // The renamed members are variables of a function wrapping the file.
+  gd::String declarations;
+  for (const gd::String& name : declaredNames) {
+    if (!declarations.empty()) declarations += ",";
+    declarations += name;
+  }
+  return "(function(){\nvar " + declarations + ";\n" +
+         gd::String::FromUTF8(output) + "\n})();\n";
+}
+
+}  // namespace gdjs
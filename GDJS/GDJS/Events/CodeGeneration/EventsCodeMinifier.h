@@ -0,0 +1,74 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_EVENTSCODEMINIFIER_H
+#define GDJS_EVENTSCODEMINIFIER_H
+#include <map>
+#include <set>
+#include <string>
+
+#include "GDCore/String.h"
+
+namespace gdjs {
+
+/**
+ * \brief Reduce the size of the code generated for events, to be used when
+ * exporting a game for release.
+ *
+ * The code of a scene declares its objects lists, condition booleans and
+ * functions as members of its namespace (`gdjs.Scene1Code.GDPlayerObjects1`).
+ * These members are renamed to short variables declared in a function wrapping
+ * the whole file, except `func` which is called by the game engine. Comments
+ * and indentation are removed.
+ *
+ * The code written by users (see MarkAsVerbatim) is kept unchanged, and the
+ * members it uses are not renamed.
+ */
+class EventsCodeMinifier {
+ public:
+  EventsCodeMinifier() : nextShortNameIndex(0){};
+
+  /**
+   * \brief Minify the code of a file generated for events.
+   *
+   * The namespaces whose members are renamed are the ones declared in the
+   * file (as `gdjs.Scene1Code = {};`).
+   */
+  gd::String Minify(const gd::String& code);
+
+  /**
+   * \brief Return the original name of each variable declared by the last
+   * minified code, to be able to debug it.
+   */
+  const std::map<gd::String, gd::String>& GetOriginalNames() const {
+    return originalNames;
+  }
+
+  /**
+   * \brief Mark some code that must not be changed by the minifier (like the
+   * code of JavaScript events).
+   */
+  static gd::String MarkAsVerbatim(const gd::String& code) {
+    return verbatimBegin + "\n" + code + "\n" + verbatimEnd;
+  }
+
+  /**
+   * \brief Remove the marks added by MarkAsVerbatim, to get the code as it
+   * was generated when it's not minified.
+   */
+  static gd::String RemoveVerbatimMarks(const gd::String& code);
+
+ private:
+  gd::String GetShortName(const std::set<std::string>& usedIdentifiers);
+
+  std::map<gd::String, gd::String> originalNames;
+  std::size_t nextShortNameIndex;
+
+  static const gd::String verbatimBegin;
+  static const gd::String verbatimEnd;
+};
+
+}  // namespace gdjs
+#endif  // GDJS_EVENTSCODEMINIFIER_H
@@ -10,6 +10,9 @@
 #include <string>
 #include <vector>
 #include "GDCore/Project/Layout.h"
+namespace gd {
+class SerializerElement;
+}
 
 namespace gdjs {
 
@@ -27,11 +30,22 @@ class LayoutCodeGenerator {
 
   /**
    * \brief Generate the complete code for the events of the specified scene.
+   *
+   * If eventsProfilingSections is not null, the code is instrumented to
+   * measure the time spent in events, and the measured sections are
+   * serialized in it (see gdjs::EventsCodeGenerator::GenerateLayoutCode).
+   *
+   * If sharedExternalEventsFunctions is not null, the links to these external
+   * events call their functions (see
+   * gdjs::SharedExternalEventsCodeGenerator).
    */
   gd::String GenerateLayoutCompleteCode(
       const gd::Layout& layout,
       std::set<gd::String>& includeFiles,
-      bool compilationForRuntime);
+      bool compilationForRuntime,
+      gd::SerializerElement* eventsProfilingSections = nullptr,
+      const std::map<gd::String, gd::String>* sharedExternalEventsFunctions =
+          nullptr);
 
  private:
   const gd::Project& project;
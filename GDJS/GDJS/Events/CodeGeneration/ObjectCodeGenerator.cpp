@@ -6,6 +6,7 @@
 #include "ObjectCodeGenerator.h"
 
 #include "EventsCodeGenerator.h"
+#include "GDCore/Tools/CodeTemplate.h"
 
 namespace gdjs {
 
@@ -120,7 +121,8 @@ gd::String ObjectCodeGenerator::GenerateRuntimeObjectTemplateCode(
     std::function<gd::String()> generatePropertiesCode,
     std::function<gd::String()> generateMethodsCode,
     std::function<gd::String()> generateUpdateFromObjectDataCode) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
 CODE_NAMESPACE = CODE_NAMESPACE || {};
 
 /**
@@ -155,84 +157,100 @@ CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME = class RUNTIME_OBJECT_CLASSNAME extends
 METHODS_CODE
 
 gdjs.registerObject("EXTENSION_NAME::OBJECT_NAME", CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME);
-)jscode_template")
-      .FindAndReplace("EXTENSION_NAME", extensionName)
-      .FindAndReplace("OBJECT_NAME", eventsBasedObject.GetName())
-      .FindAndReplace("OBJECT_FULL_NAME", eventsBasedObject.GetFullName())
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("INITIALIZE_PROPERTIES_CODE",
-                      generateInitializePropertiesCode())
-      .FindAndReplace("UPDATE_FROM_OBJECT_DATA_CODE", generateUpdateFromObjectDataCode())
-      .FindAndReplace("PROPERTIES_CODE", generatePropertiesCode())
-      .FindAndReplace("METHODS_CODE", generateMethodsCode());
-  ;
+)jscode_template",
+      {"EXTENSION_NAME",
+       "OBJECT_NAME",
+       "OBJECT_FULL_NAME",
+       "RUNTIME_OBJECT_CLASSNAME",
+       "CODE_NAMESPACE",
+       "INITIALIZE_PROPERTIES_CODE",
+       "UPDATE_FROM_OBJECT_DATA_CODE",
+       "PROPERTIES_CODE",
+       "METHODS_CODE"});
+  return codeTemplate.Render({extensionName,
+                             eventsBasedObject.GetName(),
+                             eventsBasedObject.GetFullName(),
+                             eventsBasedObject.GetName(),
+                             codeNamespace,
+                             generateInitializePropertiesCode(),
+                             generateUpdateFromObjectDataCode(),
+                             generatePropertiesCode(),
+                             generateMethodsCode()});
 }
 // TODO these 2 methods are probably not needed if the properties are merged by GDJS.
 gd::String ObjectCodeGenerator::GenerateInitializePropertyFromDataCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._objectData.PROPERTY_NAME = objectData.content.PROPERTY_NAME !== undefined ? objectData.content.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this._objectData.PROPERTY_NAME = objectData.content.PROPERTY_NAME !== undefined ? objectData.content.PROPERTY_NAME : DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 gd::String
 ObjectCodeGenerator::GenerateInitializePropertyFromDefaultValueCode(
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
-    this._objectData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property));
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
+    this._objectData.PROPERTY_NAME = DEFAULT_VALUE;)jscode_template",
+      {"PROPERTY_NAME", "DEFAULT_VALUE"});
+  return codeTemplate.Render({property.GetName(),
+                             GeneratePropertyValueCode(property)});
 }
 
 gd::String ObjectCodeGenerator::GenerateRuntimeObjectPropertyTemplateCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
   GETTER_NAME() {
     return this._objectData.PROPERTY_NAME !== undefined ? this._objectData.PROPERTY_NAME : DEFAULT_VALUE;
   }
   SETTER_NAME(newValue) {
     this._objectData.PROPERTY_NAME = newValue;
-  }TOGGLE_PROPERTY_CODE)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName())
-      .FindAndReplace("GETTER_NAME",
-                      GetObjectPropertyGetterName(property.GetName()))
-      .FindAndReplace("SETTER_NAME",
-                      GetObjectPropertySetterName(property.GetName()))
-      .FindAndReplace("DEFAULT_VALUE", GeneratePropertyValueCode(property))
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace(
-          "TOGGLE_PROPERTY_CODE",
-          (property.GetType() == "Boolean"
-               ? GenerateToggleBooleanPropertyTemplateCode(
-                     GetObjectPropertyToggleFunctionName(property.GetName()),
-                     GetObjectPropertyGetterName(property.GetName()),
-                     GetObjectPropertySetterName(property.GetName()))
-               : ""));
+  }TOGGLE_PROPERTY_CODE)jscode_template",
+      {"PROPERTY_NAME",
+       "GETTER_NAME",
+       "SETTER_NAME",
+       "DEFAULT_VALUE",
+       "TOGGLE_PROPERTY_CODE"});
+  gd::String togglePropertyCode =
+      property.GetType() == "Boolean"
+          ? GenerateToggleBooleanPropertyTemplateCode(
+                GetObjectPropertyToggleFunctionName(property.GetName()),
+                GetObjectPropertyGetterName(property.GetName()),
+                GetObjectPropertySetterName(property.GetName()))
+          : "";
+  return codeTemplate.Render({property.GetName(),
+                             GetObjectPropertyGetterName(property.GetName()),
+                             GetObjectPropertySetterName(property.GetName()),
+                             GeneratePropertyValueCode(property),
+                             togglePropertyCode});
 }
 
 gd::String ObjectCodeGenerator::GenerateToggleBooleanPropertyTemplateCode(
     const gd::String &toggleFunctionName, const gd::String &getterName,
     const gd::String &setterName) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
   TOGGLE_NAME() {
     this.SETTER_NAME(!this.GETTER_NAME());
-  })jscode_template")
-      .FindAndReplace("TOGGLE_NAME", toggleFunctionName)
-      .FindAndReplace("GETTER_NAME", getterName)
-      .FindAndReplace("SETTER_NAME", setterName);
+  })jscode_template",
+      {"TOGGLE_NAME", "GETTER_NAME", "SETTER_NAME"});
+  return codeTemplate.Render({toggleFunctionName,
+                             getterName,
+                             setterName});
 }
 
 gd::String ObjectCodeGenerator::GenerateUpdatePropertyFromObjectDataCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::NamedPropertyDescriptor& property) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
     if (oldObjectData.content.PROPERTY_NAME !== newObjectData.content.PROPERTY_NAME)
-      this._objectData.PROPERTY_NAME = newObjectData.content.PROPERTY_NAME;)jscode_template")
-      .FindAndReplace("PROPERTY_NAME", property.GetName());
+      this._objectData.PROPERTY_NAME = newObjectData.content.PROPERTY_NAME;)jscode_template",
+      {"PROPERTY_NAME"});
+  return codeTemplate.Render({property.GetName()});
 }
 
 gd::String ObjectCodeGenerator::GeneratePropertyValueCode(
@@ -255,15 +273,16 @@ gd::String ObjectCodeGenerator::GeneratePropertyValueCode(
 gd::String ObjectCodeGenerator::GenerateDefaultDoStepPreEventsFunctionCode(
     const gd::EventsBasedObject& eventsBasedObject,
     const gd::String& codeNamespace) {
-  return gd::String(R"jscode_template(
+  static const gd::CodeTemplate codeTemplate(
+      R"jscode_template(
 CODE_NAMESPACE.RUNTIME_OBJECT_CLASSNAME.prototype.doStepPreEvents = function() {
   PRELUDE_CODE
 };
-)jscode_template")
-      .FindAndReplace("RUNTIME_OBJECT_CLASSNAME",
-                      eventsBasedObject.GetName())
-      .FindAndReplace("CODE_NAMESPACE", codeNamespace)
-      .FindAndReplace("PRELUDE_CODE", GenerateDoStepPreEventsPreludeCode());
+)jscode_template",
+      {"RUNTIME_OBJECT_CLASSNAME", "CODE_NAMESPACE", "PRELUDE_CODE"});
+  return codeTemplate.Render({eventsBasedObject.GetName(),
+                             codeNamespace,
+                             GenerateDoStepPreEventsPreludeCode()});
 }
 
 gd::String ObjectCodeGenerator::GenerateDoStepPreEventsPreludeCode() {
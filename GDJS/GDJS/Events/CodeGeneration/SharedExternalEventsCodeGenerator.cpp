@@ -0,0 +1,72 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "SharedExternalEventsCodeGenerator.h"
+
+#include <algorithm>
+
+#include "EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/SharedExternalEventsFinder.h"
+#include "GDCore/IDE/SceneNameMangler.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+
+namespace gdjs {
+
+std::map<gd::String, gd::String>
+SharedExternalEventsCodeGenerator::GenerateFunctionsFor(
+    const gd::Layout& layout,
+    std::set<gd::String>& includeFiles,
+    bool compilationForRuntime) {
+  std::map<gd::String, gd::String> functions;
+  for (const gd::String& name :
+       gd::SharedExternalEventsFinder::FindExternalEventsToCall(project,
+                                                                layout)) {
+    const gd::ExternalEvents& externalEvents = project.GetExternalEvents(name);
+    gd::String mangledName =
+        gd::SceneNameMangler::Get()->GetMangledSceneName(name) +
+        "ExternalEventsCode";
+
+    // Generate the code in the namespace of the first function, so that it
+    // can be compared to the functions already generated for other scenes.
+    gd::String code = EventsCodeGenerator::GenerateSharedExternalEventsCode(
+        project,
+        layout,
+        externalEvents,
+        "gdjs." + mangledName,
+        includeFiles,
+        compilationForRuntime);
+
+    std::vector<gd::String>& variants = variantsCodes[name];
+    std::size_t variant =
+        std::find(variants.begin(), variants.end(), code) - variants.begin();
+    if (variant != 0) mangledName += gd::String::From(variant);
+    gd::String codeNamespace = "gdjs." + mangledName;
+
+    if (variant == variants.size()) {
+      variants.push_back(code);
+      if (variant != 0)
+        code = EventsCodeGenerator::GenerateSharedExternalEventsCode(
+            project,
+            layout,
+            externalEvents,
+            codeNamespace,
+            includeFiles,
+            compilationForRuntime);
+
+      // Export the symbols to avoid them being stripped by the Closure
+      // Compiler:
+      functionsCodes.push_back(code + "\n" + "gdjs['" + mangledName + "']" +
+                               " = " + codeNamespace + ";\n");
+    }
+
+    functions[name] = codeNamespace + ".func";
+  }
+
+  return functions;
+}
+
+}  // namespace gdjs
@@ -0,0 +1,64 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_SHAREDEXTERNALEVENTSCODEGENERATOR_H
+#define GDJS_SHAREDEXTERNALEVENTSCODEGENERATOR_H
+#include <map>
+#include <set>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class Layout;
+class Project;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief Generate the functions running the external events linked by the
+ * scenes, so that the external events are generated once instead of being
+ * copied in the code of each scene.
+ *
+ * The code of external events depends on the objects of the scene linking
+ * them. Scenes for which the same code is generated share the same function.
+ *
+ * \see gd::SharedExternalEventsFinder
+ */
+class SharedExternalEventsCodeGenerator {
+ public:
+  SharedExternalEventsCodeGenerator(const gd::Project& project_)
+      : project(project_){};
+
+  /**
+   * \brief Generate, if not done already, the functions running the external
+   * events that the scene can call.
+   *
+   * \return The name of the function to call for each external events (to be
+   * given to gdjs::LayoutCodeGenerator::GenerateLayoutCompleteCode).
+   */
+  std::map<gd::String, gd::String> GenerateFunctionsFor(
+      const gd::Layout& layout,
+      std::set<gd::String>& includeFiles,
+      bool compilationForRuntime);
+
+  /**
+   * \brief Return the complete code of each function generated so far.
+   */
+  const std::vector<gd::String>& GetFunctionsCodes() const {
+    return functionsCodes;
+  }
+
+ private:
+  const gd::Project& project;
+  std::map<gd::String, std::vector<gd::String> >
+      variantsCodes;  ///< For each external events, the code of each
+                      ///< function, generated in the same namespace to be
+                      ///< compared.
+  std::vector<gd::String> functionsCodes;
+};
+
+}  // namespace gdjs
+#endif  // GDJS_SHAREDEXTERNALEVENTSCODEGENERATOR_H
@@ -84,7 +84,7 @@ AdvancedExtension::AdvancedExtension() {
             parameterNameCode + ") : false)";
         gd::String outputCode =
             codeGenerator.GenerateBooleanFullName("conditionTrue", context) +
-            ".val = " + valueCode + ";\n";
+            " = " + valueCode + ";\n";
         return outputCode;
       });
 
@@ -141,8 +141,7 @@ AdvancedExtension::AdvancedExtension() {
                 instruction.GetParameter(2).GetPlainString());
 
         gd::String resultingBoolean =
-            codeGenerator.GenerateBooleanFullName("conditionTrue", context) +
-            ".val";
+            codeGenerator.GenerateBooleanFullName("conditionTrue", context);
 
         return resultingBoolean + " = ((typeof eventsFunctionContext !== 'undefined' ? "
                "Number(eventsFunctionContext.getArgument(" +
@@ -169,8 +168,7 @@ AdvancedExtension::AdvancedExtension() {
                 instruction.GetParameter(2).GetPlainString());
 
         gd::String resultingBoolean =
-            codeGenerator.GenerateBooleanFullName("conditionTrue", context) +
-            ".val";
+            codeGenerator.GenerateBooleanFullName("conditionTrue", context);
 
         return resultingBoolean + " = ((typeof eventsFunctionContext !== 'undefined' ? "
                "\"\" + eventsFunctionContext.getArgument(" +
@@ -20,6 +20,7 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/LoopInvariants.h"
 #include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Builtin/AllBuiltinExtensions.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
@@ -31,12 +32,47 @@
 #include "GDCore/Tools/Localization.h"
 #include "GDJS/Events/Builtin/JsCodeEvent.h"
 #include "GDJS/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/EventsCodeMinifier.h"
 
 using namespace std;
 using namespace gd;
 
 namespace gdjs {
 
+namespace {
+/**
+ * Generate the code evaluating the expressions hoisted out of a loop, to be
+ * put just before the loop.
+ */
+gd::String GenerateLoopInvariantsCode(
+    gd::EventsCodeGenerator& codeGenerator,
+    const gd::LoopInvariants& loopInvariants) {
+  gd::String code;
+  for (const auto& hoistedCode : loopInvariants.GetHoistedCodes()) {
+    codeGenerator.AddGlobalDeclaration(hoistedCode.first + " = null;\n");
+    code += hoistedCode.first + " = " + hoistedCode.second + ";\n";
+  }
+
+  return code;
+}
+
+/**
+ * Create the loop invariants of a loop event, to be given to the context used
+ * for the conditions, actions and sub-events of the loop.
+ */
+gd::LoopInvariants MakeLoopInvariants(
+    gd::EventsCodeGenerator& codeGenerator,
+    const gd::BaseEvent& loopEvent,
+    const gd::EventsCodeGenerationContext& context) {
+  gd::LoopInvariants loopInvariants(
+      codeGenerator.GetCodeNamespaceAccessor() + "loopInvariant" +
+      gd::String::From(context.GetContextDepth()) + "_");
+  loopInvariants.FindWrittenVariables(codeGenerator, loopEvent);
+
+  return loopInvariants;
+}
+}  // namespace
+
 CommonInstructionsExtension::CommonInstructionsExtension() {
   gd::BuiltinExtensionsImplementer::ImplementsCommonInstructionsExtension(
       *this);
@@ -68,8 +104,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                 instruction.GetParameter(2).GetPlainString());
 
         gd::String resultingBoolean =
-            codeGenerator.GenerateBooleanFullName("conditionTrue", context) +
-            ".val";
+            codeGenerator.GenerateBooleanFullName("conditionTrue", context);
 
         return resultingBoolean + " = (" + value1Code + " " + operatorCode +
                " " + value2Code + ");\n";
@@ -99,8 +134,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                 instruction.GetParameter(2).GetPlainString());
 
         gd::String resultingBoolean =
-            codeGenerator.GenerateBooleanFullName("conditionTrue", context) +
-            ".val";
+            codeGenerator.GenerateBooleanFullName("conditionTrue", context);
 
         return resultingBoolean + " = (" + value1Code + " " + operatorCode +
                " " + value2Code + ");\n";
@@ -113,8 +147,18 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
       .SetCodeGenerator([](gd::BaseEvent& event_,
                            gd::EventsCodeGenerator& codeGenerator,
                            gd::EventsCodeGenerationContext& context) {
-        return "/*Link should not have any generated code. You probably "
-               "wrongly used a link in events without a layout.*/";
+        // Only the links to external events shared by the scenes are kept
+        // by the preprocessing: call the function running them.
+        gd::LinkEvent& event = dynamic_cast<gd::LinkEvent&>(event_);
+        const gd::String& functionName =
+            codeGenerator.GetSharedExternalEventsFunction(event.GetTarget());
+        if (!functionName.empty() &&
+            event.GetIncludeConfig() == gd::LinkEvent::INCLUDE_ALL)
+          return functionName + "(runtimeScene);\n";
+
+        return gd::String(
+            "/*Link should not have any generated code. You probably "
+            "wrongly used a link in events without a layout.*/");
       })
       .SetPreprocessing([](gd::BaseEvent& event_,
                            gd::EventsCodeGenerator& codeGenerator,
@@ -123,6 +167,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (!codeGenerator.HasProjectAndLayout()) return;
 
         gd::LinkEvent& event = dynamic_cast<gd::LinkEvent&>(event_);
+        if (!codeGenerator.GetSharedExternalEventsFunction(event.GetTarget())
+                 .empty() &&
+            event.GetIncludeConfig() == gd::LinkEvent::INCLUDE_ALL)
+          return;
+
         event.ReplaceLinkByLinkedEvents(
             codeGenerator.GetProject(), eventList, indexOfTheEventInThisList);
       });
@@ -142,8 +191,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                       "condition" +
                           gd::String::From(event.GetConditions().size() - 1) +
                           "IsTrue",
-                      context) +
-                      ".val";
+                      context);
 
         gd::EventsCodeGenerationContext actionsContext;
         actionsContext.Reuse(context);
@@ -220,11 +268,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "if( " +
                   codeGenerator.GenerateBooleanFullName(
                       "condition" + gd::String::From(cId) + "IsTrue", context) +
-                  ".val ) {\n";
+                  " ) {\n";
               conditionsCode += "    " +
                                 codeGenerator.GenerateBooleanFullName(
                                     "conditionTrue", context) +
-                                ".val = true;\n";
+                                " = true;\n";
               std::set<gd::String> objectsListsToBeDeclared =
                   context.GetAllObjectsToBeDeclared();
               for (set<gd::String>::iterator it =
@@ -281,7 +329,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   codeGenerator.GenerateBooleanFullName(
                       "condition" + gd::String::From(i) + "IsTrue",
                       parentContext) +
-                  ".val = false;\n";
+                  " = false;\n";
 
             // Generate code
             gd::String code;
@@ -325,12 +373,11 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
               predicat += " && " +
                           codeGenerator.GenerateBooleanFullName(
                               "condition" + gd::String::From(i) + "IsTrue",
-                              parentContext) +
-                          ".val";
+                              parentContext);
 
             outputCode += codeGenerator.GenerateBooleanFullName("conditionTrue",
                                                                 parentContext) +
-                          ".val = " + predicat + ";\n";
+                          " = " + predicat + ";\n";
 
             return outputCode;
           });
@@ -347,7 +394,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
               outputCode +=
                   codeGenerator.GenerateBooleanFullName(
                       "condition" + gd::String::From(i) + "IsTrue", context) +
-                  ".val = false;\n";
+                  " = false;\n";
             }
 
             for (unsigned int cId = 0; cId < conditions.size(); ++cId) {
@@ -357,7 +404,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                     codeGenerator.GenerateBooleanFullName(
                         "condition" + gd::String::From(cId - 1) + "IsTrue",
                         context) +
-                    ".val ) {\n";
+                    " ) {\n";
 
               const gd::InstructionMetadata& instrInfos =
                   gd::MetadataProvider::GetConditionMetadata(
@@ -381,13 +428,13 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
             if (!conditions.empty()) {
               outputCode += codeGenerator.GenerateBooleanFullName(
                                 "conditionTrue", context) +
-                            ".val = !";
+                            " = !";
               outputCode +=
                   codeGenerator.GenerateBooleanFullName(
                       "condition" + gd::String::From(conditions.size() - 1) +
                           "IsTrue",
                       context) +
-                  ".val;\n";
+                  ";\n";
             }
 
             return outputCode;
@@ -402,7 +449,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                 instruction.GetOriginalInstruction().lock().get());
             gd::String outputCode = codeGenerator.GenerateBooleanFullName(
                                         "conditionTrue", context) +
-                                    ".val = ";
+                                    " = ";
             gd::String contextObjectName = codeGenerator.HasProjectAndLayout()
                                                ? "runtimeScene"
                                                : "eventsFunctionContext";
@@ -433,6 +480,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         context.InheritsFrom(parentContext);
         context.ForbidReuse();
 
+        // The expressions giving the same result at each iteration are
+        // evaluated only once, before the loop.
+        gd::LoopInvariants loopInvariants =
+            MakeLoopInvariants(codeGenerator, event, context);
+        context.SetLoopInvariants(&loopInvariants);
+
         // Prepare codes
         gd::String whileConditionsStr =
             codeGenerator.GenerateConditionsListCode(event.GetWhileConditions(),
@@ -444,8 +497,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "condition" +
                       gd::String::From(event.GetWhileConditions().size() - 1) +
                       "IsTrue",
-                  context) +
-              ".val";
+                  context);
 
         gd::String conditionsCode = codeGenerator.GenerateConditionsListCode(
             event.GetConditions(), context);
@@ -458,8 +510,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "condition" +
                       gd::String::From(event.GetConditions().size() - 1) +
                       "IsTrue",
-                  context) +
-              ".val";
+                  context);
 
         // Write final code
         gd::String whileBoolean = codeGenerator.GetCodeNamespaceAccessor() +
@@ -485,7 +536,10 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
 
         outputCode += "} while ( !" + whileBoolean + " );\n";
 
-        return outputCode;
+        // The objects declarations were generated with the loop, so the
+        // hoisted expressions are known only now.
+        return GenerateLoopInvariantsCode(codeGenerator, loopInvariants) +
+               outputCode;
       });
 
   GetAllEvents()["BuiltinCommonInstructions::ForEachChildVariable"]
@@ -513,8 +567,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                       "condition" +
                           gd::String::From(event.GetConditions().size() - 1) +
                           "IsTrue",
-                      context) +
-                      ".val";
+                      context);
 
         // Prepare object declaration and sub events
         gd::String subevents =
@@ -671,6 +724,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         context.InheritsFrom(parentContext);
         context.ForbidReuse();
 
+        // The expressions giving the same result at each iteration are
+        // evaluated only once, before the loop.
+        gd::LoopInvariants loopInvariants =
+            MakeLoopInvariants(codeGenerator, event, context);
+        context.SetLoopInvariants(&loopInvariants);
+
         // Prepare conditions/actions codes
         gd::String conditionsCode = codeGenerator.GenerateConditionsListCode(
             event.GetConditions(), context);
@@ -683,8 +742,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "condition" +
                       gd::String::From(event.GetConditions().size() - 1) +
                       "IsTrue",
-                  context) +
-              ".val";
+                  context);
 
         // Prepare object declaration and sub events
         gd::String subevents =
@@ -702,6 +760,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                                     gd::String::From(context.GetContextDepth());
         codeGenerator.AddGlobalDeclaration(repeatIndexVar + " = 0;\n");
         outputCode += repeatCountVar + " = " + repeatCountCode + ";\n";
+        outputCode += GenerateLoopInvariantsCode(codeGenerator, loopInvariants);
         outputCode += "for(" + repeatIndexVar + " = 0;" + repeatIndexVar +
                       " < " + repeatCountVar + ";++" + repeatIndexVar + ") {\n";
         outputCode += objectDeclaration;
@@ -741,6 +800,12 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         context.InheritsFrom(parentContext);
         context.ForbidReuse(); // TODO: This may not be necessary (to be investigated/heavily tested).
 
+        // The expressions giving the same result at each iteration are
+        // evaluated only once, before the loop.
+        gd::LoopInvariants loopInvariants =
+            MakeLoopInvariants(codeGenerator, event, context);
+        context.SetLoopInvariants(&loopInvariants);
+
         for (unsigned int i = 0; i < realObjects.size(); ++i)
           context.EmptyObjectsListNeeded(realObjects[i]);
 
@@ -756,8 +821,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
                   "condition" +
                       gd::String::From(event.GetConditions().size() - 1) +
                       "IsTrue",
-                  context) +
-              ".val";
+                  context);
 
         // Prepare object declaration and sub events
         gd::String subevents =
@@ -806,6 +870,7 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         }
 
         // Write final code :
+        outputCode += GenerateLoopInvariantsCode(codeGenerator, loopInvariants);
 
         // For loop declaration
         if (realObjects.size() ==
@@ -925,7 +990,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         functionCode +=
             functionName + " = function(" + functionParameters + ") {\n";
         functionCode += event.IsUseStrict() ? "\"use strict\";\n" : "";
-        functionCode += event.GetInlineCode();
+        functionCode +=
+            EventsCodeMinifier::MarkAsVerbatim(event.GetInlineCode());
         functionCode += "\n};\n";
         codeGenerator.AddCustomCodeOutsideMain(functionCode);
 
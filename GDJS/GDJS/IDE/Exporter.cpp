@@ -14,8 +14,13 @@
 #include "GDCore/CommonTools.h"
 #include "GDCore/IDE/AbstractFileSystem.h"
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
+#include "GDCore/IDE/Project/PathfindingObstaclesBaker.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/Project/SpriteCollisionMasksOptimizer.h"
+#include "GDCore/IDE/Project/SpriteTextureAtlasesBuilder.h"
+#include "GDCore/IDE/Project/StaticPlatformsMerger.h"
 #include "GDCore/IDE/ProjectStripper.h"
+#include "GDCore/IDE/ProjectTreeShaker.h"
 #include "GDCore/Project/ExternalEvents.h"
 #include "GDCore/Project/ExternalLayout.h"
 #include "GDCore/Project/Layout.h"
@@ -47,22 +52,43 @@ Exporter::~Exporter() {}
 bool Exporter::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
-  return helper.ExportProjectForPixiPreview(options);
+  bool succeeded = helper.ExportProjectForPixiPreview(options);
+  lastPhasesDurations = helper.GetPhasesDurations();
+  return succeeded;
 }
 
 bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
   ExporterHelper helper(fs, gdjsRoot, codeOutputDir);
+  bool succeeded = ExportWholePixiProject(options, helper);
+  lastPhasesDurations = helper.GetPhasesDurations();
+  return succeeded;
+}
+
+bool Exporter::ExportWholePixiProject(const ExportOptions &options,
+                                      ExporterHelper &helper) {
+  double previousTime = ExporterHelper::GetTimeNow();
   gd::Project exportedProject = options.project;
 
+  // Remove the unreachable elements first, so that their resources are not
+  // exported and the extensions they use are not included.
+  if (options.treeShaking) {
+    gd::TreeShakingResult treeShakingResult =
+        gd::ProjectTreeShaker::ShakeProject(exportedProject, fs);
+    gd::LogMessage(treeShakingResult.GetReport());
+  }
+
   auto usedExtensionsResult =
-      gd::UsedExtensionsFinder::ScanProject(options.project);
+      gd::UsedExtensionsFinder::ScanProject(exportedProject);
   auto &usedExtensions = usedExtensionsResult.GetUsedExtensions();
 
+  previousTime = helper.LogTimeSpent("Project preparation", previousTime);
+
   auto exportProject = [this,
                         &exportedProject,
                         &options,
                         &helper,
-                        &usedExtensionsResult](gd::String exportDir) {
+                        &usedExtensionsResult,
+                        &previousTime](gd::String exportDir) {
     // Use project properties fallback to set empty properties
     if (exportedProject.GetAuthorIds().empty() &&
         !options.fallbackAuthorId.empty()) {
@@ -79,6 +105,18 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     std::vector<gd::String> includesFiles;
     std::vector<gd::String> resourcesFiles;
 
+    // Pack the images of sprites before exporting the resources, so that the
+    // pages are exported instead of the images they replace.
+    if (options.textureAtlases) {
+      gd::String pagesDirectory =
+          fs.GetTempDir() + "/GDTemporaries/TextureAtlases";
+      fs.MkDir(pagesDirectory);
+      fs.ClearDir(pagesDirectory);
+      gd::SpriteTextureAtlasesBuilder::BuildTextureAtlases(
+          exportedProject, fs, pagesDirectory);
+      previousTime = helper.LogTimeSpent("Texture atlases", previousTime);
+    }
+
     // Export the resources (before generating events as some resources
     // filenames may be updated)
     helper.ExportResources(fs, exportedProject, exportDir);
@@ -90,6 +128,8 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
         fs, exportedProject.GetResourcesManager(), exportDir);
     // end of compatibility code
 
+    previousTime = helper.LogTimeSpent("Resource export", previousTime);
+
     // Export engine libraries
     helper.AddLibsInclude(
         /*pixiRenderers=*/true,
@@ -112,8 +152,12 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
     helper.ExportEffectIncludes(exportedProject, includesFiles);
 
     // Export events
-    if (!helper.ExportEventsCode(
-            exportedProject, codeOutputDir, includesFiles, false)) {
+    if (!helper.ExportEventsCode(exportedProject,
+                                 codeOutputDir,
+                                 includesFiles,
+                                 false,
+                                 options.eventsProfiling,
+                                 options.minifyEventsCode)) {
       gd::LogError(_("Error during exporting! Unable to export events:\n") +
                    lastError);
       return false;
@@ -128,9 +172,25 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
       return false;
     }
 
+    previousTime = helper.LogTimeSpent("Events code export", previousTime);
+
+    // Static platforms are found by scanning the events, so they are merged
+    // before the events are stripped.
+    if (options.mergeStaticPlatforms)
+      gd::StaticPlatformsMerger::MergeProjectStaticPlatforms(
+          exportedProject, fs, exportDir);
+
     // Strip the project (*after* generating events as the events may use
     // stripped things like objects groups...)...
     gd::ProjectStripper::StripProjectForExport(exportedProject);
+    if (options.optimizeCollisionMasks)
+      gd::SpriteCollisionMasksOptimizer::OptimizeProjectCollisionMasks(
+          exportedProject);
+    if (options.bakePathfindingObstacles)
+      gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+          exportedProject, fs, exportDir);
+
+    previousTime = helper.LogTimeSpent("Data optimization", previousTime);
 
     //...and export it
     gd::SerializerElement noRuntimeGameOptions;
@@ -143,6 +203,8 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
                         helper.GenerateWebManifest(exportedProject)))
       gd::LogError("Unable to export WebManifest.");
 
+    previousTime = helper.LogTimeSpent("Project data export", previousTime);
+
     helper.ExportIncludesAndLibs(includesFiles, exportDir, false);
     helper.ExportIncludesAndLibs(resourcesFiles, exportDir, false);
 
@@ -162,6 +224,7 @@ bool Exporter::ExportWholePixiProject(const ExportOptions &options) {
       return false;
     }
 
+    previousTime = helper.LogTimeSpent("Include and libs export", previousTime);
     return true;
   };
 
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -20,6 +21,7 @@ class AbstractFileSystem;
 namespace gdjs {
 struct PreviewExportOptions;
 struct ExportOptions;
+class ExporterHelper;
 }
 
 namespace gdjs {
@@ -55,6 +57,15 @@ class Exporter {
    */
   const gd::String& GetLastError() const { return lastError; };
 
+  /**
+   * \brief Return the names and durations (in milliseconds) of the phases of
+   * the last export, in order.
+   */
+  const std::vector<std::pair<gd::String, double>>& GetLastPhasesDurations()
+      const {
+    return lastPhasesDurations;
+  };
+
   /**
    * \brief Change the directory where code files are generated.
    *
@@ -65,6 +76,9 @@ class Exporter {
   }
 
  private:
+  bool ExportWholePixiProject(const ExportOptions& options,
+                              ExporterHelper& helper);
+
   gd::AbstractFileSystem&
       fs;  ///< The abstract file system to be used for exportation.
   gd::String lastError;  ///< The last error that occurred.
@@ -72,6 +86,8 @@ class Exporter {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::vector<std::pair<gd::String, double>>
+      lastPhasesDurations;  ///< The durations of the phases of the last export.
 };
 
 }  // namespace gdjs
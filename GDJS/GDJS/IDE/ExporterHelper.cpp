@@ -10,6 +10,7 @@
 #endif
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <sstream>
@@ -26,6 +27,8 @@
 #include "GDCore/IDE/Events/UsedExtensionsFinder.h"
 #include "GDCore/IDE/ExportedDependencyResolver.h"
 #include "GDCore/IDE/Project/ProjectResourcesCopier.h"
+#include "GDCore/IDE/Project/PathfindingObstaclesBaker.h"
+#include "GDCore/IDE/Project/SpriteCollisionMasksOptimizer.h"
 #include "GDCore/IDE/ProjectStripper.h"
 #include "GDCore/IDE/SceneNameMangler.h"
 #include "GDCore/Project/EventsBasedObject.h"
@@ -38,31 +41,37 @@
 #include "GDCore/Project/SourceFile.h"
 #include "GDCore/Serialization/Serializer.h"
 #include "GDCore/TinyXml/tinyxml.h"
+#include "GDCore/Tools/CodeTemplate.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDJS/Events/CodeGeneration/EventsCodeMinifier.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+#include "GDJS/Events/CodeGeneration/SharedExternalEventsCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
 
-namespace {
-double GetTimeNow() {
+namespace gdjs {
+
+double ExporterHelper::GetTimeNow() {
 #if defined(EMSCRIPTEN)
   double currentTime = emscripten_get_now();
   return currentTime;
 #else
-  return 0;
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
 #endif
 }
-double GetTimeSpent(double previousTime) { return GetTimeNow() - previousTime; }
-double LogTimeSpent(const gd::String &name, double previousTime) {
-  gd::LogStatus(name + " took " + gd::String::From(GetTimeSpent(previousTime)) +
+
+double ExporterHelper::LogTimeSpent(const gd::String &name,
+                                    double previousTime) {
+  double timeNow = GetTimeNow();
+  phasesDurations.push_back(std::make_pair(name, timeNow - previousTime));
+  gd::LogStatus(name + " took " + gd::String::From(timeNow - previousTime) +
                 "ms");
   std::cout << std::endl;
-  return GetTimeNow();
+  return timeNow;
 }
-}  // namespace
-
-namespace gdjs {
 
 static void InsertUnique(std::vector<gd::String> &container, gd::String str) {
   if (std::find(container.begin(), container.end(), str) == container.end())
@@ -146,7 +155,11 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   if (!options.projectDataOnlyExport) {
     // Generate events code
-    if (!ExportEventsCode(immutableProject, codeOutputDir, includesFiles, true))
+    if (!ExportEventsCode(immutableProject,
+                          codeOutputDir,
+                          includesFiles,
+                          true,
+                          options.eventsProfiling))
       return false;
 
     // Export source files
@@ -164,6 +177,12 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   // Strip the project (*after* generating events as the events may use stripped
   // things (objects groups...))
   gd::ProjectStripper::StripProjectForExport(exportedProject);
+  if (options.optimizeCollisionMasks)
+    gd::SpriteCollisionMasksOptimizer::OptimizeProjectCollisionMasks(
+        exportedProject);
+  if (options.bakePathfindingObstacles)
+    gd::PathfindingObstaclesBaker::BakeProjectObstacles(
+        exportedProject, fs, options.exportPath);
   exportedProject.SetFirstLayout(options.layoutName);
 
   previousTime = LogTimeSpent("Data stripping", previousTime);
@@ -338,17 +357,6 @@ bool ExporterHelper::ExportCordovaFiles(const gd::Project &project,
     return output;
   };
 
-  gd::String str =
-      fs.ReadFile(gdjsRoot + "/Runtime/Cordova/config.xml")
-          .FindAndReplace("GDJS_PROJECTNAME",
-                          gd::Serializer::ToEscapedXMLString(project.GetName()))
-          .FindAndReplace(
-              "GDJS_PACKAGENAME",
-              gd::Serializer::ToEscapedXMLString(project.GetPackageName()))
-          .FindAndReplace("GDJS_PROJECTVERSION", project.GetVersion())
-          .FindAndReplace("<!-- GDJS_ICONS_ANDROID -->", makeIconsAndroid())
-          .FindAndReplace("<!-- GDJS_ICONS_IOS -->", makeIconsIos());
-
   gd::String plugins = "";
   auto dependenciesAndExtensions =
       gd::ExportedDependencyResolver::GetDependenciesFor(
@@ -384,8 +392,16 @@ bool ExporterHelper::ExportCordovaFiles(const gd::Project &project,
   }
 
   // TODO: migrate the plugins to the package.json
-  str =
-      str.FindAndReplace("<!-- GDJS_EXTENSION_CORDOVA_DEPENDENCY -->", plugins);
+  gd::String str = gd::CodeTemplate::Substitute(
+      fs.ReadFile(gdjsRoot + "/Runtime/Cordova/config.xml"),
+      {{"GDJS_PROJECTNAME",
+        gd::Serializer::ToEscapedXMLString(project.GetName())},
+       {"GDJS_PACKAGENAME",
+        gd::Serializer::ToEscapedXMLString(project.GetPackageName())},
+       {"GDJS_PROJECTVERSION", project.GetVersion()},
+       {"<!-- GDJS_ICONS_ANDROID -->", makeIconsAndroid()},
+       {"<!-- GDJS_ICONS_IOS -->", makeIconsIos()},
+       {"<!-- GDJS_EXTENSION_CORDOVA_DEPENDENCY -->", plugins}});
 
   if (!fs.WriteToFile(exportDir + "/config.xml", str)) {
     lastError = "Unable to write Cordova config.xml file.";
@@ -405,12 +421,12 @@ bool ExporterHelper::ExportCordovaFiles(const gd::Project &project,
                                 .FindAndReplace(" ", "-")));
 
   {
-    gd::String str =
-        fs.ReadFile(gdjsRoot + "/Runtime/Cordova/package.json")
-            .FindAndReplace("\"GDJS_GAME_NAME\"", jsonName)
-            .FindAndReplace("\"GDJS_GAME_AUTHOR\"", jsonAuthor)
-            .FindAndReplace("\"GDJS_GAME_VERSION\"", jsonVersion)
-            .FindAndReplace("\"GDJS_GAME_MANGLED_NAME\"", jsonMangledName);
+    gd::String str = gd::CodeTemplate::Substitute(
+        fs.ReadFile(gdjsRoot + "/Runtime/Cordova/package.json"),
+        {{"\"GDJS_GAME_NAME\"", jsonName},
+         {"\"GDJS_GAME_AUTHOR\"", jsonAuthor},
+         {"\"GDJS_GAME_VERSION\"", jsonVersion},
+         {"\"GDJS_GAME_MANGLED_NAME\"", jsonMangledName}});
 
     if (!fs.WriteToFile(exportDir + "/package.json", str)) {
       lastError = "Unable to write Cordova package.json file.";
@@ -460,14 +476,6 @@ bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
                                 .FindAndReplace(" ", "-")));
 
   {
-    gd::String str =
-        fs.ReadFile(gdjsRoot + "/Runtime/Electron/package.json")
-            .FindAndReplace("\"GDJS_GAME_NAME\"", jsonName)
-            .FindAndReplace("\"GDJS_GAME_PACKAGE_NAME\"", jsonPackageName)
-            .FindAndReplace("\"GDJS_GAME_AUTHOR\"", jsonAuthor)
-            .FindAndReplace("\"GDJS_GAME_VERSION\"", jsonVersion)
-            .FindAndReplace("\"GDJS_GAME_MANGLED_NAME\"", jsonMangledName);
-
     gd::String packages = "";
 
     auto dependenciesAndExtensions =
@@ -490,8 +498,14 @@ bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
                   dependency.GetVersion() + "\",";
     }
 
-    str = str.FindAndReplace("\"GDJS_EXTENSION_NPM_DEPENDENCY\": \"0\",",
-                             packages);
+    gd::String str = gd::CodeTemplate::Substitute(
+        fs.ReadFile(gdjsRoot + "/Runtime/Electron/package.json"),
+        {{"\"GDJS_GAME_NAME\"", jsonName},
+         {"\"GDJS_GAME_PACKAGE_NAME\"", jsonPackageName},
+         {"\"GDJS_GAME_AUTHOR\"", jsonAuthor},
+         {"\"GDJS_GAME_VERSION\"", jsonVersion},
+         {"\"GDJS_GAME_MANGLED_NAME\"", jsonMangledName},
+         {"\"GDJS_EXTENSION_NPM_DEPENDENCY\": \"0\",", packages}});
 
     if (!fs.WriteToFile(exportDir + "/package.json", str)) {
       lastError = "Unable to write Electron package.json file.";
@@ -500,15 +514,13 @@ bool ExporterHelper::ExportElectronFiles(const gd::Project &project,
   }
 
   {
-    gd::String str =
-        fs.ReadFile(gdjsRoot + "/Runtime/Electron/main.js")
-            .FindAndReplace(
-                "800 /*GDJS_WINDOW_WIDTH*/",
-                gd::String::From<int>(project.GetGameResolutionWidth()))
-            .FindAndReplace(
-                "600 /*GDJS_WINDOW_HEIGHT*/",
-                gd::String::From<int>(project.GetGameResolutionHeight()))
-            .FindAndReplace("\"GDJS_GAME_NAME\"", jsonName);
+    gd::String str = gd::CodeTemplate::Substitute(
+        fs.ReadFile(gdjsRoot + "/Runtime/Electron/main.js"),
+        {{"800 /*GDJS_WINDOW_WIDTH*/",
+          gd::String::From<int>(project.GetGameResolutionWidth())},
+         {"600 /*GDJS_WINDOW_HEIGHT*/",
+          gd::String::From<int>(project.GetGameResolutionHeight())},
+         {"\"GDJS_GAME_NAME\"", jsonName}});
 
     if (!fs.WriteToFile(exportDir + "/main.js", str)) {
       lastError = "Unable to write Electron main.js file.";
@@ -561,10 +573,12 @@ bool ExporterHelper::CompleteIndexFile(
                          "\" crossorigin=\"anonymous\"></script>\n";
   }
 
-  str = str.FindAndReplace("/* GDJS_CUSTOM_STYLE */", "")
-            .FindAndReplace("<!-- GDJS_CUSTOM_HTML -->", "")
-            .FindAndReplace("<!-- GDJS_CODE_FILES -->", codeFilesIncludes)
-            .FindAndReplace("{}/*GDJS_ADDITIONAL_SPEC*/", additionalSpec);
+  str = gd::CodeTemplate::Substitute(
+      str,
+      {{"/* GDJS_CUSTOM_STYLE */", ""},
+       {"<!-- GDJS_CUSTOM_HTML -->", ""},
+       {"<!-- GDJS_CODE_FILES -->", codeFilesIncludes},
+       {"{}/*GDJS_ADDITIONAL_SPEC*/", additionalSpec}});
 
   return true;
 }
@@ -697,20 +711,69 @@ bool ExporterHelper::ExportEffectIncludes(
 bool ExporterHelper::ExportEventsCode(const gd::Project &project,
                                       gd::String outputDir,
                                       std::vector<gd::String> &includesFiles,
-                                      bool exportForPreview) {
+                                      bool exportForPreview,
+                                      bool generateEventsProfilingCode,
+                                      bool minifyEventsCode) {
   fs.MkDir(outputDir);
 
+  gd::SerializerElement eventsProfilingElement;
+  eventsProfilingElement.ConsiderAsArrayOf("layout");
+
+  gd::SerializerElement namesElement;
+  namesElement.ConsiderAsArrayOf("file");
+  EventsCodeMinifier minifier;
+  auto writeEventsCode = [this, minifyEventsCode, &minifier, &namesElement](
+                             const gd::String &filename,
+                             const gd::String &code) {
+    if (!minifyEventsCode)
+      return fs.WriteToFile(filename,
+                            EventsCodeMinifier::RemoveVerbatimMarks(code));
+
+    gd::String minifiedCode = minifier.Minify(code);
+    gd::SerializerElement &fileElement = namesElement.AddChild("file");
+    fileElement.SetAttribute("name", fs.FileNameFrom(filename));
+    gd::SerializerElement &originalNamesElement =
+        fileElement.AddChild("originalNames");
+    for (const auto &it : minifier.GetOriginalNames())
+      originalNamesElement.SetAttribute(it.first, it.second);
+
+    return fs.WriteToFile(filename, minifiedCode);
+  };
+
+  // Linked external events are copied in each scene when profiling, so that
+  // all the events of a scene are measured.
+  bool shareExternalEventsCode =
+      project.GetShareExternalEventsCode() && !generateEventsProfilingCode;
+  SharedExternalEventsCodeGenerator sharedExternalEventsCodeGenerator(project);
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     std::set<gd::String> eventsIncludes;
     const gd::Layout &layout = project.GetLayout(i);
+    gd::SerializerElement *layoutEventsProfilingSections = nullptr;
+    if (generateEventsProfilingCode) {
+      gd::SerializerElement &layoutElement =
+          eventsProfilingElement.AddChild("layout");
+      layoutElement.SetAttribute("name", layout.GetName());
+      layoutEventsProfilingSections = &layoutElement.AddChild("sections");
+    }
+
+    std::map<gd::String, gd::String> sharedExternalEventsFunctions;
+    if (shareExternalEventsCode)
+      sharedExternalEventsFunctions =
+          sharedExternalEventsCodeGenerator.GenerateFunctionsFor(
+              layout, eventsIncludes, !exportForPreview);
+
     LayoutCodeGenerator layoutCodeGenerator(project);
     gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
+        layout,
+        eventsIncludes,
+        !exportForPreview,
+        layoutEventsProfilingSections,
+        &sharedExternalEventsFunctions);
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
 
     // Export the code
-    if (fs.WriteToFile(filename, eventsOutput)) {
+    if (writeEventsCode(filename, eventsOutput)) {
       for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
 
       InsertUnique(includesFiles, filename);
@@ -720,6 +783,36 @@ bool ExporterHelper::ExportEventsCode(const gd::Project &project,
     }
   }
 
+  const auto &sharedExternalEventsCodes =
+      sharedExternalEventsCodeGenerator.GetFunctionsCodes();
+  for (std::size_t i = 0; i < sharedExternalEventsCodes.size(); ++i) {
+    gd::String filename = outputDir + "/" + "external-events-code" +
+                          gd::String::From(i) + ".js";
+    if (!writeEventsCode(filename, sharedExternalEventsCodes[i])) {
+      lastError = _("Unable to write ") + filename;
+      return false;
+    }
+
+    InsertUnique(includesFiles, filename);
+  }
+
+  if (generateEventsProfilingCode) {
+    gd::String filename = outputDir + "/events-profiling.json";
+    if (!fs.WriteToFile(filename,
+                        gd::Serializer::ToJSON(eventsProfilingElement))) {
+      lastError = _("Unable to write ") + filename;
+      return false;
+    }
+  }
+
+  if (minifyEventsCode) {
+    gd::String filename = outputDir + "/events-code-names.json";
+    if (!fs.WriteToFile(filename, gd::Serializer::ToJSON(namesElement))) {
+      lastError = _("Unable to write ") + filename;
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -789,38 +882,55 @@ bool ExporterHelper::ExportIncludesAndLibs(
     const std::vector<gd::String> &includesFiles,
     gd::String exportDir,
     bool exportSourceMaps) {
+  // Files are checked, then copied, all at once so that the file system can
+  // do it faster.
+  std::vector<gd::FileCopyRequest> candidateRequests;
+  std::vector<bool> areSourceMaps;
   for (auto &include : includesFiles) {
     if (!fs.IsAbsolute(include)) {
       // By convention, an include file that is relative is relative to
       // the "<GDJS Root>/Runtime" folder, and will have the same relative
       // path when exported.
       gd::String source = gdjsRoot + "/Runtime/" + include;
-      if (fs.FileExists(source)) {
-        gd::String path = fs.DirNameFrom(exportDir + "/" + include);
-        if (!fs.DirExists(path)) fs.MkDir(path);
-
-        fs.CopyFile(source, exportDir + "/" + include);
-
-        gd::String sourceMap = source + ".map";
-        // Copy source map if present
-        if (exportSourceMaps && fs.FileExists(sourceMap)) {
-          fs.CopyFile(sourceMap, exportDir + "/" + include + ".map");
-        }
-      } else {
-        std::cout << "Could not find GDJS include file " << include
-                  << std::endl;
+      candidateRequests.push_back(
+          gd::FileCopyRequest(source, exportDir + "/" + include));
+      areSourceMaps.push_back(false);
+
+      // Copy source map if present
+      if (exportSourceMaps) {
+        candidateRequests.push_back(gd::FileCopyRequest(
+            source + ".map", exportDir + "/" + include + ".map"));
+        areSourceMaps.push_back(true);
       }
     } else {
       // Note: all the code generated from events are generated in another
       // folder and fall in this case:
-      if (fs.FileExists(include)) {
-        fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
-      } else {
-        std::cout << "Could not find include file " << include << std::endl;
-      }
+      candidateRequests.push_back(gd::FileCopyRequest(
+          include, exportDir + "/" + fs.FileNameFrom(include)));
+      areSourceMaps.push_back(false);
     }
   }
 
+  std::vector<gd::String> sources;
+  for (const auto &request : candidateRequests)
+    sources.push_back(request.source);
+  std::vector<gd::FileStatus> sourcesStatuses = fs.StatFiles(sources);
+
+  std::vector<gd::FileCopyRequest> copyRequests;
+  std::set<gd::String> directories;
+  for (std::size_t i = 0; i < candidateRequests.size(); ++i) {
+    if (sourcesStatuses[i].fileExists) {
+      directories.insert(fs.DirNameFrom(candidateRequests[i].destination));
+      copyRequests.push_back(candidateRequests[i]);
+    } else if (!areSourceMaps[i]) {
+      std::cout << "Could not find include file "
+                << candidateRequests[i].source << std::endl;
+    }
+  }
+
+  fs.MkDirs(std::vector<gd::String>(directories.begin(), directories.end()));
+  fs.CopyFiles(copyRequests);
+
   return true;
 }
 
@@ -899,14 +1009,14 @@ const gd::String ExporterHelper::GenerateWebManifest(
     const auto desktopIconFile = getFileNameForIcon("desktop", 512);
     if (!desktopIconFile.empty()) resourcesForSizes[512] = desktopIconFile;
 
-    for (const auto &sizeAndFile : resourcesForSizes) {
-      icons +=
-          gd::String(R"({
+    static const gd::CodeTemplate iconTemplate(R"({
         "src": "{FILE}",
         "sizes": "{SIZE}x{SIZE}"
-      },)")
-              .FindAndReplace("{SIZE}", gd::String::From(sizeAndFile.first))
-              .FindAndReplace("{FILE}", sizeAndFile.second);
+      },)",
+                                               {"{SIZE}", "{FILE}"});
+    for (const auto &sizeAndFile : resourcesForSizes) {
+      icons += iconTemplate.Render(
+          {gd::String::From(sizeAndFile.first), sizeAndFile.second});
     }
   }
 
@@ -919,7 +1029,7 @@ const gd::String ExporterHelper::GenerateWebManifest(
   gd::String jsonDescription =
       gd::Serializer::ToJSON(gd::SerializerElement(project.GetDescription()));
 
-  return gd::String(R"webmanifest({
+  static const gd::CodeTemplate webManifestTemplate(R"webmanifest({
   "name": {NAME},
   "short_name": {NAME},
   "id": {PACKAGE_ID},
@@ -930,13 +1040,18 @@ const gd::String ExporterHelper::GenerateWebManifest(
   "background_color": "black",
   "categories": ["games", "entertainment"],
   "icons": {ICONS}
-})webmanifest")
-      .FindAndReplace("{NAME}", jsonName)
-      .FindAndReplace("{PACKAGE_ID}", jsonPackageName)
-      .FindAndReplace("{DESCRIPTION}", jsonDescription)
-      .FindAndReplace("{ORIENTATION}",
-                      orientation == "default" ? "any" : orientation)
-      .FindAndReplace("{ICONS}", icons);
+})webmanifest",
+                                                    {"{NAME}",
+                                                     "{PACKAGE_ID}",
+                                                     "{DESCRIPTION}",
+                                                     "{ORIENTATION}",
+                                                     "{ICONS}"});
+  return webManifestTemplate.Render(
+      {jsonName,
+       jsonPackageName,
+       jsonDescription,
+       orientation == "default" ? "any" : orientation,
+       icons});
 };
 
 }  // namespace gdjs
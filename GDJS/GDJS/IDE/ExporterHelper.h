@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -41,7 +42,10 @@ struct PreviewExportOptions {
         nonRuntimeScriptsCacheBurst(0),
         fallbackAuthorId(""),
         fallbackAuthorUsername(""),
-        allowAuthenticationUsingIframeForPreview(false){};
+        allowAuthenticationUsingIframeForPreview(false),
+        eventsProfiling(false),
+        optimizeCollisionMasks(false),
+        bakePathfindingObstacles(false){};
 
   /**
    * \brief Set the address of the debugger server that the game should reach
@@ -175,6 +179,42 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the events code must be instrumented to measure the time
+   * spent in each event (false by default).
+   *
+   * \see ExporterHelper::ExportEventsCode
+   */
+  PreviewExportOptions &SetEventsProfiling(bool enable) {
+    eventsProfiling = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the custom collision masks of sprites must be simplified
+   * and decomposed into convex polygons (false by default). It should be
+   * the same as for the exports, so that collisions are the same in
+   * previews.
+   *
+   * \see gd::SpriteCollisionMasksOptimizer
+   */
+  PreviewExportOptions &SetOptimizeCollisionMasks(bool enable) {
+    optimizeCollisionMasks = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the pathfinding obstacles of the initial instances must be
+   * computed during the export (false by default). It should be the same as
+   * for the exports, so that pathfinding is the same in previews.
+   *
+   * \see gd::PathfindingObstaclesBaker
+   */
+  PreviewExportOptions &SetBakePathfindingObstacles(bool enable) {
+    bakePathfindingObstacles = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String websocketDebuggerServerAddress;
@@ -192,6 +232,9 @@ struct PreviewExportOptions {
   gd::String electronRemoteRequirePath;
   gd::String gdevelopResourceToken;
   bool allowAuthenticationUsingIframeForPreview;
+  bool eventsProfiling;
+  bool optimizeCollisionMasks;
+  bool bakePathfindingObstacles;
 };
 
 /**
@@ -207,7 +250,14 @@ struct ExportOptions {
         exportPath(exportPath_),
         target(""),
         fallbackAuthorId(""),
-        fallbackAuthorUsername(""){};
+        fallbackAuthorUsername(""),
+        eventsProfiling(false),
+        textureAtlases(false),
+        minifyEventsCode(false),
+        mergeStaticPlatforms(false),
+        treeShaking(false),
+        optimizeCollisionMasks(false),
+        bakePathfindingObstacles(false){};
 
   /**
    * \brief Set the fallback author info (if info not present in project
@@ -231,11 +281,94 @@ struct ExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the events code must be instrumented to measure the time
+   * spent in each event (false by default).
+   *
+   * \see ExporterHelper::ExportEventsCode
+   */
+  ExportOptions &SetEventsProfiling(bool enable) {
+    eventsProfiling = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the images of sprites must be packed into texture atlases
+   * (false by default).
+   *
+   * \see gd::SpriteTextureAtlasesBuilder
+   */
+  ExportOptions &SetTextureAtlases(bool enable) {
+    textureAtlases = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the events code must be minified (false by default).
+   *
+   * \see gdjs::EventsCodeMinifier
+   */
+  ExportOptions &SetMinifyEventsCode(bool enable) {
+    minifyEventsCode = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the adjacent platforms that never move must be merged into
+   * larger ones (false by default).
+   *
+   * \see gd::StaticPlatformsMerger
+   */
+  ExportOptions &SetMergeStaticPlatforms(bool enable) {
+    mergeStaticPlatforms = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the objects, behaviors, events functions and resources
+   * that the game can't use must be removed (false by default).
+   *
+   * \see gd::ProjectTreeShaker
+   */
+  ExportOptions &SetTreeShaking(bool enable) {
+    treeShaking = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the custom collision masks of sprites must be simplified
+   * and decomposed into convex polygons (false by default).
+   *
+   * \see gd::SpriteCollisionMasksOptimizer
+   */
+  ExportOptions &SetOptimizeCollisionMasks(bool enable) {
+    optimizeCollisionMasks = enable;
+    return *this;
+  }
+
+  /**
+   * \brief Set if the pathfinding obstacles of the initial instances must be
+   * computed during the export (false by default).
+   *
+   * \see gd::PathfindingObstaclesBaker
+   */
+  ExportOptions &SetBakePathfindingObstacles(bool enable) {
+    bakePathfindingObstacles = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String target;
   gd::String fallbackAuthorUsername;
   gd::String fallbackAuthorId;
+  bool eventsProfiling;
+  bool textureAtlases;
+  bool minifyEventsCode;
+  bool mergeStaticPlatforms;
+  bool treeShaking;
+  bool optimizeCollisionMasks;
+  bool bakePathfindingObstacles;
 };
 
 /**
@@ -321,11 +454,19 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   * \param generateEventsProfilingCode If true, the code measures the time
+   * spent in each event, and "events-profiling.json" is written in the output
+   * directory, mapping the measured sections to the events of each scene.
+   * \param minifyEventsCode If true, the code is minified, and
+   * "events-code-names.json" is written in the output directory, giving the
+   * original names of the variables of each file.
    */
   bool ExportEventsCode(const gd::Project &project,
                         gd::String outputDir,
                         std::vector<gd::String> &includesFiles,
-                        bool exportForPreview);
+                        bool exportForPreview,
+                        bool generateEventsProfilingCode = false,
+                        bool minifyEventsCode = false);
 
   /**
    * \brief Add the project effects include files.
@@ -466,6 +607,29 @@ class ExporterHelper {
       const gd::String &exportDir,
       gd::String urlPrefix = "");
 
+  /**
+   * \brief Return the current time, in milliseconds.
+   */
+  static double GetTimeNow();
+
+  /**
+   * \brief Log the time spent by a phase of the export, and store it.
+   *
+   * \param name The name of the phase.
+   * \param previousTime The time when the phase started.
+   * \return The current time, to be used as the start of the next phase.
+   */
+  double LogTimeSpent(const gd::String &name, double previousTime);
+
+  /**
+   * \brief Return the names and durations (in milliseconds) of the phases of
+   * the exports done with this helper, in order.
+   */
+  const std::vector<std::pair<gd::String, double>> &GetPhasesDurations()
+      const {
+    return phasesDurations;
+  }
+
   gd::AbstractFileSystem
       &fs;  ///< The abstract file system to be used for exportation.
   gd::String lastError;  ///< The last error that occurred.
@@ -473,6 +637,8 @@ class ExporterHelper {
       gdjsRoot;  ///< The root directory of GDJS, used to copy runtime files.
   gd::String codeOutputDir;  ///< The directory where JS code is outputted. Will
                              ///< be then copied to the final output directory.
+  std::vector<std::pair<gd::String, double>>
+      phasesDurations;  ///< The durations of the phases logged so far.
 };
 
 }  // namespace gdjs
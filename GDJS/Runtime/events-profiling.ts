@@ -0,0 +1,116 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2013-present Florian Rival (Florian.Rival@gmail.com). All rights reserved.
+ * This project is released under the MIT License.
+ */
+namespace gdjs {
+  const getTimeNow =
+    typeof performance !== 'undefined' && typeof performance.now === 'function'
+      ? performance.now.bind(performance)
+      : Date.now;
+
+  /**
+   * The measures of the sections of the events of a scene, when the events
+   * code was generated with events profiling enabled.
+   *
+   * Sections are identified by their index. The "events-profiling.json" file
+   * written by the exporter maps these indices to the events (and instructions)
+   * they measure.
+   */
+  export class EventsProfilingSections {
+    /** The namespace of the events code (for example: "gdjs.MySceneCode"). */
+    codeNamespace: string;
+    /** The number of times each section was run. */
+    callsCounts: Float64Array;
+    /** The total time, in milliseconds, spent in each section. */
+    totalTimes: Float64Array;
+
+    static _all: Record<string, EventsProfilingSections> = {};
+
+    constructor(codeNamespace: string, sectionsCount: integer) {
+      this.codeNamespace = codeNamespace;
+      this.callsCounts = new Float64Array(sectionsCount);
+      this.totalTimes = new Float64Array(sectionsCount);
+    }
+
+    /**
+     * Return the current time, to be given to `end` when the section ends.
+     */
+    static now(): float {
+      return getTimeNow();
+    }
+
+    /**
+     * Create (or reset, when the events code is reloaded) the measures of the
+     * events code with the given namespace.
+     */
+    static register(
+      codeNamespace: string,
+      sectionsCount: integer
+    ): EventsProfilingSections {
+      const sections = new EventsProfilingSections(
+        codeNamespace,
+        sectionsCount
+      );
+      EventsProfilingSections._all[codeNamespace] = sections;
+      return sections;
+    }
+
+    /**
+     * Get the measures of all the events code that were registered.
+     */
+    static getAll(): Record<string, EventsProfilingSections> {
+      return EventsProfilingSections._all;
+    }
+
+    /**
+     * Reset the measures of all the events code that were registered.
+     */
+    static resetAll(): void {
+      for (const codeNamespace in EventsProfilingSections._all) {
+        EventsProfilingSections._all[codeNamespace].reset();
+      }
+    }
+
+    /**
+     * Record a run of a section.
+     * @param sectionId The index of the section.
+     * @param startTime The time returned by `now` when the section started.
+     */
+    end(sectionId: integer, startTime: float): void {
+      this.callsCounts[sectionId]++;
+      this.totalTimes[sectionId] += getTimeNow() - startTime;
+    }
+
+    reset(): void {
+      this.callsCounts.fill(0);
+      this.totalTimes.fill(0);
+    }
+
+    /**
+     * Get the measures of the sections that were run, to be matched with the
+     * sections of "events-profiling.json".
+     */
+    getMeasures(): Array<{
+      id: integer;
+      callsCount: integer;
+      totalTime: float;
+    }> {
+      const measures: Array<{
+        id: integer;
+        callsCount: integer;
+        totalTime: float;
+      }> = [];
+      for (let id = 0; id < this.callsCounts.length; id++) {
+        if (this.callsCounts[id] === 0) continue;
+
+        measures.push({
+          id,
+          callsCount: this.callsCounts[id],
+          totalTime: this.totalTimes[id],
+        });
+      }
+      return measures;
+    }
+  }
+}
@@ -25,6 +25,50 @@ namespace gdjs {
     }
   };
 
+  /**
+   * Return the part of the image file to be used for the resource, if the
+   * image was packed into a texture atlas at export.
+   */
+  const getAtlasFrame = (
+    resourceData: ResourceData
+  ): PIXI.Rectangle | null => {
+    if (!resourceData.metadata) return null;
+    try {
+      const metadata = JSON.parse(resourceData.metadata);
+      const atlasFrame = metadata ? metadata.atlasFrame : null;
+      if (!atlasFrame) return null;
+
+      return new PIXI.Rectangle(
+        atlasFrame.x,
+        atlasFrame.y,
+        atlasFrame.width,
+        atlasFrame.height
+      );
+    } catch (error) {
+      logger.error(
+        'Unable to parse the metadata of resource "' +
+          resourceData.name +
+          '":',
+        error
+      );
+      return null;
+    }
+  };
+
+  /**
+   * Return the texture to be used for the resource: the loaded texture
+   * itself, or the part of it that was packed into a texture atlas.
+   */
+  const getResourceTexture = (
+    loadedTexture: PIXI.Texture,
+    resourceData: ResourceData
+  ): PIXI.Texture => {
+    const atlasFrame = getAtlasFrame(resourceData);
+    if (!atlasFrame) return loadedTexture;
+
+    return new PIXI.Texture(loadedTexture.baseTexture, atlasFrame);
+  };
+
   const findResourceWithNameAndKind = (
     resources: ResourceData[],
     resourceName: string,
@@ -123,7 +167,7 @@ namespace gdjs {
 
       logger.log('Loading texture for resource "' + resourceName + '"...');
       const file = resource.file;
-      const texture = PIXI.Texture.from(
+      const fileTexture = PIXI.Texture.from(
         this._resourcesLoader.getFullUrl(file),
         {
           resourceOptions: {
@@ -138,6 +182,7 @@ namespace gdjs {
       ).on('error', (error) => {
         logFileLoadingError(file, error);
       });
+      const texture = getResourceTexture(fileTexture, resource);
       applyTextureSettings(texture, resource);
 
       this._loadedTextures.put(resourceName, texture);
@@ -270,8 +315,9 @@ namespace gdjs {
                 return;
               }
 
-              this._loadedTextures.put(resource.name, loadedTexture);
-              applyTextureSettings(loadedTexture, resource);
+              const texture = getResourceTexture(loadedTexture, resource);
+              this._loadedTextures.put(resource.name, texture);
+              applyTextureSettings(texture, resource);
             });
           }
         }
@@ -0,0 +1,182 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+std::atomic<std::size_t> allocationsCount(0);
+std::atomic<std::size_t> allocatedBytes(0);
+
+void* CountedAllocation(std::size_t size) {
+  allocationsCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+}  // namespace
+
+// The global allocation functions are replaced to count the allocations done
+// by the benchmarks (including in GDCore and GDJS).
+void* operator new(std::size_t size) {
+  void* pointer = CountedAllocation(size);
+  if (!pointer) throw std::bad_alloc();
+  return pointer;
+}
+void* operator new[](std::size_t size) {
+  void* pointer = CountedAllocation(size);
+  if (!pointer) throw std::bad_alloc();
+  return pointer;
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAllocation(size);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return CountedAllocation(size);
+}
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+  std::free(pointer);
+}
+
+namespace gdjs {
+
+bool BenchmarkRunner::ShouldRun(const gd::String& name) const {
+  return filter.empty() || name.find(filter) != gd::String::npos;
+}
+
+void BenchmarkRunner::Run(const gd::String& name,
+                          std::function<void()> setUp,
+                          std::function<void()> benchmark) {
+  if (!ShouldRun(name)) return;
+
+  for (std::size_t i = 0; i < warmupRunsCount; ++i) {
+    setUp();
+    benchmark();
+  }
+
+  BenchmarkResult result;
+  result.name = name;
+  std::size_t totalAllocationsCount = 0;
+  std::size_t totalAllocatedBytes = 0;
+  for (std::size_t i = 0; i < runsCount; ++i) {
+    setUp();
+    std::size_t allocationsCountBefore = allocationsCount.load();
+    std::size_t allocatedBytesBefore = allocatedBytes.load();
+    auto start = std::chrono::steady_clock::now();
+    benchmark();
+    auto end = std::chrono::steady_clock::now();
+    totalAllocationsCount += allocationsCount.load() - allocationsCountBefore;
+    totalAllocatedBytes += allocatedBytes.load() - allocatedBytesBefore;
+
+    result.durations.push_back(
+        std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  std::sort(result.durations.begin(), result.durations.end());
+  double runs = static_cast<double>(std::max<std::size_t>(runsCount, 1));
+  result.allocationsCount = totalAllocationsCount / runs;
+  result.allocatedBytes = totalAllocatedBytes / runs;
+
+  std::cerr << name << ": " << GetPercentile(result.durations, 50) << "ms ("
+            << runsCount << " runs, " << result.allocationsCount
+            << " allocations)" << std::endl;
+  results.push_back(result);
+}
+
+double BenchmarkRunner::GetPercentile(const std::vector<double>& sortedValues,
+                                      double percentile) {
+  if (sortedValues.empty()) return 0;
+
+  // Linear interpolation between the closest ranks.
+  double rank = percentile / 100.0 * (sortedValues.size() - 1);
+  std::size_t lowerIndex = static_cast<std::size_t>(std::floor(rank));
+  std::size_t upperIndex =
+      std::min(lowerIndex + 1, sortedValues.size() - 1);
+  double weight = rank - lowerIndex;
+  return sortedValues[lowerIndex] * (1 - weight) +
+         sortedValues[upperIndex] * weight;
+}
+
+void BenchmarkRunner::SerializeTo(gd::SerializerElement& element) const {
+  element.ConsiderAsArrayOf("benchmark");
+  for (const BenchmarkResult& result : results) {
+    gd::SerializerElement& resultElement = element.AddChild("benchmark");
+    resultElement.AddChild("name").SetStringValue(result.name);
+    resultElement.AddChild("runs").SetIntValue(
+        static_cast<int>(result.durations.size()));
+    resultElement.AddChild("min").SetDoubleValue(
+        result.durations.empty() ? 0 : result.durations.front());
+    double sum = 0;
+    for (double duration : result.durations) sum += duration;
+    resultElement.AddChild("mean").SetDoubleValue(
+        result.durations.empty() ? 0 : sum / result.durations.size());
+    resultElement.AddChild("p50").SetDoubleValue(
+        GetPercentile(result.durations, 50));
+    resultElement.AddChild("p90").SetDoubleValue(
+        GetPercentile(result.durations, 90));
+    resultElement.AddChild("p99").SetDoubleValue(
+        GetPercentile(result.durations, 99));
+    resultElement.AddChild("max").SetDoubleValue(
+        result.durations.empty() ? 0 : result.durations.back());
+    resultElement.AddChild("allocationsCount")
+        .SetDoubleValue(result.allocationsCount);
+    resultElement.AddChild("allocatedBytes")
+        .SetDoubleValue(result.allocatedBytes);
+  }
+}
+
+std::size_t BenchmarkRunner::CompareTo(const gd::SerializerElement& baseline,
+                                       double maxRegression,
+                                       std::ostream& log) const {
+  std::size_t regressionsCount = 0;
+  auto checkRegression = [&](const gd::String& name,
+                             const gd::String& measure,
+                             double baselineValue,
+                             double value) {
+    if (baselineValue <= 0 || value <= baselineValue * (1 + maxRegression))
+      return;
+
+    regressionsCount++;
+    log << "Regression in " << name << ": " << measure << " went from "
+        << baselineValue << " to " << value << "." << std::endl;
+  };
+
+  baseline.ConsiderAsArrayOf("benchmark");
+  for (std::size_t i = 0; i < baseline.GetChildrenCount(); ++i) {
+    const gd::SerializerElement& baselineResult = baseline.GetChild(i);
+    gd::String name = baselineResult.GetChild("name").GetStringValue();
+    auto result = std::find_if(
+        results.begin(), results.end(), [&name](const BenchmarkResult& result) {
+          return result.name == name;
+        });
+    if (result == results.end()) continue;
+
+    checkRegression(name,
+                    "median duration",
+                    baselineResult.GetChild("p50").GetDoubleValue(),
+                    GetPercentile(result->durations, 50));
+    checkRegression(
+        name,
+        "allocations count",
+        baselineResult.GetChild("allocationsCount").GetDoubleValue(),
+        result->allocationsCount);
+  }
+
+  return regressionsCount;
+}
+
+}  // namespace gdjs
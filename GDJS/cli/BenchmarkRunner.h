@@ -0,0 +1,108 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_BENCHMARKRUNNER_H
+#define GDJS_BENCHMARKRUNNER_H
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+#include "GDCore/String.h"
+namespace gd {
+class SerializerElement;
+}
+
+namespace gdjs {
+
+/**
+ * \brief The measures of the runs of a benchmark.
+ */
+struct BenchmarkResult {
+  gd::String name;
+  std::vector<double> durations;  ///< In milliseconds, sorted.
+  double allocationsCount;        ///< The mean of the runs.
+  double allocatedBytes;          ///< The mean of the runs.
+};
+
+/**
+ * \brief Run benchmarks several times, measuring their durations and the
+ * memory allocations they do, and report the results as JSON.
+ *
+ * Allocations are counted by replacing the global `operator new`, which is
+ * done by BenchmarkRunner.cpp for the whole executable.
+ */
+class BenchmarkRunner {
+ public:
+  /**
+   * \param runsCount The measured runs of each benchmark.
+   * \param warmupRunsCount The runs done before the measures, to fill caches.
+   * \param filter If not empty, only the benchmarks with a name containing it
+   * are run.
+   */
+  BenchmarkRunner(std::size_t runsCount_,
+                  std::size_t warmupRunsCount_,
+                  const gd::String& filter_)
+      : runsCount(runsCount_),
+        warmupRunsCount(warmupRunsCount_),
+        filter(filter_){};
+
+  /**
+   * \brief Check if a benchmark is run, according to the filter.
+   */
+  bool ShouldRun(const gd::String& name) const;
+
+  /**
+   * \brief Measure the runs of a benchmark.
+   *
+   * \param setUp Called (without being measured) before each run.
+   * \param benchmark The measured function.
+   */
+  void Run(const gd::String& name,
+           std::function<void()> setUp,
+           std::function<void()> benchmark);
+
+  /**
+   * \brief Measure the runs of a benchmark needing no set up.
+   */
+  void Run(const gd::String& name, std::function<void()> benchmark) {
+    Run(name, []() {}, benchmark);
+  }
+
+  const std::vector<BenchmarkResult>& GetResults() const { return results; }
+
+  /**
+   * \brief Serialize the results, with the percentiles of the durations.
+   */
+  void SerializeTo(gd::SerializerElement& element) const;
+
+  /**
+   * \brief Compare the results to the ones of a previous report (serialized
+   * with SerializeTo), and log the regressions.
+   *
+   * A benchmark regressed if its median duration or its allocations count
+   * grew by more than the given ratio.
+   *
+   * \return The number of regressions.
+   */
+  std::size_t CompareTo(const gd::SerializerElement& baseline,
+                        double maxRegression,
+                        std::ostream& log) const;
+
+  /**
+   * \brief Return the percentile (between 0 and 100) of sorted values.
+   */
+  static double GetPercentile(const std::vector<double>& sortedValues,
+                              double percentile);
+
+ private:
+  std::size_t runsCount;
+  std::size_t warmupRunsCount;
+  gd::String filter;
+  std::vector<BenchmarkResult> results;
+};
+
+}  // namespace gdjs
+#endif  // GDJS_BENCHMARKRUNNER_H
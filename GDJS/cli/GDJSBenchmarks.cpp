@@ -0,0 +1,302 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of GDCore and GDJS, run on generated projects.
+ *
+ * The report is written on the standard output as JSON:
+ * `{"configuration": {...}, "benchmarks": [{"name", "runs", "min", "mean",
+ * "p50", "p90", "p99", "max", "allocationsCount", "allocatedBytes"}]}`, with
+ * durations in milliseconds, and allocations being the mean of the runs.
+ *
+ * When a previous report is given with --baseline, regressions are logged
+ * and the exit code is 1 if any benchmark regressed, so that it can be used
+ * in continuous integration.
+ */
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/IDE/AbstractFileSystem.h"
+#include "GDCore/IDE/Events/EventsRefactorer.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/Exporter.h"
+#include "GDJS/IDE/ExporterHelper.h"
+#include "SyntheticProjectGenerator.h"
+
+namespace {
+
+/**
+ * \brief A file system keeping the written files in memory, so that the
+ * exports are benchmarked without the disk.
+ */
+class InMemoryFileSystem : public gd::AbstractFileSystem {
+ public:
+  virtual void MkDir(const gd::String& path){};
+  virtual bool DirExists(const gd::String& path) { return true; };
+  virtual bool FileExists(const gd::String& path) {
+    return files.find(path) != files.end();
+  };
+  virtual gd::String FileNameFrom(const gd::String& file) {
+    std::size_t slash = file.find_last_of("/");
+    return slash == gd::String::npos ? file : file.substr(slash + 1);
+  };
+  virtual gd::String DirNameFrom(const gd::String& file) {
+    std::size_t slash = file.find_last_of("/");
+    return slash == gd::String::npos ? "" : file.substr(0, slash);
+  };
+  virtual bool MakeAbsolute(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (!IsAbsolute(filename)) filename = baseDirectory + "/" + filename;
+    return true;
+  };
+  virtual bool MakeRelative(gd::String& filename,
+                            const gd::String& baseDirectory) {
+    if (filename.find(baseDirectory + "/") == 0)
+      filename = filename.substr(baseDirectory.size() + 1);
+    return true;
+  };
+  virtual bool IsAbsolute(const gd::String& filename) {
+    return !filename.empty() && filename[0] == '/';
+  }
+  virtual bool CopyFile(const gd::String& file, const gd::String& destination) {
+    files[destination] = files[file];
+    return true;
+  }
+  virtual bool ClearDir(const gd::String& directory) {
+    for (auto it = files.begin(); it != files.end();) {
+      if (it->first.find(directory + "/") == 0)
+        it = files.erase(it);
+      else
+        ++it;
+    }
+    return true;
+  }
+  virtual bool WriteToFile(const gd::String& file, const gd::String& content) {
+    files[file] = content.Raw();
+    return true;
+  }
+  virtual gd::String ReadFile(const gd::String& file) {
+    return gd::String::FromUTF8(files[file]);
+  }
+  virtual bool ReadBinaryFile(const gd::String& file, std::string& content) {
+    if (!FileExists(file)) return false;
+    content = files[file];
+    return true;
+  }
+  virtual bool WriteBinaryFile(const gd::String& file,
+                               const std::string& content) {
+    files[file] = content;
+    return true;
+  }
+  virtual gd::String GetTempDir() { return "/tmp"; }
+  virtual std::vector<gd::String> ReadDir(const gd::String& path,
+                                          const gd::String& extension = "") {
+    return std::vector<gd::String>();
+  }
+
+  std::map<gd::String, std::string> files;
+};
+
+void PrintUsage() {
+  std::cerr << "Usage: GDJS_benchmarks [--scenes <count>] [--objects <count>]\n"
+               "                       [--instances <count>]\n"
+               "                       [--events-depth <count>]\n"
+               "                       [--events-breadth <count>]\n"
+               "                       [--expression-length <count>]\n"
+               "                       [--runs <count>] [--warmup <count>]\n"
+               "                       [--filter <benchmark name part>]\n"
+               "                       [--baseline <previous report.json>]\n"
+               "                       [--max-regression <ratio>]"
+            << std::endl;
+}
+
+std::unique_ptr<gd::Project> MakeProject() {
+  std::unique_ptr<gd::Project> project(new gd::Project);
+  project->AddPlatform(gdjs::JsPlatform::Get());
+  return project;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  gdjs::SyntheticProjectConfiguration configuration;
+  std::size_t runsCount = 20;
+  std::size_t warmupRunsCount = 2;
+  gd::String filter;
+  gd::String baselineFile;
+  double maxRegression = 0.1;
+
+  std::map<gd::String, std::size_t*> countsFlags = {
+      {"--scenes", &configuration.scenesCount},
+      {"--objects", &configuration.objectsPerScene},
+      {"--instances", &configuration.instancesPerScene},
+      {"--events-depth", &configuration.eventsDepth},
+      {"--events-breadth", &configuration.eventsBreadth},
+      {"--expression-length", &configuration.expressionLength},
+      {"--runs", &runsCount},
+      {"--warmup", &warmupRunsCount}};
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = gd::String::FromUTF8(argv[i]);
+    if (i + 1 >= argc) {
+      std::cerr << "Unknown or incomplete argument: " << argv[i] << std::endl;
+      PrintUsage();
+      return 2;
+    }
+    gd::String value = gd::String::FromUTF8(argv[++i]);
+
+    auto countFlag = countsFlags.find(argument);
+    if (countFlag != countsFlags.end()) {
+      *countFlag->second = value.To<std::size_t>();
+    } else if (argument == "--filter") {
+      filter = value;
+    } else if (argument == "--baseline") {
+      baselineFile = value;
+    } else if (argument == "--max-regression") {
+      maxRegression = value.To<double>();
+    } else {
+      std::cerr << "Unknown argument: " << argv[i - 1] << std::endl;
+      PrintUsage();
+      return 2;
+    }
+  }
+
+  // Only the report is written on the standard output: logs of the platform
+  // and of the exporter are redirected to the standard error.
+  std::ostream report(std::cout.rdbuf());
+  std::streambuf* standardOutputBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+
+  gdjs::JsPlatform& platform = gdjs::JsPlatform::Get();
+  std::unique_ptr<gd::Project> project = MakeProject();
+  gdjs::SyntheticProjectGenerator(configuration).Generate(*project);
+
+  gd::SerializerElement projectElement;
+  project->SerializeTo(projectElement);
+  gd::String projectJson = gd::Serializer::ToJSON(projectElement);
+
+  gdjs::BenchmarkRunner runner(runsCount, warmupRunsCount, filter);
+  runner.Run("JsPlatform::JsPlatform", []() { gdjs::JsPlatform platform; });
+  runner.Run("Serializer::ToJSON", [&projectElement]() {
+    gd::Serializer::ToJSON(projectElement);
+  });
+  runner.Run("Serializer::FromJSON", [&projectJson]() {
+    gd::Serializer::FromJSON(projectJson);
+  });
+
+  std::unique_ptr<gd::Project> unserializedProject;
+  runner.Run(
+      "Project::UnserializeFrom",
+      [&unserializedProject]() { unserializedProject = MakeProject(); },
+      [&unserializedProject, &projectElement]() {
+        unserializedProject->UnserializeFrom(projectElement);
+      });
+  unserializedProject.reset();
+
+  // Objects are renamed back and forth, so that each run does the same work.
+  bool isRenamed = false;
+  runner.Run("WholeProjectRefactorer::ObjectOrGroupRenamedInLayout",
+             [&project, &isRenamed]() {
+               gd::String objectName =
+                   gdjs::SyntheticProjectGenerator::GetObjectName(0);
+               gd::String oldName = isRenamed ? "RenamedObject" : objectName;
+               gd::String newName = isRenamed ? objectName : "RenamedObject";
+               for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+                 gd::Layout& layout = project->GetLayout(i);
+                 if (!layout.HasObjectNamed(oldName)) continue;
+
+                 layout.GetObject(oldName).SetName(newName);
+                 gd::WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
+                     *project, layout, oldName, newName, false);
+               }
+               isRenamed = !isRenamed;
+             });
+
+  runner.Run("EventsRefactorer::SearchInEvents", [&project, &platform]() {
+    gd::String searchedObjectName =
+        gdjs::SyntheticProjectGenerator::GetObjectName(1);
+    for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+      gd::EventsRefactorer::SearchInEvents(platform,
+                                           project->GetLayout(i).GetEvents(),
+                                           searchedObjectName,
+                                           true,
+                                           true,
+                                           true,
+                                           false,
+                                           false);
+    }
+  });
+
+  runner.Run("LayoutCodeGenerator::GenerateLayoutCompleteCode", [&project]() {
+    for (std::size_t i = 0; i < project->GetLayoutsCount(); ++i) {
+      std::set<gd::String> includeFiles;
+      gdjs::LayoutCodeGenerator(*project).GenerateLayoutCompleteCode(
+          project->GetLayout(i), includeFiles, true);
+    }
+  });
+
+  bool allExportsSucceeded = true;
+  runner.Run("Exporter::ExportProjectForPixiPreview",
+             [&project, &allExportsSucceeded]() {
+               InMemoryFileSystem fs;
+               gdjs::Exporter exporter(fs, "/GDJS");
+               exporter.SetCodeOutputDirectory("/tmp/code");
+               gdjs::PreviewExportOptions options(*project, "/tmp/preview");
+               options.SetLayoutName(project->GetFirstLayout());
+               if (!exporter.ExportProjectForPixiPreview(options))
+                 allExportsSucceeded = false;
+             });
+  if (!allExportsSucceeded) {
+    std::cerr << "The preview export failed." << std::endl;
+  }
+
+  gd::SerializerElement reportElement;
+  gd::SerializerElement& configurationElement =
+      reportElement.AddChild("configuration");
+  configurationElement.AddChild("scenesCount")
+      .SetIntValue(configuration.scenesCount);
+  configurationElement.AddChild("objectsPerScene")
+      .SetIntValue(configuration.objectsPerScene);
+  configurationElement.AddChild("instancesPerScene")
+      .SetIntValue(configuration.instancesPerScene);
+  configurationElement.AddChild("eventsDepth")
+      .SetIntValue(configuration.eventsDepth);
+  configurationElement.AddChild("eventsBreadth")
+      .SetIntValue(configuration.eventsBreadth);
+  configurationElement.AddChild("expressionLength")
+      .SetIntValue(configuration.expressionLength);
+  configurationElement.AddChild("runs").SetIntValue(runsCount);
+  runner.SerializeTo(reportElement.AddChild("benchmarks"));
+  report << gd::Serializer::ToJSON(reportElement) << std::endl;
+
+  std::size_t regressionsCount = 0;
+  if (!baselineFile.empty()) {
+    std::ifstream baselineStream(baselineFile.c_str());
+    std::stringstream baselineContent;
+    baselineContent << baselineStream.rdbuf();
+    gd::SerializerElement baseline = gd::Serializer::FromJSON(
+        gd::String::FromUTF8(baselineContent.str()));
+    regressionsCount = runner.CompareTo(
+        baseline.GetChild("benchmarks"), maxRegression, std::cerr);
+  }
+
+  std::cout.rdbuf(standardOutputBuffer);
+  return (regressionsCount > 0 || !allExportsSucceeded) ? 1 : 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Command line tool exporting games without the IDE.
+ *
+ * A job exports a project, and its result is written as a line of JSON on the
+ * standard output (logs are written on the standard error):
+ * `{"project", "success", "error", "loadingDuration", "totalDuration",
+ * "phases": [{"name", "duration"}]}`, with durations in milliseconds.
+ *
+ * With --jobs, jobs are read from the standard input, one JSON object per
+ * line: `{"project", "output", "preview", "layout", "target",
+ * "eventsProfiling", "textureAtlases", "minifyEventsCode",
+ * "mergeStaticPlatforms", "treeShaking", "optimizeCollisionMasks",
+ * "bakePathfindingObstacles"}` (only "project" and "output" are required).
+ * The platform is only loaded once, so that many projects can be exported by
+ * the same process.
+ *
+ * \note Extensions declared in JavaScript (JsExtension.js files) and the
+ * metadata of events based extensions are declared by the IDE, so they are
+ * not known by this tool. Jobs of projects with events functions extensions
+ * or using instructions of unknown extensions fail, as no code could be
+ * generated for them.
+ */
+#include <unistd.h>
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/IDE/Events/EventsTypesLister.h"
+#include "GDCore/IDE/ExtensionsLoader.h"
+#include "GDCore/IDE/PosixFileSystem.h"
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/String.h"
+#include "GDJS/Extensions/JsPlatform.h"
+#include "GDJS/IDE/Exporter.h"
+#include "GDJS/IDE/ExporterHelper.h"
+
+namespace {
+
+/**
+ * \brief The command line flags setting the boolean options of a job.
+ */
+const std::vector<std::pair<gd::String, gd::String>> booleanOptionsFlags = {
+    {"--preview", "preview"},
+    {"--events-profiling", "eventsProfiling"},
+    {"--texture-atlases", "textureAtlases"},
+    {"--minify-events-code", "minifyEventsCode"},
+    {"--merge-static-platforms", "mergeStaticPlatforms"},
+    {"--tree-shaking", "treeShaking"},
+    {"--optimize-collision-masks", "optimizeCollisionMasks"},
+    {"--bake-pathfinding-obstacles", "bakePathfindingObstacles"}};
+
+/**
+ * \brief The command line flags setting the string options of a job.
+ */
+const std::vector<std::pair<gd::String, gd::String>> stringOptionsFlags = {
+    {"--project", "project"},
+    {"--output", "output"},
+    {"--layout", "layout"},
+    {"--target", "target"}};
+
+void PrintUsage() {
+  std::cerr
+      << "Usage: GDJS_exporter --gdjs-root <GDJS directory>\n"
+         "                     [--extensions <extensions directory>]\n"
+         "                     (--jobs | --project <game.json> --output <dir>\n"
+         "                      [--preview] [--layout <name>]\n"
+         "                      [--target <cordova|electron|"
+         "facebookInstantGames>]\n"
+         "                      [--events-profiling] [--texture-atlases]\n"
+         "                      [--minify-events-code]\n"
+         "                      [--merge-static-platforms] [--tree-shaking]\n"
+         "                      [--optimize-collision-masks]\n"
+         "                      [--bake-pathfinding-obstacles])"
+      << std::endl;
+}
+
+gd::String GetString(const gd::SerializerElement& job,
+                     const gd::String& name) {
+  return job.HasChild(name) ? job.GetChild(name).GetStringValue() : "";
+}
+
+bool GetBool(const gd::SerializerElement& job, const gd::String& name) {
+  return job.HasChild(name) && job.GetChild(name).GetBoolValue();
+}
+
+/**
+ * \brief Return the errors about the instructions that are not known by the
+ * platform, as the exporter can't generate any code for them.
+ */
+std::vector<gd::String> FindUnknownInstructions(gd::Project& project) {
+  gd::EventsTypesLister typesLister(project);
+  gd::ProjectBrowserHelper::ExposeProjectEventsWithoutExtensions(project,
+                                                                 typesLister);
+
+  std::vector<gd::String> errors;
+  std::set<gd::String> checkedTypes;
+  const gd::Platform& platform = gdjs::JsPlatform::Get();
+  for (const gd::String& type : typesLister.GetAllConditionsTypes()) {
+    if (!type.empty() && checkedTypes.insert("condition " + type).second &&
+        gd::MetadataProvider::IsBadInstructionMetadata(
+            gd::MetadataProvider::GetConditionMetadata(platform, type)))
+      errors.push_back("Unknown condition: " + type + ".");
+  }
+  for (const gd::String& type : typesLister.GetAllActionsTypes()) {
+    if (!type.empty() && checkedTypes.insert("action " + type).second &&
+        gd::MetadataProvider::IsBadInstructionMetadata(
+            gd::MetadataProvider::GetActionMetadata(platform, type)))
+      errors.push_back("Unknown action: " + type + ".");
+  }
+
+  return errors;
+}
+
+/**
+ * \brief Load and export the project of a job.
+ *
+ * \return The result of the job.
+ */
+gd::SerializerElement RunJob(const gd::SerializerElement& job,
+                             gd::AbstractFileSystem& fs,
+                             const gd::String& gdjsRoot,
+                             const gd::String& codeOutputDir) {
+  double startTime = gdjs::ExporterHelper::GetTimeNow();
+  gd::String projectFile = GetString(job, "project");
+  gd::String exportPath = GetString(job, "output");
+
+  gd::SerializerElement result;
+  result.AddChild("project").SetStringValue(projectFile);
+  auto fail = [&result](const gd::String& error) {
+    result.AddChild("success").SetBoolValue(false);
+    result.AddChild("error").SetStringValue(error);
+    return result;
+  };
+  if (projectFile.empty() || exportPath.empty())
+    return fail("The project file and the output directory are required.");
+  if (!fs.FileExists(projectFile))
+    return fail("Unable to read the project file " + projectFile + ".");
+
+  gd::Project project;
+  project.AddPlatform(gdjs::JsPlatform::Get());
+  project.UnserializeFrom(gd::Serializer::FromJSON(fs.ReadFile(projectFile)));
+  project.SetProjectFile(projectFile);
+  double loadingTime = gdjs::ExporterHelper::GetTimeNow();
+
+  // The code of events functions is generated by the IDE, so the game would
+  // not work without it.
+  if (project.GetEventsFunctionsExtensionsCount() > 0)
+    return fail(
+        "Projects with events functions extensions can't be exported by this "
+        "tool, as the code of their functions is generated by the IDE.");
+  std::vector<gd::String> unknownInstructions =
+      FindUnknownInstructions(project);
+  if (!unknownInstructions.empty()) {
+    gd::String error = "The project uses instructions that can't be exported "
+                       "by this tool:";
+    for (const gd::String& unknownInstruction : unknownInstructions)
+      error += " " + unknownInstruction;
+    return fail(error);
+  }
+
+  // Code of the previous job is removed so that it can't be exported.
+  fs.MkDir(codeOutputDir);
+  fs.ClearDir(codeOutputDir);
+  gdjs::Exporter exporter(fs, gdjsRoot);
+  exporter.SetCodeOutputDirectory(codeOutputDir);
+
+  bool succeeded = false;
+  if (GetBool(job, "preview")) {
+    gdjs::PreviewExportOptions options(project, exportPath);
+    gd::String layoutName = GetString(job, "layout");
+    options.SetLayoutName(layoutName.empty() ? project.GetFirstLayout()
+                                             : layoutName);
+    options.SetEventsProfiling(GetBool(job, "eventsProfiling"))
+        .SetOptimizeCollisionMasks(GetBool(job, "optimizeCollisionMasks"))
+        .SetBakePathfindingObstacles(GetBool(job, "bakePathfindingObstacles"));
+    succeeded = exporter.ExportProjectForPixiPreview(options);
+  } else {
+    gdjs::ExportOptions options(project, exportPath);
+    options.SetTarget(GetString(job, "target"))
+        .SetEventsProfiling(GetBool(job, "eventsProfiling"))
+        .SetTextureAtlases(GetBool(job, "textureAtlases"))
+        .SetMinifyEventsCode(GetBool(job, "minifyEventsCode"))
+        .SetMergeStaticPlatforms(GetBool(job, "mergeStaticPlatforms"))
+        .SetTreeShaking(GetBool(job, "treeShaking"))
+        .SetOptimizeCollisionMasks(GetBool(job, "optimizeCollisionMasks"))
+        .SetBakePathfindingObstacles(GetBool(job, "bakePathfindingObstacles"));
+    succeeded = exporter.ExportWholePixiProject(options);
+  }
+
+  result.AddChild("success").SetBoolValue(succeeded);
+  result.AddChild("error").SetStringValue(
+      succeeded ? "" : exporter.GetLastError());
+  result.AddChild("loadingDuration").SetDoubleValue(loadingTime - startTime);
+  result.AddChild("totalDuration")
+      .SetDoubleValue(gdjs::ExporterHelper::GetTimeNow() - startTime);
+  gd::SerializerElement& phasesElement = result.AddChild("phases");
+  phasesElement.ConsiderAsArrayOf("phase");
+  for (const auto& phase : exporter.GetLastPhasesDurations()) {
+    gd::SerializerElement& phaseElement = phasesElement.AddChild("phase");
+    phaseElement.AddChild("name").SetStringValue(phase.first);
+    phaseElement.AddChild("duration").SetDoubleValue(phase.second);
+  }
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  gd::String gdjsRoot;
+  gd::String extensionsDirectory;
+  bool readJobs = false;
+  gd::SerializerElement commandLineJob;
+  for (int i = 1; i < argc; ++i) {
+    gd::String argument = gd::String::FromUTF8(argv[i]);
+    bool hasValue = i + 1 < argc;
+    bool isKnownArgument = false;
+    if (argument == "--jobs") {
+      readJobs = true;
+      isKnownArgument = true;
+    } else if (argument == "--gdjs-root" && hasValue) {
+      gdjsRoot = gd::String::FromUTF8(argv[++i]);
+      isKnownArgument = true;
+    } else if (argument == "--extensions" && hasValue) {
+      extensionsDirectory = gd::String::FromUTF8(argv[++i]);
+      isKnownArgument = true;
+    }
+    for (const auto& flag : booleanOptionsFlags) {
+      if (argument == flag.first) {
+        commandLineJob.AddChild(flag.second).SetBoolValue(true);
+        isKnownArgument = true;
+      }
+    }
+    for (const auto& flag : stringOptionsFlags) {
+      if (argument == flag.first && hasValue) {
+        commandLineJob.AddChild(flag.second)
+            .SetStringValue(gd::String::FromUTF8(argv[++i]));
+        isKnownArgument = true;
+      }
+    }
+
+    if (!isKnownArgument) {
+      std::cerr << "Unknown or incomplete argument: " << argv[i] << std::endl;
+      PrintUsage();
+      return 2;
+    }
+  }
+  if (gdjsRoot.empty() || (!readJobs && !commandLineJob.HasChild("project"))) {
+    PrintUsage();
+    return 2;
+  }
+
+  // Only results are written on the standard output: logs of the platform and
+  // of the exporter are redirected to the standard error.
+  std::ostream results(std::cout.rdbuf());
+  std::streambuf* standardOutputBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+
+  gd::PosixFileSystem fs;
+  gd::String codeOutputDir = fs.GetTempDir() + "/GDJSExporter" +
+                             gd::String::From(getpid()) + "/JSCodeTemp";
+  gdjs::JsPlatform& platform = gdjs::JsPlatform::Get();
+  if (!extensionsDirectory.empty()) {
+    gd::ExtensionsLoader::LoadAllExtensions(
+        extensionsDirectory, platform, true);
+    gd::ExtensionsLoader::ExtensionsLoadingDone(extensionsDirectory);
+  }
+
+  bool allJobsSucceeded = true;
+  auto runJob = [&](const gd::SerializerElement& job) {
+    gd::SerializerElement result = RunJob(job, fs, gdjsRoot, codeOutputDir);
+    if (!result.GetChild("success").GetBoolValue()) allJobsSucceeded = false;
+    results << gd::Serializer::ToJSON(result) << std::endl;
+  };
+  if (readJobs) {
+    std::string line;
+    while (std::getline(std::cin, line)) {
+      if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+      runJob(gd::Serializer::FromJSON(line.c_str()));
+    }
+  } else {
+    runJob(commandLineJob);
+  }
+
+  fs.ClearDir(fs.DirNameFrom(codeOutputDir));
+  rmdir(fs.DirNameFrom(codeOutputDir).c_str());
+  std::cout.rdbuf(standardOutputBuffer);
+  return allJobsSucceeded ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "SyntheticProjectGenerator.h"
+
+#include <algorithm>
+
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Event.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Direction.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+
+namespace gdjs {
+
+namespace {
+
+const std::size_t variablesPerScene = 10;
+
+gd::String GetVariableName(std::size_t index) {
+  return "Counter" + gd::String::From(index % variablesPerScene);
+}
+
+gd::Instruction MakeInstruction(const gd::String& type,
+                                const gd::String& firstParameter,
+                                const gd::String& operatorParameter,
+                                const gd::String& value) {
+  gd::Instruction instruction;
+  instruction.SetType(type);
+  instruction.SetParametersCount(3);
+  instruction.SetParameter(0, gd::Expression(firstParameter));
+  instruction.SetParameter(1, gd::Expression(operatorParameter));
+  instruction.SetParameter(2, gd::Expression(value));
+  return instruction;
+}
+
+}  // namespace
+
+gd::String SyntheticProjectGenerator::GetObjectName(std::size_t index) {
+  return "Object" + gd::String::From(index);
+}
+
+void SyntheticProjectGenerator::Generate(gd::Project& project) const {
+  project.SetName("Synthetic project");
+  project.SetPackageName("com.example.syntheticproject");
+  for (std::size_t i = 0; i < configuration.objectsPerScene; ++i) {
+    project.GetResourcesManager().AddResource(
+        GetObjectName(i), "images/" + GetObjectName(i) + ".png", "image");
+  }
+
+  for (std::size_t i = 0; i < configuration.scenesCount; ++i) {
+    GenerateLayout(
+        project,
+        project.InsertNewLayout("Scene" + gd::String::From(i),
+                                project.GetLayoutsCount()));
+  }
+  if (project.GetLayoutsCount() > 0)
+    project.SetFirstLayout(project.GetLayout(0).GetName());
+}
+
+void SyntheticProjectGenerator::GenerateLayout(gd::Project& project,
+                                               gd::Layout& layout) const {
+  for (std::size_t i = 0; i < variablesPerScene; ++i)
+    layout.GetVariables().InsertNew(GetVariableName(i)).SetValue(i);
+
+  for (std::size_t i = 0; i < configuration.objectsPerScene; ++i) {
+    gd::Object& object =
+        layout.InsertNewObject(project, "Sprite", GetObjectName(i), i);
+    auto* spriteObject =
+        dynamic_cast<gd::SpriteObject*>(&object.GetConfiguration());
+    if (!spriteObject) continue;
+
+    gd::Sprite sprite;
+    sprite.SetImageName(GetObjectName(i));
+    gd::Direction direction;
+    direction.AddSprite(sprite);
+    gd::Animation animation;
+    animation.SetName("Idle");
+    animation.SetDirectionsCount(1);
+    animation.SetDirection(direction, 0);
+    spriteObject->AddAnimation(animation);
+  }
+
+  if (configuration.objectsPerScene > 0) {
+    for (std::size_t i = 0; i < configuration.instancesPerScene; ++i) {
+      gd::InitialInstance& instance =
+          layout.GetInitialInstances().InsertNewInitialInstance();
+      instance.SetObjectName(
+          GetObjectName(i % configuration.objectsPerScene));
+      instance.SetX(static_cast<double>((i % 100) * 32));
+      instance.SetY(static_cast<double>((i / 100) * 32));
+    }
+  }
+
+  GenerateEvents(layout.GetEvents(), configuration.eventsDepth);
+}
+
+void SyntheticProjectGenerator::GenerateEvents(gd::EventsList& events,
+                                               std::size_t depth) const {
+  if (depth == 0 || configuration.objectsPerScene == 0) return;
+
+  for (std::size_t i = 0; i < configuration.eventsBreadth; ++i) {
+    std::size_t seed = depth * configuration.eventsBreadth + i;
+    gd::String objectName =
+        GetObjectName(seed % configuration.objectsPerScene);
+
+    gd::StandardEvent event;
+    event.GetConditions().Insert(MakeInstruction(
+        "PosX", objectName, "<", GenerateExpression(seed)));
+    event.GetActions().Insert(MakeInstruction(
+        "MettreX", objectName, "+", GenerateExpression(seed + 1)));
+    event.GetActions().Insert(MakeInstruction(
+        "ModVarScene", GetVariableName(seed), "=",
+        GenerateExpression(seed + 2)));
+
+    gd::BaseEvent& insertedEvent = events.InsertEvent(event);
+    GenerateEvents(insertedEvent.GetSubEvents(), depth - 1);
+  }
+}
+
+gd::String SyntheticProjectGenerator::GenerateExpression(
+    std::size_t seed) const {
+  std::size_t objectsCount = std::max<std::size_t>(
+      configuration.objectsPerScene, 1);
+  gd::String expression;
+  for (std::size_t i = 0; i < std::max<std::size_t>(
+                                  configuration.expressionLength, 1);
+       ++i) {
+    std::size_t termSeed = seed + i;
+    if (i > 0) expression += (termSeed % 3 == 0) ? " * " : " + ";
+
+    switch (termSeed % 4) {
+      case 0:
+        expression += GetObjectName(termSeed % objectsCount) + ".X()";
+        break;
+      case 1:
+        expression += "Variable(" + GetVariableName(termSeed) + ")";
+        break;
+      case 2:
+        expression += "cos(" + gd::String::From(termSeed) + " / 10)";
+        break;
+      default:
+        expression += "(" + GetObjectName(termSeed % objectsCount) +
+                      ".Y() - " + gd::String::From(termSeed) + ")";
+        break;
+    }
+  }
+
+  return expression;
+}
+
+}  // namespace gdjs
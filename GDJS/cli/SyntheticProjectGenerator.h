@@ -0,0 +1,71 @@
+/*
+ * GDevelop JS Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDJS_SYNTHETICPROJECTGENERATOR_H
+#define GDJS_SYNTHETICPROJECTGENERATOR_H
+#include <cstddef>
+
+#include "GDCore/String.h"
+namespace gd {
+class EventsList;
+class Layout;
+class Project;
+}  // namespace gd
+
+namespace gdjs {
+
+/**
+ * \brief The size of a project made by gdjs::SyntheticProjectGenerator.
+ */
+struct SyntheticProjectConfiguration {
+  SyntheticProjectConfiguration()
+      : scenesCount(5),
+        objectsPerScene(50),
+        instancesPerScene(500),
+        eventsDepth(3),
+        eventsBreadth(4),
+        expressionLength(8){};
+
+  std::size_t scenesCount;
+  std::size_t objectsPerScene;
+  std::size_t instancesPerScene;
+  std::size_t eventsDepth;    ///< The levels of events (including sub events).
+  std::size_t eventsBreadth;  ///< The events at the root and in each event.
+  std::size_t expressionLength;  ///< The terms of the generated expressions.
+};
+
+/**
+ * \brief Generate projects of arbitrary sizes, made of the builtin objects
+ * and instructions, to benchmark the tools of the IDE and the exporter.
+ *
+ * Generated projects are deterministic: the same configuration always
+ * gives the same project.
+ */
+class SyntheticProjectGenerator {
+ public:
+  SyntheticProjectGenerator(const SyntheticProjectConfiguration& configuration_)
+      : configuration(configuration_){};
+
+  /**
+   * \brief Fill the project (which must be using the JS platform) with
+   * scenes, objects, instances and events.
+   */
+  void Generate(gd::Project& project) const;
+
+  /**
+   * \brief Return the name of the n-th object of the scenes.
+   */
+  static gd::String GetObjectName(std::size_t index);
+
+ private:
+  void GenerateLayout(gd::Project& project, gd::Layout& layout) const;
+  void GenerateEvents(gd::EventsList& events, std::size_t depth) const;
+  gd::String GenerateExpression(std::size_t seed) const;
+
+  SyntheticProjectConfiguration configuration;
+};
+
+}  // namespace gdjs
+#endif  // GDJS_SYNTHETICPROJECTGENERATOR_H
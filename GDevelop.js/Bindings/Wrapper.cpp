@@ -30,9 +30,11 @@
 #include <GDCore/IDE/Events/EventsLeaderboardsRenamer.h>
 #include <GDCore/IDE/Events/EventsPositionFinder.h>
 #include <GDCore/IDE/Events/EventsRefactorer.h>
+#include <GDCore/IDE/Events/EventsDiagnosticsAnalyzer.h>
 #include <GDCore/IDE/Events/EventsRemover.h>
 #include <GDCore/IDE/Events/EventsTypesLister.h>
 #include <GDCore/IDE/Events/ExpressionCompletionFinder.h>
+#include <GDCore/IDE/Events/ExpressionCompletionIndex.h>
 #include <GDCore/IDE/Events/ExpressionNodeLocationFinder.h>
 #include <GDCore/IDE/Events/ExpressionTypeFinder.h>
 #include <GDCore/IDE/Events/ExpressionValidator.h>
@@ -81,12 +83,14 @@
 #include <GDJS/Events/Builtin/JsCodeEvent.h>
 #include <GDJS/Events/CodeGeneration/BehaviorCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/ObjectCodeGenerator.h>
+#include <GDJS/Events/CodeGeneration/EventsCodeMinifier.h>
 #include <GDJS/Events/CodeGeneration/EventsFunctionsExtensionCodeGenerator.h>
 #include <GDJS/Events/CodeGeneration/LayoutCodeGenerator.h>
 #include <GDJS/IDE/Exporter.h>
 #include <GDJS/IDE/ExporterHelper.h>
 #include <emscripten.h>
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
@@ -335,6 +339,136 @@ class AbstractFileSystemJS : public AbstractFileSystem {
     return directories;
   }
 
+  // Batch operations are optional: when a JSImplementation has them, a whole
+  // batch is done with a single call, and results are written in the memory
+  // of Emscripten. Otherwise, operations are done one by one.
+  virtual std::vector<gd::FileStatus> StatFiles(
+      const std::vector<gd::String> &paths) {
+    std::vector<double> statuses(paths.size(), 0);
+    bool isHandled = (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('statFiles')) return false;
+          // Each status is 1 if the file exists, plus 2 if the directory
+          // exists, plus 4 times the size of the file in bytes.
+          var statuses = self.statFiles(wrapPointer($1, Module['VectorString']));
+          for (var i = 0; i < statuses.length; i++)
+            HEAPF64[($2 >> 3) + i] = statuses[i];
+          return true;
+        },
+        (int)this,
+        (int)&paths,
+        (int)statuses.data());
+    if (!isHandled) return AbstractFileSystem::StatFiles(paths);
+
+    std::vector<gd::FileStatus> fileStatuses(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+      std::uint64_t status = static_cast<std::uint64_t>(statuses[i]);
+      fileStatuses[i].fileExists = (status & 1) != 0;
+      fileStatuses[i].dirExists = (status & 2) != 0;
+      fileStatuses[i].size = static_cast<std::size_t>(status >> 2);
+    }
+    return fileStatuses;
+  }
+
+  virtual std::vector<bool> CopyFiles(
+      const std::vector<gd::FileCopyRequest> &requests) {
+    std::vector<gd::String> sources;
+    std::vector<gd::String> destinations;
+    for (const auto &request : requests) {
+      sources.push_back(request.source);
+      destinations.push_back(request.destination);
+    }
+    std::vector<unsigned char> results(requests.size(), 0);
+    bool isHandled = (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('copyFiles')) return false;
+          var results = self.copyFiles(wrapPointer($1, Module['VectorString']),
+                                       wrapPointer($2, Module['VectorString']));
+          for (var i = 0; i < results.length; i++)
+            HEAPU8[$3 + i] = results[i] ? 1 : 0;
+          return true;
+        },
+        (int)this,
+        (int)&sources,
+        (int)&destinations,
+        (int)results.data());
+    if (!isHandled) return AbstractFileSystem::CopyFiles(requests);
+
+    return std::vector<bool>(results.begin(), results.end());
+  }
+
+  virtual std::vector<bool> WriteFiles(
+      const std::vector<gd::FileWriteRequest> &requests) {
+    std::vector<gd::String> files;
+    std::vector<gd::String> contents;
+    for (const auto &request : requests) {
+      files.push_back(request.file);
+      contents.push_back(request.content);
+    }
+    std::vector<unsigned char> results(requests.size(), 0);
+    bool isHandled = (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('writeFiles')) return false;
+          var results = self.writeFiles(wrapPointer($1, Module['VectorString']),
+                                        wrapPointer($2, Module['VectorString']));
+          for (var i = 0; i < results.length; i++)
+            HEAPU8[$3 + i] = results[i] ? 1 : 0;
+          return true;
+        },
+        (int)this,
+        (int)&files,
+        (int)&contents,
+        (int)results.data());
+    if (!isHandled) return AbstractFileSystem::WriteFiles(requests);
+
+    return std::vector<bool>(results.begin(), results.end());
+  }
+
+  // Binary files are optional too (they are used to pack images in texture
+  // atlases). The bytes read are kept by Module until they are copied in the
+  // memory of Emscripten, once the string has the right size.
+  virtual bool ReadBinaryFile(const gd::String &file, std::string &content) {
+    int size = EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('readBinaryFile')) return -1;
+          var bytes = self.readBinaryFile(UTF8ToString($1));
+          if (!bytes) return -1;
+          Module['lastReadBinaryFileBytes'] = bytes;
+          return bytes.length;
+        },
+        (int)this,
+        file.c_str());
+    if (size < 0) return false;
+
+    content.resize(size);
+    EM_ASM(
+        {
+          HEAPU8.set(Module['lastReadBinaryFileBytes'], $0);
+          Module['lastReadBinaryFileBytes'] = null;
+        },
+        (int)content.data());
+    return true;
+  }
+
+  virtual bool WriteBinaryFile(const gd::String &file,
+                               const std::string &content) {
+    return (bool)EM_ASM_INT(
+        {
+          var self = Module['getCache'](Module['AbstractFileSystemJS'])[$0];
+          if (!self.hasOwnProperty('writeBinaryFile')) return false;
+          return self.writeBinaryFile(UTF8ToString($1),
+                                      HEAPU8.slice($2, $2 + $3));
+        },
+        (int)this,
+        file.c_str(),
+        (int)content.data(),
+        (int)content.size());
+  }
+
   AbstractFileSystemJS(){};
   virtual ~AbstractFileSystemJS(){};
 };
@@ -436,6 +570,9 @@ typedef ExpressionCompletionDescription::CompletionKind
     ExpressionCompletionDescription_CompletionKind;
 typedef std::vector<gd::ExpressionCompletionDescription>
     VectorExpressionCompletionDescription;
+typedef std::vector<gd::ExpressionCompletionCandidate>
+    VectorExpressionCompletionCandidate;
+typedef std::vector<gd::EventsDiagnostic> VectorEventsDiagnostic;
 typedef std::map<gd::String, std::map<gd::String, gd::PropertyDescriptor>>
     MapExtensionProperties;
 typedef gd::Variable::Type Variable_Type;
@@ -505,6 +642,16 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 
 #define WRAPPED_at(a) at(a).get()
 
+// Wrapper to move the node owned by the unique_ptr given by reference:
+#define WRAPPED_ReparseExpression(                                \
+    previousExpression, previousNode, editStartPosition,          \
+    editEndPosition, replacement)                                 \
+  ReparseExpression(previousExpression,                           \
+                    std::move(previousNode),                      \
+                    editStartPosition,                            \
+                    editEndPosition,                              \
+                    replacement)
+
 #define MAP_getOrCreate(key) operator[](key)
 #define MAP_get(key) find(key)->second
 #define MAP_set(key, value) [key] = value
@@ -513,6 +660,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_CreateNewGDJSProject CreateNewGDJSProject
 #define STATIC_InitializePlatforms InitializePlatforms
 #define STATIC_ValidateName ValidateName
+#define STATIC_EscapeContentHashPathSegment EscapeContentHashPathSegment
 #define STATIC_ToJSON ToJSON
 #define STATIC_FromJSON(x) FromJSON(x)
 #define STATIC_IsObject IsObject
@@ -656,6 +804,8 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 #define STATIC_GetObjectPropertyGetterName GetObjectPropertyGetterName
 #define STATIC_GetObjectPropertySetterName GetObjectPropertySetterName
 #define STATIC_GetObjectPropertyToggleFunctionName GetObjectPropertyToggleFunctionName
+#define STATIC_MarkAsVerbatim MarkAsVerbatim
+#define STATIC_RemoveVerbatimMarks RemoveVerbatimMarks
 #define STATIC_GetPropertyActionName GetPropertyActionName
 #define STATIC_GetPropertyConditionName GetPropertyConditionName
 #define STATIC_GetPropertyExpressionName GetPropertyExpressionName
@@ -671,6 +821,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
   IsExtensionLifecycleEventsFunction
 
 #define STATIC_GetCompletionDescriptionsFor GetCompletionDescriptionsFor
+#define STATIC_ComputeMatchScore ComputeMatchScore
 #define STATIC_GetType GetType
 #define STATIC_GetNodeAtPosition GetNodeAtPosition
 
@@ -3459,6 +3459,51 @@ describe('libGD.js', function () {
     it('can parse arguments being expressions', function () {
       testExpression('number', 'MouseX(VariableString(myVariable), 0) + 1');
     });
+
+    it('can reparse edited expressions', function () {
+      const parser = new gd.ExpressionParser2();
+      const getErrors = (expressionNode) => {
+        const expressionValidator = new gd.ExpressionValidator(
+          gd.JsPlatform.get(),
+          project,
+          layout,
+          'number'
+        );
+        expressionNode.get().visit(expressionValidator);
+        const errors = [];
+        for (let i = 0; i < expressionValidator.getErrors().size(); i++)
+          errors.push(expressionValidator.getErrors().at(i).getMessage());
+        expressionValidator.delete();
+        return errors;
+      };
+
+      // Replace the parameter of sin by two parameters.
+      const expression = 'abs(-5) + cos(sin(3))';
+      let expressionNode = parser.parseExpression(expression);
+      expect(getErrors(expressionNode)).toEqual([]);
+      expressionNode = parser.reparseExpression(
+        expression,
+        expressionNode,
+        18,
+        19,
+        '3, 4'
+      );
+      expect(getErrors(expressionNode)).toEqual([
+        "This parameter was not expected by this expression. Remove it or verify that you've entered the proper expression name. The number of parameters must be exactly 1",
+      ]);
+
+      // Undo the edit.
+      expressionNode = parser.reparseExpression(
+        'abs(-5) + cos(sin(3, 4))',
+        expressionNode,
+        18,
+        22,
+        '3'
+      );
+      expect(getErrors(expressionNode)).toEqual([]);
+
+      parser.delete();
+    });
   });
 
   describe('gd.ExpressionCompletionFinder', function () {
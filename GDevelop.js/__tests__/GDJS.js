@@ -602,6 +602,321 @@ describe('libGD.js - GDJS related tests', function () {
 
       action.delete();
     });
+
+    it('declares the booleans of the conditions as local variables', function () {
+      const project = new gd.ProjectHelper.createNewGDJSProject();
+
+      const includeFiles = new gd.SetString();
+      const eventsFunction = new gd.EventsFunction();
+
+      // Create an event with an Or condition containing an And condition,
+      // and a sub event.
+      const serializerElement = gd.Serializer.fromJSObject([
+        {
+          type: 'BuiltinCommonInstructions::Standard',
+          conditions: [
+            {
+              type: { value: 'BuiltinCommonInstructions::Or' },
+              parameters: [],
+              subInstructions: [
+                { type: { value: 'Egal' }, parameters: ['1', '=', '2'] },
+                {
+                  type: { value: 'BuiltinCommonInstructions::And' },
+                  parameters: [],
+                  subInstructions: [
+                    {
+                      type: { value: 'StrEqual' },
+                      parameters: ['"1"', '=', '"1"'],
+                    },
+                    { type: { value: 'Egal' }, parameters: ['2', '=', '2'] },
+                  ],
+                },
+              ],
+            },
+          ],
+          actions: [
+            {
+              type: { value: 'ModVarScene' },
+              parameters: ['SuccessVariable', '=', '1'],
+            },
+          ],
+          events: [
+            {
+              type: 'BuiltinCommonInstructions::Standard',
+              conditions: [
+                { type: { value: 'Egal' }, parameters: ['3', '=', '3'] },
+              ],
+              actions: [
+                {
+                  type: { value: 'ModVarScene' },
+                  parameters: ['SuccessVariable', '+', '1'],
+                },
+              ],
+              events: [],
+            },
+          ],
+        },
+      ]);
+      eventsFunction.getEvents().unserializeFrom(project, serializerElement);
+
+      const namespace = 'gdjs.eventsFunction.myTest';
+      const extension = new gd.EventsFunctionsExtension();
+      const eventsFunctionsExtensionCodeGenerator =
+        new gd.EventsFunctionsExtensionCodeGenerator(project);
+      const code =
+        eventsFunctionsExtensionCodeGenerator.generateFreeEventsFunctionCompleteCode(
+          extension,
+          eventsFunction,
+          namespace,
+          includeFiles,
+          true
+        );
+
+      // Each function generated for an events list declares its booleans...
+      expect(code).toContain(
+        'let condition0IsTrue_0 = false, condition0IsTrue_1 = false, ' +
+          'condition0IsTrue_2 = false, condition1IsTrue_1 = false, ' +
+          'condition1IsTrue_2 = false;'
+      );
+      expect(code).toContain('let condition0IsTrue_0 = false;\n');
+
+      // ...and the custom conditions directly set the boolean of their parent.
+      expect(code).toContain('condition0IsTrue_0 = true;');
+      expect(code).toContain(
+        'condition1IsTrue_1 = true && condition0IsTrue_2 && condition1IsTrue_2;'
+      );
+
+      // No boxed boolean is generated anymore.
+      expect(code).not.toContain('.val');
+      expect(code).not.toContain('{val:false}');
+      expect(code).not.toContain('conditionTrue_');
+      expect(code).not.toContain(namespace + '.condition');
+
+      serializerElement.delete();
+      eventsFunctionsExtensionCodeGenerator.delete();
+      extension.delete();
+      includeFiles.delete();
+      eventsFunction.delete();
+      project.delete();
+    });
+  });
+
+  describe('EventsCodeMinifier', () => {
+    const minify = (code) => {
+      const minifier = new gd.EventsCodeMinifier();
+      const minifiedCode = minifier.minify(code);
+      const originalNamesMap = minifier.getOriginalNames();
+      const originalNames = {};
+      const names = originalNamesMap.keys();
+      for (let i = 0; i < names.size(); i++) {
+        originalNames[names.at(i)] = originalNamesMap.get(names.at(i));
+      }
+      minifier.delete();
+      return { minifiedCode, originalNames };
+    };
+
+    it('renames the members of the namespace in a function wrapping the file', () => {
+      const { minifiedCode, originalNames } = minify(
+        [
+          'gdjs.Scene1Code = {};',
+          'gdjs.Scene1Code.GDPlayerObjects1 = [];',
+          'gdjs.Scene1Code.condition0IsTrue_0 = {val:false};',
+          '',
+          'gdjs.Scene1Code.eventsList0 = function(runtimeScene) {',
+          '  // A comment',
+          '  gdjs.Scene1Code.GDPlayerObjects1.length = 0;',
+          '  /* Another comment */',
+          '};',
+          '',
+          'gdjs.Scene1Code.func = function(runtimeScene) {',
+          'gdjs.Scene1Code.eventsList0(runtimeScene);',
+          '}',
+          '',
+        ].join('\n')
+      );
+
+      // The variables are declared by the wrapping function, and `func`
+      // (called by the game engine) is kept.
+      expect(minifiedCode).toBe(
+        [
+          '(function(){',
+          'var a,b,c;',
+          'gdjs.Scene1Code={};a=[];b={val:false};c=function(runtimeScene){a.length=0;};gdjs.Scene1Code.func=function(runtimeScene){c(runtimeScene);}',
+          '})();',
+          '',
+        ].join('\n')
+      );
+      expect(originalNames).toEqual({
+        a: 'gdjs.Scene1Code.GDPlayerObjects1',
+        b: 'gdjs.Scene1Code.condition0IsTrue_0',
+        c: 'gdjs.Scene1Code.eventsList0',
+      });
+    });
+
+    it('keeps strings and template literals unchanged', () => {
+      const { minifiedCode } = minify(
+        [
+          'gdjs.Scene1Code = {};',
+          'gdjs.Scene1Code.GDPlayerObjects1 = [];',
+          'gdjs.Scene1Code.func = function() {',
+          '  var text = "gdjs.Scene1Code.GDPlayerObjects1 \\" // not a comment";',
+          "  var other = 'it\\'s /* not a comment */';",
+          '  var template = `a ${1 + 1} \\` b`;',
+          '}',
+        ].join('\n')
+      );
+
+      // Short names are not the ones of identifiers used in the code (like
+      // `a` and `b` in the template literal).
+      expect(minifiedCode).toBe(
+        [
+          '(function(){',
+          'var c;',
+          'gdjs.Scene1Code={};c=[];gdjs.Scene1Code.func=function(){' +
+            'var text="gdjs.Scene1Code.GDPlayerObjects1 \\" // not a comment";' +
+            "var other='it\\'s /* not a comment */';" +
+            'var template=`a ${1 + 1} \\` b`;}',
+          '})();',
+          '',
+        ].join('\n')
+      );
+    });
+
+    it('keeps the new lines that can end a statement', () => {
+      const { minifiedCode } = minify(
+        [
+          'gdjs.Scene1Code = {};',
+          'gdjs.Scene1Code.value = 1;',
+          'gdjs.Scene1Code.func = function() {',
+          '  x++',
+          '  y',
+          '  return x',
+          '}',
+        ].join('\n')
+      );
+
+      expect(minifiedCode).toBe(
+        [
+          '(function(){',
+          'var a;',
+          'gdjs.Scene1Code={};a=1;gdjs.Scene1Code.func=function(){x++',
+          'y',
+          'return x',
+          '}',
+          '})();',
+          '',
+        ].join('\n')
+      );
+    });
+
+    it('keeps the spaces between unary and binary operators', () => {
+      const { minifiedCode } = minify(
+        [
+          'gdjs.Scene1Code = {};',
+          'gdjs.Scene1Code.value = 1;',
+          'gdjs.Scene1Code.func = function() {',
+          '  var x = a - -b;',
+          '  var y = a + +b;',
+          '  var z = a - - b + + c;',
+          '}',
+        ].join('\n')
+      );
+
+      expect(minifiedCode).toContain('var x=a- -b;var y=a+ +b;var z=a- -b+ +c;');
+    });
+
+    it('keeps the code of JavaScript events and the members it uses', () => {
+      const { minifiedCode, originalNames } = minify(
+        [
+          'gdjs.Scene1Code = {};',
+          'gdjs.Scene1Code.GDPlayerObjects1 = [];',
+          'gdjs.Scene1Code.GDEnemyObjects1 = [];',
+          'gdjs.Scene1Code.userFunc0 = function(runtimeScene) {',
+          gd.EventsCodeMinifier.markAsVerbatim(
+            [
+              '// Kept comment',
+              'const    players = gdjs.Scene1Code.GDPlayerObjects1;',
+              'players.length',
+            ].join('\n')
+          ),
+          '};',
+          'gdjs.Scene1Code.func = function(runtimeScene) {',
+          'gdjs.Scene1Code.GDEnemyObjects1.length = 0;',
+          'gdjs.Scene1Code.userFunc0(runtimeScene);',
+          '}',
+        ].join('\n')
+      );
+
+      expect(minifiedCode).toBe(
+        [
+          '(function(){',
+          'var a,b;',
+          'gdjs.Scene1Code={};gdjs.Scene1Code.GDPlayerObjects1=[];a=[];b=function(runtimeScene){',
+          '// Kept comment',
+          'const    players = gdjs.Scene1Code.GDPlayerObjects1;',
+          'players.length',
+          '};gdjs.Scene1Code.func=function(runtimeScene){a.length=0;b(runtimeScene);}',
+          '})();',
+          '',
+        ].join('\n')
+      );
+      expect(originalNames).toEqual({
+        a: 'gdjs.Scene1Code.GDEnemyObjects1',
+        b: 'gdjs.Scene1Code.userFunc0',
+      });
+    });
+
+    it('does not change code without namespace', () => {
+      const code = 'var a = 1;\n// no namespace\n';
+      expect(minify(code).minifiedCode).toBe(code);
+    });
+
+    it('removes the verbatim marks', () => {
+      expect(
+        gd.EventsCodeMinifier.removeVerbatimMarks(
+          'f = function() {\n' +
+            gd.EventsCodeMinifier.markAsVerbatim('x();') +
+            '\n};\n'
+        )
+      ).toBe('f = function() {\nx();\n};\n');
+    });
+
+    const exportEventsCode = (minifyEventsCode) => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      const layout = project.insertNewLayout('Scene', 0);
+      const event = layout
+        .getEvents()
+        .insertNewEvent(project, 'BuiltinCommonInstructions::JsCode', 0);
+      gd.asJsCodeEvent(event).setInlineCode(
+        'runtimeScene.setBackgroundColor(1, 2, 3);'
+      );
+
+      const fs = makeFakeAbstractFileSystem(gd, {
+        '/fake-gdjs-root/Runtime/index.html': '<html></html>',
+      });
+      const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+      exporter.setCodeOutputDirectory('/fake-code-dir');
+      const exportOptions = new gd.ExportOptions(project, '/fake-export-dir');
+      exportOptions.setMinifyEventsCode(minifyEventsCode);
+      expect(exporter.exportWholePixiProject(exportOptions)).toBe(true);
+      exportOptions.delete();
+      exporter.delete();
+      project.delete();
+
+      const codeCall = fs.writeToFile.mock.calls.find(
+        (call) => call[0] === '/fake-code-dir/code0.js'
+      );
+      return codeCall[1];
+    };
+
+    it('exports the code of JavaScript events without the verbatim marks', () => {
+      for (const minifyEventsCode of [false, true]) {
+        const code = exportEventsCode(minifyEventsCode);
+        expect(code).toContain('runtimeScene.setBackgroundColor(1, 2, 3);');
+        expect(code).not.toContain('gdjs-verbatim');
+        expect(code).not.toContain('gdjs-end-verbatim');
+      }
+    });
   });
 
   describe('TextObject', function () {
@@ -393,6 +393,216 @@ describe('libGD.js - GDJS Code Generation integration tests', function () {
     project.delete();
   });
 
+  it('generates a working function sharing the objects lists of the parent events', function () {
+    // Create sub-events that only read the objects picked by their parent
+    // (so they use its list), and a sub-event filtering the objects again.
+    const makeAddToObjectTestVariableAction = (value) => ({
+      type: { value: 'ModVarObjet' },
+      parameters: ['MyObjectA', 'TestVariable', '+', value],
+    });
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [
+          {
+            type: { value: 'VarObjet' },
+            parameters: ['MyObjectA', 'TestVariable', '>', '0'],
+          },
+        ],
+        actions: [],
+        events: [
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [makeAddToObjectTestVariableAction('1')],
+            events: [],
+          },
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [
+              {
+                type: { value: 'VarObjet' },
+                parameters: ['MyObjectA', 'TestVariable', '>', '2'],
+              },
+            ],
+            actions: [makeAddToObjectTestVariableAction('10')],
+            events: [],
+          },
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [makeAddToObjectTestVariableAction('100')],
+            events: [],
+          },
+          {
+            type: 'BuiltinCommonInstructions::Standard',
+            conditions: [],
+            actions: [makeAddToObjectTestVariableAction('1000')],
+            events: [],
+          },
+        ],
+      },
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const objectParameter = new gd.ParameterMetadata();
+    objectParameter.setType('object');
+    objectParameter.setName('MyObjectA');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.delete();
+
+    const runCompiledEvents = generateCompiledEventsForEventsFunction(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    const myObjects = [1, 0, 5].map((value) => {
+      const myObjectA = runtimeScene.createObject('MyObjectA');
+      myObjectA.getVariables().get('TestVariable').setNumber(value);
+      return myObjectA;
+    });
+
+    runCompiledEvents(gdjs, runtimeScene, [
+      gdjs.Hashtable.newFrom({ MyObjectA: myObjects }),
+    ]);
+
+    // The filtering done by the second sub-event must not change the objects
+    // used by the next sub-events.
+    expect(
+      myObjects.map((myObjectA) =>
+        myObjectA.getVariables().get('TestVariable').getAsNumber()
+      )
+    ).toEqual([1102, 0, 1116]);
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
+  it('generates a working function with a repeat event using variables', function () {
+    // The variables are hoisted out of the loop, but the value of Step must
+    // still be read at each iteration, as it's modified by the loop.
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::Repeat',
+        repeatExpression: '3',
+        conditions: [],
+        actions: [
+          {
+            type: { value: 'ModVarScene' },
+            parameters: ['Counter', '+', 'Variable(Step) * 2'],
+          },
+          {
+            type: { value: 'ModVarScene' },
+            parameters: ['Step', '+', '1'],
+          },
+        ],
+        events: [],
+      },
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const runCompiledEvents = generateCompiledEventsForEventsFunction(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+    runtimeScene.getVariables().get('Step').setNumber(1);
+    runCompiledEvents(gdjs, runtimeScene, []);
+
+    expect(runtimeScene.getVariables().get('Counter').getAsNumber()).toBe(12);
+    expect(runtimeScene.getVariables().get('Step').getAsNumber()).toBe(4);
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
+  it('generates a working function with conditions reordered by cost', function () {
+    // The scene variable condition is cheaper than the comparison of numbers,
+    // and can be evaluated first, but not before the picking condition.
+    const eventsSerializerElement = gd.Serializer.fromJSObject([
+      {
+        type: 'BuiltinCommonInstructions::Standard',
+        conditions: [
+          {
+            type: { value: 'VarObjet' },
+            parameters: ['MyObjectA', 'TestVariable', '>', '0'],
+          },
+          {
+            type: { value: 'BuiltinCommonInstructions::CompareNumbers' },
+            parameters: ['1', '<', '2'],
+          },
+          {
+            type: { value: 'VarScene' },
+            parameters: ['Flag', '=', '1'],
+          },
+        ],
+        actions: [
+          {
+            type: { value: 'ModVarObjet' },
+            parameters: ['MyObjectA', 'TestVariable', '+', '10'],
+          },
+        ],
+        events: [],
+      },
+    ]);
+
+    const project = new gd.ProjectHelper.createNewGDJSProject();
+    project.setReorderConditionsByCost(true);
+    const eventsFunction = new gd.EventsFunction();
+    eventsFunction
+      .getEvents()
+      .unserializeFrom(project, eventsSerializerElement);
+
+    const objectParameter = new gd.ParameterMetadata();
+    objectParameter.setType('object');
+    objectParameter.setName('MyObjectA');
+    eventsFunction.getParameters().push_back(objectParameter);
+    objectParameter.delete();
+
+    const runCompiledEvents = generateCompiledEventsForEventsFunction(
+      gd,
+      project,
+      eventsFunction
+    );
+
+    const runWithFlag = (flag) => {
+      const { gdjs, runtimeScene } = makeMinimalGDJSMock();
+      runtimeScene.getVariables().get('Flag').setNumber(flag);
+      const myObjects = [1, 0, 5].map((value) => {
+        const myObjectA = runtimeScene.createObject('MyObjectA');
+        myObjectA.getVariables().get('TestVariable').setNumber(value);
+        return myObjectA;
+      });
+
+      runCompiledEvents(gdjs, runtimeScene, [
+        gdjs.Hashtable.newFrom({ MyObjectA: myObjects }),
+      ]);
+      return myObjects.map((myObjectA) =>
+        myObjectA.getVariables().get('TestVariable').getAsNumber()
+      );
+    };
+
+    expect(runWithFlag(0)).toEqual([1, 0, 5]);
+    expect(runWithFlag(1)).toEqual([11, 0, 15]);
+
+    eventsFunction.delete();
+    project.delete();
+  });
+
   it('generates a working function with BuiltinCommonInstructions::Once', function () {
     // Event to create an object, then add
     const eventsSerializerElement = gd.Serializer.fromJSObject([
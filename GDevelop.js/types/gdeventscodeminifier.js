@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsCodeMinifier {
+  constructor(): void;
+  minify(code: string): string;
+  getOriginalNames(): gdMapStringString;
+  static markAsVerbatim(code: string): string;
+  static removeVerbatimMarks(code: string): string;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsDiagnostic {
+  getEventPath(): string;
+  getInstructionType(): string;
+  getParameterIndex(): number;
+  getExpression(): string;
+  getMessage(): string;
+  getStartPosition(): number;
+  getEndPosition(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
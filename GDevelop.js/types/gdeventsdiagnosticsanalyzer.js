@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdEventsDiagnosticsAnalyzer {
+  constructor(platform: gdPlatform): void;
+  analyzeProject(project: gdProject): gdVectorEventsDiagnostic;
+  getDiagnostics(): gdVectorEventsDiagnostic;
+  getValidatedEventsListsCount(): number;
+  setThreadsCount(threadsCount: number): void;
+  clearCache(): void;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
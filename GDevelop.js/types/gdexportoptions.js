@@ -3,6 +3,13 @@ declare class gdExportOptions {
   constructor(project: gdProject, outputPath: string): void;
   setFallbackAuthor(id: string, username: string): gdExportOptions;
   setTarget(target: string): gdExportOptions;
+  setEventsProfiling(enable: boolean): gdExportOptions;
+  setTextureAtlases(enable: boolean): gdExportOptions;
+  setMinifyEventsCode(enable: boolean): gdExportOptions;
+  setMergeStaticPlatforms(enable: boolean): gdExportOptions;
+  setTreeShaking(enable: boolean): gdExportOptions;
+  setOptimizeCollisionMasks(enable: boolean): gdExportOptions;
+  setBakePathfindingObstacles(enable: boolean): gdExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -0,0 +1,9 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdExpressionCompletionCandidate {
+  getCompletionKind(): ExpressionCompletionDescription_CompletionKind;
+  getName(): string;
+  getType(): string;
+  getScore(): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -0,0 +1,10 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdExpressionCompletionIndex {
+  constructor(platform: gdPlatform): void;
+  removeObjectsContainer(objectsContainer: gdObjectsContainer): void;
+  removeVariablesContainer(variablesContainer: gdVariablesContainer): void;
+  getCompletionCandidatesFor(description: gdExpressionCompletionDescription, globalObjectsContainer: gdObjectsContainer, objectsContainer: gdObjectsContainer, globalVariables: gdVariablesContainer, variables: gdVariablesContainer, maxCount: number): gdVectorExpressionCompletionCandidate;
+  static computeMatchScore(pattern: string, name: string): number;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -9,6 +9,7 @@ declare class gdExpressionMetadata {
   getHelpPath(): string;
   isShown(): boolean;
   isPrivate(): boolean;
+  isPure(): boolean;
   isRelevantForLayoutEvents(): boolean;
   isRelevantForFunctionEvents(): boolean;
   isRelevantForAsynchronousFunctionEvents(): boolean;
@@ -18,6 +19,7 @@ declare class gdExpressionMetadata {
   getParameters(): gdVectorParameterMetadata;
   setHidden(): gdExpressionMetadata;
   setPrivate(): gdExpressionMetadata;
+  setPure(): gdExpressionMetadata;
   setRelevantForLayoutEventsOnly(): gdExpressionMetadata;
   setRelevantForFunctionEventsOnly(): gdExpressionMetadata;
   setRelevantForAsynchronousFunctionEventsOnly(): gdExpressionMetadata;
@@ -2,6 +2,7 @@
 declare class gdExpressionParser2 {
   constructor(): void;
   parseExpression(expression: string): gdUniquePtrExpressionNode;
+  reparseExpression(previousExpression: string, previousNode: gdUniquePtrExpressionNode, editStartPosition: number, editEndPosition: number, replacement: string): gdUniquePtrExpressionNode;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -21,6 +21,8 @@ declare class gdInstructionMetadata {
   isRelevantForFunctionEvents(): boolean;
   isRelevantForAsynchronousFunctionEvents(): boolean;
   isRelevantForCustomObjectEvents(): boolean;
+  getEvaluationCost(): number;
+  isSideEffectFree(): boolean;
   setCanHaveSubInstructions(): gdInstructionMetadata;
   setHelpPath(helpPath: string): gdInstructionMetadata;
   setHidden(): gdInstructionMetadata;
@@ -41,6 +43,9 @@ declare class gdInstructionMetadata {
   markAsSimple(): gdInstructionMetadata;
   markAsAdvanced(): gdInstructionMetadata;
   markAsComplex(): gdInstructionMetadata;
+  markAsCheapToEvaluate(): gdInstructionMetadata;
+  markAsExpensiveToEvaluate(): gdInstructionMetadata;
+  markAsSideEffectFree(): gdInstructionMetadata;
   getCodeExtraInformation(): gdExtraInformation;
   setFunctionName(functionName: string): gdExtraInformation;
   setAsyncFunctionName(functionName: string): gdExtraInformation;
@@ -15,6 +15,9 @@ declare class gdMultipleInstructionMetadata {
   markAsSimple(): gdMultipleInstructionMetadata;
   markAsAdvanced(): gdMultipleInstructionMetadata;
   markAsComplex(): gdMultipleInstructionMetadata;
+  markAsCheapToEvaluate(): gdMultipleInstructionMetadata;
+  markAsExpensiveToEvaluate(): gdMultipleInstructionMetadata;
+  markAsSideEffectFree(): gdMultipleInstructionMetadata;
   setPrivate(): gdMultipleInstructionMetadata;
   delete(): void;
   ptr: number;
@@ -14,6 +14,9 @@ declare class gdPreviewExportOptions {
   setElectronRemoteRequirePath(electronRemoteRequirePath: string): gdPreviewExportOptions;
   setGDevelopResourceToken(gdevelopResourceToken: string): gdPreviewExportOptions;
   setAllowAuthenticationUsingIframeForPreview(enable: boolean): gdPreviewExportOptions;
+  setEventsProfiling(enable: boolean): gdPreviewExportOptions;
+  setOptimizeCollisionMasks(enable: boolean): gdPreviewExportOptions;
+  setBakePathfindingObstacles(enable: boolean): gdPreviewExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -48,6 +48,12 @@ declare class gdProject extends gdObjectsContainer {
   isFolderProject(): boolean;
   setUseDeprecatedZeroAsDefaultZOrder(enable: boolean): void;
   getUseDeprecatedZeroAsDefaultZOrder(): boolean;
+  setReorderConditionsByCost(enable: boolean): void;
+  getReorderConditionsByCost(): boolean;
+  setShareExternalEventsCode(enable: boolean): void;
+  getShareExternalEventsCode(): boolean;
+  setEventsFunctionsInliningMaxCodeGrowth(maxCodeGrowth: number): void;
+  getEventsFunctionsInliningMaxCodeGrowth(): number;
   setLastCompilationDirectory(path: string): void;
   getLastCompilationDirectory(): string;
   getExtensionProperties(): gdExtensionProperties;
@@ -101,6 +107,8 @@ declare class gdProject extends gdObjectsContainer {
   static validateName(name: string): boolean;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(element: gdSerializerElement): void;
+  computeContentHash(path: string): string;
+  static escapeContentHashPathSegment(name: string): string;
   getTypeOfBehavior(layout: gdLayout, name: string, searchInGroups: boolean): string;
   getTypeOfObject(layout: gdLayout, name: string, searchInGroups: boolean): string;
   getBehaviorsOfObject(layout: gdLayout, name: string, searchInGroups: boolean): gdVectorString;
@@ -0,0 +1,7 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdVectorExpressionCompletionCandidate {
+  size(): number;
+  at(index: number): gdExpressionCompletionCandidate;
+  delete(): void;
+  ptr: number;
+};
\ No newline at end of file
@@ -171,6 +171,12 @@ declare class libGDevelop {
   ExpressionCompletionDescription: Class<gdExpressionCompletionDescription>;
   VectorExpressionCompletionDescription: Class<gdVectorExpressionCompletionDescription>;
   ExpressionCompletionFinder: Class<gdExpressionCompletionFinder>;
+  ExpressionCompletionCandidate: Class<gdExpressionCompletionCandidate>;
+  VectorExpressionCompletionCandidate: Class<gdVectorExpressionCompletionCandidate>;
+  ExpressionCompletionIndex: Class<gdExpressionCompletionIndex>;
+  EventsDiagnostic: Class<gdEventsDiagnostic>;
+  VectorEventsDiagnostic: Class<gdVectorEventsDiagnostic>;
+  EventsDiagnosticsAnalyzer: Class<gdEventsDiagnosticsAnalyzer>;
   ExpressionNodeLocationFinder: Class<gdExpressionNodeLocationFinder>;
   ExpressionTypeFinder: Class<gdExpressionTypeFinder>;
   ExpressionNode: Class<gdExpressionNode>;
@@ -226,6 +232,7 @@ declare class libGDevelop {
   BehaviorCodeGenerator: Class<gdBehaviorCodeGenerator>;
   ObjectCodeGenerator: Class<gdObjectCodeGenerator>;
   EventsFunctionsExtensionCodeGenerator: Class<gdEventsFunctionsExtensionCodeGenerator>;
+  EventsCodeMinifier: Class<gdEventsCodeMinifier>;
   PreviewExportOptions: Class<gdPreviewExportOptions>;
   ExportOptions: Class<gdExportOptions>;
   Exporter: Class<gdExporter>;
@@ -216,6 +216,71 @@ class LocalFileSystem {
       return false;
     }
   };
+  _getFileSize = (filePath: string): number => {
+    // Files to be downloaded don't exist yet, so their size is unknown (0).
+    try {
+      const stat = fs.statSync(filePath);
+      return stat.isFile() ? stat.size : 0;
+    } catch (e) {
+      return 0;
+    }
+  };
+
+  // Batch operations, done with a single call from GDevelop.js.
+  statFiles = (paths: gdVectorString): Array<number> => {
+    const statuses = [];
+    for (let i = 0; i < paths.size(); i++) {
+      const path = paths.at(i);
+      const fileExists = this.fileExists(path);
+      // Sizes can exceed 32 bits, so the status is not built with bitwise
+      // operators.
+      statuses.push(
+        (fileExists ? 1 : 0) +
+          (this.dirExists(path) ? 2 : 0) +
+          (fileExists ? 4 * this._getFileSize(path) : 0)
+      );
+    }
+    return statuses;
+  };
+  copyFiles = (
+    sources: gdVectorString,
+    destinations: gdVectorString
+  ): Array<boolean> => {
+    const results = [];
+    for (let i = 0; i < sources.size(); i++) {
+      results.push(this.copyFile(sources.at(i), destinations.at(i)));
+    }
+    return results;
+  };
+  writeFiles = (
+    files: gdVectorString,
+    contents: gdVectorString
+  ): Array<boolean> => {
+    const results = [];
+    for (let i = 0; i < files.size(); i++) {
+      results.push(this.writeToFile(files.at(i), contents.at(i)));
+    }
+    return results;
+  };
+
+  // Binary files, used to pack images in texture atlases.
+  readBinaryFile = (file: string): ?Uint8Array => {
+    try {
+      return new Uint8Array(fs.readFileSync(file));
+    } catch (e) {
+      console.error('readBinaryFile(' + file + ') failed: ' + e);
+      return null;
+    }
+  };
+  writeBinaryFile = (file: string, content: Uint8Array): boolean => {
+    try {
+      fs.outputFileSync(file, Buffer.from(content));
+    } catch (e) {
+      console.error('writeBinaryFile(' + file + ', ...) failed: ' + e);
+      return false;
+    }
+    return true;
+  };
 }
 
 export default LocalFileSystem;